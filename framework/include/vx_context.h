@@ -17,10 +17,12 @@
 #define VX_CONTEXT_H
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "vx_event_queue.hpp"
 #include "vx_internal.h"
+#include "vx_memory.h"
 #include "vx_reference.h"
 
 /*!
@@ -188,6 +190,14 @@ public:
      */
     vx_size maxTensorDims() const;
 
+    /**
+     * @brief Get the CPU variant the targets run their kernels with
+     *
+     * @return vx_enum The vx_cpu_variant_e picked at context creation.
+     * @ingroup group_int_context
+     */
+    vx_enum cpuVariant() const;
+
     /**
      * @brief Get the unique kernel information
      *
@@ -335,6 +345,16 @@ public:
      */
     void memoryUnmap(vx_uint32 map_id);
 
+    /*! \brief Pops a free memory map slot, or returns false if the table is full.
+     * \ingroup group_int_context
+     */
+    vx_bool takeMemoryMapSlot(vx_uint32 *id);
+
+    /*! \brief Pushes a memory map slot back on the free list.
+     * \ingroup group_int_context
+     */
+    void giveMemoryMapSlot(vx_uint32 id);
+
     /**
      * @brief Validate border mode supported
      *
@@ -427,9 +447,13 @@ public:
     /*! \brief The pointer to process global lock */
     vx_sem_t*           p_global_lock;
     /*! \brief The reference table which contains the handle for later garage collection if needed */
-    vx_reference        reftable[VX_INT_MAX_REF];
+    std::vector<vx_reference> reftable;
     /*! \brief The number of references in the table. */
     vx_uint32           num_references;
+    /*! \brief The emptied reference table slots, the next one to hand out at the back */
+    std::vector<vx_uint32> reftable_free;
+    /*! \brief The reference table slots of each reference in the table, one per time it was added */
+    std::unordered_multimap<vx_reference, vx_uint32> reftable_index;
     /*! \brief The array of kernel modules. */
     vx_module_t         modules[VX_INT_MAX_MODULES];
     /*! \brief The number of kernel libraries loaded */
@@ -458,8 +482,15 @@ public:
     vx_bool             perf_enabled;
     /*! \brief The list of externally accessed references */
     vx_external_t       accessors[VX_INT_MAX_REF];
-    /*! \brief The memory mapping table lock */
-    vx_sem_t            memory_maps_lock;
+    /*! \brief The free accessor slots, the next one to hand out at the back */
+    std::vector<vx_uint32> accessors_free;
+    /*! \brief The allocator of object memory and mapping buffers */
+    MemoryPool          memory_pool;
+    /*! \brief The head of the free memory map slots: the slot index plus one in the low
+     * half (zero when the table is full), a change count against ABA in the high half */
+    std::atomic<vx_uint64> memory_maps_free;
+    /*! \brief The free slot after each free memory map slot, plus one */
+    std::atomic<vx_uint32> memory_maps_next[VX_INT_MAX_REF];
     /*! \brief The list of memory maps */
     vx_memory_map_t     memory_maps[VX_INT_MAX_REF];
     /*! \brief The list of user defined structs. */
@@ -498,6 +529,8 @@ public:
     vx_enum             imm_target_enum;
     /*! \brief The immediate mode target string */
     vx_char             imm_target_string[VX_MAX_TARGET_NAME];
+    /*! \brief The CPU variant the targets pick their kernels for, read before they load */
+    const vx_enum       cpu_variant;
 #ifdef OPENVX_USE_OPENCL_INTEROP
     cl_context opencl_context;
     cl_command_queue opencl_command_queue;
@@ -506,10 +539,6 @@ public:
     /*! \brief The event queue for the context */
     EventQueue event_queue;
 #endif
-    /*! \brief The graph queue for the context */
-    vx_value_set_t graph_queue[VX_INT_MAX_QUEUE_DEPTH];
-    /*! \brief The number of graphs in the queue */
-    vx_size numGraphsQueued;
     /*! \brief The vendor id */
     const vx_uint16 vendor_id;
     /*! \brief The version number this implements */
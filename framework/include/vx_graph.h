@@ -18,6 +18,10 @@
 
 #include <COREFLOW/execution_queue.hpp>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
 
 #include "vx_internal.h"
 #include "vx_reference.h"
@@ -156,6 +160,97 @@ private:
      */
     void topologicalSort(vx_node* list, vx_uint32 nnodes);
 
+    /**
+     * @brief Build the producer/consumer tables used to schedule execution.
+     * Every node depends once on each distinct node writing one of its inputs.
+     *
+     * @ingroup group_int_graph
+     */
+    void computeDependencies();
+
+    /**
+     * @brief Compute each node's bottom level, the cost of the longest path from the node to
+     * the end of the graph. Measured node times are used once every node has one, before
+     * that the verify-time cost hints are. Only called from verify, so executions in flight
+     * never see the levels change under them.
+     *
+     * @ingroup group_int_graph
+     */
+    void computePriorities();
+
+    /**
+     * @brief Append the nodes of the child graphs of composite nodes to this graph, so they
+     * are scheduled with the rest of it. Each composite node then only completes once its
+     * inlined nodes have.
+     *
+     * @ingroup group_int_graph
+     */
+    void inlineChildGraphs();
+
+    /**
+     * @brief Give the inlined nodes back to their child graphs, see \ref inlineChildGraphs
+     *
+     * @ingroup group_int_graph
+     */
+    void restoreChildGraphs();
+
+    /**
+     * @brief Whether the memory of a virtual object is left to \ref planMemory instead of
+     * being allocated on its own by the memory allocation phase of verify.
+     *
+     * @param ref       The node parameter.
+     * @return vx_true_e if the object is planned, else vx_false_e.
+     * @ingroup group_int_graph
+     */
+    vx_bool defersAllocation(vx_reference ref);
+
+    /**
+     * @brief Place the virtual objects left by the memory allocation phase into shared slabs.
+     * Objects share a slab when every use of one is ordered before the write of the next,
+     * anything else is allocated on its own.
+     *
+     * @ingroup group_int_graph
+     */
+    void planMemory();
+
+    /**
+     * @brief Detach the planned objects from \ref memorySlabs and free the slabs
+     *
+     * @ingroup group_int_graph
+     */
+    void releaseMemoryPlan();
+
+    /**
+     * @brief Find chains of pointwise and 3x3 neighborhood image nodes linked only through
+     * virtual images and record them in \ref fusedChains, so each chain runs as a single
+     * pass at its last node.
+     *
+     * @ingroup group_int_graph
+     */
+    void fuseNodes();
+
+    /**
+     * @brief Execute a node which belongs to a fused chain. The other nodes of the chain
+     * complete immediately and the last one computes the whole chain in bands of rows,
+     * recomputing the rows the neighborhood steps need around each band.
+     *
+     * @param node      The node to execute.
+     * @return vx_action The action of the chain, see \ref executeNode.
+     * @ingroup group_int_graph
+     */
+    vx_action executeFused(vx_node node);
+
+    /**
+     * @brief Whether a ready node should start before another one: longer remaining path
+     * first, graph order among equals.
+     *
+     * @param a     The index of the first node.
+     * @param b     The index of the second node.
+     * @return vx_true_e if node a goes first, else vx_false_e.
+     * @ingroup group_int_graph
+     */
+    vx_bool runsBefore(vx_uint32 a, vx_uint32 b) const;
+
     /**
      * @brief Execute the graph
      *
@@ -165,6 +260,92 @@ private:
      */
     vx_status executeGraph(vx_uint32 depth);
 
+    /**
+     * @brief Dispatch the nodes of the graph onto the context workers, issuing
+     * each node as soon as all of the nodes producing its inputs have completed.
+     *
+     * @return vx_action VX_ACTION_CONTINUE if all nodes ran, otherwise the action which stopped execution.
+     * @ingroup group_int_graph
+     */
+    vx_action dispatchNodes();
+
+    /**
+     * @brief Raise the node completion events and retire consumed graph parameters
+     *
+     * @param node      The node which finished executing.
+     * @param action    The action returned by the target for this node.
+     * @ingroup group_int_graph
+     */
+    void completeNode(vx_node node, vx_action action, const vx_reference* frameRefs = nullptr);
+
+    /**
+     * @brief Issue one node of a threadpool execution to the context workers.
+     *
+     * @param index     The index of the node in the graph.
+     * @return vx_true_e if the node was issued, else vx_false_e.
+     * @ingroup group_int_graph
+     */
+    vx_bool issueNode(vx_uint32 index);
+
+#ifdef OPENVX_USE_PIPELINING
+    /**
+     * @brief Build the frame slots, per-frame buffers and bindings for pipelined execution.
+     *
+     * @return vx_status VX_SUCCESS if successful, otherwise a status with error code.
+     * @ingroup group_int_graph
+     */
+    vx_status pipelineSetup();
+
+    /**
+     * @brief Create a buffer like a virtual reference for another frame slot.
+     *
+     * @param ref   The virtual reference.
+     * @return The new reference or nullptr if it cannot be duplicated, in which case it is
+     * shared between frames.
+     * @ingroup group_int_graph
+     */
+    vx_reference pipelineClone(vx_reference ref);
+
+    /**
+     * @brief Start frames from the backlog while slots are free. Called with the pipeline lock.
+     *
+     * @param issue     Collects the work items to issue once the lock is released.
+     * @ingroup group_int_graph
+     */
+    void pipelineAdmit(std::vector<vx_value_set_t*>& issue);
+
+    /**
+     * @brief Issue a node of a frame if it can run now. Called with the pipeline lock.
+     *
+     * @param slot      The frame slot.
+     * @param index     The index of the node.
+     * @param issue     Collects the work items to issue once the lock is released.
+     * @ingroup group_int_graph
+     */
+    void pipelineTry(vx_uint32 slot, vx_uint32 index, std::vector<vx_value_set_t*>& issue);
+
+    /**
+     * @brief Account for a finished node of a frame. Called with the pipeline lock.
+     *
+     * @param slot      The frame slot.
+     * @param index     The index of the node.
+     * @param action    The action the node returned.
+     * @param issue     Collects the work items to issue once the lock is released.
+     * @ingroup group_int_graph
+     */
+    void pipelineRetire(vx_uint32 slot, vx_uint32 index, vx_action action,
+                        std::vector<vx_value_set_t*>& issue);
+#endif
+
+    /**
+     * @brief Turn access to the virtual parameters of a node on or off
+     *
+     * @param node        The node whose parameters to update.
+     * @param accessible  vx_true_e to allow access, vx_false_e to revoke it.
+     * @ingroup group_int_graph
+     */
+    static void setVirtualAccess(vx_node node, vx_bool accessible);
+
     /**
      * @brief Destroy the Graph object
      * @ingroup group_int_graph
@@ -240,10 +421,12 @@ public:
     /**
      * @brief Schedule the graph
      *
+     * @param frames The number of executions to schedule, each on its own set of ready
+     *               graph parameter references in queue auto mode.
      * @return vx_status VX_SUCCESS if successful, otherwise return status with error code.
      * @ingroup group_int_graph
      */
-    vx_status schedule();
+    vx_status schedule(vx_uint32 frames = 1u);
 
     /**
      * @brief Wait on the graph to complete
@@ -253,6 +436,15 @@ public:
      */
     vx_status wait();
 
+    /**
+     * @brief Record a finished execution of a scheduled graph
+     *
+     * @param status      The status the execution finished with.
+     * @return vx_bool    vx_true_e if more executions are scheduled on the graph.
+     * @ingroup group_int_graph
+     */
+    vx_bool retireExecution(vx_status status);
+
     /**
      * @brief Process the graph
      *
@@ -261,6 +453,26 @@ public:
      */
     vx_status process();
 
+    /**
+     * @brief Execute a single node on its target, including any pipeup iterations
+     *
+     * @param node              The node to execute.
+     * @param max_pipeup_depth  The pipeup depth required so far in this execution.
+     * @return vx_action        The action returned by the target.
+     * @ingroup group_int_graph
+     */
+    vx_action executeNode(vx_node node, vx_uint32 max_pipeup_depth);
+
+    /**
+     * @brief Release the consumers of a finished work item and signal the dispatching thread.
+     * Consumers which become ready are issued straight from the calling worker, so they
+     * continue on that worker without waiting for the dispatcher.
+     *
+     * @param workitem  The work item issued by \ref dispatchNodes.
+     * @ingroup group_int_graph
+     */
+    void notifyNodeCompleted(vx_value_set_t* workitem);
+
     /**
      * @brief Add a graph paramter
      *
@@ -299,6 +511,61 @@ public:
     vx_status pipelineValidateRefsList(
         const vx_graph_parameter_queue_params_t graph_parameters_queue_param);
 
+#ifdef OPENVX_USE_PIPELINING
+    /**
+     * @brief Whether scheduled frames of this graph can overlap. Needs QUEUE_AUTO mode,
+     * the context workers and no delays, since delays age once per whole-graph execution.
+     *
+     * @return vx_true_e if frames are pipelined, else vx_false_e.
+     * @ingroup group_int_graph
+     */
+    vx_bool pipelineEnabled();
+
+    /**
+     * @brief Admit complete sets of ready graph parameter references as new frames.
+     * Each frame starts as soon as a frame slot is free, so a batch admitted together
+     * overlaps from its first node on.
+     *
+     * @param frames The number of complete sets to admit.
+     * @return vx_status VX_SUCCESS if successful, otherwise a status with error code.
+     * @ingroup group_int_graph
+     */
+    vx_status pipelineSubmit(vx_uint32 frames);
+
+    /**
+     * @brief Block until every submitted frame has completed.
+     *
+     * @return vx_status VX_ERROR_GRAPH_ABANDONED if any frame was abandoned, else VX_SUCCESS.
+     * @ingroup group_int_graph
+     */
+    vx_status pipelineDrain();
+
+    /**
+     * @brief Point a node at the buffers of the frame a work item belongs to.
+     *
+     * @param workitem  The work item about to execute.
+     * @ingroup group_int_graph
+     */
+    void pipelineBind(vx_value_set_t* workitem);
+
+    /**
+     * @brief Retire a pipelined work item and issue whatever it made ready.
+     *
+     * @param workitem  The work item which finished.
+     * @return vx_true_e if the item belonged to a pipelined frame, else vx_false_e.
+     * @ingroup group_int_graph
+     */
+    vx_bool pipelineCompleted(vx_value_set_t* workitem);
+
+    /**
+     * @brief Drain the pipeline, point the nodes back at their verified references and
+     * release the per-frame buffers.
+     *
+     * @ingroup group_int_graph
+     */
+    void pipelineRelease();
+#endif
+
     /*! \brief Clears visited flag.
      * \ingroup group_int_graph
      */
@@ -326,17 +593,19 @@ public:
     /*! \brief Given a set of last nodes, this function will determine the next
      * set of nodes which are capable of being run. Nodes which are encountered but
      * can't be run will be placed in the left nodes list.
+     * Each list holds a node at most once, so \ref numNodes entries are enough for any of them.
      * \param [in] last_nodes The last list of nodes executed.
      * \param [in] numLast The number of nodes in the last_nodes list which are valid.
-     * \param [out] next_nodes The list of nodes next to be executed.
+     * \param [out] next_nodes The list of nodes next to be executed, of \ref numNodes entries.
      * \param [in] numNext The number of nodes in the next_nodes list which are valid.
-     * \param [out] left_nodes The list of nodes which are next, but can't be executed.
+     * \param [out] left_nodes The list of nodes which are next, but can't be executed, of
+     * \ref numNodes entries.
      * \param [in] numLeft The number of nodes in the left_nodes list which are valid.
      * \ingroup group_int_graph
      */
-    void findNextNodes(vx_uint32 last_nodes[VX_INT_MAX_REF], vx_uint32 numLast,
-                       vx_uint32 next_nodes[VX_INT_MAX_REF], vx_uint32* numNext,
-                       vx_uint32 left_nodes[VX_INT_MAX_REF], vx_uint32* numLeft);
+    void findNextNodes(const std::vector<vx_uint32>& last_nodes, vx_uint32 numLast,
+                       std::vector<vx_uint32>& next_nodes, vx_uint32* numNext,
+                       std::vector<vx_uint32>& left_nodes, vx_uint32* numLeft);
 
     /**
      * @brief Streaming loop function
@@ -344,22 +613,86 @@ public:
      */
     void streamingLoop();
 
+    /**
+     * @brief Start the streaming thread of the graph
+     *
+     * @return vx_status VX_SUCCESS if successful, otherwise return status with error code.
+     * @ingroup group_int_graph
+     */
+    vx_status streamingStart();
+
+    /**
+     * @brief Stop the streaming thread once the execution in flight completes
+     *
+     * @return vx_status VX_SUCCESS if successful, otherwise return status with error code.
+     * @ingroup group_int_graph
+     */
+    vx_status streamingStop();
+
+    /**
+     * @brief Run the trigger node of a free-running stream ahead of the rest of the graph,
+     * blocking on its source until it produces the next frame
+     *
+     * @return vx_bool vx_false_e if streaming has to stop.
+     * @ingroup group_int_graph
+     */
+    vx_bool streamingPrime();
+
+    /**
+     * @brief Wake the streaming thread, e.g. after graph parameters were enqueued
+     *
+     * @ingroup group_int_graph
+     */
+    void streamingNotify();
+
+    /**
+     * @brief Tell whether the streaming thread has the inputs for another execution
+     *
+     * @return vx_bool vx_true_e if an execution can start.
+     * @ingroup group_int_graph
+     */
+    vx_bool streamingReady();
+
     /**
      * @brief Destruct function for the Graph object
      * @ingroup group_int_graph
      */
     void destruct() override final;
 
-    /*! \brief The array of all nodes in this graph */
-    vx_node        nodes[VX_INT_MAX_REF];
+    /*! \brief The nodes of this graph, numNodes of them */
+    std::vector<vx_node> nodes;
     /*! \brief The performance logging variable. */
     vx_perf_t      perf;
     /*! \brief The number of nodes actively allocated in this graph. */
     vx_uint32      numNodes;
-    /*! \brief The array of all starting node indexes in the graph. */
-    vx_uint32      heads[VX_INT_MAX_REF];
+    /*! \brief The indexes of the starting nodes of the graph, numHeads of them */
+    std::vector<vx_uint32> heads;
     /*! \brief The number of all nodes in heads list */
     vx_uint32      numHeads;
+    /*! \brief Offsets of each node's consumers in \ref successors (numNodes + 1 entries) */
+    std::vector<vx_uint32> successorOffsets;
+    /*! \brief The consumer node indexes of every node, grouped by producer */
+    std::vector<vx_uint32> successors;
+    /*! \brief The number of distinct producer nodes each node waits on */
+    std::vector<vx_uint32> inDegree;
+    /*! \brief The longest remaining path from each node, the node's ready-queue priority */
+    std::vector<vx_uint64> bottomLevel;
+    /*! \brief The fused chains found by \ref fuseNodes, each in execution order */
+    std::vector<std::vector<vx_node>> fusedChains;
+    /*! \brief Per fused chain, the intermediate image bytes its last run kept out of memory */
+    std::vector<vx_size> fusedBytesSaved;
+    /*! \brief The child graphs whose nodes are inlined into this graph */
+    std::vector<vx_graph> inlinedGraphs;
+    /*! \brief Whether the nodes of this child graph currently run in its parent graph */
+    vx_bool        inlined;
+    /*! \brief The storage shared by the virtual objects placed by \ref planMemory */
+    std::vector<vx_uint8 *> memorySlabs;
+    /*! \brief The virtual objects whose memory lives in \ref memorySlabs */
+    std::vector<vx_reference> plannedRefs;
+    /*! \brief The bytes the planned objects would need with an allocation each */
+    vx_size        virtualBytes;
+    /*! \brief The bytes of \ref memorySlabs */
+    vx_size        slabBytes;
     /*! \brief The state of the graph (vx_graph_state_e) */
     vx_enum        state;
     /*! \brief This indicates that the graph has been verified. */
@@ -389,15 +722,98 @@ public:
     vx_uint32      numParams;
     /*! \brief A switch to turn off SMP mode */
     vx_bool        shouldSerialize;
+    /*! \brief Protects the list of work items completed by the context workers */
+    std::mutex     completionLock;
+    /*! \brief Signalled whenever a work item is added to the completed list */
+    std::condition_variable completionCond;
+    /*! \brief The work items completed by the context workers but not yet retired */
+    std::vector<vx_value_set_t*> completedItems;
+    /*! \brief The producers each node still waits on during a threadpool execution */
+    std::vector<std::atomic<vx_uint32>> dispatchPending;
+    /*! \brief One work item per node during a threadpool execution */
+    std::vector<vx_value_set_t> dispatchItems;
+    /*! \brief The nodes issued to the workers but not yet retired by the dispatcher */
+    std::atomic<vx_uint32> dispatchInflight;
+    /*! \brief Set once a node stops the execution, so workers stop issuing consumers */
+    std::atomic<bool> dispatchStopped;
+    /*! \brief The pipeup depth used for every node of a threadpool execution */
+    vx_uint32      dispatchDepth;
+    /*! \brief Protects the scheduled executions and their results */
+    std::mutex     execLock;
+    /*! \brief Signalled whenever a scheduled execution finishes */
+    std::condition_variable execDone;
+    /*! \brief The executions scheduled on the graph executors and not yet finished */
+    vx_uint32      execQueued;
+    /*! \brief Whether the scheduled executions hold the graph lock */
+    vx_bool        execHeld;
+    /*! \brief The statuses of finished executions not yet collected by wait */
+    std::deque<vx_status> execResults;
+    /*! \brief The item which puts the graph on the executor queue */
+    vx_value_set_t execItem;
     /*! \brief [hidden] If non-NULL, the parent graph, for scope handling. */
     vx_graph       parentGraph;
-    /*! \brief The array of all delays in this graph */
-    vx_delay delays[VX_INT_MAX_REF];
+    /*! \brief The delays registered for auto-aging with this graph */
+    std::vector<vx_delay> delays;
 #ifdef OPENVX_USE_PIPELINING
     /*! \brief The number of enqueable parameters */
     vx_uint32 numEnqueableParams;
-    /*! \brief The number of times to schedule a graph  */
-    vx_size scheduleCount;
+    /*! \brief One in-flight frame of a pipelined execution */
+    struct PipelineFrame
+    {
+        /*! \brief The sequence number of the frame using this slot */
+        vx_uint64 seq;
+        /*! \brief Whether the slot holds a frame */
+        vx_bool active;
+        /*! \brief The nodes of the frame not yet retired */
+        vx_uint32 remaining;
+        /*! \brief VX_ACTION_ABANDON once a node of the frame failed */
+        vx_action action;
+        /*! \brief The producers each node still waits on in this frame */
+        std::vector<vx_uint32> pending;
+        /*! \brief Whether each node has been issued in this frame */
+        std::vector<vx_bool> issued;
+        /*! \brief The graph parameter references, then the frame's own virtual buffers */
+        std::vector<vx_reference> refs;
+    };
+    /*! \brief The state of pipelined execution, see \ref pipelineEnabled */
+    struct
+    {
+        /*! \brief Protects everything below */
+        std::mutex lock;
+        /*! \brief Signalled when the last frame completes */
+        std::condition_variable drained;
+        /*! \brief Whether the slots and buffers below are built, read without the lock */
+        std::atomic<vx_bool> configured;
+        /*! \brief The frame slots, frame n uses slot n % size */
+        std::vector<PipelineFrame> frames;
+        /*! \brief One work item per slot and node, slot * numNodes + node */
+        std::vector<vx_value_set_t> items;
+        /*! \brief The references the graph was verified with, indexed like PipelineFrame::refs */
+        std::vector<vx_reference> originals;
+        /*! \brief The per-frame buffers owned by the pipeline */
+        std::vector<vx_reference> clones;
+        /*! \brief The nodes as they were ordered when the pipeline was built */
+        std::vector<vx_node> nodes;
+        /*! \brief Per node, the (parameter, reference index) pairs rebound for every frame */
+        std::vector<std::vector<std::pair<vx_uint32, vx_uint32>>> bindings;
+        /*! \brief Per node, the readers of shared buffers it writes; they must finish the
+         * previous frame before the node overwrites them */
+        std::vector<std::vector<vx_uint32>> sharedReaders;
+        /*! \brief Per node, the writers of shared buffers it reads */
+        std::vector<std::vector<vx_uint32>> sharedWriters;
+        /*! \brief The next frame each node runs, nodes process frames in order */
+        std::vector<vx_uint64> nodeFrame;
+        /*! \brief The sequence number of the next admitted frame */
+        vx_uint64 nextSeq;
+        /*! \brief Frames submitted but waiting for a free slot */
+        vx_uint32 backlog;
+        /*! \brief Frames currently occupying a slot */
+        vx_uint32 inflight;
+        /*! \brief Nodes issued while the previous frame was still in flight */
+        vx_uint64 overlapped;
+        /*! \brief The result reported by \ref pipelineDrain */
+        vx_status status;
+    } pipeline;
 #endif
 #ifdef OPENVX_USE_STREAMING
     /*! \brief This indicates that the graph is streaming enabled */
@@ -408,7 +824,16 @@ public:
     vx_uint32 triggerNodeIndex;
     /*! \brief The thread used for streaming */
     vx_thread streamingThread;
+    /*! \brief Protects the streaming state */
+    std::mutex streamLock;
+    /*! \brief Signalled on stop requests and newly enqueued graph parameters */
+    std::condition_variable streamWake;
+    /*! \brief Set by \ref streamingStop, checked between executions */
+    std::atomic<vx_bool> streamStop;
 #endif
+    /*! \brief The trigger node the streaming thread already ran for the coming execution,
+     * UINT32_MAX otherwise */
+    vx_uint32 streamPrimed;
     /*! \brief The graph scheduling mode */
     vx_graph_schedule_mode_type_e scheduleMode;
 };
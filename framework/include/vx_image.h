@@ -361,6 +361,29 @@ public:
      */
     vx_status unmapPatch(vx_map_id map_id);
 
+    /**
+     * @brief Let an image read the planes of another one instead of copying them
+     *
+     * The planes are shared copy-on-write, whichever image is written first moves to a
+     * copy of its own. Only plain images allocated by the framework qualify.
+     *
+     * @param input  The image whose planes are shared
+     * @param output The image of the same format and size which stops owning its own planes
+     * @return vx_bool vx_true_e if the planes are shared, vx_false_e if a real copy is needed
+     * @ingroup group_int_image
+     */
+    static vx_bool shareImage(vx_image input, vx_image output);
+
+    /**
+     * @brief Give the image private planes before it is written
+     *
+     * @param keep Whether the contents are carried over, vx_false_e when they are about to be
+     *             overwritten
+     * @return vx_bool vx_false_e if the private planes could not be allocated
+     * @ingroup group_int_image
+     */
+    vx_bool unshareImage(vx_bool keep);
+
     /*! \brief Prints the values of the images.
      * \ingroup group_int_image
      */
@@ -412,6 +435,8 @@ public:
     vx_rectangle_t region;
     /*! \brief The memory type */
     vx_enum        memory_type;
+    /*! \brief The mappings of the planes imported by \ref vxCreateImageFromFd */
+    vx_fd_mapping_t fd_maps[VX_PLANE_MAX];
 #if defined(EXPERIMENTAL_USE_OPENCL)
     /*! \brief This describes the type of OpenCL Image that maps to this image (if applicable). */
     cl_image_format cl_format;
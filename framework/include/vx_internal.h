@@ -64,7 +64,11 @@
 #elif defined(_WIN32) || defined(UNDER_CE)
 #include <windows.h>
 #endif
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <thread>
 
 #include <VX/vx.h>
@@ -141,6 +145,11 @@
  */
 #define VX_INT_MAX_REF      (14336)
 
+/*! \brief The alignment of each plane of memory attached from a graph memory slab.
+ * \ingroup group_int_defines
+ */
+#define VX_MEMORY_ATTACH_ALIGN (64)
+
 /*! \brief Maximum number of user defined structs/
  * \ingroup group_int_defines
  */
@@ -181,6 +190,17 @@
  */
 #define VX_INT_MAX_QUEUE_DEPTH (100002)
 
+/*! \brief Capacity of each threadpool worker's local deque, must be a power of two.
+ * Work spawned beyond this spills into the pool's shared injection queue.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_MAX_DEQUE_DEPTH (1024)
+
+/*! \brief The working set one band of a fused chain aims for, so its rows stay in cache.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_FUSION_BAND_BYTES (256 * 1024)
+
 /*! \brief The value to use in event waiting which never returns.
  * \ingroup group_int_defines
  */
@@ -191,6 +211,31 @@
  */
 #define VX_INT_HOST_CORES (std::thread::hardware_concurrency())
 
+/*! \brief The default number of graph executors, overridden by VX_GRAPH_EXECUTORS.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_GRAPH_EXECUTORS (4)
+
+/*! \brief The default alignment of pooled memory, overridden by VX_MEMORY_ALIGNMENT.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_MEMORY_ALIGNMENT (64)
+
+/*! \brief The default bytes the memory pool keeps for reuse, overridden by VX_MEMORY_POOL_CACHE.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_MEMORY_POOL_CACHE (256u << 20)
+
+/*! \brief Pooled blocks of at least this size are backed by huge pages with VX_MEMORY_HUGE_PAGES=1.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_HUGE_PAGE_SIZE (2u << 20)
+
+/*! \brief The maximum number of graph executors.
+ * \ingroup group_int_defines
+ */
+#define VX_INT_MAX_GRAPH_EXECUTORS (32)
+
 /*! \brief The largest optical flow pyr LK window.
  * \ingroup group_int_defines
  */
@@ -415,15 +460,28 @@ typedef struct vx_queue_t {
 };
 
 /*! \brief The processor structure which contains the graph queue.
+ * Each executor thread takes a scheduled graph from the input queue and runs it, so
+ * independent graphs execute concurrently. Completion is signalled on the graph itself.
  * \ingroup group_int_context
  */
 typedef struct vx_processor_t {
     vx_queue_t input;
-    vx_queue_t output;
-    vx_thread_t thread;
+    vx_thread_t threads[VX_INT_MAX_GRAPH_EXECUTORS];
+    vx_uint32 numThreads;
     vx_bool running;
 };
 
+/*! \brief The work-stealing deque object.
+ * The owning worker pushes and pops at the bottom, any other thread steals from the top
+ * (Chase-Lev). All operations are lock-free.
+ * \ingroup group_int_osal
+ */
+typedef struct vx_deque_t {
+    std::atomic<vx_value_set_t *> data[VX_INT_MAX_DEQUE_DEPTH];
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+};
+
 // forward declarations
 struct vx_threadpool_t;
 struct vx_threadpool_worker_t;
@@ -439,12 +497,20 @@ using vx_error = coreflow::Error*;
  */
 typedef vx_bool (*vx_threadpool_f)(struct vx_threadpool_worker_t *worker);
 
+/*! \brief The function run for one chunk of a node's work, see \ref coreflow::Node::processChunks.
+ * \param [in] arg The argument given along with the function.
+ * \param [in] chunk The index of the chunk to run.
+ * \param [in] slot The slot of the calling thread, unique among the threads running the chunks.
+ * \ingroup group_int_osal
+ */
+typedef vx_status (*vx_chunk_f)(void *arg, vx_uint32 chunk, vx_uint32 slot);
+
 /*! \brief The structure given to each threadpool worker during execution.
  * \ingroup group_int_osal
  */
 typedef struct vx_threadpool_worker_t {
-    /*! \brief The work queue */
-    vx_queue_t *queue;
+    /*! \brief The local work deque, other workers steal from it when idle */
+    vx_deque_t *deque;
     /*! \brief The handle to the worker thread */
     vx_thread_t handle;
     /*! \brief The index of this worker in the pool */
@@ -461,6 +527,8 @@ typedef struct vx_threadpool_worker_t {
     struct vx_threadpool_t *pool;
     /*! \brief Performance capture variable. */
     vx_perf_t perf;
+    /*! \brief The number of work items this worker took from another worker. */
+    std::atomic<uint64_t> steals;
 };
 
 /*! \brief The threadpool tracking structure
@@ -477,12 +545,22 @@ typedef struct vx_threadpool_t {
     int32_t numCurrentItems;
     /*! \brief The array of workers */
     vx_threadpool_worker_t *workers;
-    /*! \brief The next index to submit work to */
-    uint32_t nextWorkerIndex;
-    /*! \brief The semaphore which protect access to the work queues */
+    /*! \brief The semaphore which protect access to the completion count */
     vx_sem_t sem;
     /*! \brief The event which indicates that all work is completed */
     vx_internal_event_t completed;
+    /*! \brief Work issued from outside the pool, taken by whichever worker is free first */
+    std::deque<vx_value_set_t *> injected;
+    /*! \brief The lock which protects the injection queue and idle workers */
+    std::mutex lock;
+    /*! \brief Wakes idle workers when work arrives or the pool shuts down */
+    std::condition_variable wake;
+    /*! \brief The number of issued work items not yet taken by a worker */
+    std::atomic<int32_t> numQueued;
+    /*! \brief The number of workers waiting on \ref wake */
+    std::atomic<int32_t> numSleeping;
+    /*! \brief Set when the pool is being destroyed */
+    std::atomic<bool> stopping;
 };
 
 /*! \brief The work item to distribute across the threadpools
@@ -688,6 +766,12 @@ enum vx_target_priority_e
     /*! \brief Defines the priority of the OpenCL Target */
     VX_TARGET_PRIORITY_OPENCL,
 #endif
+#if defined(EXPERIMENTAL_USE_X86SIMD)
+    /*! \brief Defines the priority of the x86 SIMD target, ahead of tiling
+     * since it implements most of the same kernels for the CPU variant the
+     * context picked at run time */
+    VX_TARGET_PRIORITY_X86SIMD,
+#endif
 #if defined(OPENVX_USE_TILING)
     /*! \brief Defines the priority of the TILING Target */
     VX_TARGET_PRIORITY_TILING,
@@ -832,6 +916,11 @@ enum vx_bounds_e {
  */
 #define VX_PLANE_MAX    (4)
 
+/*! \brief The bookkeeping of planes shared copy-on-write, see \ref coreflow::Memory::shareMemory.
+ * \ingroup group_int_memory
+ */
+struct vx_memory_share_t;
+
 /*! \brief The raw definition of memory layout.
  * \ingroup group_int_memory
  */
@@ -861,6 +950,8 @@ typedef struct vx_memory_t {
      * VX_WRITE_ONLY or VX_READ_AND_WRITE flag parts. Only single writers are permitted.
      */
     vx_sem_t locks[VX_PLANE_MAX];
+    /*! \brief Set while the planes are shared with other memory blocks, nullptr when they are private */
+    vx_memory_share_t *share;
 #if defined(EXPERIMENTAL_USE_OPENCL)
     /*! \brief This contains the OpenCL memory references */
     cl_mem hdls[VX_PLANE_MAX];
@@ -871,6 +962,16 @@ typedef struct vx_memory_t {
 #endif
 };
 
+/*! \brief A mapping of imported memfd or DMA-BUF memory, see \ref vxCreateImageFromFd.
+ * \ingroup group_int_memory
+ */
+typedef struct vx_fd_mapping_t {
+    /*! \brief The page aligned start of the mapping, or nullptr */
+    void*          base;
+    /*! \brief The length of the mapping in bytes */
+    vx_size        length;
+} vx_fd_mapping_t;
+
 /*! \brief The internal representation of the delay parameters as a list.
  * \ingroup group_int_delay
  */
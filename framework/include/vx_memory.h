@@ -16,6 +16,9 @@
 #ifndef VX_MEMORY_H
 #define VX_MEMORY_H
 
+#include <mutex>
+#include <vector>
+
 #include "vx_internal.h"
 
 /*! \file
@@ -26,6 +29,15 @@
  * \brief The Internal Memory API.
  */
 
+/*! \brief Planes shared by several \ref vx_memory_t, freed with the last of them.
+ * \ingroup group_int_memory
+ */
+struct vx_memory_share_t
+{
+    /*! \brief The number of memory blocks pointing at the planes */
+    vx_uint32 count;
+};
+
 /*! \brief The internal representation of a \ref vx_memory_t
  * \ingroup group_int_memory
  */
@@ -50,6 +62,73 @@ public:
      */
     static vx_bool allocateMemory(vx_context context, vx_memory_t *memory);
 
+    /*! \brief Computes the strides of one plane of a memory block.
+     * \ingroup group_int_memory
+     * \param [in] memory The memory block.
+     * \param [in] p The plane index.
+     * \return The size of the plane in bytes.
+     */
+    static vx_size computePlaneSize(vx_memory_t *memory, vx_uint32 p);
+
+    /*! \brief Computes the bytes a memory block needs when attached to external storage.
+     * \ingroup group_int_memory
+     * \param [in] memory The memory block.
+     * \return The size of all planes, each one aligned to \ref VX_MEMORY_ATTACH_ALIGN.
+     */
+    static vx_size computeAttachSize(vx_memory_t *memory);
+
+    /*! \brief Points an unallocated memory block at storage owned by someone else.
+     * \ingroup group_int_memory
+     * \param [in] context The reference to the overall context.
+     * \param [in] memory The memory block.
+     * \param [in] base The storage, at least \ref computeAttachSize bytes.
+     * \return vx_true_e if successful.
+     */
+    static vx_bool attachMemory(vx_context context, vx_memory_t *memory, vx_uint8 *base);
+
+    /*! \brief Undoes \ref attachMemory, leaving the memory block unallocated.
+     * \ingroup group_int_memory
+     * \param [in] context The reference to the overall context.
+     * \param [in] memory The memory block.
+     */
+    static void detachMemory(vx_context context, vx_memory_t *memory);
+
+    /*! \brief Makes a memory block read the planes of another one until either is written.
+     * \ingroup group_int_memory
+     * \param [in] context The reference to the overall context.
+     * \param [in] src The allocated memory block whose planes are shared.
+     * \param [in] dst The memory block with the same layout, its own planes are freed.
+     * \return vx_true_e if successful.
+     */
+    static vx_bool shareMemory(vx_context context, vx_memory_t *src, vx_memory_t *dst);
+
+    /*! \brief Gives a memory block private planes before it is written.
+     * \ingroup group_int_memory
+     * \param [in] context The reference to the overall context.
+     * \param [in] memory The memory block, nothing is done unless it shares its planes.
+     * \param [in] keep Whether the contents are copied over, vx_false_e when they are about to be
+     * overwritten.
+     * \return vx_true_e if the planes are private on return.
+     */
+    static vx_bool unshareMemory(vx_context context, vx_memory_t *memory, vx_bool keep);
+
+    /*! \brief Maps part of a memfd or DMA-BUF file descriptor into the process, shared.
+     * \ingroup group_int_memory
+     * \param [in] fd The file descriptor, still owned by the caller.
+     * \param [in] offset The byte offset of the data in the file.
+     * \param [in] size The number of bytes to map.
+     * \param [in] usage The \ref vx_accessor_e access the mapping is protected for.
+     * \param [out] mapping Records the mapping for \ref unmapDescriptor.
+     * \return The address of the data, or nullptr on failure.
+     */
+    static vx_uint8 *mapDescriptor(vx_int32 fd, vx_size offset, vx_size size, vx_enum usage, vx_fd_mapping_t *mapping);
+
+    /*! \brief Undoes \ref mapDescriptor, if the mapping is set.
+     * \ingroup group_int_memory
+     * \param [in] mapping The mapping, cleared on return.
+     */
+    static void unmapDescriptor(vx_fd_mapping_t *mapping);
+
     /*! \brief Print info of memory block.
      * \ingroup group_int_memory
      * \param [in] mem The memory block.
@@ -80,6 +159,84 @@ public:
                                             vx_uint32 p);
 };
 
+/*! \brief The context-wide allocator behind \ref vx_memory_t and mapping buffers.
+ *
+ * Blocks are aligned to VX_MEMORY_ALIGNMENT (default \ref VX_INT_MEMORY_ALIGNMENT) and
+ * rounded up to a size class, four per power of two. Released blocks go onto the free list of
+ * their class, up to VX_MEMORY_POOL_CACHE bytes, and are handed out again before the system is
+ * asked for more. VX_MEMORY_ZERO_FILL=0 skips clearing new blocks and VX_MEMORY_HUGE_PAGES=1
+ * asks for huge pages behind large ones.
+ * \ingroup group_int_memory
+ */
+class MemoryPool
+{
+public:
+    /*! \brief Reads the pool configuration from the environment.
+     * \ingroup group_int_memory
+     */
+    MemoryPool();
+
+    /*! \brief Returns every cached block to the system.
+     * \ingroup group_int_memory
+     */
+    ~MemoryPool();
+
+    /*! \brief Allocates a block.
+     * \ingroup group_int_memory
+     * \param [in] size The bytes needed.
+     * \param [in] zero Whether the block is cleared, unless zero filling is turned off.
+     * \return The aligned block or nullptr.
+     */
+    void *allocate(vx_size size, vx_bool zero = vx_true_e);
+
+    /*! \brief Gives a block from \ref allocate back to the pool.
+     * \ingroup group_int_memory
+     * \param [in] ptr The block, nullptr is ignored.
+     */
+    void release(void *ptr);
+
+    /*! \brief Returns every cached block to the system.
+     * \ingroup group_int_memory
+     */
+    void trim();
+
+    /*! \brief The alignment of every block.
+     * \ingroup group_int_memory
+     */
+    vx_size alignment() const;
+
+    /*! \brief The bytes currently cached on the free lists.
+     * \ingroup group_int_memory
+     */
+    vx_size cachedBytes();
+
+    /*! \brief The number of allocations served from the free lists.
+     * \ingroup group_int_memory
+     */
+    vx_size reusedBlocks();
+
+private:
+    /*! \brief The size class of a request and the size of that class */
+    static vx_uint32 sizeClass(vx_size size, vx_size *rounded);
+
+    /*! \brief Guards the free lists */
+    std::mutex lock;
+    /*! \brief The cached blocks of each size class */
+    std::vector<std::vector<void *>> freeLists;
+    /*! \brief The alignment of every block, a power of two */
+    vx_size align;
+    /*! \brief The most bytes kept on the free lists */
+    vx_size cacheLimit;
+    /*! \brief The bytes on the free lists */
+    vx_size cached;
+    /*! \brief The allocations served from the free lists */
+    vx_size reused;
+    /*! \brief Whether blocks are cleared when asked to */
+    vx_bool zeroFill;
+    /*! \brief Whether large blocks are backed by huge pages */
+    vx_bool hugePages;
+};
+
 } // namespace coreflow
 
 #endif /* VX_MEMORY_H */
\ No newline at end of file
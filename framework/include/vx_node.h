@@ -34,6 +34,8 @@
 enum vx_node_attribute_internal_e {
     /*\brief The attribute used to get the pointer to tile local memory */
     VX_NODE_ATTRIBUTE_TILE_MEMORY_PTR = VX_ATTRIBUTE_BASE(VX_ID_KHRONOS, VX_TYPE_NODE) + 0xD,
+    /*\brief The attribute used to get the per-replica performance of a replicated node, an array of <tt>\ref vx_perf_t</tt> */
+    VX_NODE_ATTRIBUTE_REPLICA_PERFORMANCE = VX_ATTRIBUTE_BASE(VX_ID_KHRONOS, VX_TYPE_NODE) + 0x10,
 };
 
 /*! \brief Used to set the graph as a child of the node within another graph.
@@ -111,6 +113,24 @@ public:
      */
     vx_status setTarget(vx_enum target_enum, const char *target_string);
 
+    /**
+     * @brief Run the node with the kernel of another target
+     *
+     * @param target_kernel The kernel of that target
+     * @param target_index  The index of the target in the context
+     * @ingroup group_int_node
+     */
+    void assignKernel(vx_kernel target_kernel, vx_uint32 target_index);
+
+    /**
+     * @brief Move the node to the next target in priority order that has its kernel and
+     * accepts the node, for when its current target declines it at verify
+     *
+     * @return vx_status VX_SUCCESS on success, VX_ERROR_NOT_SUPPORTED if no later target does
+     * @ingroup group_int_node
+     */
+    vx_status fallBackTarget();
+
     /**
      * @brief Get the local data size of the node
      *
@@ -245,6 +265,42 @@ public:
     static vx_status replicateNode(vx_graph graph, vx_node first_node, vx_bool *replicate,
                                    vx_uint32 number_of_parameters);
 
+    /**
+     * @brief Run every replica of a replicated node
+     *
+     * The replicas are fanned out across the context workers, the calling thread runs
+     * replicas too and returns once all of them are done.
+     *
+     * @return vx_status VX_SUCCESS if every replica succeeded, otherwise the first failure
+     * @ingroup group_int_node
+     */
+    vx_status processReplicas();
+
+    /**
+     * @brief Run a function over a number of independent chunks of the node's work
+     *
+     * The chunks are fanned out across the context workers, the calling thread runs
+     * chunks too and returns once all of them are done. Each thread taking part passes
+     * its own slot to the function, 0 for the caller and below \p maxThreads for the
+     * helpers, so per-thread scratch memory can be indexed by it.
+     *
+     * @param numChunks  The number of chunks
+     * @param maxThreads The most threads to run chunks at once, 1 runs them all on the caller
+     * @param function   The function run for every chunk
+     * @param arg        The argument passed to the function
+     * @return vx_status VX_SUCCESS if every chunk succeeded, otherwise the first failure
+     * @ingroup group_int_node
+     */
+    vx_status processChunks(vx_uint32 numChunks, vx_uint32 maxThreads, vx_chunk_f function, void *arg);
+
+    /**
+     * @brief Threadpool entry point which helps run the chunks of a node
+     *
+     * @param workitem The work item issued by \ref processChunks
+     * @ingroup group_int_node
+     */
+    static void workerChunks(vx_value_set_t *workitem);
+
     /*! \brief Used to set the graph as a child of the node within another graph.
      * \param [in] node The node.
      * \param [in] graph The child graph.
@@ -315,6 +371,12 @@ public:
     vx_bool             is_replicated;
     /*! \brief The replicated parameters flags */
     vx_bool             replicated_flags[VX_INT_MAX_PARAMS];
+    /*! \brief The performance of each replica, from the last execution */
+    std::vector<vx_perf_t> replica_perf;
+    /*! \brief The index of the graph's fused chain holding the node, or -1 */
+    vx_int32            fused_chain;
+    /*! \brief The composite node whose child graph this node is inlined from, or nullptr */
+    vx_node             inlined_into;
     /*! \brief The node state */
     vx_node_state_e     state;
 };
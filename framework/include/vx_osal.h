@@ -156,6 +156,9 @@ public:
                                         void *arg);
 
     /*! \brief Start and issue tasks to thread pool.
+     * Work issued from inside a running work item is pushed onto the calling worker's own
+     * deque (so continuations stay on the same core), anything else goes to the shared
+     * injection queue. Idle workers steal from busy ones.
      * \ingroup group_int_osal
      * \param[in] pool The pointer to the thread pool.
      * \param[in] workitems The work items to issue.
@@ -172,6 +175,12 @@ public:
      */
     static vx_bool completeThreadpool(vx_threadpool_t *pool, vx_bool blocking);
 
+    /*! \brief Tells whether the calling thread is a worker of any thread pool.
+     * \ingroup group_int_osal
+     * \return vx_true_e if called from a pool worker, else vx_false_e.
+     */
+    static vx_bool isThreadpoolWorker();
+
     /**
      * @brief Launch worker thread pool.
      * @ingroup group_int_osal
@@ -186,7 +195,43 @@ public:
      */
     static void destroyThreadpool(vx_threadpool_t **ppool);
 
+    /*! \brief Initializes a work-stealing deque.
+     * \ingroup group_int_osal
+     * \param[in] d The pointer to the deque object.
+     */
+    static void initDeque(vx_deque_t *d);
+
+    /*! \brief Pushes onto the bottom of a deque. Only the owning thread may push.
+     * \ingroup group_int_osal
+     * \param[in] d The pointer to the deque object.
+     * \param[in] data The work item to push.
+     * \return vx_true_e if successful, vx_false_e if the deque is full.
+     */
+    static vx_bool pushDeque(vx_deque_t *d, vx_value_set_t *data);
+
+    /*! \brief Pops the most recently pushed item. Only the owning thread may pop.
+     * \ingroup group_int_osal
+     * \param[in] d The pointer to the deque object.
+     * \return The work item or nullptr if the deque is empty.
+     */
+    static vx_value_set_t *popDeque(vx_deque_t *d);
+
+    /*! \brief Steals the oldest item from a deque. Safe to call from any thread.
+     * \ingroup group_int_osal
+     * \param[in] d The pointer to the deque object.
+     * \return The work item or nullptr if the deque is empty or the steal lost a race.
+     */
+    static vx_value_set_t *stealDeque(vx_deque_t *d);
+
 private:
+    /*! \brief Finds the next work item for a worker: its own deque first, then the
+     * injection queue, then the other workers' deques.
+     * \ingroup group_int_osal
+     * \param[in] worker The worker looking for work.
+     * \return The work item or nullptr if none was found.
+     */
+    static vx_value_set_t *takeThreadpool(vx_threadpool_worker_t *worker);
+
     /*! \brief Gets the capture time in nanoseconds.
      * \ingroup group_int_osal
      * \return The time in nanoseconds.
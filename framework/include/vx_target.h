@@ -113,6 +113,9 @@ public:
     vx_target_funcs_t   funcs;
     /*! \brief Used to determine precidence when more than once core supports a kernel */
     vx_uint32           priority;
+    /*! \brief Whether the kernels of the target compute the same pixels as the C model for
+     * every border and format they accept, which lets the graph fuse them */
+    vx_bool             bit_exact;
     /*! \brief The number of supported kernels on this target */
     vx_uint32           num_kernels;
     /*! \brief The supported kernels on this target */
@@ -64,6 +64,23 @@ public:
     static vx_tensor createTensor(
         vx_context context, vx_size number_of_dims, const vx_size *dims, vx_enum data_type, vx_int8 fixed_point_position);
 
+    /**
+     * @brief Create a view sharing the storage of another tensor
+     *
+     * The view is laid out by its own dimensions and strides, so slices, reshapes and
+     * permutations of the parent need no copy.
+     *
+     * @param tensor         The tensor whose storage is shared
+     * @param number_of_dims The number of dimensions of the view
+     * @param dims           The dimensions of the view
+     * @param strides        The stride of each view dimension in bytes
+     * @param offset         The byte offset of the first view element in the parent
+     * @return vx_tensor The view object
+     * @ingroup group_int_tensor
+     */
+    static vx_tensor createView(vx_tensor tensor, vx_size number_of_dims, const vx_size *dims,
+                                const vx_size *strides, vx_size offset);
+
     /*! \brief Used to validate the vx_tensor types.
      * \param [in] tensor The vx_tensor to validate.
      * \ingroup group_int_tensor
@@ -127,6 +144,27 @@ public:
         const vx_size * tensor_stride, const vx_size * patch_stride,  vx_size number_of_dimensions,
         vx_size * tensor_pos, vx_size * patch_pos);
 
+    /**
+     * @brief Copy an n-dimensional block between two strided layouts
+     *
+     * Dimensions which are contiguous on both sides are folded together so the
+     * block moves in runs as long as the layouts allow, down to one memcpy when
+     * both are packed.
+     *
+     * @param dst                   destination base pointer
+     * @param dst_stride            destination stride in bytes per dimension
+     * @param src                   source base pointer
+     * @param src_stride            source stride in bytes per dimension
+     * @param extent                number of elements per dimension
+     * @param number_of_dimensions  number of dimensions
+     * @param element_size          size of one element in bytes
+     * @ingroup group_int_tensor
+     */
+    static void copyStrided(vx_uint8 *dst, const vx_size *dst_stride,
+                            const vx_uint8 *src, const vx_size *src_stride,
+                            const vx_size *extent, vx_size number_of_dimensions,
+                            vx_size element_size);
+
     /**
      * @brief Get the dimensions of the tensor
      * @return const vx_size* The dimensions of the tensor
@@ -162,6 +200,13 @@ public:
      */
     const vx_size *strides() const;
 
+    /**
+     * @brief Check if the elements of the tensor are packed without gaps in dimension order
+     * @return vx_bool vx_true_e if the strides are the packed strides of the dimensions
+     * @ingroup group_int_tensor
+     */
+    vx_bool isContiguous() const;
+
     /**
      * @brief Get the size of the tensor in bytes
      * @return vx_size The size of the tensor in bytes
@@ -235,6 +280,10 @@ public:
     vx_tensor parent;
     /*! \brief Array of subimages. */
     vx_image  subimages[VX_INT_MAX_REF];
+    /*! \brief The memory type, VX_MEMORY_TYPE_NONE unless the storage was imported */
+    vx_enum memory_type;
+    /*! \brief The mapping of the storage imported by \ref vxCreateTensorFromFd */
+    vx_fd_mapping_t fd_map;
 };
 
 } // namespace coreflow
@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 
 #include <VX/vx_khr_xml.h>
@@ -31,6 +33,9 @@ vx_char targetModules[][VX_MAX_TARGET_NAME] = {
 #endif
 #if defined(EXPERIMENTAL_USE_VENUM)
     "openvx-venum",
+#endif
+#if defined(EXPERIMENTAL_USE_X86SIMD)
+    "openvx-x86simd",
 #endif
     "openvx-c_model", "openvx-onnxRT", "openvx-ai_server", "openvx-liteRT", "openvx-torch",
 };
@@ -39,6 +44,77 @@ static std::shared_ptr<Context> single_context = nullptr;
 static vx_sem_t context_lock;
 static vx_sem_t global_lock;
 
+/*! \brief Reads the number of graph executors from VX_GRAPH_EXECUTORS, if set.
+ * \ingroup group_int_context
+ */
+static vx_uint32 graphExecutors()
+{
+    vx_uint32 count = VX_INT_GRAPH_EXECUTORS;
+    const char *str = std::getenv("VX_GRAPH_EXECUTORS");
+    if (str)
+    {
+        count = (vx_uint32)std::strtoul(str, nullptr, 10);
+    }
+    return std::clamp(count, 1u, (vx_uint32)VX_INT_MAX_GRAPH_EXECUTORS);
+}
+
+/*! \brief Reads the best CPU variant of the host from cpuid, lowered to VX_CPU_VARIANT if it is set.
+ * \ingroup group_int_context
+ */
+static vx_enum selectCpuVariant()
+{
+    static const struct {
+        const char *name;
+        vx_enum variant;
+    } variants[] = {
+        {"scalar", VX_CPU_VARIANT_SCALAR},
+        {"sse4.2", VX_CPU_VARIANT_SSE42},
+        {"avx2", VX_CPU_VARIANT_AVX2},
+        {"avx512", VX_CPU_VARIANT_AVX512},
+    };
+    vx_enum variant = VX_CPU_VARIANT_SCALAR;
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__GNUC__)
+    /* each variant also needs the ones before it, AVX also needs the OS to save the registers,
+     * which __builtin_cpu_supports checks */
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        variant = VX_CPU_VARIANT_SSE42;
+        if (__builtin_cpu_supports("avx2"))
+        {
+            variant = VX_CPU_VARIANT_AVX2;
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            {
+                variant = VX_CPU_VARIANT_AVX512;
+            }
+        }
+    }
+#endif
+    const char *str = std::getenv("VX_CPU_VARIANT");
+    if (str)
+    {
+        vx_size v = 0;
+        while (v < dimof(variants) && strcmp(str, variants[v].name) != 0)
+        {
+            v++;
+        }
+        if (v == dimof(variants))
+        {
+            VX_PRINT(VX_ZONE_WARNING, "Ignoring unknown VX_CPU_VARIANT %s\n", str);
+        }
+        else if (variants[v].variant > variant)
+        {
+            VX_PRINT(VX_ZONE_WARNING, "The host does not support VX_CPU_VARIANT %s\n", str);
+        }
+        else
+        {
+            variant = variants[v].variant;
+        }
+    }
+    VX_PRINT(VX_ZONE_CONTEXT, "Using CPU variant %s\n", variants[variant - VX_CPU_VARIANT_SCALAR].name);
+    return variant;
+}
+
 /*****************************************************************************/
 // INTERNAL CONTEXT APIS
 /*****************************************************************************/
@@ -47,6 +123,8 @@ Context::Context()
       p_global_lock(&global_lock),
       reftable(),
       num_references(0),
+      reftable_free(),
+      reftable_index(),
       modules(),
       num_modules(0),
       proc(),
@@ -61,7 +139,10 @@ Context::Context()
       log_reentrant(vx_false_e),
       perf_enabled(vx_true_e),
       accessors(),
-      memory_maps_lock(),
+      accessors_free(),
+      memory_pool(),
+      memory_maps_free(0u),
+      memory_maps_next(),
       memory_maps(),
       user_structs(),
       workers(nullptr),
@@ -79,6 +160,7 @@ Context::Context()
       next_dynamic_user_library_id(1),
       imm_target_enum(),
       imm_target_string(),
+      cpu_variant(selectCpuVariant()),
 #ifdef OPENVX_USE_OPENCL_INTEROP
       opencl_context(nullptr),
       opencl_command_queue(nullptr),
@@ -86,8 +168,6 @@ Context::Context()
 #ifdef OPENVX_USE_PIPELINING
       event_queue(),
 #endif
-      graph_queue(),
-      numGraphsQueued(0ul),
       vendor_id((vx_uint16)VX_ID_EDGE_AI),
       version_number((vx_uint16)VX_VERSION),
       implementation("core.VX"),
@@ -107,12 +187,26 @@ Context::Context()
     " ")
 {
     imm_border.mode = VX_BORDER_UNDEFINED;
+
+    /* the accessors hand out their lowest slots first */
+    accessors_free.reserve(dimof(accessors));
+    for (vx_uint32 a = dimof(accessors); a > 0u; a--)
+    {
+        accessors_free.push_back(a - 1u);
+    }
+
+    /* every memory map slot starts out free, in index order */
+    for (vx_uint32 id = 0u; id < dimof(memory_maps); id++)
+    {
+        memory_maps_next[id].store((id + 1u < dimof(memory_maps)) ? id + 2u : 0u, std::memory_order_relaxed);
+    }
+    memory_maps_free.store(1u, std::memory_order_release);
 }
 
 Context::~Context()
 {
     vx_uint32 r;
-    for (r = 0; r < VX_INT_MAX_REF; r++)
+    for (r = 0; r < reftable.size(); r++)
     {
         if (reftable[r])
         {
@@ -232,16 +326,17 @@ vx_context Context::createContext()
                 }
             }
 
-            /* create the internal thread which processes graphs for asynchronous mode. */
+            /* create the internal threads which process graphs for asynchronous mode. */
             Osal::initQueue(&context->proc.input);
-            Osal::initQueue(&context->proc.output);
             context->proc.running = vx_true_e;
-            context->proc.thread = Osal::createThread(Context::workerGraph, &context->proc);
+            context->proc.numThreads = graphExecutors();
+            for (vx_uint32 e = 0u; e < context->proc.numThreads; e++)
+            {
+                context->proc.threads[e] = Osal::createThread(Context::workerGraph, &context->proc);
+            }
+            VX_PRINT(VX_ZONE_CONTEXT, "Created %u graph executors\n", context->proc.numThreads);
             context->imm_target_enum = VX_TARGET_ANY;
             memset(context->imm_target_string, 0, sizeof(context->imm_target_string));
-
-            /* memory maps table lock */
-            Osal::createSem(&context->memory_maps_lock, 1);
         }
     }
     else
@@ -318,6 +413,11 @@ vx_size Context::maxTensorDims() const
     return VX_MAX_TENSOR_DIMENSIONS;
 }
 
+vx_enum Context::cpuVariant() const
+{
+    return cpu_variant;
+}
+
 std::vector<vx_kernel_info_t> Context::uniqueKernelTable()
 {
     vx_uint32 k = 0u;
@@ -495,6 +595,10 @@ vx_status Context::loadTarget(const vx_char* targetName)
                 targets[index]->funcs.process  = (vx_target_process_f) Osal::getSymbol(targets[index]->module.handle, "vxTargetProcess");
                 targets[index]->funcs.verify   = (vx_target_verify_f)  Osal::getSymbol(targets[index]->module.handle, "vxTargetVerify");
                 targets[index]->funcs.addkernel= (vx_target_addkernel_f)Osal::getSymbol(targets[index]->module.handle, "vxTargetAddKernel");
+#ifdef OPENVX_KHR_TILING
+                /* optional, only targets which run tiling kernels export it */
+                targets[index]->funcs.addtilingkernel = (vx_target_addtilingkernel_f)Osal::getSymbol(targets[index]->module.handle, "vxTargetAddTilingKernel");
+#endif
 
                 if (targets[index]->funcs.init &&
                     targets[index]->funcs.deinit &&
@@ -584,6 +688,8 @@ void Context::removeAccessor(vx_uint32 index)
 {
     if (index < dimof(accessors))
     {
+        /* maps of different objects come and go from any thread */
+        Osal::semWait(&lock);
         if (accessors[index].allocated == vx_true_e)
         {
             ::operator delete(accessors[index].ptr);
@@ -592,36 +698,40 @@ void Context::removeAccessor(vx_uint32 index)
         {
             ::operator delete(accessors[index].extra_data);
         }
+        if (accessors[index].used == vx_true_e)
+        {
+            accessors_free.push_back(index);
+        }
         memset(&accessors[index], 0, sizeof(vx_external_t));
+        Osal::semPost(&lock);
         VX_PRINT(VX_ZONE_CONTEXT, "Removed accessors[%u]\n", index);
     }
 }
 
 vx_bool Context::addReference(const vx_reference& ref)
 {
-    vx_bool ret = vx_false_e;
     Osal::semWait(&lock);
     {
-        for (vx_uint32 r = 0; r < VX_INT_MAX_REF; r++)
+        vx_uint32 r;
+        /* refill an emptied slot before growing the table */
+        if (!reftable_free.empty())
         {
-            if (reftable[r] == nullptr)
-            {
-                reftable[r] = ref;
-                num_references++;
-                ret = vx_true_e;
-                VX_PRINT(VX_ZONE_INFO, "Added ref %p to reftable\n", ref);
-                VX_PRINT(VX_ZONE_INFO, "Current num_references:%d\n", num_references);
-                break;
-            }
+            r = reftable_free.back();
+            reftable_free.pop_back();
+            reftable[r] = ref;
         }
+        else
+        {
+            r = (vx_uint32)reftable.size();
+            reftable.push_back(ref);
+        }
+        reftable_index.emplace(ref, r);
+        num_references++;
+        VX_PRINT(VX_ZONE_INFO, "Added ref %p to reftable\n", ref);
+        VX_PRINT(VX_ZONE_INFO, "Current num_references:%d\n", num_references);
     }
     Osal::semPost(&lock);
-    if (vx_false_e == ret)
-    {
-        VX_PRINT(VX_ZONE_ERROR, "Failed to add ref %p to reftable\n", ref);
-        DEBUG_BREAK();
-    }
-    return ret;
+    return vx_true_e;
 }
 
 vx_bool Context::removeReference(vx_reference& ref)
@@ -629,23 +739,22 @@ vx_bool Context::removeReference(vx_reference& ref)
     vx_bool ret = vx_false_e;
 
     Osal::semWait(&lock);
-    for (vx_uint32 r = 0; r < VX_INT_MAX_REF; r++)
+    auto found = reftable_index.find(ref);
+    if (found != reftable_index.end())
     {
-        if (reftable[r] &&
-            reftable[r] == ref)
+        vx_uint32 r = found->second;
+        // if (0u == ref->totalReferenceCount())
         {
-            // if (0u == ref->totalReferenceCount())
-            {
-                VX_PRINT(VX_ZONE_LOG, "Removing:\n");
-                Reference::printReference(ref); // For debugging
-                // delete reftable[r];
-                reftable[r] = nullptr;
-            }
-            ref = nullptr;
-            num_references--;
-            ret = vx_true_e;
-            break;
+            VX_PRINT(VX_ZONE_LOG, "Removing:\n");
+            Reference::printReference(ref); // For debugging
+            // delete reftable[r];
+            reftable[r] = nullptr;
         }
+        reftable_index.erase(found);
+        reftable_free.push_back(r);
+        ref = nullptr;
+        num_references--;
+        ret = vx_true_e;
     }
     Osal::semPost(&lock);
     return ret;
@@ -672,44 +781,33 @@ vx_bool Context::workerNode(vx_threadpool_worker_t *worker)
     vx_bool ret = vx_true_e;
     vx_target target = (vx_target)worker->data->v1;
     vx_node node = (vx_node)worker->data->v2;
-    vx_action action = (vx_action)worker->data->v3;
-    vx_uint32 p = 0;
 
-    /* turn on access to virtual memory */
-    for (p = 0u; p < node->kernel->signature.num_parameters; p++)
+    if (target == nullptr)
     {
-        if (node->parameters[p] == nullptr) continue;
-        if (node->parameters[p]->is_virtual == vx_true_e)
-        {
-            node->parameters[p]->is_accessible = vx_true_e;
-        }
+        /* not a node but a helper for the chunks of one */
+        Node::workerChunks(worker->data);
+        return ret;
     }
+    /* the dispatcher passes the pipeup depth in and collects the action out of v3 */
+    vx_uint32 max_pipeup_depth = (vx_uint32)worker->data->v3;
+    vx_action action = VX_ACTION_CONTINUE;
 
+    /* access to virtual memory is granted by the dispatching graph for the whole execution */
+#ifdef OPENVX_USE_PIPELINING
+    /* a pipelined frame points the node at its own buffers first */
+    node->graph->pipelineBind(worker->data);
+#endif
     VX_PRINT(VX_ZONE_GRAPH, "Executing %s on target %s\n", node->kernel->name, target->name);
-    action = target->funcs.process(target, &node, 0, 1);
+    action = node->graph->executeNode(node, max_pipeup_depth);
     VX_PRINT(VX_ZONE_GRAPH, "Executed %s on target %s with action %d returned\n", node->kernel->name, target->name, action);
 
-    /* turn on access to virtual memory */
-    for (p = 0u; p < node->kernel->signature.num_parameters; p++)
-    {
-        if (node->parameters[p] == nullptr) continue;
-        if (node->parameters[p]->is_virtual == vx_true_e)
-        {
-            // determine who is the last thread to release...
-            // if this is an input, then there should be "zero" rectangles, which
-            // should allow commits to work, even if the flag is lowered.
-            // if this is an output, there should only be a single writer, so
-            // no locks are needed. Bidirectional is not allowed to be virtual.
-            node->parameters[p]->is_accessible = vx_true_e;
-        }
-    }
-
     if (action == VX_ACTION_ABANDON)
     {
         ret = vx_false_e;
     }
     // collect the specific results.
     worker->data->v3 = (vx_value_t)action;
+    node->graph->notifyNodeCompleted(worker->data);
     return ret;
 }
 
@@ -725,14 +823,14 @@ vx_value_t Context::workerGraph(void *arg)
         if (Osal::readQueue(&proc->input, &data) == vx_true_e)
         {
             g = (vx_graph)data->v1;
-            // s = (vx_status)v2;
-            VX_PRINT(VX_ZONE_CONTEXT, "Read graph=" VX_FMT_REF ", status=%d\n",g,s);
-            s = vxProcessGraph(g);
-            VX_PRINT(VX_ZONE_CONTEXT, "Writing graph=" VX_FMT_REF ", status=%d\n",g,s);
-            data->v1 = (vx_value_t)g;
-            data->v2 = (vx_status)s;
-            if (Osal::writeQueue(&proc->output, data) == vx_false_e)
-                VX_PRINT(VX_ZONE_ERROR, "Failed to write graph=" VX_FMT_REF " status=%d\n", g, s);
+            VX_PRINT(VX_ZONE_CONTEXT, "Read graph=" VX_FMT_REF "\n", g);
+            /* the graph stays with this executor until every execution scheduled on it ran, so
+             * executions of one graph never overlap while other executors run other graphs */
+            do
+            {
+                s = vxProcessGraph(g);
+                VX_PRINT(VX_ZONE_CONTEXT, "Completed graph=" VX_FMT_REF ", status=%d\n", g, s);
+            } while (g->retireExecution(s) == vx_true_e);
         }
     }
     VX_PRINT(VX_ZONE_CONTEXT,"Stopping thread!\n");
@@ -749,42 +847,52 @@ vx_bool Context::addAccessor(
                                  void *extra_data)
 {
     vx_uint32 a;
-    vx_bool worked = vx_false_e;
-    for (a = 0u; a < dimof(accessors); a++)
+    void *allocated = nullptr;
+
+    /* Allocation requested */
+    if (size > 0ul && ptr == nullptr)
     {
-        if (accessors[a].used == vx_false_e)
-        {
-            VX_PRINT(VX_ZONE_CONTEXT, "Found open accessors[%u]\n", a);
-            /* Allocation requested */
-            if (size > 0ul && ptr == nullptr)
-            {
-                ptr = accessors[a].ptr = new vx_char[size]();
-                if (accessors[a].ptr == nullptr)
-                    return vx_false_e;
-                accessors[a].allocated = vx_true_e;
-            }
-            /* Pointer provided by the caller */
-            else
-            {
-                accessors[a].ptr = ptr;
-                accessors[a].allocated = vx_false_e;
-            }
-            accessors[a].usage = usage;
-            accessors[a].ref = ref;
-            accessors[a].used = vx_true_e;
-            accessors[a].extra_data = extra_data;
-            if (pIndex) *pIndex = a;
-            worked = vx_true_e;
-            break;
-        }
+        allocated = new vx_char[size]();
+        if (allocated == nullptr)
+            return vx_false_e;
     }
-    return worked;
+
+    Osal::semWait(&lock);
+    if (accessors_free.empty())
+    {
+        Osal::semPost(&lock);
+        VX_PRINT(VX_ZONE_ERROR, "No free accessors!\n");
+        delete[] (vx_char *)allocated;
+        return vx_false_e;
+    }
+    a = accessors_free.back();
+    accessors_free.pop_back();
+    if (allocated != nullptr)
+    {
+        ptr = accessors[a].ptr = allocated;
+        accessors[a].allocated = vx_true_e;
+    }
+    /* Pointer provided by the caller */
+    else
+    {
+        accessors[a].ptr = ptr;
+        accessors[a].allocated = vx_false_e;
+    }
+    accessors[a].usage = usage;
+    accessors[a].ref = ref;
+    accessors[a].used = vx_true_e;
+    accessors[a].extra_data = extra_data;
+    Osal::semPost(&lock);
+    VX_PRINT(VX_ZONE_CONTEXT, "Found open accessors[%u]\n", a);
+    if (pIndex) *pIndex = a;
+    return vx_true_e;
 }
 
 vx_bool Context::findAccessor(const void* ptr, vx_uint32* pIndex)
 {
     vx_uint32 a;
     vx_bool worked = vx_false_e;
+    Osal::semWait(&lock);
     for (a = 0u; a < dimof(accessors); a++)
     {
         if (accessors[a].used == vx_true_e &&
@@ -796,9 +904,50 @@ vx_bool Context::findAccessor(const void* ptr, vx_uint32* pIndex)
             break;
         }
     }
+    Osal::semPost(&lock);
     return worked;
 }
 
+vx_bool Context::takeMemoryMapSlot(vx_uint32 *id)
+{
+    vx_uint64 head = memory_maps_free.load(std::memory_order_acquire);
+
+    for (;;)
+    {
+        vx_uint32 slot = (vx_uint32)head;
+        if (slot == 0u)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "No free memory map slots!\n");
+            return vx_false_e;
+        }
+
+        /* bump the change count so a slot popped and pushed back meanwhile fails the swap */
+        vx_uint64 next = (((head >> 32) + 1u) << 32) |
+                         memory_maps_next[slot - 1u].load(std::memory_order_relaxed);
+        if (memory_maps_free.compare_exchange_weak(head, next,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_acquire))
+        {
+            *id = slot - 1u;
+            return vx_true_e;
+        }
+    }
+}
+
+void Context::giveMemoryMapSlot(vx_uint32 id)
+{
+    vx_uint64 head = memory_maps_free.load(std::memory_order_relaxed);
+    vx_uint64 next;
+
+    do
+    {
+        memory_maps_next[id].store((vx_uint32)head, std::memory_order_relaxed);
+        next = (((head >> 32) + 1u) << 32) | (id + 1u);
+    } while (!memory_maps_free.compare_exchange_weak(head, next,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed));
+}
+
 vx_bool Context::memoryMap(
     vx_reference ref,
     vx_size      size,
@@ -810,82 +959,66 @@ vx_bool Context::memoryMap(
     vx_map_id*   map_id)
 {
     vx_uint32 id;
-    vx_uint8* buf    = 0;
-    vx_bool   worked = vx_false_e;
+    vx_uint8* buf = 0;
 
-    /* lock the table for modification */
-    if (vx_true_e == Osal::semWait(&memory_maps_lock))
+    /* the slot is ours alone once popped, so it is filled without a lock */
+    if (vx_false_e == takeMemoryMapSlot(&id))
     {
-        for (id = 0u; id < dimof(memory_maps); id++)
-        {
-            if (memory_maps[id].used == vx_false_e)
-            {
-                VX_PRINT(VX_ZONE_CONTEXT, "Found free memory map slot[%u]\n", id);
+        return vx_false_e;
+    }
+    VX_PRINT(VX_ZONE_CONTEXT, "Found free memory map slot[%u]\n", id);
 
-                /* allocate mapped buffer if requested (by providing size != 0) */
-                if (size != 0)
-                {
-                    buf = new vx_uint8[size]();
-                    if (buf == nullptr)
-                    {
-                        Osal::semPost(&memory_maps_lock);
-                        return vx_false_e;
-                    }
-                }
+    /* allocate mapped buffer if requested (by providing size != 0) */
+    if (size != 0)
+    {
+        buf = (vx_uint8*)memory_pool.allocate(size);
+        if (buf == nullptr)
+        {
+            giveMemoryMapSlot(id);
+            return vx_false_e;
+        }
+    }
 
-                memory_maps[id].used       = vx_true_e;
-                memory_maps[id].ref        = ref;
-                memory_maps[id].ptr        = buf;
-                memory_maps[id].usage      = usage;
-                memory_maps[id].mem_type   = mem_type;
-                memory_maps[id].flags      = flags;
+    memory_maps[id].ref        = ref;
+    memory_maps[id].ptr        = buf;
+    memory_maps[id].usage      = usage;
+    memory_maps[id].mem_type   = mem_type;
+    memory_maps[id].flags      = flags;
 
-                vx_memory_map_extra* extra = (vx_memory_map_extra*)extra_data;
-                if (VX_TYPE_IMAGE == ref->type)
-                {
-                    memory_maps[id].extra.image_data.plane_index = extra->image_data.plane_index;
-                    memory_maps[id].extra.image_data.rect        = extra->image_data.rect;
-                }
-                else if (VX_TYPE_ARRAY == ref->type ||
-                         VX_TYPE_LUT == ref->type
+    vx_memory_map_extra* extra = (vx_memory_map_extra*)extra_data;
+    if (VX_TYPE_IMAGE == ref->type)
+    {
+        memory_maps[id].extra.image_data.plane_index = extra->image_data.plane_index;
+        memory_maps[id].extra.image_data.rect        = extra->image_data.rect;
+    }
+    else if (VX_TYPE_ARRAY == ref->type ||
+             VX_TYPE_LUT == ref->type
 #if defined(OPENVX_USE_USER_DATA_OBJECT)
-                         ||
-                         VX_TYPE_USER_DATA_OBJECT == ref->type
+             ||
+             VX_TYPE_USER_DATA_OBJECT == ref->type
 #endif /* defined(OPENVX_USE_USER_DATA_OBJECT) */
-                )
-                {
-                    vx_memory_map_extra* extra = (vx_memory_map_extra*)extra_data;
-                    memory_maps[id].extra.array_data.start = extra->array_data.start;
-                    memory_maps[id].extra.array_data.end   = extra->array_data.end;
-                }
-                else if (VX_TYPE_TENSOR == ref->type)
-                {
-                    vx_memory_map_extra* extra = (vx_memory_map_extra*)extra_data;
-                    memcpy(memory_maps[id].extra.tensor_data.start,
-                           extra->tensor_data.start, sizeof(vx_size) * extra->tensor_data.number_of_dims);
-                    memcpy(memory_maps[id].extra.tensor_data.end,
-                           extra->tensor_data.end, sizeof(vx_size) * extra->tensor_data.number_of_dims);
-                    memcpy(memory_maps[id].extra.tensor_data.stride,
-                           extra->tensor_data.stride, sizeof(vx_size) * extra->tensor_data.number_of_dims);
-                    memory_maps[id].extra.tensor_data.number_of_dims = extra->tensor_data.number_of_dims;
-                }
-
-                *ptr = buf;
-                *map_id = (vx_map_id)id;
-
-                worked = vx_true_e;
+    )
+    {
+        memory_maps[id].extra.array_data.start = extra->array_data.start;
+        memory_maps[id].extra.array_data.end   = extra->array_data.end;
+    }
+    else if (VX_TYPE_TENSOR == ref->type)
+    {
+        memcpy(memory_maps[id].extra.tensor_data.start,
+               extra->tensor_data.start, sizeof(vx_size) * extra->tensor_data.number_of_dims);
+        memcpy(memory_maps[id].extra.tensor_data.end,
+               extra->tensor_data.end, sizeof(vx_size) * extra->tensor_data.number_of_dims);
+        memcpy(memory_maps[id].extra.tensor_data.stride,
+               extra->tensor_data.stride, sizeof(vx_size) * extra->tensor_data.number_of_dims);
+        memory_maps[id].extra.tensor_data.number_of_dims = extra->tensor_data.number_of_dims;
+    }
 
-                break;
-            }
-        }
+    memory_maps[id].used = vx_true_e;
 
-        /* we're done, unlock the table */
-        worked = Osal::semPost(&memory_maps_lock);
-    }
-    else
-        worked = vx_false_e;
+    *ptr = buf;
+    *map_id = (vx_map_id)id;
 
-    return worked;
+    return vx_true_e;
 } /* MemoryMap() */
 
 vx_bool Context::findMemoryMap(
@@ -895,19 +1028,12 @@ vx_bool Context::findMemoryMap(
     vx_bool worked = vx_false_e;
     vx_uint32 id = (vx_uint32)map_id;
 
-    /* check index range */
+    /* check index range; a slot only changes hands through its owner's unmap */
     if (id < dimof(memory_maps))
     {
-        /* lock the table for exclusive access */
-        if (vx_true_e == Osal::semWait(&memory_maps_lock))
+        if ((memory_maps[id].used == vx_true_e) && (memory_maps[id].ref == ref))
         {
-            if ((memory_maps[id].used == vx_true_e) && (memory_maps[id].ref == ref))
-            {
-                worked = vx_true_e;
-            }
-
-            /* unlock the table */
-            worked &= Osal::semPost(&memory_maps_lock);
+            worked = vx_true_e;
         }
     }
 
@@ -916,28 +1042,18 @@ vx_bool Context::findMemoryMap(
 
 void Context::memoryUnmap(vx_uint32 map_id)
 {
-    /* lock the table for modification */
-    if (vx_true_e == Osal::semWait(&memory_maps_lock))
+    if (map_id < dimof(memory_maps) && memory_maps[map_id].used == vx_true_e)
     {
-        if (memory_maps[map_id].used == vx_true_e)
+        if (memory_maps[map_id].ptr != nullptr)
         {
-            if (memory_maps[map_id].ptr != nullptr)
-            {
-                /* freeing mapped buffer */
-                ::operator delete(memory_maps[map_id].ptr);
-
-                memset(&memory_maps[map_id], 0, sizeof(vx_memory_map_t));
-            }
-            VX_PRINT(VX_ZONE_CONTEXT, "Removed memory mapping[%u]\n", map_id);
+            /* freeing mapped buffer */
+            memory_pool.release(memory_maps[map_id].ptr);
         }
+        memset(&memory_maps[map_id], 0, sizeof(vx_memory_map_t));
+        VX_PRINT(VX_ZONE_CONTEXT, "Removed memory mapping[%u]\n", map_id);
 
-        memory_maps[map_id].used = vx_false_e;
-
-        /* we're done, unlock the table */
-        Osal::semPost(&memory_maps_lock);
+        giveMemoryMapSlot(map_id);
     }
-    else
-        VX_PRINT(VX_ZONE_ERROR, "Osal::semWait() failed!\n");
 
     return;
 } /* MemoryUnmap() */
@@ -1428,6 +1544,16 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryContext(vx_context context, vx_enum at
                     status = VX_ERROR_INVALID_PARAMETERS;
                 }
                 break;
+            case VX_CONTEXT_CPU_VARIANT:
+                if (VX_CHECK_PARAM(ptr, size, vx_enum, 0x3))
+                {
+                    *(vx_enum *)ptr = context->cpuVariant();
+                }
+                else
+                {
+                    status = VX_ERROR_INVALID_PARAMETERS;
+                }
+                break;
             case VX_CONTEXT_UNIQUE_KERNEL_TABLE:
                 if ((size == (context->num_unique_kernels * sizeof(vx_kernel_info_t))) &&
                     (ptr != nullptr))
@@ -1672,12 +1798,15 @@ VX_API_ENTRY vx_status VX_API_CALL vxReleaseContext(vx_context *c)
                 context->opencl_context = nullptr;
             }
 #endif
-            Osal::destroyThreadpool(&context->workers);
+            /* executors finish their graph first, which still needs the node workers */
             context->proc.running = vx_false_e;
             Osal::popQueue(&context->proc.input);
-            Osal::joinThread(context->proc.thread, nullptr);
-            Osal::deinitQueue(&context->proc.output);
+            for (vx_uint32 e = 0u; e < context->proc.numThreads; e++)
+            {
+                Osal::joinThread(context->proc.threads[e], nullptr);
+            }
             Osal::deinitQueue(&context->proc.input);
+            Osal::destroyThreadpool(&context->workers);
 
             /* Deregister any log callbacks if there is any registered */
             vxRegisterLogCallback(context, nullptr, vx_false_e);
@@ -1692,7 +1821,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxReleaseContext(vx_context *c)
              *   4. This garbage collection must be done before the targets are released since some
              * of these external references may have internal references to target kernels.
              */
-            for (r = 0; r < VX_INT_MAX_REF; r++)
+            for (r = 0; r < context->reftable.size(); r++)
             {
                 vx_reference ref = context->reftable[r];
 
@@ -1767,10 +1896,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxReleaseContext(vx_context *c)
                 }
             }
 
-            Osal::destroySem(&context->memory_maps_lock);
-
             /* By now, all external and internal references should be removed */
-            for (r = 0; r < VX_INT_MAX_REF; r++)
+            for (r = 0; r < context->reftable.size(); r++)
             {
                 if (context->reftable[r])
                 {
@@ -413,12 +413,11 @@ vx_status Delay::registerAutoAging(vx_graph graph)
     vx_uint32 i;
     vx_status status = VX_SUCCESS;
     vx_bool isAlreadyRegistered = vx_false_e;
-    vx_bool isRegisteredDelaysListFull = vx_true_e;
 
     if (vxIsValidGraph(graph) == vx_false_e) return VX_ERROR_INVALID_REFERENCE;
 
     /* check if this particular delay is already registered in the graph */
-    for (i = 0; i < VX_INT_MAX_REF; i++)
+    for (i = 0; i < graph->delays.size(); i++)
     {
         if (graph->delays[i] && vxIsValidDelay(graph->delays[i]) && graph->delays[i] == this)
         {
@@ -427,21 +426,21 @@ vx_status Delay::registerAutoAging(vx_graph graph)
         }
     }
 
-    /* if not regisered yet, find the first empty slot and register delay */
+    /* if not regisered yet, reuse the slot of a released delay or add one */
     if (isAlreadyRegistered == vx_false_e)
     {
-        for (i = 0; i < VX_INT_MAX_REF; i++)
+        for (i = 0; i < graph->delays.size(); i++)
         {
             if (vxIsValidDelay(graph->delays[i]) == vx_false_e)
             {
-                isRegisteredDelaysListFull = vx_false_e;
                 graph->delays[i] = this;
                 break;
             }
         }
-
-        /* report error if there is no empty slots to register delay */
-        if (isRegisteredDelaysListFull == vx_true_e) status = VX_ERROR_INVALID_REFERENCE;
+        if (i == graph->delays.size())
+        {
+            graph->delays.push_back(this);
+        }
     }
 
     return status;
@@ -12,12 +12,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "vx_internal.h"
 #include "vx_type_pairs.h"
@@ -34,11 +36,15 @@ VX_API_ENTRY vx_status VX_API_CALL vxExportGraphToDot(vx_graph graph, vx_char do
         if (fp)
         {
             vx_uint32 n, p, n2, d;
-            vx_uint32 num_next, next_nodes[VX_INT_MAX_REF];
-            vx_uint32 num_last, last_nodes[VX_INT_MAX_REF];
-            vx_uint32 num_left, left_nodes[VX_INT_MAX_REF];
-            vx_uint32 dep_nodes[VX_INT_MAX_REF];
-            vx_reference data[VX_INT_MAX_REF];
+            /* each list holds a node at most once */
+            vx_uint32 num_next;
+            std::vector<vx_uint32> next_nodes(graph->numNodes);
+            vx_uint32 num_last;
+            std::vector<vx_uint32> last_nodes(graph->numNodes);
+            vx_uint32 num_left;
+            std::vector<vx_uint32> left_nodes(graph->numNodes);
+            std::vector<vx_uint32> dep_nodes(graph->numNodes);
+            std::vector<vx_reference> data;
             vx_uint32 num_data = 0u;
 
             status = VX_SUCCESS;
@@ -63,7 +69,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxExportGraphToDot(vx_graph graph, vx_char do
                         if (d == num_data)
                         {
                             /* new reference added to data list */
-                            data[num_data++] = node->parameters[p];
+                            data.push_back(node->parameters[p]);
+                            num_data++;
                         }
                     }
                 }
@@ -199,7 +206,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxExportGraphToDot(vx_graph graph, vx_char do
 
             graph->clearVisitation();
             graph->clearExecution();
-            memcpy(next_nodes, graph->heads, graph->numHeads * sizeof(graph->heads[0]));
+            std::copy_n(graph->heads.begin(), graph->numHeads, next_nodes.begin());
             num_next = graph->numHeads;
             num_last = 0;
             num_left = 0;
@@ -213,7 +220,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxExportGraphToDot(vx_graph graph, vx_char do
 
                     for (p = 0; p < node->kernel->signature.num_parameters; p++)
                     {
-                        vx_uint32 count = dimof(next_nodes);
+                        vx_uint32 count = graph->numNodes;
 
                         if (showData && node->kernel->signature.directions[p] == VX_INPUT)
                         {
@@ -230,7 +237,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxExportGraphToDot(vx_graph graph, vx_char do
                         {
                             status = graph->findNodesWithReference(
                                                               node->parameters[p],
-                                                              dep_nodes,
+                                                              dep_nodes.data(),
                                                               &count,
                                                               VX_INPUT);
                             /* printf("N%u has %u dep nodes on parameter[%u], %d\n", next_nodes[n], count, p, status); */
@@ -251,7 +258,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxExportGraphToDot(vx_graph graph, vx_char do
                         }
                     }
                 }
-                memcpy(last_nodes, next_nodes, num_next * sizeof(next_nodes[0]));
+                std::copy_n(next_nodes.begin(), num_next, last_nodes.begin());
                 num_last = num_next;
                 num_next = 0;
                 graph->findNextNodes(last_nodes, num_last, next_nodes, &num_next, left_nodes, &num_left);
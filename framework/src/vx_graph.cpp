@@ -16,6 +16,7 @@
 #include "vx_graph.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <queue>
 
 #include "vx_internal.h"
@@ -32,6 +33,17 @@ Graph::Graph(vx_context context, vx_reference scope)
       numNodes(0),
       heads(),
       numHeads(0),
+      successorOffsets(),
+      successors(),
+      inDegree(),
+      bottomLevel(),
+      fusedChains(),
+      inlinedGraphs(),
+      inlined(vx_false_e),
+      memorySlabs(),
+      plannedRefs(),
+      virtualBytes(0),
+      slabBytes(0),
       state(VX_FAILURE),
       verified(vx_false_e),
       reverify(vx_false_e),
@@ -39,18 +51,36 @@ Graph::Graph(vx_context context, vx_reference scope)
       parameters(),
       numParams(0),
       shouldSerialize(vx_false_e),
+      completionLock(),
+      completionCond(),
+      completedItems(),
+      dispatchPending(),
+      dispatchItems(),
+      dispatchInflight(0u),
+      dispatchStopped(false),
+      dispatchDepth(1u),
+      execLock(),
+      execDone(),
+      execQueued(0u),
+      execHeld(vx_false_e),
+      execResults(),
+      execItem(),
       parentGraph(nullptr),
       delays(),
 #ifdef OPENVX_USE_PIPELINING
       numEnqueableParams(0),
-      scheduleCount(0),
+      pipeline(),
 #endif /* OPENVX_USE_PIPELINING */
 #ifdef OPENVX_USE_STREAMING
       isStreamingEnabled(vx_false_e),
       isStreaming(vx_false_e),
       triggerNodeIndex(UINT32_MAX),
       streamingThread(),
+      streamLock(),
+      streamWake(),
+      streamStop(vx_false_e),
 #endif /* OPENVX_USE_STREAMING */
+      streamPrimed(UINT32_MAX),
       scheduleMode(VX_GRAPH_SCHEDULE_MODE_NORMAL)
 {
 }
@@ -302,7 +332,13 @@ vx_enum Graph::getState() const
 
 vx_uint32 Graph::getNumNodes() const
 {
-    return numNodes;
+    vx_uint32 count = numNodes;
+    /* inlined nodes belong to their child graphs */
+    for (vx_graph child : inlinedGraphs)
+    {
+        count -= child->numNodes;
+    }
+    return count;
 }
 
 vx_uint32 Graph::getNumParams() const
@@ -323,6 +359,10 @@ vx_status Graph::verify()
     vx_bool first_time_verify =
         ((this->verified == vx_false_e) && (this->reverify == vx_false_e)) ? vx_true_e : vx_false_e;
 
+#ifdef OPENVX_USE_PIPELINING
+    /* the frame buffers and bindings describe the graph as it was last verified */
+    this->pipelineRelease();
+#endif
     this->verified = vx_false_e;
 
     vx_uint32 h, n, p;
@@ -331,6 +371,10 @@ vx_status Graph::verify()
     /* lock the graph */
     Osal::semWait(&this->lock);
 
+    /* composite nodes rebuild their child graphs, so start from the graph as the user built it */
+    this->restoreChildGraphs();
+    this->releaseMemoryPlan();
+
     /* To properly deal with parameter dependence in the graph, the
         nodes have to be in topological order when their parameters
         are inspected and their dependent attributes -such as geometry
@@ -338,7 +382,7 @@ vx_status Graph::verify()
     VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
     VX_PRINT(VX_ZONE_GRAPH, "Topological Sort Phase\n");
     VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
-    this->topologicalSort(this->nodes, this->numNodes);
+    this->topologicalSort(this->nodes.data(), this->numNodes);
 
     VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
     VX_PRINT(VX_ZONE_GRAPH, "User Kernel Preprocess Phase! (%d)\n", status);
@@ -385,6 +429,24 @@ vx_status Graph::verify()
         }
     }
 
+    VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
+    VX_PRINT(VX_ZONE_GRAPH, "Target Selection Phase! (%d)\n", status);
+    VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
+
+    /* a target may not implement every attribute of a node, like its border mode, the node
+     * then runs on the next target down before its parameters are validated */
+    for (n = 0; n < this->numNodes; n++)
+    {
+        vx_node node = this->nodes[n];
+        vx_target target = this->context->targets[node->affinity];
+        if (target && target->funcs.verify(target, node) == VX_ERROR_NOT_SUPPORTED &&
+            node->fallBackTarget() != VX_SUCCESS)
+        {
+            VX_PRINT(VX_ZONE_WARNING, "No target below %s implements node %s as configured\n",
+                     target->name, node->kernel->name);
+        }
+    }
+
     VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
     VX_PRINT(VX_ZONE_GRAPH, "Parameter Validation Phase! (%d)\n", status);
     VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
@@ -653,7 +715,11 @@ vx_status Graph::verify()
                          this->nodes[n]->parameters[p], this->nodes[n]->parameters[p]->type,
                          this->nodes[n]->kernel->signature.types[p]);
 
-                if (this->nodes[n]->parameters[p]->type == VX_TYPE_IMAGE)
+                if (this->defersAllocation(this->nodes[n]->parameters[p]) == vx_true_e)
+                {
+                    /* placed by the memory planning phase */
+                }
+                else if (this->nodes[n]->parameters[p]->type == VX_TYPE_IMAGE)
                 {
                     if (static_cast<vx_image>(this->nodes[n]->parameters[p])->allocateImage() ==
                         vx_false_e)
@@ -742,7 +808,7 @@ vx_status Graph::verify()
     VX_PRINT(VX_ZONE_GRAPH, "Head Nodes Determination Phase! (%d)\n", status);
     VX_PRINT(VX_ZONE_GRAPH, "###############################\n");
 
-    memset(this->heads, 0, sizeof(this->heads));
+    this->heads.clear();
     this->numHeads = 0;
 
     /* now traverse the graph and put nodes with no predecessor in the head list */
@@ -801,7 +867,8 @@ vx_status Graph::verify()
         {
             VX_PRINT(VX_ZONE_GRAPH, "Found a head in node[%u] => %s\n", n,
                      this->nodes[n]->kernel->name);
-            this->heads[this->numHeads++] = n;
+            this->heads.push_back(n);
+            this->numHeads++;
         }
     }
 
@@ -860,6 +927,15 @@ vx_status Graph::verify()
         goto exit;
     }
 
+    VX_PRINT(VX_ZONE_GRAPH, "##########################\n");
+    VX_PRINT(VX_ZONE_GRAPH, "Dependency Table Phase (%d)\n", status);
+    VX_PRINT(VX_ZONE_GRAPH, "##########################\n");
+
+    if (status == VX_SUCCESS)
+    {
+        this->computeDependencies();
+    }
+
     VX_PRINT(VX_ZONE_GRAPH, "#########################\n");
     VX_PRINT(VX_ZONE_GRAPH, "Target Verification Phase (%d)\n", status);
     VX_PRINT(VX_ZONE_GRAPH, "#########################\n");
@@ -926,6 +1002,22 @@ vx_status Graph::verify()
         }
     }
 
+    VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
+    VX_PRINT(VX_ZONE_GRAPH, "Child Graph Inlining Phase (%d)\n", status);
+    VX_PRINT(VX_ZONE_GRAPH, "###########################\n");
+    if (status == VX_SUCCESS)
+    {
+        this->inlineChildGraphs();
+    }
+
+    VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
+    VX_PRINT(VX_ZONE_GRAPH, "Memory Planning Phase (%d)\n", status);
+    VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
+    if (status == VX_SUCCESS)
+    {
+        this->planMemory();
+    }
+
     VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
     VX_PRINT(VX_ZONE_GRAPH, "COST CALCULATIONS (%d)\n", status);
     VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
@@ -981,6 +1073,22 @@ vx_status Graph::verify()
                  this->nodes[n]->costs.bandwidth);
     }
 
+    VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
+    VX_PRINT(VX_ZONE_GRAPH, "NODE FUSION (%d)\n", status);
+    VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
+    if (status == VX_SUCCESS)
+    {
+        this->fuseNodes();
+    }
+
+    VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
+    VX_PRINT(VX_ZONE_GRAPH, "CRITICAL PATH (%d)\n", status);
+    VX_PRINT(VX_ZONE_GRAPH, "#######################\n");
+    if (status == VX_SUCCESS)
+    {
+        this->computePriorities();
+    }
+
 exit:
     this->reverify = vx_false_e;
     if (status == VX_SUCCESS)
@@ -1001,20 +1109,344 @@ exit:
     return status;
 }
 
+void Graph::setVirtualAccess(vx_node node, vx_bool accessible)
+{
+    for (vx_uint32 p = 0u; p < node->kernel->signature.num_parameters; p++)
+    {
+        if (node->parameters[p] == nullptr) continue;
+        if (node->parameters[p]->is_virtual == vx_true_e)
+        {
+            node->parameters[p]->is_accessible = accessible;
+        }
+    }
+}
+
+vx_action Graph::executeNode(vx_node node, vx_uint32 max_pipeup_depth)
+{
+    vx_action action = VX_ACTION_CONTINUE;
+    vx_target target = this->context->targets[node->affinity];
+
+    /* the nodes of an inlined child graph ran in this graph, the composite node only completes */
+    if (node->child != nullptr && node->child->inlined == vx_true_e)
+    {
+        vx_graph child = node->child;
+        node->status = VX_SUCCESS;
+        if (this->context->perf_enabled)
+        {
+            Osal::startCapture(&node->perf);
+        }
+        for (vx_uint32 i = 0; i < child->numNodes; i++)
+        {
+            if (child->nodes[i]->status != VX_SUCCESS)
+            {
+                node->status = child->nodes[i]->status;
+            }
+            if (this->context->perf_enabled && child->nodes[i]->perf.beg < node->perf.beg)
+            {
+                node->perf.beg = child->nodes[i]->perf.beg;
+            }
+        }
+        node->executed = vx_true_e;
+        if (this->context->perf_enabled)
+        {
+            Osal::stopCapture(&node->perf);
+        }
+        if (node->status != VX_SUCCESS)
+        {
+            return VX_ACTION_ABANDON;
+        }
+        return node->callback ? node->callback(node) : VX_ACTION_CONTINUE;
+    }
+
+    /* pipelined frames rebind every node, so chains only run fused outside of them */
+    if (node->fused_chain >= 0
+#ifdef OPENVX_USE_PIPELINING
+        && this->pipelineEnabled() == vx_false_e
+#endif
+    )
+    {
+        return this->executeFused(node);
+    }
+
+    /* Check for pipeup phase:
+     * If this is the first time we are executing the graph, we need to pipeup
+     * all nodes with kernels in the graph that need pipeup of refs.
+     */
+    if (node->kernel->pipeUpCounter < max_pipeup_depth - 1)
+    {
+        node->state = VX_NODE_STATE_PIPEUP;
+        VX_PRINT(VX_ZONE_GRAPH, "Piping up node %s to depth %u\n", node->kernel->name, max_pipeup_depth);
+        node->kernel->pipeUpCounter++;
+        // Retain input buffers during PIPEUP
+        for (vx_uint32 i = 0; i < node->kernel->output_depth - 1; i++)
+        {
+            action = target->funcs.process(target, &node, 0, 1);
+            node->kernel->pipeUpCounter++;
+        }
+        // For source nodes, provide new output buffers during PIPEUP
+        for (vx_uint32 i = 0; i < node->kernel->input_depth - 1; i++)
+        {
+            action = target->funcs.process(target, &node, 0, 1);
+            node->kernel->pipeUpCounter++;
+        }
+    }
+
+    /* If this node was in pipeup, update its state */
+    node->state = VX_NODE_STATE_STEADY;
+
+    action = target->funcs.process(target, &node, 0, 1);
+
+    return action;
+}
+
+void Graph::completeNode(vx_node node, vx_action action, const vx_reference* frameRefs)
+{
+#ifdef OPENVX_USE_PIPELINING
+    /* Raise a node completed event, inlined nodes are not visible to the user. */
+    vx_event_info_t event_info;
+    event_info.node_completed.graph = this;
+    event_info.node_completed.node = node;
+    if (this->context->event_queue.isEnabled() && node->inlined_into == nullptr &&
+        VX_SUCCESS != this->context->event_queue.push(VX_EVENT_NODE_COMPLETED, 0, &event_info,
+                                                      (vx_reference)node))
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Failed to push node completed event for node %s\n",
+                 node->kernel->name);
+    }
+
+    /* Raise a graph parameter consumed event */
+    for (vx_uint32 gp = 0; gp < this->numEnqueableParams; gp++)
+    {
+        vx_node param_node = this->parameters[gp].node;
+        vx_uint32 param_index = this->parameters[gp].index;
+
+        /* If this node just executed and consumed a graph parameter */
+        if (param_node == node)
+        {
+            vx_event_info_t event_info = {};
+            event_info.graph_parameter_consumed.graph = this;
+            event_info.graph_parameter_consumed.graph_parameter_index = param_index;
+
+            /* a pipelined frame took its reference out of the ready queue when it started */
+            if (frameRefs)
+                (void)this->parameters[gp].queue.enqueueDone(frameRefs[gp]);
+            else
+                (void)this->parameters[gp].queue.moveReadyToDone();
+
+            if (this->context->event_queue.isEnabled() &&
+                param_node->kernel->signature.directions[param_index] == VX_INPUT &&
+                VX_SUCCESS != this->context->event_queue.push(VX_EVENT_GRAPH_PARAMETER_CONSUMED,
+                                                              0, &event_info, (vx_reference)this))
+            {
+                VX_PRINT(VX_ZONE_ERROR,
+                         "Failed to push graph parameter consumed event for "
+                         "graph %p, param %u\n",
+                         this, gp);
+            }
+        }
+    }
+
+    if (action == VX_ACTION_ABANDON)
+    {
+        /* Raise a node error event. */
+        vx_event_info_t event_info;
+        event_info.node_error.graph = this;
+        event_info.node_error.node = node;
+        event_info.node_error.status = node->status;
+        if (this->context->event_queue.isEnabled() &&
+            VX_SUCCESS != this->context->event_queue.push(VX_EVENT_NODE_ERROR, 0, &event_info,
+                                                          (vx_reference)node))
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Failed to push node error event for node %s\n",
+                     node->kernel->name);
+        }
+    }
+#else
+    (void)node;
+    (void)action;
+    (void)frameRefs;
+#endif
+}
+
+vx_bool Graph::issueNode(vx_uint32 index)
+{
+    vx_node node = this->nodes[index];
+    vx_target target = this->context->targets[node->affinity];
+    vx_value_set_t* work = &this->dispatchItems[index];
+
+    Node::printNode(node);
+    work->v1 = (vx_value_t)target;
+    work->v2 = (vx_value_t)node;
+    work->v3 = (vx_value_t)this->dispatchDepth;
+    node->visited = vx_true_e;
+
+    VX_PRINT(VX_ZONE_GRAPH, "Scheduling work on %s for %s\n", target->name, node->kernel->name);
+    this->dispatchInflight++;
+    if (Osal::issueThreadpool(this->context->workers, work, 1) == vx_false_e)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Failed to issue node[%u] %s to the workers!\n", index,
+                 node->kernel->name);
+        this->dispatchInflight--;
+        this->dispatchStopped = true;
+        return vx_false_e;
+    }
+    return vx_true_e;
+}
+
+void Graph::notifyNodeCompleted(vx_value_set_t* workitem)
+{
+#ifdef OPENVX_USE_PIPELINING
+    if (this->pipelineCompleted(workitem) == vx_true_e)
+    {
+        return;
+    }
+#endif
+
+    vx_action action = (vx_action)workitem->v3;
+    vx_uint32 n = (vx_uint32)(workitem - this->dispatchItems.data());
+
+    if (action != VX_ACTION_CONTINUE)
+    {
+        this->dispatchStopped = true;
+    }
+
+    /* consumers are issued before this item is handed back, so the dispatcher never sees
+     * the in-flight count drop to zero while work is still being spawned */
+    std::vector<vx_uint32> released;
+    for (vx_uint32 i = this->successorOffsets[n]; i < this->successorOffsets[n + 1]; i++)
+    {
+        vx_uint32 s = this->successors[i];
+        if (--this->dispatchPending[s] == 0)
+        {
+            released.push_back(s);
+        }
+    }
+    /* this worker pops its own deque newest first, so the longest chain goes in last and
+     * stays here, while the shorter ones are left for thieves */
+    std::sort(released.begin(), released.end(),
+              [this](vx_uint32 a, vx_uint32 b) { return this->runsBefore(b, a) == vx_true_e; });
+    for (vx_uint32 s : released)
+    {
+        if (this->dispatchStopped.load() == false)
+        {
+            this->issueNode(s);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(completionLock);
+        completedItems.push_back(workitem);
+    }
+    completionCond.notify_one();
+}
+
+vx_action Graph::dispatchNodes()
+{
+    vx_action action = VX_ACTION_CONTINUE;
+    vx_uint32 n;
+    std::vector<vx_uint32> heads;
+    std::vector<vx_value_set_t*> retired;
+
+    this->dispatchPending = std::vector<std::atomic<vx_uint32>>(this->numNodes);
+    this->dispatchItems.assign(this->numNodes, vx_value_set_t{});
+    this->dispatchInflight = 0u;
+    this->dispatchStopped = false;
+    this->dispatchDepth = 1u;
+    for (n = 0; n < this->numNodes; n++)
+    {
+        this->dispatchPending[n] = this->inDegree[n];
+        this->dispatchDepth = std::max({this->dispatchDepth, this->nodes[n]->kernel->input_depth,
+                                        this->nodes[n]->kernel->output_depth});
+    }
+
+    /* consumers of the same virtual reference may run concurrently, so access is
+     * granted for the whole execution rather than toggled per node. */
+    for (n = 0; n < this->numNodes; n++)
+    {
+        Graph::setVirtualAccess(this->nodes[n], vx_true_e);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(completionLock);
+        completedItems.clear();
+    }
+
+    /* only the heads are issued from here, everything else is issued by the worker which
+     * finished the node's last producer */
+    for (n = 0; n < this->numNodes; n++)
+    {
+        if (this->inDegree[n] == 0 && n != this->streamPrimed)
+        {
+            heads.push_back(n);
+        }
+    }
+    /* the streaming thread already ran the trigger node, so its consumers start right away */
+    if (this->streamPrimed < this->numNodes)
+    {
+        for (vx_uint32 i = this->successorOffsets[this->streamPrimed];
+             i < this->successorOffsets[this->streamPrimed + 1]; i++)
+        {
+            if (--this->dispatchPending[this->successors[i]] == 0)
+            {
+                heads.push_back(this->successors[i]);
+            }
+        }
+    }
+    /* the shared queue is FIFO, so the longest chains go in first */
+    std::sort(heads.begin(), heads.end(),
+              [this](vx_uint32 a, vx_uint32 b) { return this->runsBefore(a, b) == vx_true_e; });
+    for (vx_uint32 h : heads)
+    {
+        if (this->dispatchStopped.load() == true)
+        {
+            break;
+        }
+        if (this->issueNode(h) == vx_false_e)
+        {
+            action = VX_ACTION_ABANDON;
+        }
+    }
+
+    while (this->dispatchInflight.load() > 0)
+    {
+        /* wait for at least one in-flight node to finish */
+        {
+            std::unique_lock<std::mutex> guard(completionLock);
+            completionCond.wait(guard, [this] { return !completedItems.empty(); });
+            retired.swap(completedItems);
+        }
+
+        for (vx_value_set_t* work : retired)
+        {
+            vx_action a = (vx_action)work->v3;
+            vx_node node = (vx_node)work->v2;
+
+            VX_PRINT(VX_ZONE_GRAPH, "Returned Node %s Action %d\n", node->kernel->name, a);
+            this->completeNode(node, a);
+            if (a != VX_ACTION_CONTINUE)
+            {
+                VX_PRINT(VX_ZONE_WARNING, "Node %s returned action code %d\n", node->kernel->name, a);
+                action = a;
+            }
+            this->dispatchInflight--;
+        }
+        retired.clear();
+    }
+
+    for (n = 0; n < this->numNodes; n++)
+    {
+        Graph::setVirtualAccess(this->nodes[n], vx_false_e);
+    }
+
+    return action;
+}
+
 vx_status Graph::executeGraph(vx_uint32 depth)
 {
     vx_status status = VX_SUCCESS;
     vx_action action = VX_ACTION_CONTINUE;
-    vx_uint32 n, p, numLast, numNext, numLeft = 0;
-    vx_uint32 last_nodes[VX_INT_MAX_REF];
-    vx_uint32 next_nodes[VX_INT_MAX_REF];
-    vx_uint32 left_nodes[VX_INT_MAX_REF];
+    vx_uint32 n;
     vx_uint32 max_pipeup_depth = 1;
-    (void)depth;
-
-#if defined(OPENVX_USE_SMP)
-    vx_value_set_t workitems[VX_INT_MAX_REF];
-#endif
 
 #ifdef OPENVX_USE_PIPELINING
     // Dequeue graph parameters if pipelining is enabled
@@ -1083,216 +1515,99 @@ vx_status Graph::executeGraph(vx_uint32 depth)
     this->state = VX_GRAPH_STATE_RUNNING;
     this->clearVisitation();
     this->clearExecution();
+    if (this->streamPrimed < this->numNodes)
+    {
+        this->nodes[this->streamPrimed]->executed = vx_true_e;
+    }
     if (context->perf_enabled)
     {
         Osal::startCapture(&this->perf);
     }
 
-    /* initialize the next_nodes as the graph heads */
-    memcpy(next_nodes, this->heads, this->numHeads * sizeof(vx_uint32));
-    numNext = this->numHeads;
-
-    do
+#if defined(OPENVX_USE_SMP)
+    /* nested executions (child graphs, immediate mode from inside a kernel) already
+     * run on a worker, so only the outermost execution dispatches to the pool. */
+    if (depth == 1 && this->shouldSerialize == vx_false_e && this->context->workers &&
+        this->context->workers->numWorkers > 0)
+    {
+        action = this->dispatchNodes();
+    }
+    else
+#endif
     {
-        for (n = 0; n < numNext; n++)
+        std::vector<vx_uint32> pending(this->inDegree);
+        auto later = [this](vx_uint32 a, vx_uint32 b) { return this->runsBefore(b, a) == vx_true_e; };
+        std::priority_queue<vx_uint32, std::vector<vx_uint32>, decltype(later)> ready(later);
+
+        for (n = 0; n < this->numNodes; n++)
         {
-            Node::printNode(this->nodes[next_nodes[n]]);
+            if (pending[n] == 0 && n != this->streamPrimed)
+            {
+                ready.push(n);
+            }
         }
-
-        /* execute the next nodes */
-        for (n = 0; n < numNext; n++)
+        /* the streaming thread already ran the trigger node, only its consumers are left */
+        if (this->streamPrimed < this->numNodes)
         {
-            if (this->nodes[next_nodes[n]]->executed == vx_false_e)
+            for (vx_uint32 i = this->successorOffsets[this->streamPrimed];
+                 i < this->successorOffsets[this->streamPrimed + 1]; i++)
             {
-                vx_uint32 t = this->nodes[next_nodes[n]]->affinity;
-#if defined(OPENVX_USE_SMP)
-                if (depth == 1 && this->shouldSerialize == vx_false_e)
+                if (--pending[this->successors[i]] == 0)
                 {
-                    vx_value_set_t* work = &workitems[n];
-                    vx_target target = this->context->targets[t];
-                    vx_node node = this->nodes[next_nodes[n]];
-                    work->v1 = (vx_value_t)target;
-                    work->v2 = (vx_value_t)node;
-                    work->v3 = (vx_value_t)VX_ACTION_CONTINUE;
-                    VX_PRINT(VX_ZONE_GRAPH, "Scheduling work on %s for %s\n", target->name,
-                             node->kernel->name);
+                    ready.push(this->successors[i]);
                 }
-                else
-#endif
-                {
-                    vx_target target = this->context->targets[t];
-                    vx_node node = this->nodes[next_nodes[n]];
-
-                    /* turn on access to virtual memory */
-                    for (p = 0u; p < node->kernel->signature.num_parameters; p++)
-                    {
-                        if (node->parameters[p] == nullptr) continue;
-                        if (node->parameters[p]->is_virtual == vx_true_e)
-                        {
-                            node->parameters[p]->is_accessible = vx_true_e;
-                        }
-                    }
-
-                    VX_PRINT(VX_ZONE_GRAPH, "Calling Node[%u] %s:%s\n", next_nodes[n], target->name,
-                             node->kernel->name);
-
-                    /* Check for pipeup phase:
-                     * If this is the first time we are executing the graph, we need to pipeup
-                     * all nodes with kernels in the graph that need pipeup of refs.
-                     */
-                    max_pipeup_depth = std::max(
-                        {max_pipeup_depth, node->kernel->input_depth, node->kernel->output_depth});
-                    if (node->kernel->pipeUpCounter < max_pipeup_depth - 1)
-                    {
-                        node->state = VX_NODE_STATE_PIPEUP;
-                        std::cout << "max_pipeup_depth: " << max_pipeup_depth << std::endl;
-                        node->kernel->pipeUpCounter++;
-                        // Retain input buffers during PIPEUP
-                        for (vx_uint32 i = 0; i < node->kernel->output_depth - 1; i++)
-                        {
-                            action = target->funcs.process(target, &node, 0, 1);
-                            node->kernel->pipeUpCounter++;
-                        }
-                        // For source nodes, provide new output buffers during PIPEUP
-                        for (vx_uint32 i = 0; i < node->kernel->input_depth - 1; i++)
-                        {
-                            action = target->funcs.process(target, &node, 0, 1);
-                            node->kernel->pipeUpCounter++;
-                        }
-                    }
+            }
+        }
 
-                    /* If this node was in pipeup, update its state */
-                    node->state = VX_NODE_STATE_STEADY;
+        while (!ready.empty())
+        {
+            vx_uint32 index = ready.top();
+            vx_node node = this->nodes[index];
+            vx_target target = this->context->targets[node->affinity];
+            ready.pop();
 
-                    action = target->funcs.process(target, &node, 0, 1);
+            if (node->executed == vx_true_e)
+            {
+                VX_PRINT(VX_ZONE_ERROR, "Multiple executions attempted!\n");
+                break;
+            }
 
-                    VX_PRINT(VX_ZONE_GRAPH, "Returned Node[%u] %s:%s Action %d\n", next_nodes[n],
-                             target->name, node->kernel->name, action);
+            Node::printNode(node);
 
-                    /* turn off access to virtual memory */
-                    for (p = 0u; p < node->kernel->signature.num_parameters; p++)
-                    {
-                        if (node->parameters[p] == nullptr)
-                        {
-                            continue;
-                        }
-                        if (node->parameters[p]->is_virtual == vx_true_e)
-                        {
-                            node->parameters[p]->is_accessible = vx_false_e;
-                        }
-                    }
+            /* turn on access to virtual memory */
+            Graph::setVirtualAccess(node, vx_true_e);
 
-#ifdef OPENVX_USE_PIPELINING
-                    /* Raise a node completed event. */
-                    vx_event_info_t event_info;
-                    event_info.node_completed.graph = this;
-                    event_info.node_completed.node = node;
-                    if (this->context->event_queue.isEnabled() &&
-                        VX_SUCCESS != this->context->event_queue.push(VX_EVENT_NODE_COMPLETED, 0,
-                                                                      &event_info,
-                                                                      (vx_reference)node))
-                    {
-                        VX_PRINT(VX_ZONE_ERROR, "Failed to push node completed event for node %s\n",
-                                 node->kernel->name);
-                    }
+            VX_PRINT(VX_ZONE_GRAPH, "Calling Node[%u] %s:%s\n", index, target->name,
+                     node->kernel->name);
 
-                    /* Raise a graph parameter consumed event */
-                    for (vx_uint32 gp = 0; gp < this->numEnqueableParams; gp++)
-                    {
-                        vx_node param_node = this->parameters[gp].node;
-                        vx_uint32 param_index = this->parameters[gp].index;
+            max_pipeup_depth = std::max(
+                {max_pipeup_depth, node->kernel->input_depth, node->kernel->output_depth});
+            action = this->executeNode(node, max_pipeup_depth);
 
-                        /* If this node just executed and consumed a graph parameter */
-                        if (param_node == node)
-                        {
-                            vx_event_info_t event_info = {};
-                            event_info.graph_parameter_consumed.graph = this;
-                            event_info.graph_parameter_consumed.graph_parameter_index = param_index;
+            VX_PRINT(VX_ZONE_GRAPH, "Returned Node[%u] %s:%s Action %d\n", index, target->name,
+                     node->kernel->name, action);
 
-                            (void)this->parameters[gp].queue.moveReadyToDone();
+            /* turn off access to virtual memory */
+            Graph::setVirtualAccess(node, vx_false_e);
 
-                            if (this->context->event_queue.isEnabled() &&
-                                param_node->kernel->signature.directions[param_index] == VX_INPUT &&
-                                VX_SUCCESS != this->context->event_queue.push(
-                                                  VX_EVENT_GRAPH_PARAMETER_CONSUMED, 0, &event_info,
-                                                  (vx_reference)this))
-                            {
-                                VX_PRINT(VX_ZONE_ERROR,
-                                         "Failed to push graph parameter consumed event for "
-                                         "graph %p, param %u\n",
-                                         this, gp);
-                            }
-                        }
-                    }
-#endif
+            this->completeNode(node, action);
 
-                    if (action == VX_ACTION_ABANDON)
-                    {
-#ifdef OPENVX_USE_PIPELINING
-                        /* Raise a node error event. */
-                        vx_event_info_t event_info;
-                        event_info.node_error.graph = this;
-                        event_info.node_error.node = node;
-                        event_info.node_error.status = node->status;
-                        if (this->context->event_queue.isEnabled() &&
-                            VX_SUCCESS != this->context->event_queue.push(VX_EVENT_NODE_ERROR, 0,
-                                                                          &event_info,
-                                                                          (vx_reference)node))
-                        {
-                            VX_PRINT(VX_ZONE_ERROR, "Failed to push node error event for node %s\n",
-                                     node->kernel->name);
-                        }
-#endif
-                        break;
-                    }
-                }
-            }
-            else
+            if (action == VX_ACTION_ABANDON)
             {
-                VX_PRINT(VX_ZONE_ERROR, "Multiple executions attempted!\n");
                 break;
             }
-        }
 
-#if defined(OPENVX_USE_SMP)
-        if (depth == 1 && this->shouldSerialize == vx_false_e)
-        {
-            if (Osal::issueThreadpool(this->context->workers, workitems, numNext) == vx_true_e)
+            /* release the consumers whose last producer just finished */
+            for (vx_uint32 i = this->successorOffsets[index]; i < this->successorOffsets[index + 1];
+                 i++)
             {
-                /* do a blocking complete */
-                VX_PRINT(VX_ZONE_GRAPH, "Issued %u work items!\n", numNext);
-                if (Osal::completeThreadpool(this->context->workers, vx_true_e) == vx_true_e)
-                {
-                    VX_PRINT(VX_ZONE_GRAPH, "Processed %u items in threadpool!\n", numNext);
-                }
-                action = VX_ACTION_CONTINUE;
-                for (n = 0; n < numNext; n++)
+                if (--pending[this->successors[i]] == 0)
                 {
-                    vx_action a = workitems[n].v3;
-                    if (a != VX_ACTION_CONTINUE)
-                    {
-                        action = a;
-                        VX_PRINT(VX_ZONE_WARNING, "Workitem[%u] returned action code %d\n", n, a);
-                        break;
-                    }
+                    ready.push(this->successors[i]);
                 }
             }
         }
-#endif
-
-        if (action == VX_ACTION_ABANDON)
-        {
-            break;
-        }
-
-        /* copy next_nodes to last_nodes */
-        memcpy(last_nodes, next_nodes, numNext * sizeof(vx_uint32));
-        numLast = numNext;
-
-        /* determine the next nodes */
-        this->findNextNodes(last_nodes, numLast, next_nodes, &numNext, left_nodes, &numLeft);
-
-    } while (numNext > 0);
+    }
 
     if (action == VX_ACTION_ABANDON)
     {
@@ -1304,13 +1619,13 @@ vx_status Graph::executeGraph(vx_uint32 depth)
     }
     this->clearVisitation();
 
-    for (n = 0; n < VX_INT_MAX_REF; n++)
+    for (vx_delay delay : this->delays)
     {
-        if (this->delays[n] &&
-            Reference::isValidReference(reinterpret_cast<vx_reference>(this->delays[n]),
+        if (delay &&
+            Reference::isValidReference(reinterpret_cast<vx_reference>(delay),
                                         VX_TYPE_DELAY) == vx_true_e)
         {
-            vxAgeDelay(this->delays[n]);
+            vxAgeDelay(delay);
         }
     }
 
@@ -1355,7 +1670,7 @@ vx_status Graph::executeGraph(vx_uint32 depth)
     return status;
 }
 
-vx_status Graph::schedule()
+vx_status Graph::schedule(vx_uint32 frames)
 {
     vx_status status = VX_SUCCESS;
 
@@ -1369,8 +1684,13 @@ vx_status Graph::schedule()
     }
 
 #ifdef OPENVX_USE_PIPELINING
+    if (this->pipelineEnabled() == vx_true_e)
+    {
+        return this->pipelineSubmit(frames);
+    }
+
     vx_uint32 numParams = std::min(this->numParams, numEnqueableParams);
-    vx_size batch_depth = 1u;
+    vx_size batch_depth = frames;
     if (scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_MANUAL)
     {
         batch_depth = UINT32_MAX;  // Use UINT32_MAX to indicate no limit on batch depth
@@ -1388,129 +1708,78 @@ vx_status Graph::schedule()
 
     for (vx_uint32 i = 0; i < batch_depth; i++)
 #endif
-    // if (Osal::semTryWait(&lock) == vx_true_e)
     {
-        Osal::semTryWait(&lock);
-        vx_sem_t* p_graph_queue_lock = context->p_global_lock;
-        vx_uint32 q = 0u;
-        vx_value_set_t* pq = nullptr;
-
-        Osal::semWait(p_graph_queue_lock);
-        /* acquire a position in the graph queue */
-        for (q = 0; q < dimof(context->graph_queue); q++)
+        vx_bool running = vx_false_e;
         {
-            if (context->graph_queue[q].v1 == 0)
+            std::lock_guard<std::mutex> guard(execLock);
+            if (execQueued == 0 && execHeld == vx_false_e)
             {
-                pq = &context->graph_queue[q];
-                context->numGraphsQueued++;
-                break;
+                execHeld = Osal::semTryWait(&lock);
             }
+            /* an executor already running this graph picks the execution up when done */
+            running = (execQueued++ > 0) ? vx_true_e : vx_false_e;
         }
-        Osal::semPost(p_graph_queue_lock);
-        if (pq)
-        {
-            memset(pq, 0, sizeof(vx_value_set_t));
-            pq->v1 = (vx_value_t)this;
 
-#ifdef OPENVX_USE_PIPELINING
-            /* Increment the schedule count */
-            scheduleCount++;
-#endif
+        if (running == vx_false_e)
+        {
+            execItem.v1 = (vx_value_t)this;
             /* now add the graph to the queue */
             VX_PRINT(VX_ZONE_GRAPH, "Writing graph=" VX_FMT_REF ", status=%d\n", this, status);
-            if (Osal::writeQueue(&context->proc.input, pq) == vx_true_e)
+            if (Osal::writeQueue(&context->proc.input, &execItem) == vx_false_e)
             {
-                status = VX_SUCCESS;
-            }
-            else
-            {
-                Osal::semPost(&lock);
+                std::lock_guard<std::mutex> guard(execLock);
                 VX_PRINT(VX_ZONE_ERROR, "Failed to write graph to queue");
+                execQueued = 0;
+                if (execHeld == vx_true_e)
+                {
+                    execHeld = vx_false_e;
+                    Osal::semPost(&lock);
+                }
                 status = VX_ERROR_NO_RESOURCES;
             }
         }
-        else
-        {
-            VX_PRINT(VX_ZONE_ERROR, "Graph queue is full\n");
-            status = VX_ERROR_NO_RESOURCES;
-        }
     }
-    // else
-    // {
-    //     /* graph is already scheduled */
-    //     VX_PRINT(VX_ZONE_WARNING, "Graph is already scheduled!\n");
-    //     // status = VX_ERROR_GRAPH_SCHEDULED;
-    // }
 
     return status;
 }
 
+vx_bool Graph::retireExecution(vx_status status)
+{
+    std::lock_guard<std::mutex> guard(execLock);
+
+    execResults.push_back(status);
+    execQueued--;
+    execDone.notify_all();
+
+    return (execQueued > 0) ? vx_true_e : vx_false_e;
+}
+
 vx_status Graph::wait()
 {
     vx_status status = VX_SUCCESS;
 
-    if (Osal::semTryWait(&lock) == vx_false_e ||
-        scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_MANUAL) /* locked */
-    {
-        vx_sem_t* p_graph_queue_lock = context->p_global_lock;
-        vx_graph g2;
-        vx_bool ret = vx_true_e;
-        vx_value_set_t* data = nullptr;
-        do
-        {
-            ret = Osal::readQueue(&context->proc.output, &data);
-            if (ret == vx_false_e)
-            {
-                /* graph was locked but the queue was empty... */
-                VX_PRINT(VX_ZONE_ERROR, "Queue was empty but graph was locked.\n");
-                status = VX_FAILURE;
-            }
-            else
-            {
-                g2 = (vx_graph)data->v1;
-                status = (vx_status)data->v2;
-                if (g2 == this) /* great, it's the graph we want. */
-                {
-                    vx_uint32 q = 0u;
-                    Osal::semWait(p_graph_queue_lock);
-                    /* find graph in the graph queue */
-                    for (q = 0; q < dimof(context->graph_queue); q++)
-                    {
-                        if (context->graph_queue[q].v1 == (vx_value_t)this)
-                        {
-                            context->graph_queue[q].v1 = 0;
-                            context->numGraphsQueued--;
-                            break;
-                        }
-                    }
-                    Osal::semPost(p_graph_queue_lock);
-
 #ifdef OPENVX_USE_PIPELINING
-                    /* Decrement the schedule count */
-                    scheduleCount--;
-                    /* Unlock the graph only if all scheduled executions are completed */
-                    if (scheduleCount == 0)
-                    {
-                        Osal::semPost(&lock);
-                        break;
-                    }
-#else
-                    break;
+    if (this->pipeline.configured == vx_true_e)
+    {
+        return this->pipelineDrain();
+    }
 #endif
-                }
-                else
-                {
-                    /* not the right graph, put it back. */
-                    Osal::writeQueue(&context->proc.output, data);
-                }
-            }
-        } while (ret == vx_true_e);
-        Osal::semPost(&lock); /* unlock the graph. */
+
+    std::unique_lock<std::mutex> guard(execLock);
+    /* only this graph's executions are waited on, other graphs keep running */
+    execDone.wait(guard, [this] { return execQueued == 0; });
+    while (!execResults.empty())
+    {
+        if (status == VX_SUCCESS)
+        {
+            status = execResults.front();
+        }
+        execResults.pop_front();
     }
-    else
+    if (execHeld == vx_true_e)
     {
-        // status = VX_FAILURE;
-        Osal::semPost(&lock); /* was free, release */
+        execHeld = vx_false_e;
+        Osal::semPost(&lock); /* unlock the graph. */
     }
 
     return status;
@@ -1520,17 +1789,14 @@ vx_status Graph::process()
 {
     vx_status status = VX_SUCCESS;
 
-    /* create a counter for re-entrancy checking */
-    static vx_uint32 count = 0;
-    vx_sem_t* p_sem = context->p_global_lock;
+    /* create a counter for re-entrancy checking. It is per thread, so graphs run by different
+     * executors do not see each other; a graph processed from inside a node runs on a pool
+     * worker and counts as nested, since it must not wait on the pool it occupies. */
+    static thread_local vx_uint32 count = 0;
 
-    Osal::semWait(p_sem);
     count++;
-    Osal::semPost(p_sem);
-    status = executeGraph(count);
-    Osal::semWait(p_sem);
+    status = executeGraph(count + (Osal::isThreadpoolWorker() == vx_true_e ? 1u : 0u));
     count--;
-    Osal::semPost(p_sem);
 
     return status;
 }
@@ -1651,12 +1917,19 @@ vx_status Graph::findNodesWithReference(
 }
 
 void Graph::findNextNodes(
-                     vx_uint32 last_nodes[VX_INT_MAX_REF], vx_uint32 numLast,
-                     vx_uint32 next_nodes[VX_INT_MAX_REF], vx_uint32 *numNext,
-                     vx_uint32 left_nodes[VX_INT_MAX_REF], vx_uint32 *numLeft)
+                     const std::vector<vx_uint32>& last_nodes, vx_uint32 numLast,
+                     std::vector<vx_uint32>& next_nodes, vx_uint32 *numNext,
+                     std::vector<vx_uint32>& left_nodes, vx_uint32 *numLeft)
 {
-    vx_uint32 poss_next[VX_INT_MAX_REF];
+    /* a node is only added once, so the lists never outgrow the graph */
+    std::vector<vx_uint32> poss_next(numNodes);
+    std::vector<vx_uint32> found(numNodes);
+    std::vector<vx_uint32> predicate_nodes(numNodes);
     vx_uint32 i,n,p,n1,numPoss = 0;
+    auto possible = [&](vx_uint32 node) {
+        return std::find(poss_next.begin(), poss_next.begin() + numPoss, node) !=
+               poss_next.begin() + numPoss;
+    };
 
     VX_PRINT(VX_ZONE_GRAPH, "Entering with %u left nodes\n", *numLeft);
     for (n = 0; n < *numLeft; n++)
@@ -1677,12 +1950,17 @@ void Graph::findNextNodes(
             vx_reference ref =  nodes[n]->parameters[p];
             if (((dir == VX_OUTPUT) || (dir == VX_BIDIRECTIONAL)) && (ref != nullptr))
             {
-                /* send the max possible nodes */
-                n1 = dimof(poss_next) - numPoss;
-                if (findNodesWithReference(ref, &poss_next[numPoss], &n1, VX_INPUT) == VX_SUCCESS)
+                n1 = numNodes;
+                if (findNodesWithReference(ref, found.data(), &n1, VX_INPUT) == VX_SUCCESS)
                 {
                     VX_PRINT(VX_ZONE_GRAPH, "Adding %u nodes to possible list\n", n1);
-                    numPoss += n1;
+                    for (vx_uint32 f = 0; f < n1; f++)
+                    {
+                        if (!possible(found[f]))
+                        {
+                            poss_next[numPoss++] = found[f];
+                        }
+                    }
                 }
             }
         }
@@ -1693,16 +1971,7 @@ void Graph::findNextNodes(
     /* add back all the left over nodes (making sure to not include duplicates) */
     for (i = 0; i < *numLeft; i++)
     {
-        vx_uint32 j;
-        vx_bool match = vx_false_e;
-        for (j = 0; j < numPoss; j++)
-        {
-            if (left_nodes[i] == poss_next[j])
-            {
-                match = vx_true_e;
-            }
-        }
-        if (match == vx_false_e)
+        if (!possible(left_nodes[i]))
         {
             VX_PRINT(VX_ZONE_GRAPH, "Adding back left over node[%u] %s\n", left_nodes[i], nodes[left_nodes[i]]->kernel->name);
             poss_next[numPoss++] = left_nodes[i];
@@ -1733,7 +2002,6 @@ void Graph::findNextNodes(
         /* parent nodes executed. */
         for (pi = 0; pi < numPossParam; pi++)
         {
-            vx_uint32 predicate_nodes[VX_INT_MAX_REF];
             vx_uint32 predicate_count = 0;
             vx_uint32 predicate_index = 0;
             vx_uint32 refIdx = 0;
@@ -1747,8 +2015,8 @@ void Graph::findNextNodes(
             for(refIdx = 0; refIdx < dimof(reftype); refIdx++)
             {
                 /* set the size of predicate nodes going in */
-                predicate_count = dimof(predicate_nodes);
-                if (findNodesWithReference(ref, predicate_nodes, &predicate_count, reftype[refIdx]) == VX_SUCCESS)
+                predicate_count = numNodes;
+                if (findNodesWithReference(ref, predicate_nodes.data(), &predicate_count, reftype[refIdx]) == VX_SUCCESS)
                 {
                     /* check to see of all of the predicate nodes are executed */
                     for (predicate_index = 0;
@@ -2117,6 +2385,241 @@ void Graph::topologicalSort(vx_node *list, vx_uint32 nnodes)
             list[n] = (vx_node)x[n+1].ref;
 }
 
+void Graph::computeDependencies()
+{
+    std::vector<std::vector<vx_uint32>> consumers(numNodes);
+    vx_uint32 n, p, n1, p1;
+
+    inDegree.assign(numNodes, 0u);
+    for (n = 0; n < numNodes; n++)
+    {
+        std::vector<vx_uint32> producers;
+        for (p = 0; p < nodes[n]->kernel->signature.num_parameters; p++)
+        {
+            vx_reference ref = nodes[n]->parameters[p];
+            if (nodes[n]->kernel->signature.directions[p] != VX_INPUT || ref == nullptr)
+            {
+                continue;
+            }
+            for (n1 = 0; n1 < numNodes; n1++)
+            {
+                if (n1 == n) continue;
+                for (p1 = 0; p1 < nodes[n1]->kernel->signature.num_parameters; p1++)
+                {
+                    vx_enum dir = nodes[n1]->kernel->signature.directions[p1];
+                    if ((dir == VX_OUTPUT || dir == VX_BIDIRECTIONAL) &&
+                        Graph::checkWriteDependency(nodes[n1]->parameters[p1], ref))
+                    {
+                        producers.push_back(n1);
+                        break;
+                    }
+                }
+            }
+        }
+        /* a composite node completes after the nodes inlined from its child graph */
+        for (n1 = 0; n1 < numNodes; n1++)
+        {
+            if (nodes[n1]->inlined_into == nodes[n])
+            {
+                producers.push_back(n1);
+            }
+        }
+        std::sort(producers.begin(), producers.end());
+        producers.erase(std::unique(producers.begin(), producers.end()), producers.end());
+        inDegree[n] = (vx_uint32)producers.size();
+        for (vx_uint32 producer : producers)
+        {
+            consumers[producer].push_back(n);
+        }
+    }
+
+    /* flatten into compressed rows so execution walks one contiguous array */
+    successorOffsets.assign(numNodes + 1, 0u);
+    successors.clear();
+    for (n = 0; n < numNodes; n++)
+    {
+        successorOffsets[n] = (vx_uint32)successors.size();
+        successors.insert(successors.end(), consumers[n].begin(), consumers[n].end());
+        VX_PRINT(VX_ZONE_GRAPH, "node[%u] %s waits on %u nodes and feeds %zu nodes\n", n,
+                 nodes[n]->kernel->name, inDegree[n], consumers[n].size());
+    }
+    successorOffsets[numNodes] = (vx_uint32)successors.size();
+}
+
+void Graph::computePriorities()
+{
+    std::vector<vx_uint32> order, pending(inDegree);
+    vx_bool measured = vx_true_e;
+    vx_uint32 n, i;
+
+    /* measured times and cost hints are in different units, so only switch over once
+     * every node has been measured */
+    for (n = 0; n < numNodes; n++)
+    {
+        if (nodes[n]->perf.num == 0)
+        {
+            measured = vx_false_e;
+        }
+    }
+
+    order.reserve(numNodes);
+    for (n = 0; n < numNodes; n++)
+    {
+        if (pending[n] == 0)
+        {
+            order.push_back(n);
+        }
+    }
+    for (i = 0; i < order.size(); i++)
+    {
+        for (vx_uint32 s = successorOffsets[order[i]]; s < successorOffsets[order[i] + 1]; s++)
+        {
+            if (--pending[successors[s]] == 0)
+            {
+                order.push_back(successors[s]);
+            }
+        }
+    }
+
+    bottomLevel.assign(numNodes, 0u);
+    for (i = (vx_uint32)order.size(); i-- > 0;)
+    {
+        vx_uint64 cost, below = 0u;
+        n = order[i];
+        cost = measured ? nodes[n]->perf.avg : (vx_uint64)nodes[n]->costs.bandwidth;
+        for (vx_uint32 s = successorOffsets[n]; s < successorOffsets[n + 1]; s++)
+        {
+            below = std::max(below, bottomLevel[successors[s]]);
+        }
+        /* every node costs something, so path length breaks ties between free nodes */
+        bottomLevel[n] = std::max<vx_uint64>(cost, 1u) + below;
+        VX_PRINT(VX_ZONE_GRAPH, "node[%u] %s bottom level %" PRIu64 " (%s)\n", n,
+                 nodes[n]->kernel->name, bottomLevel[n], measured ? "measured" : "estimated");
+    }
+}
+
+void Graph::inlineChildGraphs()
+{
+    vx_uint32 count = numNodes;
+
+#ifdef OPENVX_USE_PIPELINING
+    if (pipelineEnabled() == vx_true_e)
+    {
+        return;
+    }
+#endif
+
+    for (vx_uint32 n = 0; n < count; n++)
+    {
+        vx_node node = nodes[n];
+        vx_graph child = node->child;
+        vx_bool inlinable = vx_true_e;
+        vx_uint32 i, p, q;
+
+        if (child == nullptr || child->verified == vx_false_e || node->is_replicated == vx_true_e)
+        {
+            continue;
+        }
+        /* the child nodes have to work on the composite's own parameters */
+        for (p = 0; p < child->numParams; p++)
+        {
+            vx_node owner = child->parameters[p].node;
+            if (owner->parameters[child->parameters[p].index] != node->parameters[p])
+            {
+                inlinable = vx_false_e;
+            }
+        }
+        for (i = 0; i < child->numNodes && inlinable == vx_true_e; i++)
+        {
+            vx_node inner = child->nodes[i];
+            /* only one level is inlined */
+            if (inner->child != nullptr)
+            {
+                inlinable = vx_false_e;
+            }
+            /* a child node reading an output of the composite would wait on itself */
+            for (p = 0; p < inner->kernel->signature.num_parameters; p++)
+            {
+                if (inner->kernel->signature.directions[p] != VX_INPUT || !inner->parameters[p])
+                    continue;
+                for (q = 0; q < node->kernel->signature.num_parameters; q++)
+                {
+                    if (node->kernel->signature.directions[q] != VX_INPUT &&
+                        Graph::checkWriteDependency(node->parameters[q], inner->parameters[p]))
+                    {
+                        inlinable = vx_false_e;
+                    }
+                }
+            }
+        }
+        if (inlinable == vx_false_e)
+        {
+            continue;
+        }
+
+        for (i = 0; i < child->numNodes; i++)
+        {
+            vx_node inner = child->nodes[i];
+            /* workers report completion to inner->graph, which is now this graph */
+            inner->graph = this;
+            inner->inlined_into = node;
+            nodes.push_back(inner);
+            numNodes++;
+        }
+        /* keep the child graph alive while this graph runs its nodes */
+        child->incrementReference(VX_INTERNAL);
+        child->inlined = vx_true_e;
+        inlinedGraphs.push_back(child);
+        VX_PRINT(VX_ZONE_GRAPH, "Inlined %u nodes of %s\n", child->numNodes, node->kernel->name);
+    }
+
+    if (!inlinedGraphs.empty())
+    {
+        this->computeDependencies();
+    }
+}
+
+void Graph::restoreChildGraphs()
+{
+    vx_uint32 n, kept = 0;
+
+    if (inlinedGraphs.empty())
+    {
+        return;
+    }
+    for (n = 0; n < numNodes; n++)
+    {
+        if (nodes[n]->inlined_into == nullptr)
+        {
+            nodes[kept++] = nodes[n];
+        }
+    }
+    nodes.resize(kept);
+    numNodes = kept;
+
+    for (vx_graph child : inlinedGraphs)
+    {
+        for (n = 0; n < child->numNodes; n++)
+        {
+            child->nodes[n]->graph = child;
+            child->nodes[n]->inlined_into = nullptr;
+        }
+        child->inlined = vx_false_e;
+        vx_reference ref = (vx_reference)child;
+        Reference::releaseReference(&ref, VX_TYPE_GRAPH, VX_INTERNAL, nullptr);
+    }
+    inlinedGraphs.clear();
+}
+
+vx_bool Graph::runsBefore(vx_uint32 a, vx_uint32 b) const
+{
+    if (bottomLevel[a] != bottomLevel[b])
+    {
+        return bottomLevel[a] > bottomLevel[b] ? vx_true_e : vx_false_e;
+    }
+    return a < b ? vx_true_e : vx_false_e;
+}
+
 vx_bool Graph::setupOutput(vx_uint32 n, vx_uint32 p, vx_reference* vref, vx_meta_format* meta,
                             vx_status* status, vx_uint32* num_errors)
 {
@@ -3064,35 +3567,168 @@ vx_status Graph::pipelineValidateRefsList(
 void Graph::streamingLoop()
 {
 #ifdef OPENVX_USE_STREAMING
-    while (isStreaming)
-    {
-        /* Wait for trigger node event if set */
-        // if (triggerNodeIndex != UINT32_MAX)
-        // {
-        //     VX_PRINT(VX_ZONE_INFO, "Trigger node defined -- waiting on it to trigger\n");
-        //     /* Wait for the trigger node to complete */
-        //     while (!nodes[triggerNodeIndex]->executed)
-        //     {
-        //         std::cout << "Waiting for trigger node to complete" << std::endl;
-        //         std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        //         /* Allow clean exit */
-        //         if (!isStreaming) return;
-        //     }
-        //     /* Reset the event for the next iteration */
-        //     nodes[triggerNodeIndex]->executed = vx_false_e;
-        // }
-
-        /* Schedule and wait for the graph */
-        vx_status status = vxScheduleGraph(this);
-        if (status != VX_SUCCESS) break;
-        status = vxWaitGraph(this);
-        if (status != VX_SUCCESS) break;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> guard(streamLock);
+            /* sleep until there is something to run or we are asked to stop */
+            streamWake.wait(guard, [this] { return streamStop == vx_true_e || streamingReady() == vx_true_e; });
+            if (streamStop == vx_true_e)
+            {
+                break;
+            }
+        }
+
+        /* without enqueued inputs the trigger node paces the stream: it runs here on its own,
+         * so the thread blocks in its source until the next frame, then the rest follows */
+        if (streamingPrime() == vx_false_e)
+        {
+            break;
+        }
+        if (streamStop == vx_true_e)
+        {
+            streamPrimed = UINT32_MAX;
+            break;
+        }
+
+        vx_status status = vxProcessGraph(this);
+        streamPrimed = UINT32_MAX;
+        if (status != VX_SUCCESS)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Streaming stopped, graph returned %d\n", status);
+            break;
+        }
     }
 #endif /* OPENVX_USE_STREAMING */
 }
 
+#ifdef OPENVX_USE_STREAMING
+vx_bool Graph::streamingReady()
+{
+    vx_bool ready = vx_true_e;
+
+#ifdef OPENVX_USE_PIPELINING
+    /* with enqueable parameters, an execution needs a ready reference for each of them */
+    if (scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO ||
+        scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_MANUAL)
+    {
+        for (vx_uint32 i = 0; i < numEnqueableParams; i++)
+        {
+            if (parameters[i].queue.readyQueueSize() == 0)
+            {
+                ready = vx_false_e;
+                break;
+            }
+        }
+    }
+#endif
+
+    return ready;
+}
+
+vx_bool Graph::streamingPrime()
+{
+    vx_node trigger;
+    vx_action action;
+
+    if (verified == vx_false_e && vxVerifyGraph(this) != VX_SUCCESS)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Streaming stopped, the graph does not verify\n");
+        return vx_false_e;
+    }
+#ifdef OPENVX_USE_PIPELINING
+    if (numEnqueableParams > 0 && (scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO ||
+                                   scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_MANUAL))
+    {
+        return vx_true_e;
+    }
+#endif
+    /* only a source can run ahead of the others, fused or composite nodes run as a whole */
+    if (triggerNodeIndex >= numNodes || inDegree[triggerNodeIndex] != 0 ||
+        nodes[triggerNodeIndex]->fused_chain >= 0 || nodes[triggerNodeIndex]->child != nullptr)
+    {
+        return vx_true_e;
+    }
+
+    trigger = nodes[triggerNodeIndex];
+    Graph::setVirtualAccess(trigger, vx_true_e);
+    action = executeNode(trigger, 1u);
+    Graph::setVirtualAccess(trigger, vx_false_e);
+    completeNode(trigger, action);
+    if (action != VX_ACTION_CONTINUE)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Streaming stopped, trigger node %s returned action %d\n",
+                 trigger->kernel->name, action);
+        return vx_false_e;
+    }
+    streamPrimed = triggerNodeIndex;
+
+    return vx_true_e;
+}
+
+void Graph::streamingNotify()
+{
+    std::lock_guard<std::mutex> guard(streamLock);
+    streamWake.notify_one();
+}
+
+vx_status Graph::streamingStart()
+{
+    if (isStreaming == vx_true_e)
+    {
+        VX_PRINT(VX_ZONE_WARNING, "this graph is currently already streaming\n");
+        return VX_SUCCESS;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(streamLock);
+        streamStop = vx_false_e;
+    }
+    isStreaming = vx_true_e;
+    streamingThread = std::thread([this]() { streamingLoop(); });
+    VX_PRINT(VX_ZONE_INFO, "Graph streaming thread started\n");
+
+    return VX_SUCCESS;
+}
+
+vx_status Graph::streamingStop()
+{
+    if (isStreaming != vx_true_e)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Streaming has not been started\n");
+        return VX_ERROR_INVALID_PARAMETERS;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(streamLock);
+        streamStop = vx_true_e;
+        streamWake.notify_all();
+    }
+    /* the execution in flight, if any, is the only thing left to wait for */
+    if (streamingThread.joinable())
+    {
+        streamingThread.join();
+        VX_PRINT(VX_ZONE_INFO, "Graph streaming joined\n");
+    }
+    isStreaming = vx_false_e;
+
+    return VX_SUCCESS;
+}
+#endif /* OPENVX_USE_STREAMING */
+
 void Graph::destruct()
 {
+#ifdef OPENVX_USE_STREAMING
+    if (isStreaming == vx_true_e)
+    {
+        (void)streamingStop();
+    }
+#endif
+#ifdef OPENVX_USE_PIPELINING
+    this->pipelineRelease();
+#endif
+    this->restoreChildGraphs();
+    this->releaseMemoryPlan();
     while (numNodes)
     {
         vx_node node = nodes[0];
@@ -3199,6 +3835,21 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryGraph(vx_graph graph, vx_enum attribut
                     status = VX_ERROR_INVALID_PARAMETERS;
                 }
                 break;
+            case VX_GRAPH_FUSED_BYTES_SAVED:
+                if (VX_CHECK_PARAM(ptr, size, vx_size, 0x3))
+                {
+                    vx_size saved = 0;
+                    for (vx_size bytes : graph->fusedBytesSaved)
+                    {
+                        saved += bytes;
+                    }
+                    *(vx_size*)ptr = saved;
+                }
+                else
+                {
+                    status = VX_ERROR_INVALID_PARAMETERS;
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -0,0 +1,1028 @@
+/*
+ * Copyright (c) 2012-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+/******************************************************************************/
+/* INTERNAL FUNCTIONS */
+/******************************************************************************/
+
+/*! \brief One node of a fused chain, resolved for the band loop */
+struct vx_fused_step_t
+{
+    vx_enum kernel;
+    vx_df_image in_format;
+    vx_df_image out_format;
+    /*! \brief Per operand, the slot of the row buffers it reads */
+    vx_int32 src[2];
+    vx_uint32 numSrc;
+    /*! \brief Per output, the slot of the row buffers it writes */
+    vx_int32 dst[2];
+    vx_uint32 numDst;
+    /*! \brief The rows above and below each output row the step reads */
+    vx_uint32 radius;
+    vx_border_t border;
+    vx_enum policy;
+    vx_float32 scale;
+    vx_int32 shift;
+    vx_enum thresh_type;
+    vx_int32 value, lower, upper, true_value, false_value;
+    vx_lut lut;
+    void *lut_ptr;
+    vx_int32 lut_offset;
+};
+
+static vx_bool isFusableKernel(vx_enum kernel)
+{
+    switch (kernel)
+    {
+        case VX_KERNEL_ABSDIFF:
+        case VX_KERNEL_ADD:
+        case VX_KERNEL_SUBTRACT:
+        case VX_KERNEL_MULTIPLY:
+        case VX_KERNEL_AND:
+        case VX_KERNEL_OR:
+        case VX_KERNEL_XOR:
+        case VX_KERNEL_NOT:
+        case VX_KERNEL_THRESHOLD:
+        case VX_KERNEL_CONVERTDEPTH:
+        case VX_KERNEL_TABLE_LOOKUP:
+        case VX_KERNEL_WEIGHTED_AVERAGE:
+        case VX_KERNEL_MAGNITUDE:
+        case VX_KERNEL_BOX_3x3:
+        case VX_KERNEL_GAUSSIAN_3x3:
+        case VX_KERNEL_SOBEL_3x3:
+        case VX_KERNEL_ERODE_3x3:
+        case VX_KERNEL_DILATE_3x3:
+        case VX_KERNEL_MEDIAN_3x3:
+            return vx_true_e;
+        default:
+            return vx_false_e;
+    }
+}
+
+/*! \brief The neighborhood radius of a fusable kernel, 0 for the pointwise ones */
+static vx_uint32 stencilRadius(vx_enum kernel)
+{
+    switch (kernel)
+    {
+        case VX_KERNEL_BOX_3x3:
+        case VX_KERNEL_GAUSSIAN_3x3:
+        case VX_KERNEL_SOBEL_3x3:
+        case VX_KERNEL_ERODE_3x3:
+        case VX_KERNEL_DILATE_3x3:
+        case VX_KERNEL_MEDIAN_3x3:
+            return 1u;
+        default:
+            return 0u;
+    }
+}
+
+/*! \brief The images written by a fusable node, at most two, returns how many */
+static vx_uint32 fusedOutputs(vx_node node, vx_image outputs[2])
+{
+    vx_uint32 count = 0;
+    for (vx_uint32 p = 0; p < node->kernel->signature.num_parameters && count < 2u; p++)
+    {
+        vx_reference ref = node->parameters[p];
+        if (ref && ref->type == VX_TYPE_IMAGE &&
+            node->kernel->signature.directions[p] == VX_OUTPUT)
+        {
+            outputs[count++] = (vx_image)ref;
+        }
+    }
+    return count;
+}
+
+/*! \brief Whether the node runs a tiling kernel whose metadata declares it reads no neighborhood.
+ * Such kernels compute each pixel from the same input pixels as the C model, which the target
+ * comparison tests hold them to. The tiling neighborhood kernels only run with the undefined
+ * border, which does not fuse anyway.
+ */
+static vx_bool declaresNoNeighborhood(vx_node node)
+{
+#ifdef OPENVX_KHR_TILING
+    const vx_neighborhood_size_t &nbhd = node->attributes.nhbdinfo;
+    if (node->kernel->tilingfast_function != nullptr || node->kernel->tilingflexible_function != nullptr)
+    {
+        return (nbhd.left == 0 && nbhd.right == 0 && nbhd.top == 0 && nbhd.bottom == 0)
+                   ? vx_true_e
+                   : vx_false_e;
+    }
+#else
+    (void)node;
+#endif
+    return vx_false_e;
+}
+
+/*! \brief The fused steps reproduce the C model, so a node only fuses when its target
+ * computes the same pixels, whichever target the kernel was assigned to.
+ */
+static vx_bool canFuse(vx_node node)
+{
+    vx_context context = node->context;
+
+    vx_image outputs[2];
+    vx_uint32 radius = stencilRadius(node->kernel->enumeration);
+
+    if (isFusableKernel(node->kernel->enumeration) == vx_false_e ||
+        node->kernel->user_kernel == vx_true_e || node->is_replicated == vx_true_e ||
+        node->child != nullptr || fusedOutputs(node, outputs) == 0u ||
+        (context->targets[node->affinity]->bit_exact == vx_false_e &&
+         (radius > 0u || declaresNoNeighborhood(node) == vx_false_e)))
+    {
+        return vx_false_e;
+    }
+
+    /* an undefined border shrinks the valid region, which the bands do not track */
+    if (radius > 0u && node->attributes.borders.mode != VX_BORDER_REPLICATE &&
+        node->attributes.borders.mode != VX_BORDER_CONSTANT)
+    {
+        return vx_false_e;
+    }
+
+    for (vx_uint32 p = 0; p < node->kernel->signature.num_parameters; p++)
+    {
+        vx_reference ref = node->parameters[p];
+        if (ref == nullptr)
+        {
+            /* an optional output left out, like one of the Sobel gradients */
+            if (node->kernel->signature.directions[p] == VX_OUTPUT &&
+                node->kernel->signature.states[p] == VX_PARAMETER_STATE_OPTIONAL)
+            {
+                continue;
+            }
+            return vx_false_e;
+        }
+        if (ref->type == VX_TYPE_IMAGE)
+        {
+            /* the band loop handles single plane 8 and 16 bit pixels, the neighborhood
+             * kernels only 8 bit inputs as the c_model does */
+            vx_image image = (vx_image)ref;
+            if (image->format != VX_DF_IMAGE_U8 && image->format != VX_DF_IMAGE_S16)
+            {
+                return vx_false_e;
+            }
+            if (radius > 0u && node->kernel->signature.directions[p] == VX_INPUT &&
+                image->format != VX_DF_IMAGE_U8)
+            {
+                return vx_false_e;
+            }
+        }
+        else if (ref->type == VX_TYPE_LUT)
+        {
+            /* the c_model leaves pixels outside of the table untouched, which a fused
+             * chain cannot reproduce, so only tables covering every input value fuse */
+            vx_enum type = 0;
+            vx_size count = 0;
+            vx_uint32 offset = 0;
+            vx_int32 lowest, highest;
+            vxQueryLUT((vx_lut)ref, VX_LUT_TYPE, &type, sizeof(type));
+            vxQueryLUT((vx_lut)ref, VX_LUT_COUNT, &count, sizeof(count));
+            vxQueryLUT((vx_lut)ref, VX_LUT_OFFSET, &offset, sizeof(offset));
+            lowest = (type == VX_TYPE_UINT8) ? 0 : INT16_MIN;
+            highest = (type == VX_TYPE_UINT8) ? UINT8_MAX : INT16_MAX;
+            if ((type != VX_TYPE_UINT8 && type != VX_TYPE_INT16) ||
+                (vx_int32)offset + lowest < 0 || (vx_int32)offset + highest >= (vx_int32)count)
+            {
+                return vx_false_e;
+            }
+        }
+    }
+    return vx_true_e;
+}
+
+/*! \brief Read the scalars, threshold and table of a step as of this execution */
+static vx_status loadStep(vx_node node, vx_fused_step_t &step)
+{
+    vx_reference *params = node->parameters;
+    vx_status status = VX_SUCCESS;
+
+    switch (step.kernel)
+    {
+        case VX_KERNEL_ADD:
+        case VX_KERNEL_SUBTRACT:
+            status = vxCopyScalar((vx_scalar)params[2], &step.policy, VX_READ_ONLY,
+                                  VX_MEMORY_TYPE_HOST);
+            break;
+        case VX_KERNEL_MULTIPLY:
+            status = vxCopyScalar((vx_scalar)params[2], &step.scale, VX_READ_ONLY,
+                                  VX_MEMORY_TYPE_HOST);
+            status |= vxCopyScalar((vx_scalar)params[3], &step.policy, VX_READ_ONLY,
+                                   VX_MEMORY_TYPE_HOST);
+            break;
+        case VX_KERNEL_CONVERTDEPTH:
+            status = vxCopyScalar((vx_scalar)params[2], &step.policy, VX_READ_ONLY,
+                                  VX_MEMORY_TYPE_HOST);
+            status |= vxCopyScalar((vx_scalar)params[3], &step.shift, VX_READ_ONLY,
+                                   VX_MEMORY_TYPE_HOST);
+            break;
+        case VX_KERNEL_WEIGHTED_AVERAGE:
+            status = vxCopyScalar((vx_scalar)params[1], &step.scale, VX_READ_ONLY,
+                                  VX_MEMORY_TYPE_HOST);
+            break;
+        case VX_KERNEL_THRESHOLD:
+        {
+            vx_threshold thresh = (vx_threshold)params[1];
+            vx_pixel_value_t value = {}, lower = {}, upper = {}, true_value = {}, false_value = {};
+            vx_df_image format = 0;
+            status = vxQueryThreshold(thresh, VX_THRESHOLD_TYPE, &step.thresh_type,
+                                      sizeof(step.thresh_type));
+            status |= vxQueryThreshold(thresh, VX_THRESHOLD_INPUT_FORMAT, &format, sizeof(format));
+            if (step.thresh_type == VX_THRESHOLD_TYPE_BINARY)
+            {
+                status |= vxQueryThreshold(thresh, VX_THRESHOLD_THRESHOLD_VALUE, &value,
+                                           sizeof(value));
+            }
+            else
+            {
+                status |= vxQueryThreshold(thresh, VX_THRESHOLD_THRESHOLD_LOWER, &lower,
+                                           sizeof(lower));
+                status |= vxQueryThreshold(thresh, VX_THRESHOLD_THRESHOLD_UPPER, &upper,
+                                           sizeof(upper));
+            }
+            status |= vxQueryThreshold(thresh, VX_THRESHOLD_TRUE_VALUE, &true_value,
+                                       sizeof(true_value));
+            status |= vxQueryThreshold(thresh, VX_THRESHOLD_FALSE_VALUE, &false_value,
+                                       sizeof(false_value));
+            step.value = (format == VX_DF_IMAGE_S16) ? value.S16 : value.U8;
+            step.lower = (format == VX_DF_IMAGE_S16) ? lower.S16 : lower.U8;
+            step.upper = (format == VX_DF_IMAGE_S16) ? upper.S16 : upper.U8;
+            step.true_value = true_value.U8;
+            step.false_value = false_value.U8;
+            break;
+        }
+        case VX_KERNEL_TABLE_LOOKUP:
+        {
+            vx_uint32 offset = 0;
+            step.lut = (vx_lut)params[1];
+            status = vxQueryLUT(step.lut, VX_LUT_OFFSET, &offset, sizeof(offset));
+            status |= vxAccessLUT(step.lut, &step.lut_ptr, VX_READ_ONLY);
+            step.lut_offset = (vx_int32)offset;
+            break;
+        }
+        default:
+            break;
+    }
+    return status;
+}
+
+/*! \brief Clamp or wrap an intermediate result into the output pixel type */
+static inline vx_int32 convertResult(vx_int32 result, vx_enum policy, vx_df_image format)
+{
+    if (policy == VX_CONVERT_POLICY_SATURATE)
+    {
+        if (format == VX_DF_IMAGE_U8)
+            return result > UINT8_MAX ? UINT8_MAX : (result < 0 ? 0 : result);
+        return result > INT16_MAX ? INT16_MAX : (result < INT16_MIN ? INT16_MIN : result);
+    }
+    return (format == VX_DF_IMAGE_U8) ? (vx_int32)(vx_uint8)result : (vx_int32)(vx_int16)result;
+}
+
+/*! \brief Run one step over a row, with the same arithmetic as the c_model kernel */
+static void runStep(const vx_fused_step_t &step, const vx_int32 *a, const vx_int32 *b,
+                    vx_int32 *dst, vx_uint32 width)
+{
+    vx_uint32 x;
+
+    switch (step.kernel)
+    {
+        case VX_KERNEL_ABSDIFF:
+            for (x = 0; x < width; x++)
+            {
+                vx_uint32 val = (vx_uint32)(a[x] > b[x] ? a[x] - b[x] : b[x] - a[x]);
+                dst[x] = (step.out_format == VX_DF_IMAGE_S16 && val > 32767) ? 32767 : (vx_int32)val;
+            }
+            break;
+        case VX_KERNEL_ADD:
+            for (x = 0; x < width; x++)
+                dst[x] = convertResult(a[x] + b[x], step.policy, step.out_format);
+            break;
+        case VX_KERNEL_SUBTRACT:
+            for (x = 0; x < width; x++)
+                dst[x] = convertResult(a[x] - b[x], step.policy, step.out_format);
+            break;
+        case VX_KERNEL_MULTIPLY:
+            for (x = 0; x < width; x++)
+            {
+                vx_float64 scaled_result = step.scale * (vx_float64)(a[x] * b[x]);
+                dst[x] = convertResult((vx_int32)scaled_result, step.policy, step.out_format);
+            }
+            break;
+        case VX_KERNEL_AND:
+            for (x = 0; x < width; x++)
+                dst[x] = a[x] & b[x];
+            break;
+        case VX_KERNEL_OR:
+            for (x = 0; x < width; x++)
+                dst[x] = a[x] | b[x];
+            break;
+        case VX_KERNEL_XOR:
+            for (x = 0; x < width; x++)
+                dst[x] = a[x] ^ b[x];
+            break;
+        case VX_KERNEL_NOT:
+            for (x = 0; x < width; x++)
+                dst[x] = (vx_uint8)~a[x];
+            break;
+        case VX_KERNEL_THRESHOLD:
+            if (step.thresh_type == VX_THRESHOLD_TYPE_BINARY)
+            {
+                for (x = 0; x < width; x++)
+                    dst[x] = a[x] > step.value ? step.true_value : step.false_value;
+            }
+            else
+            {
+                for (x = 0; x < width; x++)
+                    dst[x] = (a[x] > step.upper || a[x] < step.lower) ? step.false_value
+                                                                       : step.true_value;
+            }
+            break;
+        case VX_KERNEL_CONVERTDEPTH:
+            if (step.out_format == VX_DF_IMAGE_S16)
+            {
+                for (x = 0; x < width; x++)
+                    dst[x] = (vx_int16)(a[x] << step.shift);
+            }
+            else if (step.policy == VX_CONVERT_POLICY_WRAP)
+            {
+                for (x = 0; x < width; x++)
+                    dst[x] = (vx_uint8)(a[x] >> step.shift);
+            }
+            else
+            {
+                for (x = 0; x < width; x++)
+                {
+                    vx_int16 value = (vx_int16)(a[x] >> step.shift);
+                    dst[x] = value < 0 ? 0 : (value > UINT8_MAX ? UINT8_MAX : value);
+                }
+            }
+            break;
+        case VX_KERNEL_TABLE_LOOKUP:
+            if (step.in_format == VX_DF_IMAGE_U8)
+            {
+                const vx_uint8 *table = (const vx_uint8 *)step.lut_ptr;
+                for (x = 0; x < width; x++)
+                    dst[x] = table[step.lut_offset + a[x]];
+            }
+            else
+            {
+                const vx_int16 *table = (const vx_int16 *)step.lut_ptr;
+                for (x = 0; x < width; x++)
+                    dst[x] = table[step.lut_offset + a[x]];
+            }
+            break;
+        case VX_KERNEL_WEIGHTED_AVERAGE:
+            /* a is img1 and b is img2, weighted as in the c_model */
+            for (x = 0; x < width; x++)
+            {
+                vx_int32 result = (vx_int32)((1 - step.scale) * (vx_float32)b[x] +
+                                             step.scale * (vx_float32)a[x]);
+                dst[x] = (vx_uint8)result;
+            }
+            break;
+        case VX_KERNEL_MAGNITUDE:
+            if (step.out_format == VX_DF_IMAGE_U8)
+            {
+                for (x = 0; x < width; x++)
+                {
+                    vx_int32 grad[2] = {a[x] * a[x], b[x] * b[x]};
+                    vx_float64 sum = grad[0] + grad[1];
+                    vx_uint32 value = ((vx_int32)sqrt(sum)) / 4;
+                    dst[x] = (vx_uint8)(value > UINT8_MAX ? UINT8_MAX : value);
+                }
+            }
+            else
+            {
+                for (x = 0; x < width; x++)
+                {
+                    vx_float64 sum = (vx_float64)a[x] * a[x] + (vx_float64)b[x] * b[x];
+                    vx_uint32 value = (vx_int32)(sqrt(sum) + 0.5);
+                    dst[x] = (vx_int16)(value > INT16_MAX ? INT16_MAX : value);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*! \brief Clamp a convolution sum into the output pixel type, as the c_model does */
+static inline vx_int32 clampConvolved(vx_int32 value, vx_df_image format)
+{
+    if (format == VX_DF_IMAGE_U8)
+        return value > UINT8_MAX ? UINT8_MAX : (value < 0 ? 0 : value);
+    return value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value);
+}
+
+/*! \brief Run one 3x3 neighborhood step over a row, with the same arithmetic and border
+ * handling as the c_model kernel. \p in holds the rows above, at and below the output
+ * row, already resolved against the top and bottom border.
+ */
+static void runStencil(const vx_fused_step_t &step, const vx_int32 *const in[3], vx_int32 *dst0,
+                       vx_int32 *dst1, vx_uint32 width)
+{
+    static const vx_int32 box[3][3] = {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
+    static const vx_int32 gaussian[3][3] = {{1, 2, 1}, {2, 4, 2}, {1, 2, 1}};
+    static const vx_int32 sobel_x[3][3] = {{-1, 0, +1}, {-2, 0, +2}, {-1, 0, +1}};
+    static const vx_int32 sobel_y[3][3] = {{-1, -2, -1}, {0, 0, 0}, {+1, +2, +1}};
+    const vx_int32 constant = (vx_int32)step.border.constant_value.U8;
+    vx_int32 px[9];
+
+    for (vx_uint32 x = 0; x < width; x++)
+    {
+        for (vx_int32 j = 0; j < 3; j++)
+        {
+            for (vx_int32 i = 0; i < 3; i++)
+            {
+                vx_int32 cx = (vx_int32)x + i - 1;
+                if (cx < 0 || cx >= (vx_int32)width)
+                {
+                    if (step.border.mode == VX_BORDER_CONSTANT)
+                    {
+                        px[j * 3 + i] = constant;
+                        continue;
+                    }
+                    cx = cx < 0 ? 0 : (vx_int32)width - 1;
+                }
+                px[j * 3 + i] = in[j][cx];
+            }
+        }
+
+        switch (step.kernel)
+        {
+            case VX_KERNEL_BOX_3x3:
+            case VX_KERNEL_GAUSSIAN_3x3:
+            {
+                const vx_int32(*conv)[3] = (step.kernel == VX_KERNEL_BOX_3x3) ? box : gaussian;
+                vx_int32 sum = 0, div = 0;
+                for (vx_uint32 k = 0; k < 9; k++)
+                {
+                    sum += conv[k / 3][k % 3] * px[k];
+                    div += conv[k / 3][k % 3];
+                }
+                dst0[x] = clampConvolved(sum / div, step.out_format);
+                break;
+            }
+            case VX_KERNEL_SOBEL_3x3:
+            {
+                /* the coefficients sum to zero, which the c_model divides by one */
+                vx_int32 gx = 0, gy = 0;
+                for (vx_uint32 k = 0; k < 9; k++)
+                {
+                    gx += sobel_x[k / 3][k % 3] * px[k];
+                    gy += sobel_y[k / 3][k % 3] * px[k];
+                }
+                if (dst0)
+                    dst0[x] = clampConvolved(gx, step.out_format);
+                if (dst1)
+                    dst1[x] = clampConvolved(gy, step.out_format);
+                break;
+            }
+            case VX_KERNEL_ERODE_3x3:
+                dst0[x] = *std::min_element(px, px + 9);
+                break;
+            case VX_KERNEL_DILATE_3x3:
+                dst0[x] = *std::max_element(px, px + 9);
+                break;
+            case VX_KERNEL_MEDIAN_3x3:
+                std::nth_element(px, px + 4, px + 9);
+                dst0[x] = px[4];
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void Graph::fuseNodes()
+{
+    std::map<vx_reference, std::vector<vx_uint32>> readers;
+    std::vector<vx_int32> next(numNodes, -1);
+    std::vector<vx_bool> fed(numNodes, vx_false_e);
+    vx_uint32 n, p;
+
+    fusedChains.clear();
+    fusedBytesSaved.clear();
+    for (n = 0; n < numNodes; n++)
+    {
+        nodes[n]->fused_chain = -1;
+    }
+
+#ifdef OPENVX_USE_PIPELINING
+    if (pipelineEnabled() == vx_true_e)
+    {
+        return;
+    }
+#endif
+
+    for (n = 0; n < numNodes; n++)
+    {
+        vx_node node = nodes[n];
+        for (p = 0; p < node->kernel->signature.num_parameters; p++)
+        {
+            vx_reference ref = node->parameters[p];
+            if (ref && node->kernel->signature.directions[p] != VX_OUTPUT)
+            {
+                std::vector<vx_uint32> &list = readers[ref];
+                if (list.empty() || list.back() != n)
+                {
+                    list.push_back(n);
+                }
+            }
+        }
+    }
+
+    /* a node hands its outputs on to the next one when nobody else can see the images */
+    for (n = 0; n < numNodes; n++)
+    {
+        vx_image outputs[2];
+        vx_uint32 numOutputs = canFuse(nodes[n]) ? fusedOutputs(nodes[n], outputs) : 0u;
+        vx_int32 consumer = -1;
+
+        for (vx_uint32 o = 0; o < numOutputs; o++)
+        {
+            vx_image image = outputs[o];
+            vx_bool exposed = vx_false_e;
+
+            if (image->is_virtual == vx_false_e || image->delay != nullptr ||
+                image->parent != nullptr || image->subimages[0] != nullptr ||
+                readers[(vx_reference)image].size() != 1u)
+            {
+                consumer = -1;
+                break;
+            }
+            for (p = 0; p < numParams; p++)
+            {
+                if (parameters[p].node->parameters[parameters[p].index] == (vx_reference)image)
+                {
+                    exposed = vx_true_e;
+                }
+            }
+            /* every output has to go to the same node, like both Sobel gradients */
+            vx_int32 reader = (vx_int32)readers[(vx_reference)image][0];
+            if (exposed == vx_true_e || (o > 0 && reader != consumer))
+            {
+                consumer = -1;
+                break;
+            }
+            consumer = reader;
+        }
+        if (consumer >= 0 && canFuse(nodes[consumer]) == vx_true_e)
+        {
+            next[n] = consumer;
+            fed[consumer] = vx_true_e;
+        }
+    }
+
+    for (n = 0; n < numNodes; n++)
+    {
+        std::vector<vx_node> chain;
+        vx_int32 cur = (vx_int32)n;
+
+        if (fed[n] == vx_true_e || next[n] < 0)
+        {
+            continue;
+        }
+        /* the nodes are sorted, so a chain runs in graph order */
+        while (cur >= 0 && nodes[cur]->fused_chain < 0)
+        {
+            chain.push_back(nodes[cur]);
+            nodes[cur]->fused_chain = (vx_int32)fusedChains.size();
+            cur = next[cur];
+        }
+        if (chain.size() < 2u)
+        {
+            for (vx_node node : chain)
+            {
+                node->fused_chain = -1;
+            }
+            continue;
+        }
+        VX_PRINT(VX_ZONE_GRAPH, "Fused chain " VX_FMT_SIZE " of " VX_FMT_SIZE " nodes, %s to %s\n", fusedChains.size(),
+                 chain.size(), chain.front()->kernel->name, chain.back()->kernel->name);
+        fusedChains.push_back(chain);
+    }
+    fusedBytesSaved.assign(fusedChains.size(), 0u);
+}
+
+/*! \brief One execution of a fused chain, split into bands of output rows.
+ * Every operand of the chain has a slot of row buffers: the external sources first, then
+ * one per step output. A band computes each slot over its own rows plus the halo the
+ * later steps read around them, so neighboring bands recompute the halo rows instead of
+ * waiting on each other.
+ */
+struct vx_fused_bands_t
+{
+    const std::vector<vx_fused_step_t> *steps;
+    /*! \brief Per slot, the rows above and below the band it is computed over */
+    std::vector<vx_uint32> halo;
+    /*! \brief Per slot, the image it is read from or written to, nullptr for intermediates */
+    std::vector<vx_image> images;
+    std::vector<vx_imagepatch_addressing_t> addrs;
+    std::vector<vx_uint8 *> bases;
+    vx_uint32 numSources;
+    /*! \brief The slots written out to the chain outputs */
+    std::vector<vx_uint32> outputs;
+    /*! \brief Per step, a row of its constant border value */
+    std::vector<std::vector<vx_int32>> constants;
+    vx_uint32 width;
+    vx_uint32 height;
+    vx_uint32 band;
+    /*! \brief The row buffers of one thread, a thread's slot times this into \ref scratch */
+    vx_size perThread;
+    std::vector<vx_int32> scratch;
+};
+
+static vx_status runBand(void *arg, vx_uint32 chunk, vx_uint32 thread)
+{
+    vx_fused_bands_t *bands = (vx_fused_bands_t *)arg;
+    const std::vector<vx_fused_step_t> &steps = *bands->steps;
+    const vx_int32 width = (vx_int32)bands->width;
+    const vx_int32 height = (vx_int32)bands->height;
+    const vx_int32 y0 = (vx_int32)(chunk * bands->band);
+    const vx_int32 y1 = std::min(height, y0 + (vx_int32)bands->band);
+    std::vector<vx_int32 *> buffers(bands->halo.size());
+    vx_int32 *base = &bands->scratch[thread * bands->perThread];
+    vx_uint32 i, s;
+    vx_int32 x, y;
+
+    for (i = 0; i < buffers.size(); i++)
+    {
+        buffers[i] = base;
+        base += (bands->band + 2u * bands->halo[i]) * bands->width;
+    }
+    /* row y of a slot, which only exists within the band and its halo */
+    auto row = [&](vx_uint32 slot, vx_int32 y) {
+        return buffers[slot] + (y - (y0 - (vx_int32)bands->halo[slot])) * width;
+    };
+
+    for (i = 0; i < bands->numSources; i++)
+    {
+        vx_int32 lo = std::max(0, y0 - (vx_int32)bands->halo[i]);
+        vx_int32 hi = std::min(height, y1 + (vx_int32)bands->halo[i]);
+        const vx_imagepatch_addressing_t &addr = bands->addrs[i];
+        for (y = lo; y < hi; y++)
+        {
+            const vx_uint8 *src = bands->bases[i] + y * addr.stride_y;
+            vx_int32 *dst = row(i, y);
+            if (bands->images[i]->format == VX_DF_IMAGE_U8)
+            {
+                for (x = 0; x < width; x++)
+                    dst[x] = src[x * addr.stride_x];
+            }
+            else
+            {
+                for (x = 0; x < width; x++)
+                    dst[x] = *(const vx_int16 *)&src[x * addr.stride_x];
+            }
+        }
+    }
+
+    for (s = 0; s < steps.size(); s++)
+    {
+        const vx_fused_step_t &step = steps[s];
+        vx_int32 halo = 0;
+        for (i = 0; i < step.numDst; i++)
+        {
+            if (step.dst[i] >= 0)
+                halo = std::max(halo, (vx_int32)bands->halo[step.dst[i]]);
+        }
+        vx_int32 lo = std::max(0, y0 - halo);
+        vx_int32 hi = std::min(height, y1 + halo);
+        for (y = lo; y < hi; y++)
+        {
+            vx_int32 *dst0 = step.dst[0] >= 0 ? row(step.dst[0], y) : nullptr;
+            if (step.radius == 0u)
+            {
+                runStep(step, row(step.src[0], y), row(step.src[1], y), dst0, bands->width);
+                continue;
+            }
+            const vx_int32 *in[3];
+            for (vx_int32 k = 0; k < 3; k++)
+            {
+                vx_int32 q = y + k - 1;
+                if (q < 0 || q >= height)
+                {
+                    if (step.border.mode == VX_BORDER_CONSTANT)
+                    {
+                        in[k] = bands->constants[s].data();
+                        continue;
+                    }
+                    q = q < 0 ? 0 : height - 1;
+                }
+                in[k] = row(step.src[0], q);
+            }
+            vx_int32 *dst1 = (step.numDst > 1u && step.dst[1] >= 0) ? row(step.dst[1], y) : nullptr;
+            runStencil(step, in, dst0, dst1, bands->width);
+        }
+    }
+
+    for (vx_uint32 o : bands->outputs)
+    {
+        const vx_imagepatch_addressing_t &addr = bands->addrs[o];
+        for (y = y0; y < y1; y++)
+        {
+            vx_uint8 *dst = bands->bases[o] + y * addr.stride_y;
+            const vx_int32 *result = row(o, y);
+            if (bands->images[o]->format == VX_DF_IMAGE_U8)
+            {
+                for (x = 0; x < width; x++)
+                    dst[x * addr.stride_x] = (vx_uint8)result[x];
+            }
+            else
+            {
+                for (x = 0; x < width; x++)
+                    *(vx_int16 *)&dst[x * addr.stride_x] = (vx_int16)result[x];
+            }
+        }
+    }
+    return VX_SUCCESS;
+}
+
+vx_action Graph::executeFused(vx_node node)
+{
+    std::vector<vx_node> &chain = fusedChains[node->fused_chain];
+    std::vector<vx_fused_step_t> steps(chain.size());
+    std::vector<vx_reference> granted;
+    std::vector<vx_map_id> map_ids;
+    vx_fused_bands_t bands;
+    vx_image last[2] = {nullptr, nullptr};
+    fusedOutputs(chain.back(), last);
+    vx_rectangle_t full = {0, 0, last[0]->width, last[0]->height};
+    vx_action action = VX_ACTION_CONTINUE;
+    vx_status status = VX_SUCCESS;
+    vx_bool fused = vx_true_e;
+    vx_size saved = 0;
+    vx_uint32 i, s;
+
+    if (node != chain.back())
+    {
+        /* the last node of the chain computes this one's output */
+        if (context->perf_enabled)
+        {
+            Osal::startCapture(&node->perf);
+            Osal::stopCapture(&node->perf);
+        }
+        node->executed = vx_true_e;
+        node->status = VX_SUCCESS;
+        return VX_ACTION_CONTINUE;
+    }
+
+    /* the chain reads images the serial executor has not opened to this node */
+    for (vx_node member : chain)
+    {
+        for (i = 0; i < member->kernel->signature.num_parameters; i++)
+        {
+            vx_reference ref = member->parameters[i];
+            if (ref && ref->is_virtual == vx_true_e && ref->is_accessible == vx_false_e)
+            {
+                ref->is_accessible = vx_true_e;
+                granted.push_back(ref);
+            }
+        }
+    }
+
+    /* resolve every operand to a slot: external sources first, then the step outputs */
+    std::vector<vx_image> sources, produced;
+    for (s = 0; s < chain.size(); s++)
+    {
+        vx_node member = chain[s];
+        for (i = 0; i < member->kernel->signature.num_parameters; i++)
+        {
+            vx_reference ref = member->parameters[i];
+            if (ref == nullptr || ref->type != VX_TYPE_IMAGE)
+                continue;
+            if (member->kernel->signature.directions[i] == VX_OUTPUT)
+                produced.push_back((vx_image)ref);
+            else if (std::find(produced.begin(), produced.end(), (vx_image)ref) == produced.end() &&
+                     std::find(sources.begin(), sources.end(), (vx_image)ref) == sources.end())
+                sources.push_back((vx_image)ref);
+        }
+    }
+    bands.images = sources;
+    bands.images.insert(bands.images.end(), produced.begin(), produced.end());
+    bands.numSources = (vx_uint32)sources.size();
+    auto slotOf = [&](vx_reference ref) {
+        return (vx_int32)(std::find(bands.images.begin(), bands.images.end(), (vx_image)ref) -
+                          bands.images.begin());
+    };
+
+    for (s = 0; s < chain.size(); s++)
+    {
+        vx_node member = chain[s];
+        vx_fused_step_t &step = steps[s];
+        step.kernel = member->kernel->enumeration;
+        step.radius = stencilRadius(step.kernel);
+        step.border = member->attributes.borders;
+        step.numSrc = 0;
+        step.numDst = 0;
+        for (i = 0; i < member->kernel->signature.num_parameters; i++)
+        {
+            vx_reference ref = member->parameters[i];
+            if (member->kernel->signature.directions[i] == VX_OUTPUT)
+            {
+                /* a left out optional output still takes its place, Sobel writes x then y */
+                if (ref == nullptr || ref->type == VX_TYPE_IMAGE)
+                {
+                    step.dst[step.numDst++] = ref ? slotOf(ref) : -1;
+                    if (ref)
+                        step.out_format = ((vx_image)ref)->format;
+                }
+                continue;
+            }
+            if (ref == nullptr || ref->type != VX_TYPE_IMAGE)
+            {
+                continue;
+            }
+            vx_rectangle_t rect;
+            vxGetValidRegionImage((vx_image)ref, &rect);
+            /* the kernels only touch the valid region of their inputs, which is only
+             * the same for every step when it is the whole image */
+            if (rect.start_x != 0 || rect.start_y != 0 || rect.end_x != full.end_x ||
+                rect.end_y != full.end_y)
+            {
+                fused = vx_false_e;
+            }
+            if (step.numSrc == 0)
+            {
+                step.in_format = ((vx_image)ref)->format;
+            }
+            step.src[step.numSrc++] = slotOf(ref);
+        }
+        if (step.numSrc == 1)
+        {
+            step.src[1] = step.src[0];
+        }
+        /* the border may have changed since the graph was verified */
+        if (step.radius > 0u && step.border.mode != VX_BORDER_REPLICATE &&
+            step.border.mode != VX_BORDER_CONSTANT)
+        {
+            fused = vx_false_e;
+        }
+    }
+
+    if (fused == vx_false_e)
+    {
+        VX_PRINT(VX_ZONE_GRAPH, "Running fused chain %d node by node\n", node->fused_chain);
+        for (s = 0; s < chain.size() && action == VX_ACTION_CONTINUE; s++)
+        {
+            /* the nodes of a chain may have been assigned to different targets */
+            vx_target target = context->targets[chain[s]->affinity];
+            action = target->funcs.process(target, &chain[s], 0, 1);
+        }
+        for (vx_reference ref : granted)
+        {
+            ref->is_accessible = vx_false_e;
+        }
+        fusedBytesSaved[node->fused_chain] = 0;
+        return action;
+    }
+
+    if (context->perf_enabled)
+        Osal::startCapture(&node->perf);
+
+    for (s = 0; s < chain.size(); s++)
+    {
+        status |= loadStep(chain[s], steps[s]);
+    }
+
+    /* a slot is needed around a band by as many rows as its readers reach past their own */
+    bands.halo.assign(bands.images.size(), 0u);
+    for (s = (vx_uint32)chain.size(); s-- > 0;)
+    {
+        vx_uint32 reach = 0;
+        for (i = 0; i < steps[s].numDst; i++)
+        {
+            if (steps[s].dst[i] >= 0)
+                reach = std::max(reach, bands.halo[steps[s].dst[i]]);
+        }
+        reach += steps[s].radius;
+        for (i = 0; i < steps[s].numSrc; i++)
+        {
+            bands.halo[steps[s].src[i]] = std::max(bands.halo[steps[s].src[i]], reach);
+        }
+    }
+
+    bands.steps = &steps;
+    bands.width = full.end_x;
+    bands.height = full.end_y;
+    bands.constants.resize(steps.size());
+    for (s = 0; s < steps.size(); s++)
+    {
+        if (steps[s].radius > 0u && steps[s].border.mode == VX_BORDER_CONSTANT)
+            bands.constants[s].assign(bands.width, (vx_int32)steps[s].border.constant_value.U8);
+    }
+
+    /* the chain writes the outputs of its last step, every other step output stays in
+     * the bands and never makes the round trip through memory */
+    for (i = bands.numSources; i < bands.images.size(); i++)
+    {
+        if (std::find(last, last + 2, bands.images[i]) != last + 2)
+        {
+            bands.outputs.push_back(i);
+        }
+        else
+        {
+            saved += 2u * Memory::computePlaneSize(&bands.images[i]->memory, 0);
+        }
+    }
+
+    map_ids.resize(bands.images.size());
+    bands.addrs.resize(bands.images.size());
+    bands.bases.resize(bands.images.size(), nullptr);
+    for (i = 0; i < bands.images.size(); i++)
+    {
+        vx_bool isOutput = std::find(bands.outputs.begin(), bands.outputs.end(), i) != bands.outputs.end()
+                               ? vx_true_e
+                               : vx_false_e;
+        if (i >= bands.numSources && isOutput == vx_false_e)
+            continue;
+        status |= vxMapImagePatch(bands.images[i], &full, 0, &map_ids[i], &bands.addrs[i],
+                                  (void **)&bands.bases[i],
+                                  isOutput ? VX_WRITE_ONLY : VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0);
+    }
+
+    if (status == VX_SUCCESS)
+    {
+        /* as many rows per band as keep every slot of it within the cache budget */
+        vx_size rowBytes = bands.width * sizeof(vx_int32);
+        vx_size haloRows = 0;
+        for (vx_uint32 h : bands.halo)
+            haloRows += 2u * h;
+        vx_size budget = VX_INT_FUSION_BAND_BYTES / rowBytes;
+        vx_size band = budget > haloRows ? (budget - haloRows) / bands.images.size() : 1u;
+        bands.band = (vx_uint32)std::min<vx_size>(std::max<vx_size>(band, 1u), bands.height);
+        bands.perThread = (bands.band * bands.images.size() + haloRows) * bands.width;
+
+        vx_uint32 numBands = (bands.height + bands.band - 1u) / bands.band;
+        vx_uint32 threads = context->workers ? std::min(numBands, context->workers->numWorkers + 1u) : 1u;
+        bands.scratch.resize(threads * bands.perThread);
+        status = node->processChunks(numBands, threads, runBand, &bands);
+    }
+
+    for (i = 0; i < bands.images.size(); i++)
+    {
+        if (bands.bases[i])
+            status |= vxUnmapImagePatch(bands.images[i], map_ids[i]);
+    }
+    for (s = 0; s < steps.size(); s++)
+    {
+        if (steps[s].kernel == VX_KERNEL_TABLE_LOOKUP && steps[s].lut_ptr)
+            status |= vxCommitLUT(steps[s].lut, steps[s].lut_ptr);
+    }
+    for (vx_reference ref : granted)
+    {
+        ref->is_accessible = vx_false_e;
+    }
+
+    for (vx_node member : chain)
+    {
+        member->executed = vx_true_e;
+        member->status = status;
+    }
+    fusedBytesSaved[node->fused_chain] = (status == VX_SUCCESS) ? saved : 0u;
+
+    if (context->perf_enabled)
+        Osal::stopCapture(&node->perf);
+
+    VX_PRINT(VX_ZONE_GRAPH, "fused chain %d returned %d, " VX_FMT_SIZE " bytes kept out of memory\n",
+             node->fused_chain, status, saved);
+
+    if (status != VX_SUCCESS)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Abandoning Graph due to error (%d)!\n", status);
+        return VX_ACTION_ABANDON;
+    }
+
+    for (s = 0; s < chain.size() && action == VX_ACTION_CONTINUE; s++)
+    {
+        if (chain[s]->callback)
+        {
+            action = chain[s]->callback(chain[s]);
+        }
+    }
+    return action;
+}
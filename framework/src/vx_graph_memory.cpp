@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2012-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+/******************************************************************************/
+/* INTERNAL FUNCTIONS */
+/******************************************************************************/
+
+/*! \brief A virtual object of the graph and the nodes using it.
+ * \ingroup group_int_graph
+ */
+typedef struct _vx_planned_object_t {
+    /*! \brief The virtual object */
+    vx_reference ref;
+    /*! \brief The bytes it needs */
+    vx_size size;
+    /*! \brief The index of the node writing it, or -1 */
+    vx_int32 writer;
+    /*! \brief The indexes of every node using it, the writer included */
+    std::vector<vx_uint32> users;
+    /*! \brief Whether the lifetime of the object is bounded by its writer and readers */
+    vx_bool plannable;
+} vx_planned_object_t;
+
+/*! \brief The memory block of an image, array, LUT or distribution, else nullptr. */
+static vx_memory_t *plannedMemory(vx_reference ref)
+{
+    switch (ref->type)
+    {
+        case VX_TYPE_IMAGE:
+            return &((vx_image)ref)->memory;
+        case VX_TYPE_ARRAY:
+        case VX_TYPE_LUT:
+            return &((vx_array)ref)->memory;
+        case VX_TYPE_DISTRIBUTION:
+            return &((vx_distribution)ref)->memory;
+        default:
+            return nullptr;
+    }
+}
+
+static vx_size plannedSize(vx_reference ref)
+{
+    vx_memory_t *memory = plannedMemory(ref);
+    vx_size size = 0;
+
+    if (memory != nullptr)
+    {
+        size = Memory::computeAttachSize(memory);
+    }
+    else if (ref->type == VX_TYPE_TENSOR)
+    {
+        vx_tensor tensor = (vx_tensor)ref;
+        size = Reference::sizeOfType(tensor->data_type);
+        for (vx_uint32 d = 0; d < tensor->number_of_dimensions; d++)
+        {
+            size *= tensor->dimensions[d];
+        }
+    }
+    return size;
+}
+
+/*! \brief Allocates an object the plan could not place, the way the memory allocation
+ * phase of verify would have.
+ */
+static vx_bool allocateUnplanned(vx_reference ref)
+{
+    switch (ref->type)
+    {
+        case VX_TYPE_IMAGE:
+            return ((vx_image)ref)->allocateImage();
+        case VX_TYPE_ARRAY:
+        case VX_TYPE_LUT:
+            return ((vx_array)ref)->allocateArray();
+        case VX_TYPE_DISTRIBUTION:
+            return Memory::allocateMemory(ref->context, &((vx_distribution)ref)->memory);
+        case VX_TYPE_TENSOR:
+            return ((vx_tensor)ref)->allocateTensorMemory() != nullptr ? vx_true_e : vx_false_e;
+        default:
+            return vx_false_e;
+    }
+}
+
+vx_bool Graph::defersAllocation(vx_reference ref)
+{
+    vx_uint32 i;
+
+    if (ref == nullptr || ref->is_virtual == vx_false_e || ref->scope != (vx_reference)this ||
+        ref->delay != nullptr)
+    {
+        return vx_false_e;
+    }
+#ifdef OPENVX_USE_PIPELINING
+    /* overlapping frames share some of the virtual objects, so their lifetimes overlap too */
+    if (pipelineEnabled() == vx_true_e)
+    {
+        return vx_false_e;
+    }
+#endif
+    for (i = 0; i < numParams; i++)
+    {
+        if (parameters[i].node != nullptr &&
+            parameters[i].node->parameters[parameters[i].index] == ref)
+        {
+            return vx_false_e;
+        }
+    }
+
+    switch (ref->type)
+    {
+        case VX_TYPE_IMAGE:
+        {
+            vx_image image = (vx_image)ref;
+            /* ROIs and channels alias their parent */
+            if (image->memory_type != VX_MEMORY_TYPE_NONE || image->parent != nullptr ||
+                image->memory.allocated == vx_true_e)
+            {
+                return vx_false_e;
+            }
+            for (i = 0; i < VX_INT_MAX_REF; i++)
+            {
+                if (image->subimages[i] != nullptr)
+                {
+                    return vx_false_e;
+                }
+            }
+            return vx_true_e;
+        }
+        case VX_TYPE_ARRAY:
+        case VX_TYPE_LUT:
+        {
+            vx_array array = (vx_array)ref;
+            return (array->capacity > 0 && array->memory.allocated == vx_false_e) ? vx_true_e
+                                                                                 : vx_false_e;
+        }
+        case VX_TYPE_DISTRIBUTION:
+            return ((vx_distribution)ref)->memory.allocated == vx_false_e ? vx_true_e : vx_false_e;
+        case VX_TYPE_TENSOR:
+        {
+            vx_tensor tensor = (vx_tensor)ref;
+            if (tensor->parent != nullptr || tensor->addr != nullptr)
+            {
+                return vx_false_e;
+            }
+            for (i = 0; i < VX_INT_MAX_REF; i++)
+            {
+                if (tensor->subtensors[i] != nullptr || tensor->subimages[i] != nullptr)
+                {
+                    return vx_false_e;
+                }
+            }
+            return vx_true_e;
+        }
+        default:
+            return vx_false_e;
+    }
+}
+
+void Graph::planMemory()
+{
+    std::vector<vx_planned_object_t> objects;
+    std::map<vx_reference, vx_size> index;
+    vx_uint32 n, p, i;
+
+    /* collect the deferred objects and their users, inlined nodes included */
+    for (n = 0; n < numNodes; n++)
+    {
+        vx_node node = nodes[n];
+        for (p = 0; p < node->kernel->signature.num_parameters; p++)
+        {
+            vx_reference ref = node->parameters[p];
+            if (defersAllocation(ref) == vx_false_e)
+            {
+                continue;
+            }
+            if (index.find(ref) == index.end())
+            {
+                index[ref] = objects.size();
+                objects.push_back({ref, plannedSize(ref), -1, {}, vx_true_e});
+            }
+            vx_planned_object_t &object = objects[index[ref]];
+            object.users.push_back(n);
+            if (node->kernel->signature.directions[p] == VX_BIDIRECTIONAL)
+            {
+                /* the object carries its value from one execution to the next */
+                object.plannable = vx_false_e;
+            }
+            else if (node->kernel->signature.directions[p] == VX_OUTPUT)
+            {
+                object.writer = (object.writer < 0) ? (vx_int32)n : -2;
+            }
+        }
+    }
+    if (objects.empty())
+    {
+        return;
+    }
+
+    /* order the nodes and find everything each one runs before */
+    std::vector<vx_uint32> order, rank(numNodes), pending(inDegree.begin(), inDegree.end());
+    vx_size words = (numNodes + 63u) / 64u;
+    std::vector<std::vector<vx_uint64>> reach(numNodes, std::vector<vx_uint64>(words, 0u));
+    for (n = 0; n < numNodes; n++)
+    {
+        if (pending[n] == 0)
+        {
+            order.push_back(n);
+        }
+    }
+    for (i = 0; i < order.size(); i++)
+    {
+        rank[order[i]] = i;
+        for (vx_uint32 s = successorOffsets[order[i]]; s < successorOffsets[order[i] + 1]; s++)
+        {
+            if (--pending[successors[s]] == 0)
+            {
+                order.push_back(successors[s]);
+            }
+        }
+    }
+    for (i = (vx_uint32)order.size(); i-- > 0;)
+    {
+        vx_uint32 from = order[i];
+        for (vx_uint32 s = successorOffsets[from]; s < successorOffsets[from + 1]; s++)
+        {
+            vx_uint32 to = successors[s];
+            reach[from][to / 64u] |= (vx_uint64)1u << (to % 64u);
+            for (vx_size w = 0; w < words; w++)
+            {
+                reach[from][w] |= reach[to][w];
+            }
+        }
+    }
+    auto runsAfter = [&](vx_uint32 before, vx_uint32 after) -> bool {
+        return (reach[before][after / 64u] >> (after % 64u)) & 1u;
+    };
+
+    /* an object lives from its writer to its last reader, each reader must follow the writer */
+    std::vector<vx_size> placed;
+    for (i = 0; i < objects.size(); i++)
+    {
+        vx_planned_object_t &object = objects[i];
+        if (object.writer < 0)
+        {
+            object.plannable = vx_false_e;
+        }
+        for (vx_uint32 user : object.users)
+        {
+            if (object.plannable == vx_true_e && user != (vx_uint32)object.writer &&
+                !runsAfter((vx_uint32)object.writer, user))
+            {
+                object.plannable = vx_false_e;
+            }
+        }
+        virtualBytes += object.size;
+        if (object.plannable == vx_true_e)
+        {
+            placed.push_back(i);
+        }
+    }
+    std::stable_sort(placed.begin(), placed.end(), [&](vx_size a, vx_size b) {
+        return rank[objects[a].writer] < rank[objects[b].writer];
+    });
+
+    /* interval colouring in write order: an object follows the last occupant of a slab when
+     * every user of that occupant runs before the object is written */
+    std::vector<vx_size> slabSizes, slabLast;
+    std::vector<vx_size> slabOf(objects.size(), 0);
+    for (vx_size o : placed)
+    {
+        vx_planned_object_t &object = objects[o];
+        vx_size best = slabSizes.size();
+        for (vx_size s = 0; s < slabSizes.size(); s++)
+        {
+            bool free = true;
+            for (vx_uint32 user : objects[slabLast[s]].users)
+            {
+                if (!runsAfter(user, (vx_uint32)object.writer))
+                {
+                    free = false;
+                    break;
+                }
+            }
+            if (!free)
+            {
+                continue;
+            }
+            /* the tightest slab which already fits, else the one which grows least */
+            if (best == slabSizes.size())
+            {
+                best = s;
+            }
+            else if (slabSizes[s] >= object.size)
+            {
+                if (slabSizes[best] < object.size || slabSizes[s] < slabSizes[best])
+                {
+                    best = s;
+                }
+            }
+            else if (slabSizes[best] < object.size && slabSizes[s] > slabSizes[best])
+            {
+                best = s;
+            }
+        }
+        if (best == slabSizes.size())
+        {
+            slabSizes.push_back(0);
+            slabLast.push_back(o);
+        }
+        slabSizes[best] = std::max(slabSizes[best], object.size);
+        slabLast[best] = o;
+        slabOf[o] = best;
+    }
+
+    for (vx_size s = 0; s < slabSizes.size(); s++)
+    {
+        memorySlabs.push_back(
+            (vx_uint8 *)context->memory_pool.allocate(slabSizes[s] + VX_MEMORY_ATTACH_ALIGN));
+        slabBytes += slabSizes[s];
+    }
+    for (vx_size o : placed)
+    {
+        vx_planned_object_t &object = objects[o];
+        vx_uint8 *base = memorySlabs[slabOf[o]];
+        vx_memory_t *memory = plannedMemory(object.ref);
+        if (base == nullptr)
+        {
+            object.plannable = vx_false_e;
+            continue;
+        }
+        base += (VX_MEMORY_ATTACH_ALIGN - ((uintptr_t)base % VX_MEMORY_ATTACH_ALIGN)) %
+                VX_MEMORY_ATTACH_ALIGN;
+        if (memory != nullptr)
+        {
+            object.plannable = Memory::attachMemory(context, memory, base);
+        }
+        else
+        {
+            ((vx_tensor)object.ref)->addr = base;
+        }
+        if (object.plannable == vx_true_e)
+        {
+            /* the object may not go away while it points into a slab */
+            object.ref->incrementReference(VX_INTERNAL);
+            plannedRefs.push_back(object.ref);
+        }
+    }
+    for (vx_planned_object_t &object : objects)
+    {
+        if (object.plannable == vx_false_e)
+        {
+            slabBytes += object.size;
+            if (allocateUnplanned(object.ref) == vx_false_e)
+            {
+                vxAddLogEntry(reinterpret_cast<vx_reference>(this), VX_ERROR_NO_MEMORY,
+                              "Failed to allocate virtual object %p of type %d\n", object.ref,
+                              object.ref->type);
+                VX_PRINT(VX_ZONE_ERROR, "See log\n");
+            }
+        }
+    }
+
+    VX_PRINT(VX_ZONE_GRAPH,
+             "Placed " VX_FMT_SIZE " of " VX_FMT_SIZE " virtual objects in " VX_FMT_SIZE
+             " slabs, peak " VX_FMT_SIZE " bytes instead of " VX_FMT_SIZE "\n",
+             plannedRefs.size(), objects.size(), memorySlabs.size(), slabBytes, virtualBytes);
+}
+
+void Graph::releaseMemoryPlan()
+{
+    for (vx_reference ref : plannedRefs)
+    {
+        vx_memory_t *memory = plannedMemory(ref);
+        if (memory != nullptr)
+        {
+            Memory::detachMemory(context, memory);
+        }
+        else
+        {
+            ((vx_tensor)ref)->addr = nullptr;
+        }
+        Reference::releaseReference(&ref, ref->type, VX_INTERNAL, nullptr);
+    }
+    plannedRefs.clear();
+    for (vx_uint8 *slab : memorySlabs)
+    {
+        context->memory_pool.release(slab);
+    }
+    memorySlabs.clear();
+    virtualBytes = 0;
+    slabBytes = 0;
+}
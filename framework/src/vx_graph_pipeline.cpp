@@ -18,6 +18,7 @@
 #include <VX/vx_khr_pipelining.h>
 
 #include <algorithm>
+#include <cinttypes>
 
 #include "vx_internal.h"
 
@@ -25,6 +26,628 @@ using namespace coreflow;
 
 #ifdef OPENVX_USE_PIPELINING
 
+/******************************************************************************/
+/* INTERNAL FUNCTIONS */
+/******************************************************************************/
+
+vx_bool Graph::pipelineEnabled()
+{
+    vx_bool enabled = (scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO && numEnqueableParams > 0 &&
+                       shouldSerialize == vx_false_e) ? vx_true_e : vx_false_e;
+
+#if defined(OPENVX_USE_SMP)
+    if (!context->workers || context->workers->numWorkers == 0)
+    {
+        enabled = vx_false_e;
+    }
+#else
+    enabled = vx_false_e;
+#endif
+#ifdef OPENVX_USE_STREAMING
+    if (isStreaming == vx_true_e)
+    {
+        enabled = vx_false_e;
+    }
+#endif
+    /* delays age once per whole execution, which has no meaning for overlapping frames */
+    for (vx_delay delay : delays)
+    {
+        if (delay != nullptr)
+        {
+            enabled = vx_false_e;
+        }
+    }
+
+    return enabled;
+}
+
+vx_reference Graph::pipelineClone(vx_reference ref)
+{
+    vx_reference clone = nullptr;
+
+    switch (ref->type)
+    {
+        case VX_TYPE_IMAGE:
+        {
+            vx_image image = (vx_image)ref;
+            vx_bool shared = (image->parent != nullptr || image->constant == vx_true_e) ? vx_true_e : vx_false_e;
+            /* ROIs alias their parent, so neither side can be duplicated on its own */
+            for (vx_uint32 i = 0; i < VX_INT_MAX_REF && shared == vx_false_e; i++)
+            {
+                if (image->subimages[i] != nullptr)
+                {
+                    shared = vx_true_e;
+                }
+            }
+            if (shared == vx_false_e)
+            {
+                vx_image copy = vxCreateImage(context, image->width, image->height, image->format);
+                if (vxGetStatus((vx_reference)copy) == VX_SUCCESS)
+                {
+                    copy->allocateImage();
+                    clone = (vx_reference)copy;
+                }
+            }
+            break;
+        }
+        case VX_TYPE_ARRAY:
+        {
+            vx_array array = (vx_array)ref;
+            vx_array copy = vxCreateArray(context, array->item_type, array->capacity);
+            if (vxGetStatus((vx_reference)copy) == VX_SUCCESS)
+            {
+                copy->allocateArray();
+                clone = (vx_reference)copy;
+            }
+            break;
+        }
+        case VX_TYPE_LUT:
+        {
+            vx_lut_t lut = (vx_lut_t)ref;
+            clone = (vx_reference)vxCreateLUT(context, lut->itemType(), lut->numItems());
+            break;
+        }
+        case VX_TYPE_SCALAR:
+        {
+            /* no scalar type is wider than 64 bits */
+            const vx_uint64 zero = 0u;
+            clone = (vx_reference)vxCreateScalar(context, ((vx_scalar)ref)->data_type, &zero);
+            break;
+        }
+        case VX_TYPE_TENSOR:
+        {
+            vx_tensor tensor = (vx_tensor)ref;
+            vx_bool shared = (tensor->parent != nullptr) ? vx_true_e : vx_false_e;
+            /* views alias their parent, like image ROIs */
+            for (vx_uint32 i = 0; i < VX_INT_MAX_REF && shared == vx_false_e; i++)
+            {
+                if (tensor->subtensors[i] != nullptr || tensor->subimages[i] != nullptr)
+                {
+                    shared = vx_true_e;
+                }
+            }
+            if (shared == vx_false_e)
+            {
+                vx_tensor copy = vxCreateTensor(context, tensor->number_of_dimensions, tensor->dimensions,
+                                                tensor->data_type, tensor->fixed_point_position);
+                if (vxGetStatus((vx_reference)copy) == VX_SUCCESS)
+                {
+                    copy->allocateTensorMemory();
+                    clone = (vx_reference)copy;
+                }
+            }
+            break;
+        }
+        case VX_TYPE_MATRIX:
+        {
+            vx_matrix matrix = (vx_matrix)ref;
+            clone = (vx_reference)vxCreateMatrix(context, matrix->data_type, matrix->columns, matrix->rows);
+            break;
+        }
+        case VX_TYPE_CONVOLUTION:
+        {
+            vx_convolution conv = (vx_convolution)ref;
+            vx_convolution copy = vxCreateConvolution(context, conv->columns, conv->rows);
+            if (vxGetStatus((vx_reference)copy) == VX_SUCCESS)
+            {
+                copy->setScale(conv->scaleFactor());
+                clone = (vx_reference)copy;
+            }
+            break;
+        }
+        case VX_TYPE_DISTRIBUTION:
+        {
+            vx_size bins = 0;
+            vx_int32 offset = 0;
+            vx_uint32 range = 0;
+            vx_distribution dist = (vx_distribution)ref;
+            vxQueryDistribution(dist, VX_DISTRIBUTION_BINS, &bins, sizeof(bins));
+            vxQueryDistribution(dist, VX_DISTRIBUTION_OFFSET, &offset, sizeof(offset));
+            vxQueryDistribution(dist, VX_DISTRIBUTION_RANGE, &range, sizeof(range));
+            clone = (vx_reference)vxCreateDistribution(context, bins, offset, range);
+            break;
+        }
+        case VX_TYPE_REMAP:
+        {
+            vx_remap remap = (vx_remap)ref;
+            clone = (vx_reference)vxCreateRemap(context, remap->src_width, remap->src_height,
+                                                remap->dst_width, remap->dst_height);
+            break;
+        }
+        case VX_TYPE_THRESHOLD:
+        {
+            vx_threshold threshold = (vx_threshold)ref;
+            clone = (vx_reference)vxCreateThresholdForImage(context, threshold->thresh_type,
+                                                            threshold->input_format, threshold->output_format);
+            break;
+        }
+        case VX_TYPE_PYRAMID:
+        {
+            vx_pyramid pyramid = (vx_pyramid)ref;
+            vx_pyramid copy = vxCreatePyramid(context, pyramid->numLevels, pyramid->scale, pyramid->width,
+                                              pyramid->height, pyramid->format);
+            if (vxGetStatus((vx_reference)copy) == VX_SUCCESS)
+            {
+                for (vx_size i = 0; i < copy->numLevels; i++)
+                {
+                    copy->levels[i]->allocateImage();
+                }
+                clone = (vx_reference)copy;
+            }
+            break;
+        }
+        case VX_TYPE_OBJECT_ARRAY:
+        {
+            vx_object_array array = (vx_object_array)ref;
+            if (array->num_items > 0)
+            {
+                clone = (vx_reference)vxCreateObjectArray(context, array->items[0], array->num_items);
+            }
+            break;
+        }
+        case VX_TYPE_USER_DATA_OBJECT:
+        {
+            vx_user_data_object object = (vx_user_data_object)ref;
+            clone = (vx_reference)vxCreateUserDataObject(context, object->type_name, object->size, nullptr);
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (clone != nullptr && vxGetStatus(clone) != VX_SUCCESS)
+    {
+        clone = nullptr;
+    }
+
+    return clone;
+}
+
+vx_status Graph::pipelineSetup()
+{
+    vx_uint32 depth = VX_INT_MAX_PARAM_QUEUE_DEPTH, gp, n, p, s;
+    std::vector<std::vector<vx_reference>> copies;
+
+    /* as many frames in flight as every enqueable parameter has buffers for */
+    for (gp = 0; gp < numEnqueableParams; gp++)
+    {
+        depth = std::min(depth, parameters[gp].numBufs);
+        pipeline.originals.push_back(parameters[gp].node->parameters[parameters[gp].index]);
+        copies.emplace_back();
+    }
+    depth = std::max(depth, 1u);
+
+    /* give every further frame slot its own copy of the virtual intermediates */
+    for (n = 0; n < numNodes; n++)
+    {
+        for (p = 0; p < nodes[n]->kernel->signature.num_parameters; p++)
+        {
+            vx_reference ref = nodes[n]->parameters[p];
+            std::vector<vx_reference> slots;
+            if (ref == nullptr || ref->is_virtual == vx_false_e ||
+                std::find(pipeline.originals.begin(), pipeline.originals.end(), ref) !=
+                    pipeline.originals.end())
+            {
+                continue;
+            }
+            /* pyramid levels and object array items alias their container, so a container
+             * whose elements the graph also uses directly cannot be duplicated either */
+            vx_bool aliased = (ref->scope != nullptr && (ref->scope->type == VX_TYPE_PYRAMID ||
+                                                          ref->scope->type == VX_TYPE_OBJECT_ARRAY))
+                                  ? vx_true_e : vx_false_e;
+            for (vx_uint32 c = 0; c < numNodes && aliased == vx_false_e; c++)
+            {
+                for (vx_uint32 pc = 0; pc < nodes[c]->kernel->signature.num_parameters; pc++)
+                {
+                    if (nodes[c]->parameters[pc] != nullptr && nodes[c]->parameters[pc]->scope == ref)
+                    {
+                        aliased = vx_true_e;
+                    }
+                }
+            }
+            for (s = 1; s < depth && aliased == vx_false_e; s++)
+            {
+                vx_reference clone = pipelineClone(ref);
+                if (clone == nullptr)
+                {
+                    break;
+                }
+                slots.push_back(clone);
+            }
+            if (slots.size() + 1 != depth)
+            {
+                VX_PRINT(VX_ZONE_GRAPH, "Node[%u].parameter[%u] is shared between frames\n", n, p);
+                for (vx_reference clone : slots)
+                {
+                    vxReleaseReference(&clone);
+                }
+                continue;
+            }
+            pipeline.originals.push_back(ref);
+            pipeline.clones.insert(pipeline.clones.end(), slots.begin(), slots.end());
+            copies.push_back(slots);
+        }
+    }
+
+    pipeline.nodes.assign(nodes.begin(), nodes.end());
+    pipeline.bindings.assign(numNodes, {});
+    pipeline.sharedReaders.assign(numNodes, {});
+    pipeline.sharedWriters.assign(numNodes, {});
+    for (n = 0; n < numNodes; n++)
+    {
+        for (p = 0; p < nodes[n]->kernel->signature.num_parameters; p++)
+        {
+            vx_reference ref = nodes[n]->parameters[p];
+            auto key = std::find(pipeline.originals.begin(), pipeline.originals.end(), ref);
+            vx_enum dir = nodes[n]->kernel->signature.directions[p];
+            if (ref == nullptr)
+            {
+                continue;
+            }
+            if (key != pipeline.originals.end())
+            {
+                pipeline.bindings[n].push_back({p, (vx_uint32)(key - pipeline.originals.begin())});
+                continue;
+            }
+            if (dir != VX_OUTPUT && dir != VX_BIDIRECTIONAL)
+            {
+                continue;
+            }
+            /* a buffer all frames share may only be rewritten once its readers are done */
+            for (vx_uint32 c = 0; c < numNodes; c++)
+            {
+                for (vx_uint32 pc = 0; c != n && pc < nodes[c]->kernel->signature.num_parameters; pc++)
+                {
+                    if (nodes[c]->kernel->signature.directions[pc] == VX_INPUT &&
+                        Graph::checkWriteDependency(ref, nodes[c]->parameters[pc]))
+                    {
+                        pipeline.sharedReaders[n].push_back(c);
+                        pipeline.sharedWriters[c].push_back(n);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    pipeline.frames.assign(depth, PipelineFrame{});
+    for (s = 0; s < depth; s++)
+    {
+        PipelineFrame& frame = pipeline.frames[s];
+        frame.active = vx_false_e;
+        frame.pending.assign(numNodes, 0u);
+        frame.issued.assign(numNodes, vx_false_e);
+        frame.refs.assign(pipeline.originals.size(), nullptr);
+        for (vx_uint32 k = numEnqueableParams; k < pipeline.originals.size(); k++)
+        {
+            frame.refs[k] = (s == 0) ? pipeline.originals[k] : copies[k][s - 1];
+        }
+    }
+    pipeline.items.assign(depth * numNodes, vx_value_set_t{});
+    pipeline.nodeFrame.assign(numNodes, 0u);
+    pipeline.nextSeq = 0u;
+    pipeline.backlog = 0u;
+    pipeline.inflight = 0u;
+    pipeline.overlapped = 0u;
+    pipeline.status = VX_SUCCESS;
+
+    dispatchDepth = 1u;
+    for (n = 0; n < numNodes; n++)
+    {
+        Graph::setVirtualAccess(nodes[n], vx_true_e);
+        dispatchDepth = std::max({dispatchDepth, nodes[n]->kernel->input_depth, nodes[n]->kernel->output_depth});
+    }
+    pipeline.configured = vx_true_e;
+
+    VX_PRINT(VX_ZONE_GRAPH, "Pipelining %u frames with %zu per-frame buffers\n", depth,
+             pipeline.clones.size());
+    return VX_SUCCESS;
+}
+
+void Graph::pipelineAdmit(std::vector<vx_value_set_t*>& issue)
+{
+    while (pipeline.backlog > 0)
+    {
+        vx_uint32 s = (vx_uint32)(pipeline.nextSeq % pipeline.frames.size());
+        PipelineFrame& frame = pipeline.frames[s];
+        if (frame.active == vx_true_e)
+        {
+            break;
+        }
+        for (vx_uint32 gp = 0; gp < numEnqueableParams; gp++)
+        {
+            if (!parameters[gp].queue.dequeueReady(frame.refs[gp]))
+            {
+                VX_PRINT(VX_ZONE_ERROR, "No ready reference for graph parameter %u\n", gp);
+                pipeline.status = VX_ERROR_NO_RESOURCES;
+                pipeline.backlog = 0;
+                break;
+            }
+        }
+        if (pipeline.backlog == 0)
+        {
+            break;
+        }
+
+        frame.seq = pipeline.nextSeq++;
+        frame.active = vx_true_e;
+        frame.remaining = numNodes;
+        frame.action = VX_ACTION_CONTINUE;
+        for (vx_uint32 n = 0; n < numNodes; n++)
+        {
+            frame.pending[n] = inDegree[n];
+            frame.issued[n] = vx_false_e;
+        }
+        pipeline.backlog--;
+        pipeline.inflight++;
+        state = VX_GRAPH_STATE_RUNNING;
+        VX_PRINT(VX_ZONE_GRAPH, "Frame %" PRIu64 " started in slot %u\n", frame.seq, s);
+
+        for (vx_uint32 n = 0; n < numNodes; n++)
+        {
+            pipelineTry(s, n, issue);
+        }
+    }
+}
+
+void Graph::pipelineTry(vx_uint32 slot, vx_uint32 index, std::vector<vx_value_set_t*>& issue)
+{
+    PipelineFrame& frame = pipeline.frames[slot];
+
+    if (frame.active == vx_false_e || frame.issued[index] == vx_true_e || frame.pending[index] > 0 ||
+        pipeline.nodeFrame[index] != frame.seq)
+    {
+        return;
+    }
+    for (vx_uint32 reader : pipeline.sharedReaders[index])
+    {
+        if (pipeline.nodeFrame[reader] < frame.seq)
+        {
+            return;
+        }
+    }
+    frame.issued[index] = vx_true_e;
+
+    if (frame.action != VX_ACTION_CONTINUE)
+    {
+        /* the rest of an abandoned frame is skipped, but its buffers still come back */
+        for (vx_uint32 gp = 0; gp < numEnqueableParams; gp++)
+        {
+            if (parameters[gp].node == nodes[index])
+            {
+                (void)parameters[gp].queue.enqueueDone(frame.refs[gp]);
+            }
+        }
+        pipelineRetire(slot, index, frame.action, issue);
+        return;
+    }
+
+    const PipelineFrame& previous = pipeline.frames[(slot + pipeline.frames.size() - 1) % pipeline.frames.size()];
+    if (previous.active == vx_true_e && previous.seq + 1 == frame.seq)
+    {
+        pipeline.overlapped++;
+    }
+
+    vx_value_set_t* work = &pipeline.items[slot * numNodes + index];
+    work->v1 = (vx_value_t)context->targets[nodes[index]->affinity];
+    work->v2 = (vx_value_t)nodes[index];
+    work->v3 = (vx_value_t)dispatchDepth;
+    issue.push_back(work);
+}
+
+void Graph::pipelineRetire(vx_uint32 slot, vx_uint32 index, vx_action action,
+                           std::vector<vx_value_set_t*>& issue)
+{
+    PipelineFrame& frame = pipeline.frames[slot];
+    vx_uint64 seq = frame.seq;
+    vx_uint32 next = (slot + 1) % (vx_uint32)pipeline.frames.size();
+
+    if (action != VX_ACTION_CONTINUE)
+    {
+        frame.action = VX_ACTION_ABANDON;
+        pipeline.status = VX_ERROR_GRAPH_ABANDONED;
+    }
+    pipeline.nodeFrame[index] = seq + 1;
+    frame.remaining--;
+
+    for (vx_uint32 i = successorOffsets[index]; i < successorOffsets[index + 1]; i++)
+    {
+        frame.pending[successors[i]]--;
+        pipelineTry(slot, successors[i], issue);
+    }
+
+    /* the node itself, and the writers waiting for it to read a shared buffer, may now
+     * move on to the next frame */
+    if (pipeline.frames[next].active == vx_true_e && pipeline.frames[next].seq == seq + 1)
+    {
+        pipelineTry(next, index, issue);
+        for (vx_uint32 writer : pipeline.sharedWriters[index])
+        {
+            pipelineTry(next, writer, issue);
+        }
+    }
+
+    if (frame.remaining == 0)
+    {
+        VX_PRINT(VX_ZONE_GRAPH, "Frame %" PRIu64 " completed in slot %u\n", seq, slot);
+        frame.active = vx_false_e;
+        pipeline.inflight--;
+
+        vx_event_info_t event_info;
+        event_info.graph_completed.graph = this;
+        if (context->event_queue.isEnabled() &&
+            VX_SUCCESS != context->event_queue.push(VX_EVENT_GRAPH_COMPLETED, 0, &event_info,
+                                                    (vx_reference)this))
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Failed to push graph completed event for graph %p\n", this);
+        }
+
+        pipelineAdmit(issue);
+        if (pipeline.inflight == 0 && pipeline.backlog == 0)
+        {
+            state = (pipeline.status == VX_SUCCESS) ? VX_GRAPH_STATE_COMPLETED
+                                                    : VX_GRAPH_STATE_ABANDONED;
+            pipeline.drained.notify_all();
+        }
+    }
+}
+
+vx_status Graph::pipelineSubmit(vx_uint32 frames)
+{
+    vx_status status = VX_SUCCESS;
+    std::vector<vx_value_set_t*> issue;
+
+    {
+        std::lock_guard<std::mutex> guard(pipeline.lock);
+        if (pipeline.configured == vx_false_e)
+        {
+            status = pipelineSetup();
+        }
+        if (status == VX_SUCCESS)
+        {
+            pipeline.backlog += frames;
+            pipelineAdmit(issue);
+        }
+    }
+
+    for (vx_value_set_t* work : issue)
+    {
+        if (Osal::issueThreadpool(context->workers, work, 1) == vx_false_e)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Failed to issue pipelined work!\n");
+            status = VX_ERROR_NO_RESOURCES;
+        }
+    }
+
+    return status;
+}
+
+void Graph::pipelineBind(vx_value_set_t* workitem)
+{
+    if (pipeline.configured == vx_false_e || workitem < pipeline.items.data() ||
+        workitem >= pipeline.items.data() + pipeline.items.size())
+    {
+        return;
+    }
+
+    vx_uint32 item = (vx_uint32)(workitem - pipeline.items.data());
+    PipelineFrame& frame = pipeline.frames[item / numNodes];
+    vx_node node = nodes[item % numNodes];
+
+    /* the node runs one frame at a time, so nothing else reads these slots meanwhile */
+    for (const auto& binding : pipeline.bindings[item % numNodes])
+    {
+        node->parameters[binding.first] = frame.refs[binding.second];
+    }
+}
+
+vx_bool Graph::pipelineCompleted(vx_value_set_t* workitem)
+{
+    std::vector<vx_value_set_t*> issue;
+
+    if (pipeline.configured == vx_false_e || workitem < pipeline.items.data() ||
+        workitem >= pipeline.items.data() + pipeline.items.size())
+    {
+        return vx_false_e;
+    }
+
+    vx_uint32 item = (vx_uint32)(workitem - pipeline.items.data());
+    vx_action action = (vx_action)workitem->v3;
+
+    /* the frame cannot retire before this node does, so its references are stable here */
+    completeNode((vx_node)workitem->v2, action, pipeline.frames[item / numNodes].refs.data());
+    {
+        std::lock_guard<std::mutex> guard(pipeline.lock);
+        pipelineRetire(item / numNodes, item % numNodes, action, issue);
+    }
+
+    for (vx_value_set_t* work : issue)
+    {
+        Osal::issueThreadpool(context->workers, work, 1);
+    }
+
+    return vx_true_e;
+}
+
+vx_status Graph::pipelineDrain()
+{
+    vx_status status;
+    std::unique_lock<std::mutex> guard(pipeline.lock);
+
+    pipeline.drained.wait(guard, [this] { return pipeline.inflight == 0 && pipeline.backlog == 0; });
+    status = pipeline.status;
+    pipeline.status = VX_SUCCESS;
+
+    return status;
+}
+
+void Graph::pipelineRelease()
+{
+    if (pipeline.configured == vx_false_e)
+    {
+        return;
+    }
+
+    (void)pipelineDrain();
+
+    std::lock_guard<std::mutex> guard(pipeline.lock);
+    for (vx_uint32 i = 0; i < pipeline.nodes.size(); i++)
+    {
+        /* only nodes still in the graph, removed ones no longer own their parameters */
+        if (std::find(nodes.begin(), nodes.end(), pipeline.nodes[i]) == nodes.end())
+        {
+            continue;
+        }
+        for (const auto& binding : pipeline.bindings[i])
+        {
+            pipeline.nodes[i]->parameters[binding.first] = pipeline.originals[binding.second];
+        }
+    }
+    for (vx_reference clone : pipeline.clones)
+    {
+        vxReleaseReference(&clone);
+    }
+    for (vx_uint32 n = 0; n < numNodes; n++)
+    {
+        Graph::setVirtualAccess(nodes[n], vx_false_e);
+    }
+
+    pipeline.frames.clear();
+    pipeline.items.clear();
+    pipeline.originals.clear();
+    pipeline.clones.clear();
+    pipeline.nodes.clear();
+    pipeline.bindings.clear();
+    pipeline.sharedReaders.clear();
+    pipeline.sharedWriters.clear();
+    pipeline.nodeFrame.clear();
+    pipeline.configured = vx_false_e;
+}
+
+/******************************************************************************/
+/* PUBLIC API */
+/******************************************************************************/
+
 VX_API_ENTRY vx_status vxSetGraphScheduleConfig(
     vx_graph graph,
     vx_enum graph_schedule_mode,
@@ -161,6 +784,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxGraphParameterEnqueueReadyRef(vx_graph grap
     {
         vx_bool readyToSchedule = vx_true_e;
         vx_uint32 numParams = std::min(graph->numParams, graph->numEnqueableParams);
+        vx_uint32 sets = 0u;
 
         while (readyToSchedule)
         {
@@ -180,17 +804,26 @@ VX_API_ENTRY vx_status VX_API_CALL vxGraphParameterEnqueueReadyRef(vx_graph grap
                     graph->parameters[i].queue.movePendingToReady();
                 }
 
-                if (graph->scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO
 #ifdef OPENVX_USE_STREAMING
-                    && vx_false_e == graph->isStreaming
+                if (vx_true_e == graph->isStreaming)
+                {
+                    /* the streaming thread runs the graph once it has a full set */
+                    graph->streamingNotify();
+                }
+                else
 #endif
-                )
+                if (graph->scheduleMode == VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO)
                 {
-                    /* Schedule the graph */
-                    status = vxScheduleGraph(graph);
+                    sets++;
                 }
             }
         }
+
+        if (sets > 0u)
+        {
+            /* Schedule every complete set at once, so the frames of one call overlap */
+            status = graph->schedule(sets);
+        }
     }
 
     return status;
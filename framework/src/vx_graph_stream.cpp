@@ -85,16 +85,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxStartGraphStreaming(vx_graph graph)
 
     if (VX_SUCCESS == status)
     {
-        if (vx_false_e == graph->isStreaming)
-        {
-            graph->isStreaming = vx_true_e;
-            graph->streamingThread = std::thread([graph]() { graph->streamingLoop(); });
-            VX_PRINT(VX_ZONE_INFO, "Graph streaming thread started\n");
-        }
-        else
-        {
-            VX_PRINT(VX_ZONE_WARNING, "this graph is currently already streaming\n");
-        }
+        status = graph->streamingStart();
     }
 
     return status;
@@ -112,33 +103,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxStopGraphStreaming(vx_graph graph)
 
     if (VX_SUCCESS == status)
     {
-        if (vx_true_e != graph->isStreaming)
-        {
-            VX_PRINT(VX_ZONE_ERROR, "Streaming has not been started\n");
-            status = VX_ERROR_INVALID_PARAMETERS;
-        }
+        // Stop the loop and join it once the current execution completes
+        status = graph->streamingStop();
     }
 
     if (VX_SUCCESS == status)
     {
-        // First set streaming to false to stop the loop
-        graph->isStreaming = vx_false_e;
-
-        // Wait up to 5 seconds for the thread to finish
-        std::this_thread::sleep_for(std::chrono::seconds(5));
-
-        // Wait for any pending graph executions to complete
-        vxWaitGraph(graph);
-
-        // Wait and join streaming thread with a timeout
-        if (graph->streamingThread.joinable())
-        {
-            // If thread is still running, force join
-            graph->streamingThread.join();
-
-            VX_PRINT(VX_ZONE_INFO, "Graph streaming joined\n");
-        }
-
         // Reset streaming state
         graph->isStreamingEnabled = vx_false_e;
         graph->triggerNodeIndex = UINT32_MAX;
@@ -39,7 +39,8 @@ parent(nullptr),
 subimages(),
 constant(vx_false_e),
 region(),
-memory_type()
+memory_type(),
+fd_maps()
 {
 }
 
@@ -934,6 +935,14 @@ vx_status Image::accessPatch(const vx_rectangle_t *rect, vx_uint32 plane_index,
         goto exit;
     }
 
+    /* a writer takes private planes before touching shared ones */
+    if ((usage != VX_READ_ONLY) && (unshareImage(vx_true_e) == vx_false_e))
+    {
+        VX_PRINT(VX_ZONE_ERROR, "No memory!\n");
+        status = VX_ERROR_NO_MEMORY;
+        goto exit;
+    }
+
     /* can't write to constant */
     if ((constant == vx_true_e) && ((usage == VX_WRITE_ONLY) || (usage == VX_READ_AND_WRITE)))
     {
@@ -1514,6 +1523,18 @@ vx_status Image::copyPatch(const vx_rectangle_t *rect, vx_uint32 plane_index,
         status = VX_ERROR_NO_MEMORY;
     }
 
+    /* a writer takes private planes before touching shared ones, an overwrite of the
+     * whole single plane has nothing worth copying over */
+    if ((VX_SUCCESS == status) && (usage != VX_READ_ONLY) &&
+        (unshareImage((usage == VX_WRITE_ONLY && memory.nptrs == 1u && start_x == 0u &&
+                       start_y == 0u && end_x == width && end_y == height)
+                          ? vx_false_e
+                          : vx_true_e) == vx_false_e))
+    {
+        VX_PRINT(VX_ZONE_ERROR, "No memory!\n");
+        status = VX_ERROR_NO_MEMORY;
+    }
+
     /* can't write to constant */
     if ((VX_SUCCESS == status) && (constant == vx_true_e) && (usage == VX_WRITE_ONLY))
     {
@@ -1852,6 +1873,19 @@ vx_status Image::mapPatch(const vx_rectangle_t *rect, vx_uint32 plane_index, vx_
         goto exit;
     }
 
+    /* a writer takes private planes before touching shared ones, an overwrite of the
+     * whole single plane has nothing worth copying over */
+    if ((usage != VX_READ_ONLY) &&
+        (unshareImage((usage == VX_WRITE_ONLY && memory.nptrs == 1u && start_x == 0u &&
+                       start_y == 0u && end_x == width && end_y == height)
+                          ? vx_false_e
+                          : vx_true_e) == vx_false_e))
+    {
+        VX_PRINT(VX_ZONE_ERROR, "No memory!\n");
+        status = VX_ERROR_NO_MEMORY;
+        goto exit;
+    }
+
     /* can't write to constant */
     if ((constant == vx_true_e) && ((usage == VX_WRITE_ONLY) || (usage == VX_READ_AND_WRITE)))
     {
@@ -1871,13 +1905,30 @@ vx_status Image::mapPatch(const vx_rectangle_t *rect, vx_uint32 plane_index, vx_
     {
         vx_memory_map_extra extra;
         vx_uint8 *buf = 0;
+        /* Map the plane in place with its own addressing, unless the patch splits bytes of
+         * a sub-byte format: the caller could then clobber pixels outside of it, which only
+         * the write-back of a copy protects. */
+        vx_bool direct = (memory.stride_x_bits[plane_index] == 0 ||
+                          ((start_x * memory.stride_x_bits[plane_index]) % 8 == 0 &&
+                           ((end_x * memory.stride_x_bits[plane_index]) % 8 == 0 ||
+                            end_x == width)))
+                             ? vx_true_e
+                             : vx_false_e;
 
         size = vxComputeImagePatchSize(this, rect, plane_index);
 
         extra.image_data.plane_index = plane_index;
         extra.image_data.rect = *rect;
 
-        if (VX_MEMORY_TYPE_NONE != memory_type &&
+#ifdef OPENVX_USE_OPENCL_INTEROP
+        /* the OpenCL buffer wraps a compact patch */
+        if (VX_MEMORY_TYPE_NONE == memory_type && mem_type_requested == VX_MEMORY_TYPE_OPENCL_BUFFER)
+        {
+            direct = vx_false_e;
+        }
+#endif
+
+        if ((VX_MEMORY_TYPE_NONE != memory_type || direct == vx_true_e) &&
             vx_true_e == context->memoryMap((vx_reference)this, 0, usage, mem_type, flags, &extra,
                                             (void **)&buf, map_id))
         {
@@ -2169,6 +2220,62 @@ exit:
     return status;
 }
 
+vx_bool Image::shareImage(vx_image input, vx_image output)
+{
+    /* ROIs and channels point into the planes, so neither side may have any */
+    auto plain = [](vx_image image) {
+        if (image->memory_type != VX_MEMORY_TYPE_NONE || image->parent != nullptr ||
+            image->is_virtual == vx_true_e)
+        {
+            return vx_false_e;
+        }
+        for (vx_uint32 p = 0; p < VX_INT_MAX_REF; p++)
+        {
+            if (image->subimages[p] != nullptr)
+            {
+                return vx_false_e;
+            }
+        }
+        return vx_true_e;
+    };
+
+    if (Image::isValidImage(input) == vx_false_e || Image::isValidImage(output) == vx_false_e ||
+        input == output || input->format != output->format || input->width != output->width ||
+        input->height != output->height || output->constant == vx_true_e ||
+        plain(input) == vx_false_e || plain(output) == vx_false_e ||
+        input->memory.allocated == vx_false_e)
+    {
+        return vx_false_e;
+    }
+    /* a copy only writes the valid region, the rest of the output keeps its pixels, so
+     * the planes can only stand in for it when the whole input is valid */
+    vx_rectangle_t rect;
+    input->getValidRegion(&rect);
+    if (rect.start_x != 0u || rect.start_y != 0u || rect.end_x != input->width ||
+        rect.end_y != input->height)
+    {
+        return vx_false_e;
+    }
+
+    if (Memory::shareMemory(input->context, &input->memory, &output->memory) == vx_false_e)
+    {
+        return vx_false_e;
+    }
+    VX_PRINT(VX_ZONE_IMAGE, "Image %p shares the planes of %p\n", output, input);
+
+    return vx_true_e;
+}
+
+vx_bool Image::unshareImage(vx_bool keep)
+{
+    if (memory.share == nullptr)
+    {
+        return vx_true_e;
+    }
+    VX_PRINT(VX_ZONE_IMAGE, "Image %p takes private planes before a write\n", this);
+    return Memory::unshareMemory(context, &memory, keep);
+}
+
 void Image::printImage(vx_image image)
 {
     vx_uint32 p = 0;
@@ -2235,6 +2342,7 @@ void Image::destruct()
             memory.strides[p][VX_DIM_X] = 0;
             memory.strides[p][VX_DIM_Y] = 0;
             memory.stride_x_bits[p] = 0;
+            Memory::unmapDescriptor(&fd_maps[p]);
         }
         memory.allocated = vx_false_e;
     }
@@ -2445,8 +2553,8 @@ VX_API_ENTRY vx_image VX_API_CALL vxCreateImageFromROI(vx_image image, const vx_
         }
         else
         {
-            /* perhaps the parent hasn't been allocated yet? */
-            if (image->allocateImage() == vx_true_e)
+            /* perhaps the parent hasn't been allocated yet? the ROI writes through its planes */
+            if (image->allocateImage() == vx_true_e && image->unshareImage(vx_true_e) == vx_true_e)
             {
                 subimage = (vx_image)Reference::createReference(image->context, VX_TYPE_IMAGE, VX_EXTERNAL, image->context);
                 if (vxGetStatus((vx_reference)subimage) == VX_SUCCESS)
@@ -2508,6 +2616,7 @@ VX_API_ENTRY vx_image VX_API_CALL vxCreateImageFromROI(vx_image image, const vx_
 
                     memcpy(&subimage->scale, &image->scale, sizeof(image->scale));
                     memcpy(&subimage->memory, &image->memory, sizeof(image->memory));
+                    subimage->memory.share = nullptr;
 
                     /* modify the dimensions */
                     for (p = 0; p < subimage->planes; p++)
@@ -2553,8 +2662,8 @@ VX_API_ENTRY vx_image VX_API_CALL vxCreateImageFromChannel(vx_image image, vx_en
 
     if (Image::isValidImage(image) == vx_true_e)
     {
-        /* perhaps the parent hasn't been allocated yet? */
-        if (image->allocateImage() == vx_true_e)
+        /* perhaps the parent hasn't been allocated yet? the channel writes through its planes */
+        if (image->allocateImage() == vx_true_e && image->unshareImage(vx_true_e) == vx_true_e)
         {
             /* check for valid parameters */
             switch (channel)
@@ -2804,6 +2913,96 @@ VX_API_ENTRY vx_image VX_API_CALL vxCreateImageFromHandle(vx_context context, vx
     return image;
 }
 
+VX_API_ENTRY vx_image VX_API_CALL vxCreateImageFromFd(vx_context context, vx_df_image color, const vx_imagepatch_addressing_t addrs[], const vx_int32 fds[], const vx_size offsets[], vx_enum usage)
+{
+    void *ptrs[VX_PLANE_MAX] = {nullptr};
+    vx_image image = 0;
+    vx_uint32 p = 0;
+
+    if (Context::isValidContext(context) == vx_false_e)
+    {
+        return nullptr;
+    }
+    if (addrs == nullptr || fds == nullptr ||
+        ((usage != VX_READ_ONLY) && (usage != VX_WRITE_ONLY) && (usage != VX_READ_AND_WRITE)))
+    {
+        return (vx_image)vxGetErrorObject(context, VX_ERROR_INVALID_PARAMETERS);
+    }
+
+    /* the planes are described like host memory, only their storage differs */
+    image = vxCreateImageFromHandle(context, color, addrs, ptrs, VX_MEMORY_TYPE_HOST);
+    if (vxGetStatus((vx_reference)image) != VX_SUCCESS)
+    {
+        return image;
+    }
+
+    for (p = 0; p < image->planes; p++)
+    {
+        vx_size size = (vx_size)image->memory.strides[p][VX_DIM_Y] * image->memory.dims[p][VX_DIM_Y];
+        image->memory.ptrs[p] = Memory::mapDescriptor(fds[p], offsets ? offsets[p] : 0, size, usage, &image->fd_maps[p]);
+        if (image->memory.ptrs[p] == nullptr)
+        {
+            /* releasing the image unmaps the planes mapped so far */
+            vxReleaseImage(&image);
+            return (vx_image)vxGetErrorObject(context, VX_ERROR_NO_MEMORY);
+        }
+    }
+
+    return image;
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxSwapImageFd(vx_image image, const vx_int32 fds[], const vx_size offsets[], vx_size num_planes, vx_enum usage)
+{
+    vx_fd_mapping_t maps[VX_PLANE_MAX] = {};
+    void *ptrs[VX_PLANE_MAX] = {nullptr};
+    vx_status status = VX_SUCCESS;
+    vx_uint32 p = 0;
+
+    if (Image::isValidImage(image) == vx_false_e)
+    {
+        return VX_ERROR_INVALID_REFERENCE;
+    }
+    if (image->memory_type != VX_MEMORY_TYPE_HOST || image->parent != nullptr || num_planes != image->planes ||
+        ((fds != nullptr) && (usage != VX_READ_ONLY) && (usage != VX_WRITE_ONLY) && (usage != VX_READ_AND_WRITE)))
+    {
+        return VX_ERROR_INVALID_PARAMETERS;
+    }
+
+    for (p = 0; p < image->planes && fds != nullptr; p++)
+    {
+        vx_size size = (vx_size)image->memory.strides[p][VX_DIM_Y] * image->memory.dims[p][VX_DIM_Y];
+        ptrs[p] = Memory::mapDescriptor(fds[p], offsets ? offsets[p] : 0, size, usage, &maps[p]);
+        if (ptrs[p] == nullptr)
+        {
+            status = VX_ERROR_NO_MEMORY;
+            break;
+        }
+    }
+
+    if (status == VX_SUCCESS)
+    {
+        status = image->swapHandle(fds != nullptr ? ptrs : nullptr, nullptr, num_planes);
+    }
+    if (status == VX_SUCCESS)
+    {
+        /* the old planes are no longer reachable through the image or its ROIs */
+        for (p = 0; p < image->planes; p++)
+        {
+            Memory::unmapDescriptor(&image->fd_maps[p]);
+            image->fd_maps[p] = maps[p];
+        }
+    }
+    else
+    {
+        for (p = 0; p < image->planes; p++)
+        {
+            Memory::unmapDescriptor(&maps[p]);
+        }
+    }
+
+    return status;
+}
+
 VX_API_ENTRY vx_status VX_API_CALL vxSwapImageHandle(vx_image image, void* const new_ptrs[],
     void* prev_ptrs[], vx_size num_planes)
 {
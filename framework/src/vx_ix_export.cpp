@@ -356,7 +356,7 @@ static vx_size putInTable(VXBinExportRefTable *ref_table, const vx_reference new
                     }
                 }
                 /* Need to enumerate all delays that are registered with this graph */
-                for (ix = 0; ix < VX_INT_MAX_REF; ++ix)
+                for (ix = 0; ix < g->delays.size(); ++ix)
                 {
                     actual_numrefs = putInTable(ref_table, (vx_reference)g->delays[ix], actual_numrefs, VX_IX_USE_NO_EXPORT_VALUES);
                 }
@@ -1122,14 +1122,14 @@ static vx_status exportGraph(VXBinExport *xport,vx_size i, int calcSize)
     /* Need to export all delays that are registered with this graph:
         first, count them:
     */
-    for (ix = 0; ix < VX_INT_MAX_REF; ++ix)
+    for (ix = 0; ix < g->delays.size(); ++ix)
     {
         if (g->delays[ix])
             ++delay_count;
     }
     status |= exportVxUint32(xport, delay_count, calcSize);
     /* Now actually output each delay reference in turn */
-    for (ix = 0; ix < VX_INT_MAX_REF && VX_SUCCESS == status; ++ix)
+    for (ix = 0; ix < g->delays.size() && VX_SUCCESS == status; ++ix)
     {
         if (g->delays[ix])
             status |= exportVxUint32(xport, indexOf(xport, (vx_reference)g->delays[ix]), calcSize);
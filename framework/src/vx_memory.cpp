@@ -14,25 +14,232 @@
  * limitations under the License.
  */
 
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "vx_internal.h"
 #include "vx_memory.h"
 
 using namespace coreflow;
 
-vx_bool Memory::freeMemory(vx_context context, vx_memory_t *memory)
+/*! \brief Guards the share of every memory block, its count and the planes it points at.
+ * A share is created and torn down by whichever block gets there first, so one lock
+ * covers them all instead of a lock inside the share.
+ * \ingroup group_int_memory
+ */
+static std::mutex shareLock;
+
+/*! \brief The bookkeeping stored just before every pooled block.
+ * \ingroup group_int_memory
+ */
+typedef struct vx_pool_header_t {
+    /*! \brief What the system returned */
+    void *raw;
+    /*! \brief The alignment raw was allocated with */
+    vx_size rawAlign;
+    /*! \brief The usable bytes of the block */
+    vx_size size;
+    /*! \brief The size class of the block */
+    vx_uint32 sizeClass;
+} vx_pool_header_t;
+
+/*! \brief Reads a size from the environment variable name, if set.
+ * \ingroup group_int_memory
+ */
+static vx_size memoryEnv(const char *name, vx_size fallback)
 {
-    (void)context;
+    const char *str = std::getenv(name);
+    if (str)
+    {
+        return (vx_size)std::strtoull(str, nullptr, 10);
+    }
+    return fallback;
+}
+
+MemoryPool::MemoryPool()
+    : lock(),
+      freeLists(),
+      align(memoryEnv("VX_MEMORY_ALIGNMENT", VX_INT_MEMORY_ALIGNMENT)),
+      cacheLimit(memoryEnv("VX_MEMORY_POOL_CACHE", VX_INT_MEMORY_POOL_CACHE)),
+      cached(0),
+      reused(0),
+      zeroFill(memoryEnv("VX_MEMORY_ZERO_FILL", 1) != 0 ? vx_true_e : vx_false_e),
+      hugePages(memoryEnv("VX_MEMORY_HUGE_PAGES", 0) != 0 ? vx_true_e : vx_false_e)
+{
+    /* the header has to fit in the alignment padding */
+    if (align < sizeof(vx_pool_header_t) || (align & (align - 1)) != 0)
+    {
+        VX_PRINT(VX_ZONE_WARNING, "Ignoring memory alignment " VX_FMT_SIZE "\n", align);
+        align = VX_INT_MEMORY_ALIGNMENT;
+    }
+}
+
+MemoryPool::~MemoryPool()
+{
+    trim();
+}
+
+vx_uint32 MemoryPool::sizeClass(vx_size size, vx_size *rounded)
+{
+    vx_uint32 b = 6;
+    vx_size step, steps;
+
+    if (size <= 64u)
+    {
+        *rounded = 64u;
+        return 0;
+    }
+    /* 2^b < size <= 2^(b+1), split into four classes */
+    while (((vx_size)2u << b) < size)
+    {
+        b++;
+    }
+    step = (vx_size)1u << (b - 2);
+    steps = (size + step - 1) / step;
+    *rounded = steps * step;
+    return 1 + (b - 6) * 4 + (vx_uint32)(steps - 5);
+}
+
+void *MemoryPool::allocate(vx_size size, vx_bool zero)
+{
+    vx_size rounded = 0;
+    vx_uint32 cls = sizeClass(size, &rounded);
+    vx_uint8 *block = nullptr;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (cls < freeLists.size() && !freeLists[cls].empty())
+        {
+            block = (vx_uint8 *)freeLists[cls].back();
+            freeLists[cls].pop_back();
+            cached -= rounded;
+            reused++;
+        }
+    }
+
+    if (block == nullptr)
+    {
+        vx_size rawAlign = align;
+        vx_uint8 *raw;
+        if (hugePages == vx_true_e && rounded >= VX_INT_HUGE_PAGE_SIZE)
+        {
+            rawAlign = VX_INT_HUGE_PAGE_SIZE;
+        }
+        raw = (vx_uint8 *)::operator new(align + rounded, std::align_val_t(rawAlign), std::nothrow);
+        if (raw == nullptr)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Failed to allocate " VX_FMT_SIZE " bytes\n", rounded);
+            return nullptr;
+        }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (rawAlign == VX_INT_HUGE_PAGE_SIZE)
+        {
+            madvise(raw, align + rounded, MADV_HUGEPAGE);
+        }
+#endif
+        block = raw + align;
+        vx_pool_header_t *header = (vx_pool_header_t *)block - 1;
+        header->raw = raw;
+        header->rawAlign = rawAlign;
+        header->size = rounded;
+        header->sizeClass = cls;
+    }
+
+    if (zero == vx_true_e && zeroFill == vx_true_e)
+    {
+        memset(block, 0, size);
+    }
+    return block;
+}
+
+void MemoryPool::release(void *ptr)
+{
+    vx_pool_header_t *header;
+
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    header = (vx_pool_header_t *)ptr - 1;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (cached + header->size <= cacheLimit)
+        {
+            if (header->sizeClass >= freeLists.size())
+            {
+                freeLists.resize(header->sizeClass + 1);
+            }
+            freeLists[header->sizeClass].push_back(ptr);
+            cached += header->size;
+            return;
+        }
+    }
+    ::operator delete(header->raw, std::align_val_t(header->rawAlign));
+}
+
+void MemoryPool::trim()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::vector<void *> &list : freeLists)
+    {
+        for (void *ptr : list)
+        {
+            vx_pool_header_t *header = (vx_pool_header_t *)ptr - 1;
+            ::operator delete(header->raw, std::align_val_t(header->rawAlign));
+        }
+        list.clear();
+    }
+    cached = 0;
+}
 
+vx_size MemoryPool::alignment() const
+{
+    return align;
+}
+
+vx_size MemoryPool::cachedBytes()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return cached;
+}
+
+vx_size MemoryPool::reusedBlocks()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return reused;
+}
+
+vx_bool Memory::freeMemory(vx_context context, vx_memory_t *memory)
+{
     if (memory->allocated == vx_true_e)
     {
         vx_uint32 p = 0u;
+        vx_bool last = vx_true_e;
         Memory::printMemory(memory);
+        if (memory->share != nullptr)
+        {
+            /* the planes go back to the pool with the last block sharing them */
+            std::lock_guard<std::mutex> guard(shareLock);
+            last = (--memory->share->count == 0u) ? vx_true_e : vx_false_e;
+            if (last == vx_true_e)
+            {
+                delete memory->share;
+            }
+            memory->share = nullptr;
+        }
         for (p = 0; p < memory->nptrs; p++)
         {
             if (memory->ptrs[p])
             {
                 VX_PRINT(VX_ZONE_INFO, "Freeing %p\n", memory->ptrs[p]);
-                delete[](memory->ptrs[p]);
+                if (last == vx_true_e)
+                {
+                    context->memory_pool.release(memory->ptrs[p]);
+                }
                 Osal::destroySem(&memory->locks[p]);
                 memory->ptrs[p] = nullptr;
             }
@@ -42,10 +249,265 @@ vx_bool Memory::freeMemory(vx_context context, vx_memory_t *memory)
     return memory->allocated;
 }
 
-vx_bool Memory::allocateMemory(vx_context context, vx_memory_t *memory)
+vx_size Memory::computePlaneSize(vx_memory_t *memory, vx_uint32 p)
+{
+    vx_uint32 d = 0;
+    vx_size size = sizeof(vx_uint8);
+    /* channel is a declared size, don't assume */
+    if (memory->strides[p][VX_DIM_C] != 0)
+    {
+        size = (size_t)abs(memory->strides[p][VX_DIM_C]);
+    }
+    else if (memory->stride_x_bits[p] != 0)
+    {
+        /* data type is not whole number of bytes */
+        size = 0ul;
+    }
+    if (size == 0ul)
+    {
+        memory->strides[p][VX_DIM_X] = 0;
+        /* the size of each row in the x-dimension, in integer number of bytes (rounded up from bits) */
+        size = ((vx_size)memory->stride_x_bits[p] * (vx_size)memory->dims[p][VX_DIM_X] + 7ul) / 8ul;
+        for (d = 2; d < memory->ndims; d++)
+        {
+            memory->strides[p][d] = (vx_int32)size;
+            size *= (vx_size)memory->dims[p][d];
+        }
+    }
+    else
+    {
+        /* default behavior */
+        for (d = 0; d < memory->ndims; d++)
+        {
+            memory->strides[p][d] = (vx_int32)size;
+            size *= (vx_size)memory->dims[p][d];
+        }
+    }
+    return size;
+}
+
+vx_size Memory::computeAttachSize(vx_memory_t *memory)
+{
+    vx_size total = 0;
+    for (vx_uint32 p = 0; p < memory->nptrs; p++)
+    {
+        total += (Memory::computePlaneSize(memory, p) + VX_MEMORY_ATTACH_ALIGN - 1) &
+                 ~(vx_size)(VX_MEMORY_ATTACH_ALIGN - 1);
+    }
+    return total;
+}
+
+vx_bool Memory::attachMemory(vx_context context, vx_memory_t *memory, vx_uint8 *base)
+{
+    (void)context;
+
+    if (memory == nullptr || base == nullptr || memory->allocated == vx_true_e)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Invalid memory structure provided\n");
+        return vx_false_e;
+    }
+
+    /* the planes are laid out back to back, each one aligned */
+    for (vx_uint32 p = 0; p < memory->nptrs; p++)
+    {
+        memory->ptrs[p] = base;
+        base += (Memory::computePlaneSize(memory, p) + VX_MEMORY_ATTACH_ALIGN - 1) &
+                ~(vx_size)(VX_MEMORY_ATTACH_ALIGN - 1);
+        Osal::createSem(&memory->locks[p], 1);
+    }
+    memory->allocated = vx_true_e;
+    Memory::printMemory(memory);
+
+    return vx_true_e;
+}
+
+void Memory::detachMemory(vx_context context, vx_memory_t *memory)
 {
     (void)context;
 
+    if (memory->allocated == vx_true_e)
+    {
+        for (vx_uint32 p = 0; p < memory->nptrs; p++)
+        {
+            Osal::destroySem(&memory->locks[p]);
+            memory->ptrs[p] = nullptr;
+        }
+        memory->allocated = vx_false_e;
+    }
+}
+
+vx_bool Memory::shareMemory(vx_context context, vx_memory_t *src, vx_memory_t *dst)
+{
+    if (src == nullptr || dst == nullptr || src == dst || src->allocated == vx_false_e ||
+        src->nptrs != dst->nptrs || src->ndims != dst->ndims)
+    {
+        return vx_false_e;
+    }
+    for (vx_uint32 p = 0; p < src->nptrs; p++)
+    {
+        if (src->stride_x_bits[p] != dst->stride_x_bits[p] ||
+            memcmp(src->dims[p], dst->dims[p], sizeof(src->dims[p])) != 0 ||
+            (dst->allocated == vx_true_e &&
+             memcmp(src->strides[p], dst->strides[p], sizeof(src->strides[p])) != 0))
+        {
+            return vx_false_e;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(shareLock);
+        if (src->share != nullptr && src->share == dst->share)
+        {
+            return vx_true_e;
+        }
+    }
+
+    Memory::freeMemory(context, dst);
+
+    /* the source may be unshared by its own writer meanwhile, which swaps its planes */
+    std::lock_guard<std::mutex> guard(shareLock);
+    if (src->share == nullptr)
+    {
+        src->share = new vx_memory_share_t();
+        src->share->count = 1u;
+    }
+    src->share->count++;
+    for (vx_uint32 p = 0; p < src->nptrs; p++)
+    {
+        dst->ptrs[p] = src->ptrs[p];
+        memcpy(dst->strides[p], src->strides[p], sizeof(src->strides[p]));
+        Osal::createSem(&dst->locks[p], 1);
+    }
+    dst->share = src->share;
+    dst->allocated = vx_true_e;
+
+    return vx_true_e;
+}
+
+vx_bool Memory::unshareMemory(vx_context context, vx_memory_t *memory, vx_bool keep)
+{
+    vx_uint8 *planes[VX_PLANE_MAX] = {nullptr};
+
+    {
+        std::lock_guard<std::mutex> guard(shareLock);
+        if (memory->share == nullptr)
+        {
+            return vx_true_e;
+        }
+        if (memory->share->count == 1u)
+        {
+            /* the others are gone, the planes are ours already */
+            delete memory->share;
+            memory->share = nullptr;
+            return vx_true_e;
+        }
+    }
+
+    /* someone else still reads the planes, move to a copy of our own. Our count keeps the
+     * planes alive and nobody writes them while shared, so they are copied unlocked. */
+    for (vx_uint32 p = 0; p < memory->nptrs; p++)
+    {
+        vx_size size = Memory::computePlaneSize(memory, p);
+        planes[p] = (vx_uint8 *)context->memory_pool.allocate(size, vx_false_e);
+        if (planes[p] == nullptr)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Failed to allocate " VX_FMT_SIZE " bytes for a private copy\n", size);
+            for (vx_uint32 pi = 0; pi < p; pi++)
+            {
+                context->memory_pool.release(planes[pi]);
+            }
+            return vx_false_e;
+        }
+        if (keep == vx_true_e)
+        {
+            memcpy(planes[p], memory->ptrs[p], size);
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(shareLock);
+    if (--memory->share->count == 0u)
+    {
+        /* the others left while we copied, so the old planes are ours after all */
+        for (vx_uint32 p = 0; p < memory->nptrs; p++)
+        {
+            context->memory_pool.release(planes[p]);
+        }
+        delete memory->share;
+    }
+    else
+    {
+        for (vx_uint32 p = 0; p < memory->nptrs; p++)
+        {
+            memory->ptrs[p] = planes[p];
+        }
+    }
+    memory->share = nullptr;
+
+    return vx_true_e;
+}
+
+vx_uint8 *Memory::mapDescriptor(vx_int32 fd, vx_size offset, vx_size size, vx_enum usage, vx_fd_mapping_t *mapping)
+{
+    mapping->base = nullptr;
+    mapping->length = 0;
+#if defined(__linux__)
+    if (fd < 0 || size == 0)
+    {
+        return nullptr;
+    }
+    /* only ask for the access the caller needs, so read-only descriptors can be imported */
+    int prot = 0;
+    switch (usage)
+    {
+        case VX_READ_ONLY:
+            prot = PROT_READ;
+            break;
+        case VX_WRITE_ONLY:
+            prot = PROT_WRITE;
+            break;
+        case VX_READ_AND_WRITE:
+            prot = PROT_READ | PROT_WRITE;
+            break;
+        default:
+            VX_PRINT(VX_ZONE_ERROR, "Invalid usage %d for fd %d\n", usage, fd);
+            return nullptr;
+    }
+    /* mmap wants a page aligned file offset, map from the page holding the data */
+    vx_size page = (vx_size)sysconf(_SC_PAGESIZE);
+    vx_size skip = offset % page;
+    void *base = mmap(nullptr, skip + size, prot, MAP_SHARED, fd, (off_t)(offset - skip));
+    if (base == MAP_FAILED)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Failed to map " VX_FMT_SIZE " bytes of fd %d at " VX_FMT_SIZE "\n", size, fd, offset);
+        return nullptr;
+    }
+    mapping->base = base;
+    mapping->length = skip + size;
+    return (vx_uint8 *)base + skip;
+#else
+    (void)fd;
+    (void)offset;
+    (void)size;
+    (void)usage;
+    VX_PRINT(VX_ZONE_ERROR, "File descriptor import is not supported on this platform\n");
+    return nullptr;
+#endif
+}
+
+void Memory::unmapDescriptor(vx_fd_mapping_t *mapping)
+{
+#if defined(__linux__)
+    if (mapping->base != nullptr)
+    {
+        munmap(mapping->base, mapping->length);
+    }
+#endif
+    mapping->base = nullptr;
+    mapping->length = 0;
+}
+
+vx_bool Memory::allocateMemory(vx_context context, vx_memory_t *memory)
+{
     if (memory == nullptr)
     {
         VX_PRINT(VX_ZONE_ERROR, "Invalid memory structure provided\n");
@@ -54,45 +516,13 @@ vx_bool Memory::allocateMemory(vx_context context, vx_memory_t *memory)
 
     if (memory->allocated == vx_false_e)
     {
-        vx_uint32 d = 0;
         vx_uint32 p = 0;
         VX_PRINT(VX_ZONE_INFO, "Allocating %u pointers of %u dimensions each.\n", memory->nptrs, memory->ndims);
         memory->allocated = vx_true_e;
         for (p = 0; p < memory->nptrs; p++)
         {
-            vx_size size = sizeof(vx_uint8);
-            /* channel is a declared size, don't assume */
-            if (memory->strides[p][VX_DIM_C] != 0)
-            {
-                size = (size_t)abs(memory->strides[p][VX_DIM_C]);
-            }
-            else if (memory->stride_x_bits[p] != 0)
-            {
-                /* data type is not whole number of bytes */
-                size = 0ul;
-            }
-            if (size == 0ul)
-            {
-                memory->strides[p][VX_DIM_X] = 0;
-                /* the size of each row in the x-dimension, in integer number of bytes (rounded up from bits) */
-                size = ((vx_size)memory->stride_x_bits[p] * (vx_size)memory->dims[p][VX_DIM_X] + 7ul) / 8ul;
-                for (d = 2; d < memory->ndims; d++)
-                {
-                    memory->strides[p][d] = (vx_int32)size;
-                    size *= (vx_size)memory->dims[p][d];
-                }
-            }
-            else
-            {
-                /* default behavior */
-                for (d = 0; d < memory->ndims; d++)
-                {
-                    memory->strides[p][d] = (vx_int32)size;
-                    size *= (vx_size)memory->dims[p][d];
-                }
-            }
-            /* don't presume that memory should be zeroed */
-            memory->ptrs[p] = new vx_uint8[size]();
+            vx_size size = Memory::computePlaneSize(memory, p);
+            memory->ptrs[p] = (vx_uint8 *)context->memory_pool.allocate(size);
             if (memory->ptrs[p] == nullptr)
             {
                 vx_uint32 pi;
@@ -102,7 +532,7 @@ vx_bool Memory::allocateMemory(vx_context context, vx_memory_t *memory)
                 for (pi = 0; pi < p; pi++)
                 {
                     VX_PRINT(VX_ZONE_INFO, "Freeing %p\n", memory->ptrs[pi]);
-                    free(memory->ptrs[pi]);
+                    context->memory_pool.release(memory->ptrs[pi]);
                     memory->ptrs[pi] = nullptr;
                 }
                 break;
@@ -15,6 +15,8 @@
 
 #include <ctype.h>
 
+#include <algorithm>
+
 #include "vx_internal.h"
 #include "vx_node.h"
 
@@ -41,6 +43,9 @@ Node::Node(vx_context context, vx_reference scope)
       costs(),
       is_replicated(vx_false_e),
       replicated_flags(),
+      replica_perf(),
+      fused_chain(-1),
+      inlined_into(nullptr),
       state(VX_NODE_STATE_STEADY)
 {
 }
@@ -57,44 +62,36 @@ vx_node Node::createNode(vx_graph graph, vx_kernel kernel)
     {
         if (Reference::isValidReference(reinterpret_cast<vx_reference>(kernel), VX_TYPE_KERNEL) == vx_true_e)
         {
-            vx_uint32 n = 0;
             Osal::semWait(&graph->lock);
-            for (n = 0; n < VX_INT_MAX_REF; n++)
+            node = (vx_node)Reference::createReference(graph->context, VX_TYPE_NODE, VX_EXTERNAL, reinterpret_cast<vx_reference>(graph));
+            if (Error::getStatus((vx_reference)node) == VX_SUCCESS && node->type == VX_TYPE_NODE)
             {
-                if (graph->nodes[n] == nullptr)
-                {
-                    node = (vx_node)Reference::createReference(graph->context, VX_TYPE_NODE, VX_EXTERNAL, reinterpret_cast<vx_reference>(graph));
-                    if (Error::getStatus((vx_reference)node) == VX_SUCCESS && node->type == VX_TYPE_NODE)
-                    {
-                        /* reference the abstract kernel. */
-                        node->kernel = kernel;
-                        node->affinity = kernel->affinity;
+                /* reference the abstract kernel. */
+                node->kernel = kernel;
+                node->affinity = kernel->affinity;
 
-                        /* show that there are potentially multiple nodes using this kernel. */
-                        kernel->incrementReference(VX_INTERNAL);
+                /* show that there are potentially multiple nodes using this kernel. */
+                kernel->incrementReference(VX_INTERNAL);
 
-                        /* copy the attributes over */
-                        memcpy(&node->attributes, &kernel->attributes, sizeof(vx_kernel_attr_t));
+                /* copy the attributes over */
+                memcpy(&node->attributes, &kernel->attributes, sizeof(vx_kernel_attr_t));
 
-                        /* setup our forward and back references to the node/graph */
-                        graph->nodes[n] = node;
-                        node->graph = graph;
-                        node->incrementReference(VX_INTERNAL); /* one for the graph */
+                /* setup our forward and back references to the node/graph */
+                graph->nodes.push_back(node);
+                node->graph = graph;
+                node->incrementReference(VX_INTERNAL); /* one for the graph */
 
-                        /* increase the count of nodes in the graph. */
-                        graph->numNodes++;
+                /* increase the count of nodes in the graph. */
+                graph->numNodes++;
 
-                        Osal::initPerf(&graph->nodes[n]->perf);
+                Osal::initPerf(&node->perf);
 
-                        /* force a re-verify */
-                        graph->reverify = graph->verified;
-                        graph->verified = vx_false_e;
-                        graph->state = VX_GRAPH_STATE_UNVERIFIED;
+                /* force a re-verify */
+                graph->reverify = graph->verified;
+                graph->verified = vx_false_e;
+                graph->state = VX_GRAPH_STATE_UNVERIFIED;
 
-                        VX_PRINT(VX_ZONE_NODE, "Created Node %p %s affinity:%s\n", node, node->kernel->name, node->context->targets[node->affinity]->name);
-                    }
-                    break; /* succeed or fail, break. */
-                }
+                VX_PRINT(VX_ZONE_NODE, "Created Node %p %s affinity:%s\n", node, node->kernel->name, node->context->targets[node->affinity]->name);
             }
             Osal::semPost(&graph->lock);
             Reference::printReference((vx_reference )node);
@@ -134,6 +131,22 @@ void Node::setParameter(vx_uint32 index, vx_reference value)
     parameters[index] = (vx_reference)value;
 }
 
+void Node::assignKernel(vx_kernel target_kernel, vx_uint32 target_index)
+{
+    kernel->decrementReference(VX_INTERNAL);
+    kernel = target_kernel;
+    kernel->incrementReference(VX_INTERNAL);
+
+#ifdef OPENVX_KHR_TILING
+    /* the tiling metadata describes the kernel, so it follows the kernel to its new target */
+    attributes.blockinfo = kernel->attributes.blockinfo;
+    attributes.nhbdinfo = kernel->attributes.nhbdinfo;
+    attributes.tileDataSize = kernel->attributes.tileDataSize;
+#endif
+
+    affinity = target_index;
+}
+
 vx_status Node::setTarget(vx_enum target_enum, const char *target_string)
 {
     vx_status status = VX_FAILURE;
@@ -185,11 +198,7 @@ vx_status Node::setTarget(vx_enum target_enum, const char *target_string)
 
     if (kernel != nullptr) /* target/kernel were found */
     {
-        kernel->decrementReference(VX_INTERNAL);
-        this->kernel = kernel;
-        kernel->incrementReference(VX_INTERNAL);
-
-        affinity = rt;
+        assignKernel(kernel, rt);
         graph->reverify = graph->verified;
         graph->verified = vx_false_e;
         graph->state = VX_GRAPH_STATE_UNVERIFIED;
@@ -203,6 +212,40 @@ vx_status Node::setTarget(vx_enum target_enum, const char *target_string)
     return status;
 }
 
+vx_status Node::fallBackTarget()
+{
+    vx_bool later = vx_false_e;
+
+    for (vx_uint32 t = 0; t < context->num_targets; t++)
+    {
+        vx_uint32 rt = context->priority_targets[t];
+        vx_target target = context->targets[rt];
+        if (later == vx_false_e)
+        {
+            /* only the targets ranked below the current one are left */
+            later = (rt == affinity) ? vx_true_e : vx_false_e;
+            continue;
+        }
+        vx_kernel target_kernel = target->findKernelByEnum(kernel->enumeration);
+        if (target_kernel == nullptr)
+        {
+            continue;
+        }
+        vx_uint32 previous = affinity;
+        vx_kernel previous_kernel = kernel;
+        assignKernel(target_kernel, rt);
+        if (target->funcs.verify(target, this) == VX_SUCCESS)
+        {
+            VX_PRINT(VX_ZONE_GRAPH, "Node %s moved from target %s to %s\n", kernel->name,
+                     context->targets[previous]->name, target->name);
+            return VX_SUCCESS;
+        }
+        assignKernel(previous_kernel, previous);
+    }
+
+    return VX_ERROR_NOT_SUPPORTED;
+}
+
 vx_status Node::setCallbackFn(vx_nodecomplete_f callback)
 {
     if ((callback) && (this->callback))
@@ -429,6 +472,234 @@ vx_status Node::replicateNode(vx_graph graph, vx_node first_node, vx_bool *repli
     return status;
 }
 
+/*! \brief One call of \ref Node::processChunks.
+ * Every thread helping out claims chunks from \ref next until none are left. The job is
+ * freed by whichever of them lets go of it last, since helpers may only be picked up by a
+ * worker after the issuing thread has already run all the chunks itself.
+ * \ingroup group_int_node
+ */
+struct vx_chunk_job_t {
+    /*! \brief The function run for every chunk */
+    vx_chunk_f function;
+    /*! \brief The argument passed to \ref function */
+    void *arg;
+    /*! \brief The number of chunks */
+    vx_uint32 numChunks;
+    /*! \brief The work items issued to the context workers */
+    std::vector<vx_value_set_t> workitems;
+    /*! \brief The next chunk to claim */
+    std::atomic<vx_uint32> next;
+    /*! \brief The next slot handed to a thread joining in, the issuing thread has slot 0 */
+    std::atomic<vx_uint32> slots;
+    /*! \brief The number of chunks which completed */
+    std::atomic<vx_uint32> done;
+    /*! \brief The first failing status */
+    std::atomic<vx_status> status;
+    /*! \brief The number of threads still holding the job */
+    std::atomic<vx_uint32> holders;
+    /*! \brief Protects the wait on \ref finished */
+    std::mutex lock;
+    /*! \brief Signalled when the last chunk completes */
+    std::condition_variable finished;
+};
+
+static void runChunks(vx_chunk_job_t *job, vx_uint32 slot)
+{
+    for (vx_uint32 c = job->next++; c < job->numChunks; c = job->next++)
+    {
+        vx_status status = job->function(job->arg, c, slot);
+        if (status != VX_SUCCESS)
+        {
+            vx_status expected = VX_SUCCESS;
+            job->status.compare_exchange_strong(expected, status);
+        }
+
+        if (++job->done == job->numChunks)
+        {
+            std::lock_guard<std::mutex> guard(job->lock);
+            job->finished.notify_all();
+        }
+    }
+}
+
+static void releaseChunks(vx_chunk_job_t *job)
+{
+    if (--job->holders == 0)
+    {
+        delete job;
+    }
+}
+
+vx_status Node::processChunks(vx_uint32 numChunks, vx_uint32 maxThreads, vx_chunk_f function, void *arg)
+{
+    vx_status status = VX_SUCCESS;
+
+    if (numChunks == 0)
+    {
+        return status;
+    }
+
+    vx_chunk_job_t *job = new vx_chunk_job_t();
+    job->function = function;
+    job->arg = arg;
+    job->numChunks = numChunks;
+    job->next = 0;
+    job->slots = 1;
+    job->done = 0;
+    job->status = VX_SUCCESS;
+    job->holders = 1;
+
+#if defined(OPENVX_USE_SMP)
+    if (context->workers && context->workers->numWorkers > 0 && maxThreads > 1 &&
+        graph->shouldSerialize == vx_false_e)
+    {
+        vx_uint32 helpers = std::min(std::min(numChunks, maxThreads) - 1, context->workers->numWorkers);
+
+        /* a null target tells the context worker this is a chunk helper, not a node */
+        job->workitems.assign(helpers, vx_value_set_t{0, (vx_value_t)job, 0});
+        job->holders += helpers;
+        if (helpers > 0 &&
+            Osal::issueThreadpool(context->workers, job->workitems.data(), helpers) == vx_false_e)
+        {
+            job->holders -= helpers;
+        }
+    }
+#else
+    (void)maxThreads;
+#endif
+
+    runChunks(job, 0);
+    {
+        /* helpers may still be running chunks they claimed before this thread ran out */
+        std::unique_lock<std::mutex> guard(job->lock);
+        job->finished.wait(guard, [job] { return job->done.load() == job->numChunks; });
+    }
+    status = job->status.load();
+    releaseChunks(job);
+
+    return status;
+}
+
+void Node::workerChunks(vx_value_set_t *workitem)
+{
+    vx_chunk_job_t *job = (vx_chunk_job_t *)workitem->v2;
+
+    runChunks(job, job->slots++);
+    releaseChunks(job);
+}
+
+/*! \brief The replicas of one execution of a replicated node, one chunk per replica.
+ * \ingroup group_int_node
+ */
+struct vx_replica_set_t {
+    /*! \brief The replicated node */
+    vx_node node;
+    /*! \brief The number of kernel parameters */
+    vx_uint32 numParameters;
+    /*! \brief The parameters of replica r start at r * numParameters */
+    std::vector<vx_reference> parameters;
+    /*! \brief Whether to capture the per-replica performance */
+    vx_bool perf;
+};
+
+static vx_status runReplica(void *arg, vx_uint32 r, vx_uint32 slot)
+{
+    vx_replica_set_t *set = (vx_replica_set_t *)arg;
+    vx_node node = set->node;
+    (void)slot;
+
+    if (set->perf == vx_true_e)
+        Osal::startCapture(&node->replica_perf[r]);
+
+    vx_status status = node->kernel->function(node, &set->parameters[r * set->numParameters],
+                                              set->numParameters);
+
+    if (set->perf == vx_true_e)
+        Osal::stopCapture(&node->replica_perf[r]);
+
+    if (status != VX_SUCCESS)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Replica %u of %s returned %d\n", r, node->kernel->name, status);
+    }
+    return status;
+}
+
+vx_status Node::processReplicas()
+{
+    vx_status status = VX_SUCCESS;
+    vx_uint32 numParameters = kernel->signature.num_parameters;
+    vx_size numReplicas = 0;
+    vx_uint32 p;
+
+    for (p = 0; p < numParameters && status == VX_SUCCESS; p++)
+    {
+        if (replicated_flags[p] == vx_true_e)
+        {
+            vx_size numItems = 0;
+            if (parameters[p]->scope->type == VX_TYPE_PYRAMID)
+            {
+                numItems = ((vx_pyramid)parameters[p]->scope)->numLevels;
+            }
+            else if (parameters[p]->scope->type == VX_TYPE_OBJECT_ARRAY)
+            {
+                numItems = ((vx_object_array)parameters[p]->scope)->num_items;
+            }
+            else
+            {
+                status = VX_ERROR_INVALID_PARAMETERS;
+            }
+
+            if (numReplicas == 0)
+                numReplicas = numItems;
+            else if (numItems != numReplicas)
+                status = VX_ERROR_INVALID_PARAMETERS;
+        }
+    }
+
+    if (status != VX_SUCCESS || numReplicas == 0)
+    {
+        return status;
+    }
+
+    vx_replica_set_t set;
+    set.node = this;
+    set.numParameters = numParameters;
+    set.parameters.resize(numReplicas * numParameters);
+    set.perf = context->perf_enabled;
+
+    for (vx_uint32 r = 0; r < numReplicas; r++)
+    {
+        for (p = 0; p < numParameters; p++)
+        {
+            vx_reference ref = parameters[p];
+            if (replicated_flags[p] == vx_true_e)
+            {
+                if (ref->scope->type == VX_TYPE_PYRAMID)
+                    ref = (vx_reference)((vx_pyramid)ref->scope)->levels[r];
+                else
+                    ref = (vx_reference)((vx_object_array)ref->scope)->items[r];
+            }
+            set.parameters[r * numParameters + p] = ref;
+        }
+    }
+
+    if (set.perf == vx_true_e && replica_perf.size() != numReplicas)
+    {
+        replica_perf.resize(numReplicas);
+        for (vx_perf_t &rp : replica_perf)
+        {
+            Osal::initPerf(&rp);
+        }
+    }
+
+    /* replicas share the node's local data, so only kernels without it run them concurrently */
+    vx_uint32 maxThreads = (attributes.localDataSize == 0 && attributes.localDataPtr == nullptr)
+                               ? (vx_uint32)numReplicas
+                               : 1u;
+
+    return processChunks((vx_uint32)numReplicas, maxThreads, runReplica, &set);
+}
+
 void Node::destruct()
 {
     vx_uint32 p = 0;
@@ -502,7 +773,7 @@ vx_status Node::removeNode()
             {
                 graph->numNodes--;
                 graph->nodes[i] = graph->nodes[graph->numNodes];
-                graph->nodes[graph->numNodes] = nullptr;
+                graph->nodes.pop_back();
                 /* force the graph to be verified again */
                 graph->reverify = vx_true_e;
                 graph->verified = vx_false_e;
@@ -700,6 +971,38 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryNode(vx_node node, vx_enum attribute,
                 }
                 break;
 #endif /* OPENVX_KHR_NODE_MEMORY */
+#ifdef OPENVX_KHR_TILING
+            case VX_NODE_INPUT_NEIGHBORHOOD:
+                if (VX_CHECK_PARAM(ptr, size, vx_neighborhood_size_t, 0x3))
+                {
+                    memcpy(ptr, &node->attributes.nhbdinfo, sizeof(vx_neighborhood_size_t));
+                }
+                else
+                {
+                    status = VX_ERROR_INVALID_PARAMETERS;
+                }
+                break;
+            case VX_NODE_OUTPUT_TILE_BLOCK_SIZE:
+                if (VX_CHECK_PARAM(ptr, size, vx_tile_block_size_t, 0x3))
+                {
+                    memcpy(ptr, &node->attributes.blockinfo, sizeof(vx_tile_block_size_t));
+                }
+                else
+                {
+                    status = VX_ERROR_INVALID_PARAMETERS;
+                }
+                break;
+            case VX_NODE_TILE_MEMORY_SIZE:
+                if (VX_CHECK_PARAM(ptr, size, vx_size, 0x3))
+                {
+                    *(vx_size *)ptr = node->attributes.tileDataSize;
+                }
+                else
+                {
+                    status = VX_ERROR_INVALID_PARAMETERS;
+                }
+                break;
+#endif /* OPENVX_KHR_TILING */
             case VX_NODE_BORDER:
                 if (VX_CHECK_PARAM(ptr, size, vx_border_t, 0x3))
                 {
@@ -744,6 +1047,19 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryNode(vx_node node, vx_enum attribute,
                 }
             }
                 break;
+            case VX_NODE_ATTRIBUTE_REPLICA_PERFORMANCE:
+            {
+                vx_size sz = sizeof(vx_perf_t) * node->replica_perf.size();
+                if (sz != 0 && size == sz && ((vx_size)ptr & 0x3) == 0)
+                {
+                    memcpy(ptr, node->replica_perf.data(), sz);
+                }
+                else
+                {
+                    status = VX_ERROR_INVALID_PARAMETERS;
+                }
+            }
+                break;
             case VX_NODE_VALID_RECT_RESET:
                 if (VX_CHECK_PARAM(ptr, size, vx_bool, 0x3))
                 {
@@ -21,6 +21,9 @@ using namespace coreflow;
 
 #define BILLION (1000000000LLU)
 
+/* the worker running on this thread, so work issued from inside a work item stays local */
+static thread_local vx_threadpool_worker_t *current_worker = nullptr;
+
 vx_bool Osal::createSem(vx_sem_t *sem, vx_uint32 count)
 {
 #if defined(VX_PTHREAD_SEMAPHORE)
@@ -342,15 +345,24 @@ void Osal::destroyThreadpool(vx_threadpool_t **ppool)
     if (pool)
     {
         uint32_t i;
+        {
+            std::lock_guard<std::mutex> guard(pool->lock);
+            pool->stopping = true;
+            pool->wake.notify_all();
+        }
         for (i = 0u; i < pool->numWorkers; i++)
         {
             vx_value_t ret;
-            Osal::popQueue(pool->workers[i].queue);
             Osal::joinThread(pool->workers[i].handle, &ret);
             Osal::stopCapture(&pool->workers[i].perf);
+            VX_PRINT(VX_ZONE_OSAL, "Worker %u stole " VX_FMT_SIZE " work items\n", i,
+                     (vx_size)pool->workers[i].steals.load());
             pool->workers[i].handle = 0;
-            Osal::destroyQueue(&pool->workers[i].queue);
-            pool->workers[i].queue = (vx_queue_t *)nullptr;
+        }
+        for (i = 0u; i < pool->numWorkers; i++)
+        {
+            delete(pool->workers[i].deque);
+            pool->workers[i].deque = (vx_deque_t *)nullptr;
         }
         delete[](pool->workers);
         pool->workers = (vx_threadpool_worker_t *)nullptr;
@@ -364,6 +376,7 @@ void Osal::destroyThreadpool(vx_threadpool_t **ppool)
 vx_value_t Osal::workerThreadpool(void *arg)
 {
     vx_threadpool_worker_t *pool_worker = (vx_threadpool_worker_t *)arg;
+    vx_threadpool_t *pool = pool_worker->pool;
     vx_bool ret = vx_false_e;
     vx_context context = (vx_context)pool_worker->arg;
 
@@ -374,38 +387,84 @@ vx_value_t Osal::workerThreadpool(void *arg)
 
     /*! \bug assign this thread to the next available core */
     //thread_nextaffinity();
-    if (context->perf_enabled)
+    if (context && context->perf_enabled)
     {
         Osal::initPerf(&pool_worker->perf); // reset
         Osal::startCapture(&pool_worker->perf);
     }
-    while (Osal::readQueue(pool_worker->queue, &pool_worker->data) == vx_true_e)
+    current_worker = pool_worker;
+    while (pool->stopping.load() == false)
     {
+        vx_value_set_t *data = Osal::takeThreadpool(pool_worker);
+        if (data == nullptr)
+        {
+            /* announce the sleep before re-checking, issuers check the sleepers after
+             * publishing, so one of the two sides always sees the other */
+            std::unique_lock<std::mutex> guard(pool->lock);
+            pool->numSleeping++;
+            if (pool->numQueued.load() == 0 && pool->stopping.load() == false)
+            {
+                pool->wake.wait(guard);
+            }
+            pool->numSleeping--;
+            continue;
+        }
+
         vx_threadpool_f function = pool_worker->function;
         VX_PRINT(VX_ZONE_OSAL, "Worker received workitem!\n");
+        pool_worker->data = data;
         pool_worker->active = vx_true_e;
         Osal::stopCapture(&pool_worker->perf);
         ret = function(pool_worker); /* <=== WORK IS DONE HERE */
-        Osal::semWait(&pool_worker->pool->sem);
-        pool_worker->pool->numCurrentItems--;
-        if (pool_worker->pool->numCurrentItems <= 0)
+        Osal::semWait(&pool->sem);
+        pool->numCurrentItems--;
+        if (pool->numCurrentItems <= 0)
         {
-            Osal::setEvent(&pool_worker->pool->completed);
+            Osal::setEvent(&pool->completed);
         }
-        Osal::semPost(&pool_worker->pool->sem);
-        if (context->perf_enabled)
+        Osal::semPost(&pool->sem);
+        if (context && context->perf_enabled)
         {
             Osal::startCapture(&pool_worker->perf);
         }
         pool_worker->active = vx_false_e;
-
-        // if (ret == vx_false_e)
-        //     break;
     }
+    current_worker = nullptr;
     VX_PRINT(VX_ZONE_OSAL, "Worker exiting!\n");
     return (vx_value_t)ret;
 }
 
+vx_value_set_t *Osal::takeThreadpool(vx_threadpool_worker_t *worker)
+{
+    vx_threadpool_t *pool = worker->pool;
+    vx_value_set_t *data = Osal::popDeque(worker->deque);
+
+    if (data == nullptr && pool->numQueued.load() > 0)
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+        if (!pool->injected.empty())
+        {
+            data = pool->injected.front();
+            pool->injected.pop_front();
+        }
+    }
+    /* start with the neighbour so thieves spread out over the victims */
+    for (uint32_t i = 1u; data == nullptr && i < pool->numWorkers && pool->numQueued.load() > 0; i++)
+    {
+        vx_threadpool_worker_t *victim = &pool->workers[(worker->index + i) % pool->numWorkers];
+        data = Osal::stealDeque(victim->deque);
+        if (data)
+        {
+            worker->steals++;
+        }
+    }
+    if (data)
+    {
+        pool->numQueued--;
+    }
+    return data;
+}
+
 vx_threadpool_t *Osal::createThreadpool(vx_uint32 numThreads,
                                     vx_uint32 numWorkItems,
                                     vx_size sizeWorkItem,
@@ -423,6 +482,7 @@ vx_threadpool_t *Osal::createThreadpool(vx_uint32 numThreads,
         pool->numWorkItems = numWorkItems;
         pool->sizeWorkItem = (uint32_t)sizeWorkItem;
         Osal::initEvent(&pool->completed, vx_false_e);
+        Osal::setEvent(&pool->completed);
         pool->workers = new vx_threadpool_worker_t[pool->numWorkers]();
         if (pool->workers)
         {
@@ -430,17 +490,22 @@ vx_threadpool_t *Osal::createThreadpool(vx_uint32 numThreads,
             for (i = 0u; i < pool->numWorkers; i++)
             {
                 vx_threadpool_worker_t *pool_worker = &pool->workers[i];
-                pool_worker->queue = Osal::createQueue();
+                pool_worker->deque = VX_CALLOC(vx_deque_t);
+                Osal::initDeque(pool_worker->deque);
                 pool_worker->index = i;
                 pool_worker->arg = tmp_arg;
                 pool_worker->function = worker;
                 pool_worker->pool = pool; /* back reference to top level info */
-                if (context->perf_enabled)
+                if (context && context->perf_enabled)
                 {
                     Osal::initPerf(&pool_worker->perf);
                     Osal::startCapture(&pool_worker->perf); /* capture the launch latency */
                 }
-                pool_worker->handle = Osal::createThread(&Osal::workerThreadpool, pool_worker);
+            }
+            /* start the threads once every deque exists, they steal from each other */
+            for (i = 0u; i < pool->numWorkers; i++)
+            {
+                pool->workers[i].handle = Osal::createThread(&Osal::workerThreadpool, &pool->workers[i]);
             }
         }
     }
@@ -450,40 +515,44 @@ vx_threadpool_t *Osal::createThreadpool(vx_uint32 numThreads,
 vx_bool Osal::issueThreadpool(vx_threadpool_t *pool, vx_value_set_t workitems[], uint32_t numWorkItems)
 {
     uint32_t i;
-    vx_bool wrote = vx_false_e;
+    vx_bool local = (current_worker && current_worker->pool == pool) ? vx_true_e : vx_false_e;
+
+    if (numWorkItems == 0u || pool->numWorkers == 0u)
+    {
+        return vx_false_e;
+    }
 
     Osal::semWait(&pool->sem);
     Osal::resetEvent(&pool->completed); /* we're going to have items to work on, so clear the event */
+    pool->numCurrentItems += (int32_t)numWorkItems;
+    Osal::semPost(&pool->sem);
+
     for (i = 0u; i < numWorkItems; i++)
     {
-        uint32_t index = 0xFFFFFFFFu;
-        uint32_t count = 0u; /* cycle-detector */
-        /* issue the work to the next workers_get, but don't wait if it's full */
-        do {
-            count++;
-            index = pool->nextWorkerIndex;
-            pool->nextWorkerIndex = (pool->nextWorkerIndex + 1u) % pool->numWorkers;
-            pool->numCurrentItems++;
-            wrote = Osal::writeQueue(pool->workers[index].queue, &workitems[i]);
-            if (wrote == vx_false_e)
-            {
-                pool->numCurrentItems--;
-            }
-        } while ((wrote == vx_false_e) && (count < pool->numWorkers));
-        /* there's too much work to do, there's an overflow condition. some of the work may have been issued, others not. */
-        if (wrote == vx_false_e)
+        pool->numQueued++;
+        /* continuations go to the bottom of the issuing worker's deque, where it picks them
+         * up next while the data is still warm; a full deque spills to the shared queue */
+        if (local == vx_false_e || Osal::pushDeque(current_worker->deque, &workitems[i]) == vx_false_e)
         {
-            break;
+            std::lock_guard<std::mutex> guard(pool->lock);
+            pool->injected.push_back(&workitems[i]);
         }
     }
 
-    /* if none of the writes worked for whatever reason, and we didn't have any previous pending work (how?) then set the completed event */
-    if (pool->numCurrentItems == 0)
+    if (pool->numSleeping.load() > 0)
     {
-        Osal::setEvent(&pool->completed);
+        std::lock_guard<std::mutex> guard(pool->lock);
+        if (numWorkItems == 1u)
+            pool->wake.notify_one();
+        else
+            pool->wake.notify_all();
     }
-    Osal::semPost(&pool->sem);
-    return wrote;
+    return vx_true_e;
+}
+
+vx_bool Osal::isThreadpoolWorker()
+{
+    return (current_worker != nullptr) ? vx_true_e : vx_false_e;
 }
 
 vx_bool Osal::completeThreadpool(vx_threadpool_t *pool, vx_bool blocking)
@@ -732,6 +801,83 @@ void Osal::printQueue(vx_queue_t *q)
     }
 }
 
+void Osal::initDeque(vx_deque_t *d)
+{
+    if (d)
+    {
+        for (vx_uint32 i = 0; i < VX_INT_MAX_DEQUE_DEPTH; i++)
+        {
+            d->data[i].store(nullptr, std::memory_order_relaxed);
+        }
+        d->top.store(0, std::memory_order_relaxed);
+        d->bottom.store(0, std::memory_order_relaxed);
+    }
+}
+
+vx_bool Osal::pushDeque(vx_deque_t *d, vx_value_set_t *data)
+{
+    int64_t b = d->bottom.load(std::memory_order_relaxed);
+    int64_t t = d->top.load(std::memory_order_acquire);
+
+    if (b - t >= VX_INT_MAX_DEQUE_DEPTH)
+    {
+        return vx_false_e;
+    }
+    d->data[b & (VX_INT_MAX_DEQUE_DEPTH - 1)].store(data, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    d->bottom.store(b + 1, std::memory_order_relaxed);
+    return vx_true_e;
+}
+
+vx_value_set_t *Osal::popDeque(vx_deque_t *d)
+{
+    vx_value_set_t *data = nullptr;
+    int64_t b = d->bottom.load(std::memory_order_relaxed) - 1;
+    int64_t t;
+
+    d->bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    t = d->top.load(std::memory_order_relaxed);
+    if (t <= b)
+    {
+        data = d->data[b & (VX_INT_MAX_DEQUE_DEPTH - 1)].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            /* last item, race the thieves for it */
+            if (!d->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed))
+            {
+                data = nullptr;
+            }
+            d->bottom.store(b + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        d->bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return data;
+}
+
+vx_value_set_t *Osal::stealDeque(vx_deque_t *d)
+{
+    vx_value_set_t *data = nullptr;
+    int64_t t = d->top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = d->bottom.load(std::memory_order_acquire);
+
+    if (t < b)
+    {
+        data = d->data[t & (VX_INT_MAX_DEQUE_DEPTH - 1)].load(std::memory_order_relaxed);
+        if (!d->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed))
+        {
+            data = nullptr;
+        }
+    }
+    return data;
+}
+
 vx_module_handle_t Osal::loadModule(vx_char * name)
 {
     vx_module_handle_t mod;
@@ -25,6 +25,7 @@ name(""),
 module(),
 funcs(),
 priority(0),
+bit_exact(vx_false_e),
 num_kernels(0),
 kernels(),
 reserved(nullptr)
@@ -33,7 +33,9 @@ data_type(),
 fixed_point_position(),
 subtensors(),
 parent(),
-subimages()
+subimages(),
+memory_type(VX_MEMORY_TYPE_NONE),
+fd_map()
 {
 }
 
@@ -77,6 +79,58 @@ vx_tensor Tensor::createTensor(vx_context context, vx_size number_of_dims, const
     return tensor;
 }
 
+vx_tensor Tensor::createView(vx_tensor tensor, vx_size number_of_dims, const vx_size *dims,
+                             const vx_size *strides, vx_size offset)
+{
+    vx_tensor view = nullptr;
+
+    if (number_of_dims < 1 || number_of_dims > VX_MAX_TENSOR_DIMENSIONS)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Invalid dimensions for the tensor view.\n");
+        return (vx_tensor)Error::getError(tensor->context, VX_ERROR_INVALID_DIMENSION);
+    }
+
+    /* perhaps the parent hasn't been allocated yet? */
+    if (tensor->allocateTensorMemory() == nullptr)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Parent tensor failed to allocate!\n");
+        return (vx_tensor)Error::getError(tensor->context, VX_ERROR_NO_MEMORY);
+    }
+
+    view = (vx_tensor)Reference::createReference(tensor->context, VX_TYPE_TENSOR, VX_EXTERNAL, tensor->context);
+    if (Error::getStatus((vx_reference)view) != VX_SUCCESS || view->type != VX_TYPE_TENSOR)
+    {
+        VX_PRINT(VX_ZONE_ERROR, "Child tensor failed to allocate!\n");
+        return view;
+    }
+
+    /* refer to our parent md data and internally refcount it */
+    view->parent = tensor;
+    view->scope = (vx_reference)tensor;
+    for (vx_uint32 p = 0; p < VX_INT_MAX_REF; p++)
+    {
+        if (tensor->subtensors[p] == nullptr)
+        {
+            tensor->subtensors[p] = view;
+            break;
+        }
+    }
+    tensor->incrementReference(VX_INTERNAL);
+
+    /* duplicate the metadata, only the layout differs */
+    view->data_type = tensor->data_type;
+    view->fixed_point_position = tensor->fixed_point_position;
+    view->number_of_dimensions = (vx_uint32)number_of_dims;
+    view->addr = (vx_uint8 *)tensor->addr + offset;
+    for (vx_uint32 i = 0; i < number_of_dims; i++)
+    {
+        view->dimensions[i] = dims[i];
+        view->stride[i] = strides[i];
+    }
+
+    return view;
+}
+
 vx_bool Tensor::isValidTensor(vx_tensor tensor)
 {
     if (Reference::isValidReference(reinterpret_cast<vx_reference>(tensor), VX_TYPE_TENSOR) == vx_true_e)
@@ -168,6 +222,80 @@ void Tensor::computePositionsFromIndex(vx_size index, const vx_size * start, con
     }
 }
 
+void Tensor::copyStrided(vx_uint8 *dst, const vx_size *dst_stride,
+                         const vx_uint8 *src, const vx_size *src_stride,
+                         const vx_size *extent, vx_size number_of_dimensions,
+                         vx_size element_size)
+{
+    vx_size count[VX_MAX_TENSOR_DIMENSIONS];
+    vx_size dst_step[VX_MAX_TENSOR_DIMENSIONS];
+    vx_size src_step[VX_MAX_TENSOR_DIMENSIONS];
+    vx_size index[VX_MAX_TENSOR_DIMENSIONS] = {0};
+    vx_size dims = 0;
+    vx_size run = element_size;
+    vx_bool packed = vx_true_e;
+
+    /* grow the contiguous run while both sides are packed, then merge any
+     * outer dimensions which still line up on both sides */
+    for (vx_size i = 0; i < number_of_dimensions; i++)
+    {
+        if (extent[i] == 0)
+            return;
+        if (extent[i] == 1)
+            continue;
+        if (packed == vx_true_e && dst_stride[i] == run && src_stride[i] == run)
+        {
+            run *= extent[i];
+            continue;
+        }
+        packed = vx_false_e;
+        if (dims > 0 &&
+            dst_stride[i] == dst_step[dims - 1] * count[dims - 1] &&
+            src_stride[i] == src_step[dims - 1] * count[dims - 1])
+        {
+            count[dims - 1] *= extent[i];
+            continue;
+        }
+        count[dims] = extent[i];
+        dst_step[dims] = dst_stride[i];
+        src_step[dims] = src_stride[i];
+        dims++;
+    }
+
+    if (dims == 0)
+    {
+        memcpy(dst, src, run);
+        return;
+    }
+
+    for (;;)
+    {
+        vx_uint8 *d = dst;
+        const vx_uint8 *s = src;
+        for (vx_size i = 0; i < count[0]; i++)
+        {
+            memcpy(d, s, run);
+            d += dst_step[0];
+            s += src_step[0];
+        }
+
+        /* step the outer dimensions like an odometer */
+        vx_size k = 1;
+        for (; k < dims; k++)
+        {
+            dst += dst_step[k];
+            src += src_step[k];
+            if (++index[k] < count[k])
+                break;
+            dst -= dst_step[k] * count[k];
+            src -= src_step[k] * count[k];
+            index[k] = 0;
+        }
+        if (k == dims)
+            break;
+    }
+}
+
 const vx_size *Tensor::dims() const
 {
     return dimensions;
@@ -193,6 +321,20 @@ const vx_size *Tensor::strides() const
     return stride;
 }
 
+vx_bool Tensor::isContiguous() const
+{
+    vx_size packed = Reference::sizeOfType(data_type);
+    for (vx_uint32 i = 0; i < number_of_dimensions; i++)
+    {
+        if (dimensions[i] > 1 && stride[i] != packed)
+        {
+            return vx_false_e;
+        }
+        packed *= dimensions[i];
+    }
+    return vx_true_e;
+}
+
 vx_size Tensor::size() const
 {
     vx_size total_size = Reference::sizeOfType(data_type);
@@ -280,21 +422,20 @@ vx_status Tensor::copyPatch(vx_size number_of_dimensions, const vx_size *view_st
         }
 #endif
 
-        // element_size = Reference::sizeOfType(data_type);
         vx_uint8 *user_curr_ptr = (vx_uint8 *)user_ptr;
         vx_uint8 *tensor_ptr = (vx_uint8 *)addr;
-        vx_size patch_size = Tensor::computePatchSize(view_start, view_end, number_of_dimensions);
-        for (vx_size i = 0; i < patch_size; i++)
-        {
-            vx_size patch_pos = 0;
-            vx_size tensor_pos = 0;
-            Tensor::computePositionsFromIndex(i, view_start, view_end, stride, user_stride,
-                                              number_of_dimensions, &tensor_pos, &patch_pos);
-            if (usage == VX_READ_ONLY)
-                memcpy(user_curr_ptr + patch_pos, tensor_ptr + tensor_pos, stride[0]);
-            else
-                memcpy(tensor_ptr + tensor_pos, user_curr_ptr + patch_pos, stride[0]);
+        vx_size extent[VX_MAX_TENSOR_DIMENSIONS];
+        for (vx_size i = 0; i < number_of_dimensions; i++)
+        {
+            extent[i] = view_end[i] - view_start[i];
+            tensor_ptr += view_start[i] * stride[i];
         }
+        if (usage == VX_READ_ONLY)
+            Tensor::copyStrided(user_curr_ptr, user_stride, tensor_ptr, stride, extent,
+                                number_of_dimensions, Reference::sizeOfType(data_type));
+        else
+            Tensor::copyStrided(tensor_ptr, stride, user_curr_ptr, user_stride, extent,
+                                number_of_dimensions, Reference::sizeOfType(data_type));
         status = VX_SUCCESS;
 
 #ifdef OPENVX_USE_OPENCL_INTEROP
@@ -380,7 +521,14 @@ vx_status Tensor::mapPatch(vx_size number_of_dims, const vx_size *view_start,
         vx_true_e == context->memoryMap((vx_reference)this, 0, usage, mem_type, 0, (void *)&extra,
                                         (void **)&buf, map_id))
     {
-        *ptr = addr;
+        /* hand out the storage in place, laid out as the tensor (or view) is */
+        vx_uint8 *tensor_ptr = (vx_uint8 *)addr;
+        for (vx_uint32 i = 0; i < number_of_dims; i++)
+        {
+            stride[i] = this->stride[i];
+            tensor_ptr += view_start[i] * this->stride[i];
+        }
+        *ptr = tensor_ptr;
 
         incrementReference(VX_EXTERNAL);
 
@@ -393,14 +541,14 @@ vx_status Tensor::mapPatch(vx_size number_of_dims, const vx_size *view_start,
         vx_uint8 *tensor_ptr = (vx_uint8 *)addr;
         if (usage == VX_READ_ONLY || usage == VX_READ_AND_WRITE)
         {
-            for (vx_size i = 0; i < size; i++)
+            vx_size extent[VX_MAX_TENSOR_DIMENSIONS];
+            for (vx_size i = 0; i < number_of_dims; i++)
             {
-                vx_size patch_pos = 0;
-                vx_size tensor_pos = 0;
-                Tensor::computePositionsFromIndex(i, view_start, view_end, this->stride, stride,
-                                                  number_of_dims, &tensor_pos, &patch_pos);
-                memcpy(user_curr_ptr + patch_pos, tensor_ptr + tensor_pos, this->stride[0]);
+                extent[i] = view_end[i] - view_start[i];
+                tensor_ptr += view_start[i] * this->stride[i];
             }
+            Tensor::copyStrided(user_curr_ptr, stride, tensor_ptr, this->stride, extent,
+                                number_of_dims, Reference::sizeOfType(data_type));
 
             // ownReadFromReference(&base);
         }
@@ -436,22 +584,18 @@ vx_status Tensor::unmapPatch(vx_map_id map_id)
         {
             if (vx_true_e == Osal::semWait(&lock))
             {
-                vx_uint32 size = Tensor::computePatchSize(map->extra.tensor_data.start,
-                                                          map->extra.tensor_data.end,
-                                                          map->extra.tensor_data.number_of_dims);
+                vx_size number_of_dims = map->extra.tensor_data.number_of_dims;
+                vx_size extent[VX_MAX_TENSOR_DIMENSIONS];
                 vx_uint8 *pSrc = (vx_uint8 *)map->ptr;
                 vx_uint8 *pDst = (vx_uint8 *)addr;
 
-                for (vx_size i = 0; i < size; i++)
+                for (vx_size i = 0; i < number_of_dims; i++)
                 {
-                    vx_size patch_pos = 0;
-                    vx_size tensor_pos = 0;
-                    Tensor::computePositionsFromIndex(
-                        i, map->extra.tensor_data.start, map->extra.tensor_data.end, stride,
-                        map->extra.tensor_data.stride, map->extra.tensor_data.number_of_dims,
-                        &tensor_pos, &patch_pos);
-                    memcpy(pDst + patch_pos, pSrc + tensor_pos, stride[0]);
+                    extent[i] = map->extra.tensor_data.end[i] - map->extra.tensor_data.start[i];
+                    pDst += map->extra.tensor_data.start[i] * stride[i];
                 }
+                Tensor::copyStrided(pDst, stride, pSrc, map->extra.tensor_data.stride, extent,
+                                    number_of_dims, Reference::sizeOfType(data_type));
 
                 Osal::semPost(&lock);
             }
@@ -482,7 +626,7 @@ exit:
 void Tensor::destruct()
 {
     /* if it's not imported and does not have a parent, free it */
-    if (!parent && addr)
+    if (!parent && addr && memory_type == VX_MEMORY_TYPE_NONE)
     {
         ::operator delete(addr);
         addr = nullptr;
@@ -491,6 +635,11 @@ void Tensor::destruct()
     {
         Reference::releaseReference((vx_reference*)&parent, VX_TYPE_TENSOR, VX_INTERNAL, nullptr);
     }
+    else
+    {
+        addr = nullptr;
+        Memory::unmapDescriptor(&fd_map);
+    }
 }
 
 /*****************************************************************************/
@@ -569,12 +718,48 @@ VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromHandle(vx_context context,
     }
 
     tensor->addr = ptr;
+    tensor->memory_type = memory_type;
     tensor->parent = nullptr;
     tensor->scope = (vx_reference)context;
 
     return tensor;
 }
 
+VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromFd(vx_context context, vx_size number_of_dims, const vx_size *dims,
+    vx_enum data_type, vx_int8 fixed_point_position,
+    const vx_size *stride, vx_int32 fd, vx_size offset, vx_enum usage)
+{
+    vx_fd_mapping_t map = {};
+    vx_tensor tensor = nullptr;
+    void *ptr = nullptr;
+
+    if (Context::isValidContext(context) == vx_false_e)
+    {
+        return tensor;
+    }
+    if (number_of_dims < 1 || dims == nullptr || stride == nullptr ||
+        ((usage != VX_READ_ONLY) && (usage != VX_WRITE_ONLY) && (usage != VX_READ_AND_WRITE)))
+    {
+        return (vx_tensor)vxGetErrorObject(context, VX_ERROR_INVALID_PARAMETERS);
+    }
+
+    ptr = Memory::mapDescriptor(fd, offset, dims[number_of_dims - 1] * stride[number_of_dims - 1], usage, &map);
+    if (ptr == nullptr)
+    {
+        return (vx_tensor)vxGetErrorObject(context, VX_ERROR_NO_MEMORY);
+    }
+    tensor = vxCreateTensorFromHandle(context, number_of_dims, dims, data_type, fixed_point_position,
+                                      stride, ptr, VX_MEMORY_TYPE_HOST);
+    if (vxGetStatus((vx_reference)tensor) != VX_SUCCESS)
+    {
+        Memory::unmapDescriptor(&map);
+        return tensor;
+    }
+    tensor->fd_map = map;
+
+    return tensor;
+}
+
 VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorHandle(vx_tensor tensor, void* new_ptr, void** prev_ptr)
 {
     vx_status status = VX_SUCCESS;
@@ -585,7 +770,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorHandle(vx_tensor tensor, void* ne
         {
             return VX_ERROR_INVALID_PARAMETERS;
         }
-        if (tensor->data_type != VX_MEMORY_TYPE_NONE)
+        if (tensor->memory_type != VX_MEMORY_TYPE_NONE)
         {
             vx_uint32 i;
 
@@ -640,6 +825,45 @@ VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorHandle(vx_tensor tensor, void* ne
     return status;
 }
 
+VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorFd(vx_tensor tensor, vx_int32 fd, vx_size offset, vx_enum usage)
+{
+    vx_fd_mapping_t map = {};
+    vx_status status = VX_SUCCESS;
+    void *ptr = nullptr;
+
+    if (Tensor::isValidTensor(tensor) == vx_false_e)
+    {
+        return VX_ERROR_INVALID_REFERENCE;
+    }
+    if (tensor->memory_type == VX_MEMORY_TYPE_NONE || tensor->parent != nullptr ||
+        ((usage != VX_READ_ONLY) && (usage != VX_WRITE_ONLY) && (usage != VX_READ_AND_WRITE)))
+    {
+        return VX_ERROR_INVALID_PARAMETERS;
+    }
+
+    ptr = Memory::mapDescriptor(fd, offset,
+                                tensor->dimensions[tensor->number_of_dimensions - 1] *
+                                    tensor->stride[tensor->number_of_dimensions - 1],
+                                usage, &map);
+    if (ptr == nullptr)
+    {
+        return VX_ERROR_NO_MEMORY;
+    }
+    status = vxSwapTensorHandle(tensor, ptr, nullptr);
+    if (status == VX_SUCCESS)
+    {
+        /* the old storage is no longer reachable through the tensor or its views */
+        Memory::unmapDescriptor(&tensor->fd_map);
+        tensor->fd_map = map;
+    }
+    else
+    {
+        Memory::unmapDescriptor(&map);
+    }
+
+    return status;
+}
+
 VX_API_ENTRY vx_object_array VX_API_CALL vxCreateImageObjectArrayFromTensor(vx_tensor tensor, const vx_rectangle_t *rect, vx_size array_size, vx_size stride, vx_df_image image_format)
 {
     (void)array_size;
@@ -666,7 +890,6 @@ VX_API_ENTRY vx_object_array VX_API_CALL vxCreateImageObjectArrayFromTensor(vx_t
                 {
                     if ((rect->end_y <= tensor->dimensions[1]) && (rect->end_x <= tensor->dimensions[0]))
                     {
-                        vx_uint32 image_byte_size = (vx_uint32)(tensor->dimensions[1] * tensor->dimensions[0] * Reference::sizeOfType(tensor->data_type));
                         vx_imagepatch_addressing_t addr;
                         addr.dim_x = rect->end_x - rect->start_x;
                         addr.dim_y = rect->end_y - rect->start_y;
@@ -674,8 +897,9 @@ VX_API_ENTRY vx_object_array VX_API_CALL vxCreateImageObjectArrayFromTensor(vx_t
                         addr.scale_y = VX_SCALE_UNITY;
                         addr.step_x = 1;
                         addr.step_y = addr.dim_x;
-                        addr.stride_x = (vx_uint32) Reference::sizeOfType(tensor->data_type);
-                        addr.stride_y = (vx_uint32)(tensor->dimensions[0] * Reference::sizeOfType(tensor->data_type));
+                        /* follow the tensor strides so views map without a copy */
+                        addr.stride_x = (vx_uint32)tensor->stride[0];
+                        addr.stride_y = (vx_uint32)tensor->stride[1];
 
 						if (vxGetStatus((vx_reference)images) == VX_SUCCESS && images->type == VX_TYPE_OBJECT_ARRAY)
                         {
@@ -693,9 +917,9 @@ VX_API_ENTRY vx_object_array VX_API_CALL vxCreateImageObjectArrayFromTensor(vx_t
 									subimage->parent = (vx_image)tensor;
 									subimage->scope = (vx_reference)tensor;
 									subimage->memory.allocated = vx_true_e;
-									subimage->memory.ptrs[0] = (vx_uint8*)(tensor->addr) + rect->start_y*addr.stride_y + rect->start_x*addr.stride_x + i*image_byte_size;
-									subimage->memory.strides[0][1] = addr.stride_y;
-									subimage->memory.strides[0][2] = image_byte_size;
+									subimage->memory.ptrs[0] = (vx_uint8*)(tensor->addr) + rect->start_y*addr.stride_y + rect->start_x*addr.stride_x + i*tensor->stride[2];
+									subimage->memory.strides[0][VX_DIM_X] = addr.stride_x;
+									subimage->memory.strides[0][VX_DIM_Y] = addr.stride_y;
 									for (p = 0; p < VX_INT_MAX_REF; p++)
 									{
 										if (tensor->subimages[p] == nullptr)
@@ -747,54 +971,95 @@ VX_API_ENTRY vx_object_array VX_API_CALL vxCreateImageObjectArrayFromTensor(vx_t
 VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromView(vx_tensor tensor, vx_size number_of_dimensions, const vx_size * view_start, const vx_size * view_end)
 {
     vx_tensor subtensor = nullptr;
-    (void)number_of_dimensions;
 
     if ((Tensor::isValidTensor(tensor) == vx_true_e) && (nullptr != view_start) && (nullptr != view_end))
     {
-        /* perhaps the parent hasn't been allocated yet? */
-        if (tensor->allocateTensorMemory() != nullptr)
+        if (number_of_dimensions != tensor->number_of_dimensions ||
+            Tensor::checkSizes(tensor->dimensions, view_start, view_end, number_of_dimensions) != 0)
         {
-            subtensor = (vx_tensor)Reference::createReference(tensor->context, VX_TYPE_TENSOR, VX_EXTERNAL, tensor->context);
-            if (subtensor)
-            {
-				vx_uint32 p = 0;
-                /* refer to our parent md data and internally refcount it */
-                subtensor->parent = tensor;
-                subtensor->scope = (vx_reference)tensor;
-				for (p = 0; p < VX_INT_MAX_REF; p++)
-				{
-					if (tensor->subtensors[p] == nullptr)
-					{
-						tensor->subtensors[p] = subtensor;
-						break;
-					}
-				}
-                tensor->incrementReference(VX_INTERNAL);
-                /* duplicate the metadata */
-                subtensor->data_type = tensor->data_type;
-                subtensor->fixed_point_position = tensor->fixed_point_position;
-                subtensor->number_of_dimensions = tensor->number_of_dimensions;
-                subtensor->addr = tensor->addr;
-                for (vx_uint32 i = 0; i < subtensor->number_of_dimensions; i++)
-                {
-                    subtensor->stride[i] = tensor->stride[i];
-                    subtensor->dimensions[i] = view_end[i] - view_start[i];
-                    //((vx_uint8*)(subtensor->addr)) += view->start[i] * tensor->stride[i];
-                    subtensor->addr = (vx_uint8*)(subtensor->addr) + view_start[i] * tensor->stride[i];
-                }
-            }
-            else
+            VX_PRINT(VX_ZONE_ERROR, "Invalid view\n");
+            return (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_INVALID_PARAMETERS);
+        }
+
+        vx_size dims[VX_MAX_TENSOR_DIMENSIONS];
+        vx_size offset = 0;
+        for (vx_uint32 i = 0; i < number_of_dimensions; i++)
+        {
+            dims[i] = view_end[i] - view_start[i];
+            offset += view_start[i] * tensor->stride[i];
+        }
+        subtensor = Tensor::createView(tensor, number_of_dimensions, dims, tensor->stride, offset);
+    }
+    return subtensor;
+}
+
+VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromReshape(vx_tensor tensor, vx_size number_of_dims, const vx_size *dims)
+{
+    vx_tensor view = nullptr;
+
+    if ((Tensor::isValidTensor(tensor) == vx_true_e) && (nullptr != dims))
+    {
+        vx_size count = 1;
+        vx_size strides[VX_MAX_TENSOR_DIMENSIONS];
+
+        if (number_of_dims < 1 || number_of_dims > VX_MAX_TENSOR_DIMENSIONS)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Invalid number of dimensions for the reshape\n");
+            return (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_INVALID_DIMENSION);
+        }
+        strides[0] = Reference::sizeOfType(tensor->data_type);
+        for (vx_uint32 i = 0; i < number_of_dims; i++)
+        {
+            count *= dims[i];
+            if (i > 0)
             {
-                VX_PRINT(VX_ZONE_ERROR, "Child tensor failed to allocate!\n");
+                strides[i] = strides[i - 1] * dims[i - 1];
             }
         }
-        else
+        if (count == 0 || count * strides[0] != tensor->size())
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Reshape does not keep the number of elements\n");
+            return (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_INVALID_DIMENSION);
+        }
+        if (tensor->isContiguous() == vx_false_e)
         {
-            subtensor = (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_NO_MEMORY);
-            VX_PRINT(VX_ZONE_ERROR, "Parent tensor failed to allocate!\n");
+            VX_PRINT(VX_ZONE_ERROR, "Only a packed tensor can be reshaped in place\n");
+            return (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_NOT_SUPPORTED);
         }
+        view = Tensor::createView(tensor, number_of_dims, dims, strides, 0);
     }
-    return subtensor;
+    return view;
+}
+
+VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromPermute(vx_tensor tensor, vx_size number_of_dims, const vx_size *order)
+{
+    vx_tensor view = nullptr;
+
+    if ((Tensor::isValidTensor(tensor) == vx_true_e) && (nullptr != order))
+    {
+        vx_bool seen[VX_MAX_TENSOR_DIMENSIONS] = {vx_false_e};
+        vx_size dims[VX_MAX_TENSOR_DIMENSIONS];
+        vx_size strides[VX_MAX_TENSOR_DIMENSIONS];
+
+        if (number_of_dims != tensor->number_of_dimensions)
+        {
+            VX_PRINT(VX_ZONE_ERROR, "Permutation does not cover every dimension\n");
+            return (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_INVALID_DIMENSION);
+        }
+        for (vx_uint32 i = 0; i < number_of_dims; i++)
+        {
+            if (order[i] >= number_of_dims || seen[order[i]] == vx_true_e)
+            {
+                VX_PRINT(VX_ZONE_ERROR, "Invalid permutation\n");
+                return (vx_tensor)vxGetErrorObject(tensor->context, VX_ERROR_INVALID_PARAMETERS);
+            }
+            seen[order[i]] = vx_true_e;
+            dims[i] = tensor->dimensions[order[i]];
+            strides[i] = tensor->stride[order[i]];
+        }
+        view = Tensor::createView(tensor, number_of_dims, dims, strides, 0);
+    }
+    return view;
 }
 
 VX_API_ENTRY vx_tensor VX_API_CALL vxCreateVirtualTensor(
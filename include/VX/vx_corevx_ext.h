@@ -270,6 +270,51 @@ enum vx_tensor_attribute_ext_e
     VX_TENSOR_TOTAL_SIZE = VX_ATTRIBUTE_BASE(VX_ID_KHRONOS, VX_TYPE_TENSOR) + 0x5,
 };
 
+/*! \brief additional graph attributes.
+ * \ingroup group_graph
+ */
+enum vx_graph_attribute_ext_e
+{
+    /*! \brief Bytes of intermediate images the fused node chains kept out of memory on the
+     * last execution, counting one write and one read per image. Read-only. Use a <tt>\ref vx_size</tt> parameter. */
+    VX_GRAPH_FUSED_BYTES_SAVED = VX_ATTRIBUTE_BASE(VX_ID_KHRONOS, VX_TYPE_GRAPH) + 0x10,
+};
+
+/*! \brief additional enumeration types.
+ * \ingroup group_basic_features
+ */
+enum vx_enum_ext_e
+{
+    VX_ENUM_CPU_VARIANT = 0x24, /*!< \brief CPU kernel variant enumeration. */
+};
+
+/*! \brief The CPU code paths targets compile their kernels for, each a superset of the one before.
+ * \details The context picks one when it is created, see <tt>\ref VX_CONTEXT_CPU_VARIANT</tt>.
+ * \ingroup group_context
+ */
+enum vx_cpu_variant_e
+{
+    /*! \brief Plain C loops, runs on every host. */
+    VX_CPU_VARIANT_SCALAR = VX_ENUM_BASE(VX_ID_KHRONOS, VX_ENUM_CPU_VARIANT) + 0x0,
+    /*! \brief 128 bit vectors up to SSE4.2 on x86-64. */
+    VX_CPU_VARIANT_SSE42 = VX_ENUM_BASE(VX_ID_KHRONOS, VX_ENUM_CPU_VARIANT) + 0x1,
+    /*! \brief 256 bit vectors of AVX2 on x86-64. */
+    VX_CPU_VARIANT_AVX2 = VX_ENUM_BASE(VX_ID_KHRONOS, VX_ENUM_CPU_VARIANT) + 0x2,
+    /*! \brief 512 bit vectors of AVX-512F and AVX-512BW on x86-64. */
+    VX_CPU_VARIANT_AVX512 = VX_ENUM_BASE(VX_ID_KHRONOS, VX_ENUM_CPU_VARIANT) + 0x3,
+};
+
+/*! \brief additional context attributes.
+ * \ingroup group_context
+ */
+enum vx_context_attribute_ext_e
+{
+    /*! \brief The <tt>\ref vx_cpu_variant_e</tt> the targets run their kernels with: the best
+     * one the host supports, lowered by the <tt>VX_CPU_VARIANT</tt> environment variable
+     * (scalar, sse4.2, avx2 or avx512) when it is set. Read-only. Use a <tt>\ref vx_enum</tt> parameter. */
+    VX_CONTEXT_CPU_VARIANT = VX_ATTRIBUTE_BASE(VX_ID_KHRONOS, VX_TYPE_CONTEXT) + 0x11,
+};
+
 /*!
  * \brief Creates a reference to an ObjectArray of a specific object type.
  *
@@ -308,6 +353,109 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetObjectArrayItem(vx_object_array arr, vx_
  */
 VX_API_ENTRY vx_status VX_API_CALL vxImportGraphFromDot(vx_graph graph, vx_char dotfile[], vx_bool acceptData);
 
+/*!
+ * \brief Creates an image whose planes live in memfd or DMA-BUF file descriptors, without a copy.
+ *
+ * Each plane is mapped shared from its descriptor and laid out as described by \p addrs, as for
+ * <tt>\ref vxCreateImageFromHandle</tt> with <tt>\ref VX_MEMORY_TYPE_HOST</tt>. The descriptors stay
+ * owned by the caller and may be closed once the call returns; the mappings are removed when the
+ * image is released or its planes are swapped with <tt>\ref vxSwapImageFd</tt>. Planes may share a
+ * descriptor at different offsets. DMA-BUF cache synchronization stays with the caller. The planes are
+ * mapped with only the access \p usage asks for, so an image imported <tt>\ref VX_READ_ONLY</tt> from
+ * a read-only descriptor must not be written, e.g. as a graph output.
+ *
+ * \param [in] context The reference to the overall context.
+ * \param [in] color The <tt>\ref vx_df_image_e</tt> code of the image.
+ * \param [in] addrs The layout of each plane.
+ * \param [in] fds The file descriptor of each plane.
+ * \param [in] offsets The byte offset of each plane in its descriptor, or NULL for all zero.
+ * \param [in] usage <tt>\ref VX_READ_ONLY</tt>, <tt>\ref VX_WRITE_ONLY</tt> or <tt>\ref VX_READ_AND_WRITE</tt>.
+ * \returns An image reference, check with <tt>\ref vxGetStatus</tt>.
+ * \ingroup group_image
+ */
+VX_API_ENTRY vx_image VX_API_CALL vxCreateImageFromFd(vx_context context, vx_df_image color, const vx_imagepatch_addressing_t addrs[], const vx_int32 fds[], const vx_size offsets[], vx_enum usage);
+
+/*!
+ * \brief Points an image created from handles or descriptors at the planes of other descriptors.
+ *
+ * The layout is kept. The previous descriptor mappings of the image are removed, so the image must
+ * not be in use by a running graph. Passing NULL \p fds reclaims the planes, as for
+ * <tt>\ref vxSwapImageHandle</tt>.
+ *
+ * \param [in] image The image, created by <tt>\ref vxCreateImageFromFd</tt> or <tt>\ref vxCreateImageFromHandle</tt>.
+ * \param [in] fds The file descriptor of each plane, or NULL.
+ * \param [in] offsets The byte offset of each plane in its descriptor, or NULL for all zero.
+ * \param [in] num_planes The number of planes of the image.
+ * \param [in] usage The access the new planes are mapped for, as for <tt>\ref vxCreateImageFromFd</tt>.
+ * \return A <tt>\ref vx_status_e</tt> enumeration.
+ * \ingroup group_image
+ */
+VX_API_ENTRY vx_status VX_API_CALL vxSwapImageFd(vx_image image, const vx_int32 fds[], const vx_size offsets[], vx_size num_planes, vx_enum usage);
+
+/*!
+ * \brief Creates a tensor whose storage lives in a memfd or DMA-BUF file descriptor, without a copy.
+ *
+ * The storage is mapped shared from \p fd and laid out by \p stride, as for
+ * <tt>\ref vxCreateTensorFromHandle</tt>. The mapping is removed when the tensor is released or its
+ * storage is swapped with <tt>\ref vxSwapTensorFd</tt>. As for <tt>\ref vxCreateImageFromFd</tt>, the
+ * storage is mapped with only the access \p usage asks for.
+ *
+ * \param [in] context The reference to the overall context.
+ * \param [in] number_of_dims The number of dimensions.
+ * \param [in] dims The size of each dimension.
+ * \param [in] data_type The <tt>\ref vx_type_e</tt> of the elements.
+ * \param [in] fixed_point_position The fixed point position of the elements.
+ * \param [in] stride The stride of each dimension in bytes.
+ * \param [in] fd The file descriptor, still owned by the caller.
+ * \param [in] offset The byte offset of the storage in the descriptor.
+ * \param [in] usage <tt>\ref VX_READ_ONLY</tt>, <tt>\ref VX_WRITE_ONLY</tt> or <tt>\ref VX_READ_AND_WRITE</tt>.
+ * \returns A tensor reference, check with <tt>\ref vxGetStatus</tt>.
+ * \ingroup group_tensor
+ */
+VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromFd(vx_context context, vx_size number_of_dims, const vx_size *dims, vx_enum data_type, vx_int8 fixed_point_position, const vx_size *stride, vx_int32 fd, vx_size offset, vx_enum usage);
+
+/*!
+ * \brief Points a tensor created from a handle or descriptor at the storage of another descriptor.
+ *
+ * \param [in] tensor The tensor, created by <tt>\ref vxCreateTensorFromFd</tt> or <tt>\ref vxCreateTensorFromHandle</tt>.
+ * \param [in] fd The file descriptor, still owned by the caller.
+ * \param [in] offset The byte offset of the storage in the descriptor.
+ * \param [in] usage The access the new storage is mapped for, as for <tt>\ref vxCreateTensorFromFd</tt>.
+ * \return A <tt>\ref vx_status_e</tt> enumeration.
+ * \ingroup group_tensor
+ */
+VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorFd(vx_tensor tensor, vx_int32 fd, vx_size offset, vx_enum usage);
+
+/*!
+ * \brief Creates a tensor which reads the elements of another tensor in a different shape, without a copy.
+ *
+ * The elements keep their order, so the source must be packed and \p dims must hold as many
+ * elements as the source. The view shares the storage of \p tensor.
+ *
+ * \param [in] tensor The tensor to reshape.
+ * \param [in] number_of_dims The number of dimensions of the view.
+ * \param [in] dims The size of each dimension of the view.
+ * \returns A tensor reference, check with <tt>\ref vxGetStatus</tt>.
+ * \retval VX_ERROR_INVALID_DIMENSION The number of elements differs.
+ * \retval VX_ERROR_NOT_SUPPORTED The source is a strided view which cannot be reshaped in place.
+ * \ingroup group_tensor
+ */
+VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromReshape(vx_tensor tensor, vx_size number_of_dims, const vx_size *dims);
+
+/*!
+ * \brief Creates a tensor which reads the dimensions of another tensor in a different order, without a copy.
+ *
+ * Dimension \a i of the view is dimension \p order[i] of \p tensor, only the strides are
+ * reordered. For example the order {2, 0, 1} turns a [C, W, H] tensor into a [H, C, W] view.
+ *
+ * \param [in] tensor The tensor to permute.
+ * \param [in] number_of_dims The number of dimensions, the same as the tensor.
+ * \param [in] order The source dimension of each view dimension.
+ * \returns A tensor reference, check with <tt>\ref vxGetStatus</tt>.
+ * \ingroup group_tensor
+ */
+VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromPermute(vx_tensor tensor, vx_size number_of_dims, const vx_size *order);
+
 /* COREFLOW Internal Macros */
 #define VX_INT_MAX_PARAM_QUEUE_DEPTH 10
 
@@ -322,11 +470,18 @@ VX_API_ENTRY vx_status VX_API_CALL vxImportGraphFromDot(vx_graph graph, vx_char
 #define OPENVX_USE_NN_16 1
 #define OPENVX_USE_PIPELINING 1
 #define OPENVX_USE_STREAMING 1
+#define OPENVX_USE_SMP 1
 
 #if defined(__arm__) || defined(__arm64__)
 #define OPENVX_USE_TILING 1
 #define OPENVX_KHR_TILING 1
 #define EXPERIMENTAL_USE_VENUM
+#elif defined(__x86_64__) || defined(_M_X64)
+/* the tiling kernels build over SSE4.1 on x86-64 hosts */
+#define OPENVX_USE_TILING 1
+#define OPENVX_KHR_TILING 1
+/* the x86 SIMD target picks its instruction set at run time */
+#define EXPERIMENTAL_USE_X86SIMD
 #endif /* defined(__arm__) || defined(__arm64__) */
 
 #define OPENVX_CONFORMANCE_NNEF_IMPORT 1
@@ -51,6 +51,17 @@
 #endif
 #endif
 
+/*! \def VX_RESTRICT_ARRAY
+ * \brief The restrict keyword inside the brackets of an array parameter, which only C99
+ * accepts. C++ compilers reject a qualifier there, so it is left out.
+ * \ingroup group_tiling
+ */
+#if defined(_WIN32) || defined(__cplusplus)
+#define VX_RESTRICT_ARRAY
+#else
+#define VX_RESTRICT_ARRAY restrict
+#endif
+
 /*! \brief The User Tiling Function tile block size declaration.
  * \details The author of a User Tiling Kernel will use this structure to define
  * the dimensionality of the tile block.
@@ -295,7 +306,7 @@ typedef void (*vx_tiling_kernel_f)(void * VX_RESTRICT parameters[],
                                    void * VX_RESTRICT tile_memory,
                                    vx_size tile_memory_size);
 #else
-typedef void (*vx_tiling_kernel_f)(void * VX_RESTRICT parameters[VX_RESTRICT],
+typedef void (*vx_tiling_kernel_f)(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY],
                                    void * VX_RESTRICT tile_memory,
                                    vx_size tile_memory_size);
 #endif
@@ -14,6 +14,7 @@
  */
 
 #include "debug_k.h"
+#include "vx_image.h"
 #include <string.h>
 
 
@@ -33,6 +34,12 @@ vx_status ownCopyImage(vx_image input, vx_image output)
     vx_rectangle_t rect;
     vx_status status = VX_SUCCESS; // assume success until an error occurs.
 
+    /* hand the planes over and leave the bytes to the first writer, as the C model copy does */
+    if (coreflow::Image::shareImage(input, output) == vx_true_e)
+    {
+        return VX_SUCCESS;
+    }
+
     status |= vxGetValidRegionImage(input, &rect);
 
     status |= vxQueryImage(input, VX_IMAGE_PLANES, &planes, sizeof(planes));
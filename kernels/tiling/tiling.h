@@ -193,110 +193,110 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddTilingKernelEx(vx_context context,
 
 #endif
 
-void box3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void box3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Phase_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Phase_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Phase_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Phase_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void And_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void And_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void And_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void And_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Or_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Or_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Or_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Or_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Xor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Xor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Xor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Xor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Not_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Not_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Not_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Not_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Threshold_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Threshold_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Threshold_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Threshold_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void ConvertColor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void ConvertColor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ConvertColor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ConvertColor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Multiply_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Multiply_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Multiply_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Multiply_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void NonLinearFilter_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void NonLinearFilter_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void NonLinearFilter_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void NonLinearFilter_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Magnitude_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Magnitude_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Magnitude_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Magnitude_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Erode3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Erode3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Erode3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Erode3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Dilate3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Dilate3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Dilate3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Dilate3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Median3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Median3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Median3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Median3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Sobel3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Sobel3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Sobel3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Sobel3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Max_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Max_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Min_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Min_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Gaussian3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Gaussian3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Gaussian3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Gaussian3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Addition_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Addition_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Addition_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Addition_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Subtraction_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Subtraction_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Subtraction_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Subtraction_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void ConvertDepth_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void ConvertDepth_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ConvertDepth_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ConvertDepth_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void WarpPerspective_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void WarpPerspective_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void WeightedAverage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void WeightedAverage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void WeightedAverage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void WeightedAverage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void AbsDiff_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void AbsDiff_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void IntegralImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void IntegralImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void IntegralImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void IntegralImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Convolve_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Convolve_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Convolve_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Convolve_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void HogFeatures_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void HogFeatures_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void HogFeatures_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void HogFeatures_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void Fast9Corners_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void Fast9Corners_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Fast9Corners_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void Fast9Corners_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void LBP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void LBP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void LBP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void LBP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void ScaleImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void ScaleImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ScaleImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ScaleImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void TableLookup_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void TableLookup_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void TableLookup_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void TableLookup_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void ChannelCombine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void ChannelCombine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void NonMaxSuppression_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void NonMaxSuppression_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void NonMaxSuppression_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void NonMaxSuppression_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void HogCells_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void HogCells_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void HogCells_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void HogCells_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
 
-void HoughLinesP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
-void HoughLinesP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void HoughLinesP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
+void HoughLinesP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size);
@@ -14,10 +14,10 @@
  * limitations under the License.
  */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -108,9 +108,9 @@ void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
         case VX_DF_IMAGE_U8:\
             {\
                 for (y = low_y; y < high_y; y++) {\
-                    vx_uint8* src1R = (vx_uint8 *)in_1->base[0] + in_1_tile_x + y * in_1->addr[0].stride_y;\
-                    vx_uint8* src2R = (vx_uint8 *)in_2->base[0] + in_2_tile_x + y * in_2->addr[0].stride_y;\
-                    vx_uint8* dstR = (vx_uint8 *)out->base[0] + out_tile_x + y * out->addr[0].stride_y;\
+                    vx_uint8* src1R = (vx_uint8 *)in_1->base[0] + in_1_tile_x + low_x + y * in_1->addr[0].stride_y;\
+                    vx_uint8* src2R = (vx_uint8 *)in_2->base[0] + in_2_tile_x + low_x + y * in_2->addr[0].stride_y;\
+                    vx_uint8* dstR = (vx_uint8 *)out->base[0] + out_tile_x + low_x + y * out->addr[0].stride_y;\
                     for (x = low_x; x < high_x; x++) \
                     {\
                         vx_int16 tmp = (*src1R) - (*src2R);\
@@ -157,9 +157,9 @@ void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
                         vx_uint16 *src[2] = \
                         {\
                             (vx_uint16 *)in_1->base[0] + in_1_tile_x + y * in_1->addr[0].stride_y / 2 + x * in_1->addr[0].stride_x / 2,\
-                            (vx_uint16 *)in_2->base[0] + in_2->tile_x + y * in_2->addr[0].stride_y / 2 + x * in_2->addr[0].stride_x / 2,\
+                            (vx_uint16 *)in_2->base[0] + in_2_tile_x + y * in_2->addr[0].stride_y / 2 + x * in_2->addr[0].stride_x / 2,\
                         };\
-                        vx_uint16 *dst = (vx_uint16 *)out->base[0] + out_tile_x + y * out->addr[0].stride_y + x * out->addr[0].stride_x;\
+                        vx_uint16 *dst = (vx_uint16 *)out->base[0] + out_tile_x + y * out->addr[0].stride_y / 2 + x * out->addr[0].stride_x / 2;\
                         if (*src[0] > *src[1])\
                             *dst = *src[0] - *src[1];\
                         else\
@@ -171,7 +171,7 @@ void AbsDiff_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
     }\
 
 
-void AbsDiff_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void AbsDiff_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -185,7 +185,7 @@ void AbsDiff_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], v
     }
     else
     {
-        ABSDIFF_FLEXIBLE(0, tx, ty, vxTileWidth(out, 0), in_1->tile_x, in_2->tile_x, out->tile_x)
+        ABSDIFF_FLEXIBLE(0, tx, ty, vxTileWidth(out, 0), 0, 0, 0)
         ABSDIFF_FLEXIBLE(ty, 0, vxTileHeight(out, 0), vxTileWidth(out, 0), 0, 0, 0)
     }
 }
@@ -14,10 +14,10 @@
  * limitations under the License.
  */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void Addition_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Addition_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -239,7 +239,7 @@ void Addition_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
     }
 
 
-void Addition_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Addition_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -261,7 +261,7 @@ void Addition_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
     }
 }
 
-void Subtraction_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Subtraction_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -416,7 +416,7 @@ void Subtraction_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], v
     }
 }
 
-void Subtraction_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Subtraction_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
 static vx_uint8 vx_and_op(vx_uint8 a, vx_uint8 b)
@@ -32,7 +32,7 @@ static vx_uint8 vx_xor_op(vx_uint8 a, vx_uint8 b)
     return a ^ b;
 }
 
-void And_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void And_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -46,9 +46,9 @@ void And_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
 
     for (y = low_height; y < height; y++)
     {
-        const vx_uint8* src1R = src_1 + y * in_1->image.width;
-        const vx_uint8* src2R = src_2 + y * in_2->image.width;
-        vx_uint8* dstR = dst + y * out->image.width;
+        const vx_uint8* src1R = src_1 + y * in_1->addr[0].stride_y;
+        const vx_uint8* src2R = src_2 + y * in_2->addr[0].stride_y;
+        vx_uint8* dstR = dst + y * out->addr[0].stride_y;
         for (x = 0; x < out->tile_block.width; x+=16)
         {
             uint8x16_t vSrc1R = vld1q_u8(src1R);
@@ -90,69 +90,30 @@ void And_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
 
 
 
-void And_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+/* the U8 pixels the full blocks leave out: the columns right of them in their rows,
+ * then every column of the rows below them */
+#define vxBinaryU8Flexible(op)                                                                 \
+    for (y = 0; y < vxTileHeight(out, 0); y++)                                                 \
+    {                                                                                          \
+        const vx_uint8 *src1R = in_1->base[0] + y * in_1->addr[0].stride_y;                    \
+        const vx_uint8 *src2R = in_2->base[0] + y * in_2->addr[0].stride_y;                    \
+        vx_uint8 *dstR = out->base[0] + y * out->addr[0].stride_y;                             \
+        for (x = (y < out->tile_y) ? out->tile_x : 0u; x < vxTileWidth(out, 0); x++)           \
+        {                                                                                      \
+            dstR[x] = op(src1R[x], src2R[x]);                                                  \
+        }                                                                                      \
+    }
+
+void And_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
     vx_tile_ex_t *in_2 = (vx_tile_ex_t *)parameters[1];
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[2];
-    vx_uint8 *src_1 = in_1->base[0] + in_1->tile_x;
-    vx_uint8 *src_2 = in_2->base[0] + in_2->tile_x;
-    vx_uint8 *dst = out->base[0] + out->tile_x;
-
-    vx_uint32 ty = out->tile_y;
-    vx_uint32 tx = out->tile_x;
 
     if (in_1->is_U1 == 0)
     {
-        if (ty == 0 && tx == 0)
-        {
-            for (y = 0; y < vxTileHeight(out, 0); y++)
-            {
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)&*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-        }
-        else
-        {
-            for (y = 0; y < ty; y++)
-            {
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = tx; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)&*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-            for (y = ty; y < vxTileHeight(out, 0); y++)
-            {
-                src_1 = in_1->base[0];
-                src_2 = in_2->base[0];
-                dst = out->base[0];
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)&*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-        }
+        vxBinaryU8Flexible(vx_and_op)
     }
     else
     {
@@ -160,7 +121,7 @@ void And_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void
     }
 }
 
-void Or_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Or_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -174,9 +135,9 @@ void Or_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_
 
     for (y = low_height; y < height; y++)
     {
-        const vx_uint8* src1R = src_1 + y * in_1->image.width;
-        const vx_uint8* src2R = src_2 + y * in_2->image.width;
-        vx_uint8* dstR = dst + y * out->image.width;
+        const vx_uint8* src1R = src_1 + y * in_1->addr[0].stride_y;
+        const vx_uint8* src2R = src_2 + y * in_2->addr[0].stride_y;
+        vx_uint8* dstR = dst + y * out->addr[0].stride_y;
         for (x = 0; x < out->tile_block.width; x+=16)
         {
             uint8x16_t vSrc1R = vld1q_u8(src1R);
@@ -192,69 +153,16 @@ void Or_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_
 }
 
 
-void Or_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Or_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
     vx_tile_ex_t *in_2 = (vx_tile_ex_t *)parameters[1];
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[2];
-    vx_uint8 *src_1 = in_1->base[0] + in_1->tile_x;
-    vx_uint8 *src_2 = in_2->base[0] + in_2->tile_x;
-    vx_uint8 *dst = out->base[0] + out->tile_x;
-
-    vx_uint32 ty = out->tile_y;
-    vx_uint32 tx = out->tile_x;
 
     if (in_1->is_U1 == 0)
     {
-        if (ty == 0 && tx == 0)
-        {
-            for (y = 0; y < vxTileHeight(out, 0); y++)
-            {
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)|*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-        }
-        else
-        {
-            for (y = 0; y < ty; y++)
-            {
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = tx; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)|*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-            for (y = ty; y < vxTileHeight(out, 0); y++)
-            {
-                src_1 = in_1->base[0];
-                src_2 = in_2->base[0];
-                dst = out->base[0];
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)|*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-        }
+        vxBinaryU8Flexible(vx_or_op)
     }
     else
     {
@@ -263,7 +171,7 @@ void Or_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void *
 }
 
 
-void Xor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Xor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -277,9 +185,9 @@ void Xor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
 
     for (y = low_height; y < height; y++)
     {
-        const vx_uint8* src1R = src_1 + y * in_1->image.width;
-        const vx_uint8* src2R = src_2 + y * in_2->image.width;
-        vx_uint8* dstR = dst + y * out->image.width;
+        const vx_uint8* src1R = src_1 + y * in_1->addr[0].stride_y;
+        const vx_uint8* src2R = src_2 + y * in_2->addr[0].stride_y;
+        vx_uint8* dstR = dst + y * out->addr[0].stride_y;
         for (x = 0; x < out->tile_block.width; x+=16)
         {
             uint8x16_t vSrc1R = vld1q_u8(src1R);
@@ -295,69 +203,16 @@ void Xor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
 }
 
 
-void Xor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Xor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
     vx_tile_ex_t *in_2 = (vx_tile_ex_t *)parameters[1];
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[2];
-    vx_uint8 *src_1 = in_1->base[0] + in_1->tile_x;
-    vx_uint8 *src_2 = in_2->base[0] + in_2->tile_x;
-    vx_uint8 *dst = out->base[0] + out->tile_x;
-
-    vx_uint32 ty = out->tile_y;
-    vx_uint32 tx = out->tile_x;
 
     if (in_1->is_U1 == 0)
     {
-        if (ty == 0 && tx == 0)
-        {
-            for (y = 0; y < vxTileHeight(out, 0); y++)
-            {
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)^*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-        }
-        else
-        {
-            for (y = 0; y < ty; y++)
-            {
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = tx; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)^*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-            for (y = ty; y < vxTileHeight(out, 0); y++)
-            {
-                src_1 = in_1->base[0];
-                src_2 = in_2->base[0];
-                dst = out->base[0];
-                const vx_uint8* src1R = src_1 + y * in_1->image.width;
-                const vx_uint8* src2R = src_2 + y * in_2->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = *(src1R + x)^*(src2R + x);
-                    src2R ++;
-                    src1R ++;
-                    dstR ++;
-                }
-            }
-        }
+        vxBinaryU8Flexible(vx_xor_op)
     }
     else
     {
@@ -366,7 +221,7 @@ void Xor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void
 }
 
 
-void Not_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Not_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -378,8 +233,8 @@ void Not_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
 
     for (y = low_height; y < height; y++)
     {
-        const vx_uint8* srcR = src + y * in->image.width;
-        vx_uint8* dstR = dst + y * out->image.width;
+        const vx_uint8* srcR = src + y * in->addr[0].stride_y;
+        vx_uint8* dstR = dst + y * out->addr[0].stride_y;
         for (x = 0; x < out->tile_block.width; x+=16)
         {
             uint8x16_t vSrcR = vld1q_u8(srcR);
@@ -393,58 +248,22 @@ void Not_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
 }
 
 
-void Not_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Not_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[1];
-    vx_uint8 *src = in->base[0] + in->tile_x;
-    vx_uint8 *dst = out->base[0] + out->tile_x;
-
-    vx_uint32 ty = out->tile_y;
-    vx_uint32 tx = out->tile_x;
 
     if (in->is_U1 == 0)
     {
-        if (ty == 0 && tx == 0)
+        /* the columns right of the full blocks in their rows, then the rows below them */
+        for (y = 0; y < vxTileHeight(out, 0); y++)
         {
-            for (y = 0; y < vxTileHeight(out, 0); y++)
-            {
-                const vx_uint8* srcR = src + y * in->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = ~*(srcR + x);
-                    srcR ++;
-                    dstR ++;
-                }
-            }
-        }
-        else
-        {
-            for (y = 0; y < ty; y++)
-            {
-                const vx_uint8* srcR = src + y * in->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = tx; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = ~*(srcR + x);
-                    srcR ++;
-                    dstR ++;
-                }
-            }
-            for (y = ty; y < vxTileHeight(out, 0); y++)
+            const vx_uint8 *srcR = in->base[0] + y * in->addr[0].stride_y;
+            vx_uint8 *dstR = out->base[0] + y * out->addr[0].stride_y;
+            for (x = (y < out->tile_y) ? out->tile_x : 0u; x < vxTileWidth(out, 0); x++)
             {
-                src = in->base[0];
-                dst = out->base[0];
-                const vx_uint8* srcR = src + y * in->image.width;
-                vx_uint8* dstR = dst + y * out->image.width;
-                for (x = 0; x < vxTileWidth(out, 0); x++)
-                {
-                    *(dstR+x) = ~*(srcR + x);
-                    srcR ++;
-                    dstR ++;
-                }
+                dstR[x] = (vx_uint8)~srcR[x];
             }
         }
     }
@@ -14,10 +14,10 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0, p;
     vx_tile_ex_t *in[4];
@@ -95,7 +95,6 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
     else if ((format == VX_DF_IMAGE_YUV4) || (format == VX_DF_IMAGE_IYUV))
     {
         vx_uint8 *ptr_in, *ptr_out;
-        vx_uint32 wCnt = ((high_x >> 1) >> 3) << 3;
         for (p = 0; p < 3; p++)
         {
             if (1 == out->addr[p].step_y)
@@ -120,7 +119,7 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
                              in[p]->addr->scale_y / VX_SCALE_UNITY) * in[p]->addr->stride_y;
                     ptr_out = (vx_uint8 *)base_dst_ptr[p] + (y * out->addr[p].scale_y / VX_SCALE_UNITY) * out->addr[p].stride_y;
 
-                    for (x = low_x; x < wCnt; x += 8)
+                    for (x = low_x / 2; x < high_x / 2; x += 8)
                     {
                         uint8x8_t pixels = vld1_u8(ptr_in + x * in[p]->addr->stride_x);
                         vst1_u8(ptr_out + x * out->addr[p].stride_x, pixels);
@@ -149,7 +148,6 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
 
         // plane 1
         {
-            vx_uint32 wCnt = ((high_x >> 1) >> 3) << 3;
             for (y = low_y; y < high_y; y += out->addr[1].step_y)
             {
                 vx_uint8 *ptr_src0 = (vx_uint8 *)base_src_ptrs[1] + in[1]->addr->stride_y *
@@ -157,7 +155,7 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
                 vx_uint8 *ptr_src1 = (vx_uint8 *)base_src_ptrs[2] + in[2]->addr->stride_y *
                                      ((y * in[1]->addr->step_y / out->addr[1].step_y) * in[2]->addr->scale_y / VX_SCALE_UNITY);
                 vx_uint8 *ptr_dst = (vx_uint8 *)base_dst_ptr[1] + out->addr[1].stride_y * (y *out->addr[1].scale_y / VX_SCALE_UNITY);
-                for (x = low_x; x < wCnt; x += 8)
+                for (x = low_x / 2; x < high_x / 2; x += 8)
                 {
                     uint8x8x2_t pixels;
                     pixels.val[1-vidx] = vld1_u8(ptr_src0 + x * in[1]->addr->stride_x);
@@ -199,10 +197,10 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
 #define RGB(low_y, high_y, low_x)                                                                                   \
     for (y = low_y; y < high_y; y += out->addr->step_y)                                                             \
     {                                                                                                               \
-        planes[0] = (vx_uint8 *)base_src_ptrs[0] + y * in[0]->addr->stride_y;                                       \
-        planes[1] = (vx_uint8 *)base_src_ptrs[1] + y * in[1]->addr->stride_y;                                       \
-        planes[2] = (vx_uint8 *)base_src_ptrs[2] + y * in[2]->addr->stride_y;                                       \
-        vx_uint8 *dst = (vx_uint8 *)base_dst_ptr[0] + y * out->addr->stride_y;                                      \
+        planes[0] = (vx_uint8 *)base_src_ptrs[0] + y * in[0]->addr->stride_y + low_x * in[0]->addr->stride_x;       \
+        planes[1] = (vx_uint8 *)base_src_ptrs[1] + y * in[1]->addr->stride_y + low_x * in[1]->addr->stride_x;       \
+        planes[2] = (vx_uint8 *)base_src_ptrs[2] + y * in[2]->addr->stride_y + low_x * in[2]->addr->stride_x;       \
+        vx_uint8 *dst = (vx_uint8 *)base_dst_ptr[0] + y * out->addr->stride_y + low_x * out->addr->stride_x;        \
         for (x = low_x; x < high_x; x += out->addr->step_x)                                                         \
         {                                                                                                           \
             dst[0] = planes[0][0];                                                                                  \
@@ -242,8 +240,8 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
 #define NV12(low_y, high_y, low_x)                                                                                                 \
     for (y = low_y; y < high_y; y += out->addr[0].step_y)                                                                          \
     {                                                                                                                              \
-        vx_uint8 *src = (vx_uint8 *)base_src_ptrs[0] + y * in[0]->addr->stride_y;                                                  \
-        vx_uint8 *dst = (vx_uint8 *)base_dst_ptr[0] + y * out->addr[0].stride_y;                                                   \
+        vx_uint8 *src = (vx_uint8 *)base_src_ptrs[0] + y * in[0]->addr->stride_y + low_x * in[0]->addr->stride_x;                  \
+        vx_uint8 *dst = (vx_uint8 *)base_dst_ptr[0] + y * out->addr[0].stride_y + low_x * out->addr[0].stride_x;                   \
         for (x = low_x; x < high_x; x += out->addr[0].step_x)                                                                      \
         {                                                                                                                          \
             *dst = *src;                                                                                                           \
@@ -296,7 +294,7 @@ void ChannelCombine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT]
     }
 
 
-void ChannelCombine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ChannelCombine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0, p;
     vx_tile_ex_t *in[4];
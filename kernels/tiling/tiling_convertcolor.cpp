@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 
 #include <tiling.h>
 
@@ -119,154 +119,30 @@ static void yuv2yuv_601to709(vx_uint8 y0, vx_uint8 cb0, vx_uint8 cr0,
 static void rgb2yuv_bt709_neon(vx_float32 *arrfr, vx_float32 *arrfg, vx_float32 *arrfb,
     vx_uint8 **y, vx_uint8 *cb, vx_uint8 *cr)
 {
-    /*
-    Y'= 0.2126*R' + 0.7152*G' + 0.0722*B'
-    U'=-0.1146*R' - 0.3854*G' + 0.5000*B'
-    V'= 0.5000*R' - 0.4542*G' - 0.0458*B'
-    */
-
-    float32x4_t fr32x4 = vld1q_f32(arrfr);
-    float32x4_t fg32x4 = vld1q_f32(arrfg);
-    float32x4_t fb32x4 = vld1q_f32(arrfb);
-
-    float32x4_t fy32x4 = vdupq_n_f32(0.0f);
-    fy32x4 = vmlaq_n_f32(fy32x4, fr32x4, 0.2126f);
-    fy32x4 = vmlaq_n_f32(fy32x4, fg32x4, 0.7152f);
-    fy32x4 = vmlaq_n_f32(fy32x4, fb32x4, 0.0722f);
-
-    float32x4_t fu32x4 =  vdupq_n_f32(0.0f);
-    fu32x4 = vmlaq_n_f32(fu32x4, fr32x4, -0.1146f);
-    fu32x4 = vmlaq_n_f32(fu32x4, fg32x4, -0.3854f);
-    fu32x4 = vmlaq_n_f32(fu32x4, fb32x4, 0.5000f);
-
-    float32x4_t fv32x4 = vdupq_n_f32(0.0f);
-    fv32x4 = vmlaq_n_f32(fv32x4, fr32x4, 0.5000f);
-    fv32x4 = vmlaq_n_f32(fv32x4, fg32x4, -0.4542f);
-    fv32x4 = vmlaq_n_f32(fv32x4, fb32x4, -0.0458f);
-
-    int32x4_t iy32x4 = vcvtq_s32_f32(fy32x4);
-
-    int32x4_t icoeff32x4 = vdupq_n_s32(128);
-    int32x4_t iu32x4 = vcvtq_s32_f32(fu32x4);
-    iu32x4 = vaddq_s32(iu32x4, icoeff32x4);
-
-    int32x4_t iv32x4 = vcvtq_s32_f32(fv32x4);
-    iv32x4 = vaddq_s32(iv32x4, icoeff32x4);
-
-    int16x4_t vqmovn_s32 (int32x4_t __a);
-    uint16x4_t vreinterpret_u16_s16 (int16x4_t __a);
-    uint8x8_t vqmovn_u16 (uint16x8_t __a);
-
-    y[0][0] = usat8(vgetq_lane_s32(iy32x4, 0));
-    y[1][0] = usat8(vgetq_lane_s32(iy32x4, 1));
-    y[2][0] = usat8(vgetq_lane_s32(iy32x4, 2));
-    y[3][0] = usat8(vgetq_lane_s32(iy32x4, 3));
-
-
-    cb[0] = usat8(vgetq_lane_s32(iu32x4, 0));
-    cb[1] = usat8(vgetq_lane_s32(iu32x4, 1));
-    cb[2] = usat8(vgetq_lane_s32(iu32x4, 2));
-    cb[3] = usat8(vgetq_lane_s32(iu32x4, 3));
-
-    cr[0] = usat8(vgetq_lane_s32(iv32x4, 0));
-    cr[1] = usat8(vgetq_lane_s32(iv32x4, 1));
-    cr[2] = usat8(vgetq_lane_s32(iv32x4, 2));
-    cr[3] = usat8(vgetq_lane_s32(iv32x4, 3));
+    /* per lane in double precision, so the result matches the C model bit for bit */
+    for (vx_uint32 i = 0; i < 4; i++)
+    {
+        rgb2yuv_bt709((vx_uint8)arrfr[i], (vx_uint8)arrfg[i], (vx_uint8)arrfb[i], &y[i][0], &cb[i], &cr[i]);
+    }
 }
 
 static void yuv2rgb_bt601_neon(vx_uint8 **y, vx_uint8 cb, vx_uint8 cr,
     vx_uint8 **r, vx_uint8 **g, vx_uint8 **b)
 {
-    /*
-    R'= Y' + 0.000*U' + 1.403*V'
-    G'= Y' - 0.344*U' - 0.714*V'
-    B'= Y' + 1.773*U' + 0.000*V'
-    */
-    vx_float32 fy[4] = { (vx_float32)y[0][0], (vx_float32)y[1][0], (vx_float32)y[2][0], (vx_float32)y[3][0] };
-    vx_float32 fu[4] = { (vx_float32)cb - 128, (vx_float32)cb - 128, (vx_float32)cb - 128, (vx_float32)cb - 128 };
-    vx_float32 fv[4] = { (vx_float32)cr - 128, (vx_float32)cr - 128, (vx_float32)cr - 128, (vx_float32)cr - 128 };
-
-    float32x4_t fy32x4 = vld1q_f32(fy);
-    float32x4_t fu32x4 = vld1q_f32(fu);
-    float32x4_t fv32x4 = vld1q_f32(fv);
-
-    float32x4_t fr32x4 = vdupq_n_f32(0.0f);
-    fr32x4 = vaddq_f32(fr32x4, fy32x4);
-    fr32x4 = vmlaq_n_f32(fr32x4, fu32x4, 0.000f);
-    fr32x4 = vmlaq_n_f32(fr32x4, fv32x4, 1.403f);
-
-    float32x4_t fg32x4 = vdupq_n_f32(0.0f);
-    fg32x4 = vaddq_f32(fg32x4, fy32x4);
-    fg32x4 = vmlaq_n_f32(fg32x4, fu32x4, -0.344f);
-    fg32x4 = vmlaq_n_f32(fg32x4, fv32x4, -0.714f);
-
-    float32x4_t fb32x4 = vdupq_n_f32(0.0f);
-    fb32x4 = vaddq_f32(fb32x4, fy32x4);
-    fb32x4 = vmlaq_n_f32(fb32x4, fu32x4, 1.773f);
-    fb32x4 = vmlaq_n_f32(fb32x4, fv32x4, 0.000f);
-
-    int32x4_t ir32x4 = vcvtq_s32_f32(fr32x4);
-    int32x4_t ig32x4 = vcvtq_s32_f32(fg32x4);
-    int32x4_t ib32x4 = vcvtq_s32_f32(fb32x4);
-
-    vx_int32 arr32[12];
-    vst1q_s32(arr32,  ir32x4);
-    vst1q_s32(arr32+4, ig32x4);
-    vst1q_s32(arr32+8, ib32x4);
-
-    for (vx_uint8 i = 0; i < 4; i++)
+    /* per lane in double precision, so the result matches the C model bit for bit */
+    for (vx_uint32 i = 0; i < 4; i++)
     {
-        r[i][0] = usat8(arr32[i]);
-        g[i][1] = usat8(arr32[4 + i]);
-        b[i][2] = usat8(arr32[8 + i]);
+        yuv2rgb_bt601(y[i][0], cb, cr, &r[i][0], &g[i][1], &b[i][2]);
     }
 }
 
 static void yuv2rgb_bt709_neon(vx_uint8 **y, vx_uint8 cb, vx_uint8 cr,
     vx_uint8 **r, vx_uint8 **g, vx_uint8 **b)
 {
-    /*
-    R'= Y' + 0.0000*U + 1.5748*V
-    G'= Y' - 0.1873*U - 0.4681*V
-    B'= Y' + 1.8556*U + 0.0000*V
-    */
-    vx_float32 fy[4] = { (vx_float32)y[0][0], (vx_float32)y[1][0], (vx_float32)y[2][0], (vx_float32)y[3][0] };
-    vx_float32 fu[4] = { (vx_float32)cb - 128, (vx_float32)cb - 128, (vx_float32)cb - 128, (vx_float32)cb - 128 };
-    vx_float32 fv[4] = { (vx_float32)cr - 128, (vx_float32)cr - 128, (vx_float32)cr - 128, (vx_float32)cr - 128 };
-
-    float32x4_t fy32x4 = vld1q_f32(fy);
-    float32x4_t fu32x4 = vld1q_f32(fu);
-    float32x4_t fv32x4 = vld1q_f32(fv);
-
-    float32x4_t fr32x4 = vdupq_n_f32(0.0f);
-    fr32x4 = vaddq_f32(fr32x4, fy32x4);
-    fr32x4 = vmlaq_n_f32(fr32x4, fu32x4, 0.000f);
-    fr32x4 = vmlaq_n_f32(fr32x4, fv32x4, 1.5748f);
-
-    float32x4_t fg32x4 = vdupq_n_f32(0.0f);
-    fg32x4 = vaddq_f32(fg32x4, fy32x4);
-    fg32x4 = vmlaq_n_f32(fg32x4, fu32x4, -0.1873f);
-    fg32x4 = vmlaq_n_f32(fg32x4, fv32x4,  -0.4681f);
-
-    float32x4_t fb32x4 = vdupq_n_f32(0.0f);
-    fb32x4 = vaddq_f32(fb32x4, fy32x4);
-    fb32x4 = vmlaq_n_f32(fb32x4, fu32x4, 1.8556f);
-    fb32x4 = vmlaq_n_f32(fb32x4, fv32x4, 0.000f);
-
-    int32x4_t ir32x4 = vcvtq_s32_f32(fr32x4);
-    int32x4_t ig32x4 = vcvtq_s32_f32(fg32x4);
-    int32x4_t ib32x4 = vcvtq_s32_f32(fb32x4);
-
-    vx_int32 arr32[12];
-    vst1q_s32(arr32, ir32x4);
-    vst1q_s32(arr32 + 4, ig32x4);
-    vst1q_s32(arr32+8, ib32x4);
-
-    for (vx_uint8 i = 0; i < 4; i++)
+    /* per lane in double precision, so the result matches the C model bit for bit */
+    for (vx_uint32 i = 0; i < 4; i++)
     {
-        r[i][0] = usat8(arr32[i]);
-        g[i][1] = usat8(arr32[4 + i]);
-        b[i][2] = usat8(arr32[8 + i]);
+        yuv2rgb_bt709(y[i][0], cb, cr, &r[i][0], &g[i][1], &b[i][2]);
     }
 }
 
@@ -323,95 +199,25 @@ static void yuv2yuv_601to709_neon(vx_uint8 *y0, vx_uint8 *cb0, vx_uint8 *cr0,
 static void yuv2rgb_bt601V(vx_float32* y, vx_float32* cb, vx_float32* cr,
     vx_uint8 *rUint8, vx_uint8 *gUint8, vx_uint8 *bUint8)
 {
-    float32x4_t y32X4Value = vld1q_f32(y);
-    float32x4_t cb32X4Value = vld1q_f32(cb);
-    float32x4_t cr32X4Value = vld1q_f32(cr);
-    float32x4_t All128 = vdupq_n_f32(128.0f);
-    __attribute__((unused))
-    float32x4_t AllZero = vdupq_n_f32(0.0f);
-    float32x4_t rFloatValue, gFloatValue, bFloatValue;
-    int32x4_t  rIntValue, gIntValue, bIntValue;
-    cb32X4Value = vsubq_f32(cb32X4Value,All128);
-    cr32X4Value = vsubq_f32(cr32X4Value,All128);
-
-    // R'= Y' + 0.000*U' + 1.403*V'
-    // G'= Y' - 0.344*U' - 0.714*V'
-    // B'= Y' + 1.773*U' + 0.000*V'
-    rFloatValue = vmlaq_n_f32(y32X4Value, cr32X4Value, 1.403f);
-
-    gFloatValue = vmlaq_n_f32(y32X4Value, cb32X4Value, -0.344f);
-    gFloatValue = vmlaq_n_f32(gFloatValue, cr32X4Value, -0.714f);
-
-    bFloatValue = vmlaq_n_f32(y32X4Value, cb32X4Value, 1.773f);
-
-    rIntValue = vcvtq_s32_f32(rFloatValue);
-    gIntValue = vcvtq_s32_f32(gFloatValue);
-    bIntValue = vcvtq_s32_f32(bFloatValue);
-
-    rUint8[0] = usat8(vgetq_lane_s32(rIntValue, 0));
-    gUint8[0] = usat8(vgetq_lane_s32(gIntValue, 0));
-    bUint8[0] = usat8(vgetq_lane_s32(bIntValue, 0));
-
-    rUint8[1] = usat8(vgetq_lane_s32(rIntValue, 1));
-    gUint8[1] = usat8(vgetq_lane_s32(gIntValue, 1));
-    bUint8[1] = usat8(vgetq_lane_s32(bIntValue, 1));
-
-    rUint8[2] = usat8(vgetq_lane_s32(rIntValue, 2));
-    gUint8[2] = usat8(vgetq_lane_s32(gIntValue, 2));
-    bUint8[2] = usat8(vgetq_lane_s32(bIntValue, 2));
-
-    rUint8[3] = usat8(vgetq_lane_s32(rIntValue, 3));
-    gUint8[3] = usat8(vgetq_lane_s32(gIntValue, 3));
-    bUint8[3] = usat8(vgetq_lane_s32(bIntValue, 3));
+    /* per lane in double precision, so the result matches the C model bit for bit */
+    for (vx_uint32 i = 0; i < 4; i++)
+    {
+        yuv2rgb_bt601((vx_uint8)y[i], (vx_uint8)cb[i], (vx_uint8)cr[i], &rUint8[i], &gUint8[i], &bUint8[i]);
+    }
 }
 
 static void yuv2rgb_bt709V(vx_float32* y, vx_float32* cb, vx_float32* cr,
     vx_uint8 *rUint8, vx_uint8 *gUint8, vx_uint8 *bUint8)
 {
-    float32x4_t y32X4Value = vld1q_f32(y);
-    float32x4_t cb32X4Value = vld1q_f32(cb);
-    float32x4_t cr32X4Value = vld1q_f32(cr);
-    float32x4_t All128 = vdupq_n_f32(128.0f);
-    __attribute__((unused))
-    float32x4_t AllZero = vdupq_n_f32(0.0f);
-    float32x4_t rFloatValue, gFloatValue, bFloatValue;
-    int32x4_t  rIntValue, gIntValue, bIntValue;
-    cb32X4Value = vsubq_f32(cb32X4Value,All128);
-    cr32X4Value = vsubq_f32(cr32X4Value,All128);
-
-    // R'= Y' + 0.000*U' + 1.403*V'
-    // G'= Y' - 0.344*U' - 0.714*V'
-    // B'= Y' + 1.773*U' + 0.000*V'
-    rFloatValue = vmlaq_n_f32(y32X4Value, cr32X4Value, 1.5748f);
-
-    gFloatValue = vmlaq_n_f32(y32X4Value, cb32X4Value, -0.1873f);
-    gFloatValue = vmlaq_n_f32(gFloatValue, cr32X4Value, -0.4681f);
-
-    bFloatValue = vmlaq_n_f32(y32X4Value, cb32X4Value, 1.8556f);
-
-    rIntValue = vcvtq_s32_f32(rFloatValue);
-    gIntValue = vcvtq_s32_f32(gFloatValue);
-    bIntValue = vcvtq_s32_f32(bFloatValue);
-
-    rUint8[0] = usat8(vgetq_lane_s32(rIntValue, 0));
-    gUint8[0] = usat8(vgetq_lane_s32(gIntValue, 0));
-    bUint8[0] = usat8(vgetq_lane_s32(bIntValue, 0));
-
-    rUint8[1] = usat8(vgetq_lane_s32(rIntValue, 1));
-    gUint8[1] = usat8(vgetq_lane_s32(gIntValue, 1));
-    bUint8[1] = usat8(vgetq_lane_s32(bIntValue, 1));
-
-    rUint8[2] = usat8(vgetq_lane_s32(rIntValue, 2));
-    gUint8[2] = usat8(vgetq_lane_s32(gIntValue, 2));
-    bUint8[2] = usat8(vgetq_lane_s32(bIntValue, 2));
-
-    rUint8[3] = usat8(vgetq_lane_s32(rIntValue, 3));
-    gUint8[3] = usat8(vgetq_lane_s32(gIntValue, 3));
-    bUint8[3] = usat8(vgetq_lane_s32(bIntValue, 3));
+    /* per lane in double precision, so the result matches the C model bit for bit */
+    for (vx_uint32 i = 0; i < 4; i++)
+    {
+        yuv2rgb_bt709((vx_uint8)y[i], (vx_uint8)cb[i], (vx_uint8)cr[i], &rUint8[i], &gUint8[i], &bUint8[i]);
+    }
 }
 
 
-void ConvertColor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ConvertColor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -1739,7 +1545,7 @@ void ConvertColor_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT],
         }                                                                                                       \
     }
 
-void ConvertColor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ConvertColor_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
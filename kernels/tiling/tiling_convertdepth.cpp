@@ -14,10 +14,10 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void ConvertDepth_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ConvertDepth_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -146,7 +146,7 @@ void ConvertDepth_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT],
     }
 
 
-void ConvertDepth_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ConvertDepth_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
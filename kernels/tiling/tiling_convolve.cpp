@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 
 #include <tiling.h>
 
@@ -678,7 +678,7 @@ static void convRow9x1s16(int16x8_t *pvPrv, int16x8_t *pvCur, int16x8_t *pvNxt,
     return;
 }
 
-void Convolve_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Convolve_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -2445,7 +2445,7 @@ static void vxReadRectangle_flexible(const void *base, const vx_imagepatch_addre
     }
 
 
-void Convolve_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Convolve_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0, i;
 
@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 #include <string.h>
 
@@ -535,7 +535,7 @@ static vx_uint8 vxGetFastCornerStrength(vx_int32 x, vx_int32 y, void* src_base,
     }
 }
 
-void Fast9Corners_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Fast9Corners_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -818,7 +818,7 @@ void Fast9Corners_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT],
     }
 
 
-void Fast9Corners_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Fast9Corners_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -14,12 +14,12 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
 #include <stdlib.h>
 
-void box3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void box3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -113,7 +113,7 @@ void box3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void *
 }
 
 
-void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -125,9 +125,9 @@ void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], vo
 
     if (ty == 0 && tx == 0)
     {
-        for (y = 1; y < vxTileHeight(out, 0); y++)
+        for (y = 1; y < vxTileHeight(out, 0) - 1; y++)
         {
-            for (x = 1; x < vxTileWidth(out, 0); x++)
+            for (x = 1; x < vxTileWidth(out, 0) - 1; x++)
             {
                 vx_int32 j, i;
                 vx_uint32 sum = 0;
@@ -151,7 +151,7 @@ void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], vo
     {
         for (y = 1; y < ty; y++)
         {
-            for (x = tx; x < vxTileWidth(out, 0); x++)
+            for (x = tx; x < vxTileWidth(out, 0) - 1; x++)
             {
                 vx_int32 j, i;
                 vx_uint32 sum = 0;
@@ -172,9 +172,9 @@ void box3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], vo
             }
         }
 
-        for (y = ty; y < vxTileHeight(out, 0); y++)
+        for (y = ty; y < vxTileHeight(out, 0) - 1; y++)
         {
-            for (x = 1; x < vxTileWidth(out, 0); x++)
+            for (x = 1; x < vxTileWidth(out, 0) - 1; x++)
             {
                 vx_int32 j, i;
                 vx_uint32 sum = 0;
@@ -204,7 +204,7 @@ static inline void sort(uint8x8_t *a, uint8x8_t *b)
     *b = max;
 }
 
-void Median3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Median3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -354,7 +354,7 @@ static void vxReadRectangle_U1(const void *base,
     }
 }
 
-void Median3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Median3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -376,7 +376,7 @@ void Median3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
         else
         {
             Median3x3(1, low_y, low_x, high_x - 1)
-            Median3x3(low_y, high_y, 1, high_x - 1)
+            Median3x3(low_y, high_y - 1, 1, high_x - 1)
         }
     }
     else
@@ -407,7 +407,7 @@ void Median3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
 }
 
 
-void Gaussian3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Gaussian3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -519,7 +519,7 @@ void Gaussian3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], v
     }
 
 
-void Gaussian3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Gaussian3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -539,6 +539,6 @@ void Gaussian3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT
     else
     {
         Gaussian3x3(1, low_y, low_x, high_x - 1)
-        Gaussian3x3(low_y, high_y, 1, high_x - 1)
+        Gaussian3x3(low_y, high_y - 1, 1, high_x - 1)
     }
 }
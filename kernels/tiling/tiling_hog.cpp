@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 #include <math.h>
 
@@ -22,7 +22,7 @@
 #define min(a,b) (a<b?a:b)
 #endif
 
-void HogCells_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void HogCells_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 y, x;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -45,8 +45,8 @@ void HogCells_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
 
     vx_float32 gx_0, gx_1, gx_2, gx_3;
     vx_float32 gy_0, gy_1, gy_2, gy_3;
-    float32x4_t magnitude_f32x4;
-    float32x4_t orientation_f32x4;
+    float32x4_t magnitude_f32x4 = vdupq_n_f32(0.0f);
+    float32x4_t orientation_f32x4 = vdupq_n_f32(0.0f);
     // float32x4_t fv_0_5_32x4 = vdupq_n_f32(0.5f);
     float32x4_t num_div_360_f32x4 = vdupq_n_f32(num_div_360);
     // int32x4_t bin_s32x4;
@@ -159,7 +159,7 @@ void HogCells_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
         }\
     }\
 
-void HogCells_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void HogCells_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 y, x;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -189,7 +189,7 @@ void HogCells_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
     }
 }
 
-void HogFeatures_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void HogFeatures_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_int32 x = 0, y = 0;
 
@@ -366,7 +366,7 @@ void HogFeatures_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], v
         }                                                                                                                              \
     }
 
-void HogFeatures_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void HogFeatures_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 x = 0, y = 0;
 
@@ -14,7 +14,7 @@
  * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -106,7 +106,7 @@ static void vxMapArrayRange_tiling(vx_tile_array_t *arr, vx_uint8 *buf, vx_size
     *ptr = buf;
 }
 
-void HoughLinesP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void HoughLinesP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
     vx_tile_array_t *param_hough_lines_array = (vx_tile_array_t *)parameters[1];
@@ -446,7 +446,7 @@ void HoughLinesP_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], v
     }
 }
 
-void HoughLinesP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void HoughLinesP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
     vx_tile_array_t *param_hough_lines_array = (vx_tile_array_t *)parameters[1];
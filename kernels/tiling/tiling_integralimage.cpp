@@ -14,10 +14,10 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void IntegralImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void IntegralImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -186,7 +186,7 @@ void IntegralImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT],
         }                                                                                       \
     }
 
-void IntegralImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void IntegralImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -199,8 +199,8 @@ void IntegralImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRI
     vx_uint32 low_x = in->tile_x;
     vx_uint32 high_x = vxTileWidth(in, 0);
 
-    vx_uint8 *src_base = in->base[0] + in->tile_x;
-    vx_uint8 *dst_base = out->base[0] + out->tile_x;
+    vx_uint8 *src_base = in->base[0];
+    vx_uint8 *dst_base = out->base[0];
 
     if (low_y == 0 && low_x == 0)
     {
@@ -208,10 +208,7 @@ void IntegralImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRI
     }
     else
     {
-        INTEGRAL_IMAGE(0, low_y, low_x)
-
-        vx_uint8 *src_base = in->base[0];
-        vx_uint8 *dst_base = out->base[0];
+        INTEGRAL_IMAGE(0, low_y, (low_x > 0u) ? low_x : 1u)
         INTEGRAL_IMAGE(low_y, high_y, 1)
     }
 }
@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 #include <stdlib.h>
 
@@ -616,12 +616,12 @@ static void vxLBPStandard_tiling_flexible(vx_tile_ex_t *in, vx_int8 ksize, vx_ti
         if (ksize == 3)
         {
             LBPSTANDARD_3x3(1, low_y, low_x, high_x - 1)
-            LBPSTANDARD_3x3(low_y, high_y, 1, high_x - 1)
+            LBPSTANDARD_3x3(low_y, high_y - 1, 1, high_x - 1)
         }
         else if (ksize == 5)
         {
             LBPSTANDARD_5x5(2, low_y, low_x, high_x - 2)
-            LBPSTANDARD_5x5(low_y, high_y, 2, high_x - 2)
+            LBPSTANDARD_5x5(low_y, high_y - 2, 2, high_x - 2)
         }
     }
 }
@@ -675,7 +675,7 @@ void vxLBPModified_tiling_flexible(vx_tile_ex_t *in, vx_tile_ex_t *out)
     else
     {
         LBPMODIFIED(2, low_y, low_x, high_x - 2)
-        LBPMODIFIED(low_y, high_y, 2, high_x - 2)
+        LBPMODIFIED(low_y, high_y - 2, 2, high_x - 2)
     }
 }
 
@@ -774,18 +774,18 @@ void vxLBPUniform_tiling_flexible(vx_tile_ex_t *in, vx_int8 ksize, vx_tile_ex_t
         if (ksize == 3)
         {
             LBPUNIFORM_3x3(1, low_y, low_x, high_x - 1)
-            LBPUNIFORM_3x3(low_y, high_y, 1, high_x - 1)
+            LBPUNIFORM_3x3(low_y, high_y - 1, 1, high_x - 1)
         }
         else if (ksize == 5)
         {
             LBPUNIFORM_5x5(2, low_y, low_x, high_x - 2)
-            LBPUNIFORM_5x5(low_y, high_y, 2, high_x - 2)
+            LBPUNIFORM_5x5(low_y, high_y - 2, 2, high_x - 2)
         }
     }
 }
 
 
-void LBP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void LBP_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
     vx_enum *format = (vx_enum *)parameters[1];
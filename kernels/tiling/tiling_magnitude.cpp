@@ -14,12 +14,12 @@
  * limitations under the License.
  */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 #include <math.h>
 
 // nodeless version of the Magnitude kernel
-void Magnitude_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Magnitude_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x, value;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -183,7 +183,7 @@ void Magnitude_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], voi
         }                                                                                         \
     }                                                                                             \
 
-void Magnitude_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Magnitude_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x, value;
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -15,10 +15,10 @@
  * limitations under the License.
  */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;    
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -31,9 +31,9 @@ void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
     case VX_DF_IMAGE_U8:
         for (y = low_height; y < height; y++)
         {
-            vx_uint8* src0p = (vx_uint8 *)in_1->base[0] + in_1->tile_x + y * in_1->image.width;
-            vx_uint8* src1p = (vx_uint8 *)in_2->base[0] + in_2->tile_x + y * in_2->image.width;
-            vx_uint8* dstp = (vx_uint8 *)out->base[0] + out->tile_x + y * out->image.width;
+            vx_uint8* src0p = (vx_uint8 *)in_1->base[0] + in_1->tile_x + y * in_1->addr[0].stride_y;
+            vx_uint8* src1p = (vx_uint8 *)in_2->base[0] + in_2->tile_x + y * in_2->addr[0].stride_y;
+            vx_uint8* dstp = (vx_uint8 *)out->base[0] + out->tile_x + y * out->addr[0].stride_y;
             for (x = 0; x < out->tile_block.width; x += 16)
             {
                 uint8x16_t vsrc0 = vld1q_u8( src0p + x);
@@ -67,9 +67,9 @@ void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
             switch (out->image.format)                                                                                     \
             {                                                                                                              \
             case VX_DF_IMAGE_U8:                                                                                           \
-                src0p = (vx_uint8 *)in_1->base[0] + in_1_tile_x + y * in_1->image.width + x * in_1->addr[0].stride_x;     \
-                src1p = (vx_uint8 *)in_2->base[0] + in_2_tile_x + y * in_2->image.width + x * in_2->addr[0].stride_x;     \
-                dstp = (vx_uint8 *)out->base[0] + out_tile_x + y * out->image.width + x * out->addr[0].stride_x;          \
+                src0p = (vx_uint8 *)in_1->base[0] + in_1_tile_x + y * in_1->addr[0].stride_y + x * in_1->addr[0].stride_x;     \
+                src1p = (vx_uint8 *)in_2->base[0] + in_2_tile_x + y * in_2->addr[0].stride_y + x * in_2->addr[0].stride_x;     \
+                dstp = (vx_uint8 *)out->base[0] + out_tile_x + y * out->addr[0].stride_y + x * out->addr[0].stride_x;          \
                 val0 = *(src0p);                                                                                           \
                 val1 = *(src1p);                                                                                           \
                 *dstp = val0 > val1 ? val0 : val1;                                                                         \
@@ -86,7 +86,7 @@ void Max_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
         }                                                                                                                  \
     }                                                                                                                      \
 
-void Max_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Max_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;    
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -103,12 +103,12 @@ void Max_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void
     }
     else
     {
-        MAX_FLEXIBLE(0, tx, ty, vxTileWidth(out, 0), in_1->tile_x, in_2->tile_x, out->tile_x)
+        MAX_FLEXIBLE(0, tx, ty, vxTileWidth(out, 0), 0, 0, 0)
         MAX_FLEXIBLE(ty, 0, vxTileHeight(out, 0), vxTileWidth(out, 0), 0, 0, 0)
     }
 }
 
-void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;    
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -121,9 +121,9 @@ void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
     case VX_DF_IMAGE_U8:
         for (y = low_height; y < height; y++)
         {
-            vx_uint8* src0p = (vx_uint8 *)in_1->base[0] + in_1->tile_x + y * in_1->image.width;
-            vx_uint8* src1p = (vx_uint8 *)in_2->base[0] + in_2->tile_x + y * in_2->image.width;
-            vx_uint8* dstp = (vx_uint8 *)out->base[0] + out->tile_x + y * out->image.width;
+            vx_uint8* src0p = (vx_uint8 *)in_1->base[0] + in_1->tile_x + y * in_1->addr[0].stride_y;
+            vx_uint8* src1p = (vx_uint8 *)in_2->base[0] + in_2->tile_x + y * in_2->addr[0].stride_y;
+            vx_uint8* dstp = (vx_uint8 *)out->base[0] + out->tile_x + y * out->addr[0].stride_y;
             for (x = 0; x < out->tile_block.width; x += 16)
             {
                 uint8x16_t vsrc0 = vld1q_u8( src0p + x);
@@ -157,9 +157,9 @@ void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
             switch (out->image.format)                                                                                     \
             {                                                                                                              \
             case VX_DF_IMAGE_U8:                                                                                           \
-                src0p = (vx_uint8 *)in_1->base[0] + in_1_tile_x + y * in_1->image.width + x * in_1->addr[0].stride_x;     \
-                src1p = (vx_uint8 *)in_2->base[0] + in_2_tile_x + y * in_2->image.width + x * in_2->addr[0].stride_x;     \
-                dstp = (vx_uint8 *)out->base[0] + out_tile_x + y * out->image.width + x * out->addr[0].stride_x;          \
+                src0p = (vx_uint8 *)in_1->base[0] + in_1_tile_x + y * in_1->addr[0].stride_y + x * in_1->addr[0].stride_x;     \
+                src1p = (vx_uint8 *)in_2->base[0] + in_2_tile_x + y * in_2->addr[0].stride_y + x * in_2->addr[0].stride_x;     \
+                dstp = (vx_uint8 *)out->base[0] + out_tile_x + y * out->addr[0].stride_y + x * out->addr[0].stride_x;          \
                 val0 = *(src0p);                                                                                           \
                 val1 = *(src1p);                                                                                           \
                 *dstp = val0 < val1 ? val0 : val1;                                                                         \
@@ -176,7 +176,7 @@ void Min_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX
         }                                                                                                                  \
     }                                                                                                                      \
 
-void Min_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Min_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 y, x;    
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -193,7 +193,7 @@ void Min_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void
     }
     else
     {
-        MIN_FLEXIBLE(0, tx, ty, vxTileWidth(out, 0), in_1->tile_x, in_2->tile_x, out->tile_x)
+        MIN_FLEXIBLE(0, tx, ty, vxTileWidth(out, 0), 0, 0, 0)
         MIN_FLEXIBLE(ty, 0, vxTileHeight(out, 0), vxTileWidth(out, 0), 0, 0, 0)
     }
 }
@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
 static inline void opt_max(uint8x8_t *a, uint8x8_t *b)
@@ -28,7 +28,7 @@ static inline void opt_min(uint8x8_t *a, uint8x8_t *b)
     *a = min;
 }
 
-void Erode3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Erode3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -184,7 +184,7 @@ static vx_uint8 max_op(vx_uint8 a, vx_uint8 b) {
     }
 
 
-void Erode3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Erode3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -206,7 +206,7 @@ void Erode3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
         else
         {
             Erode3x3(1, low_y, low_x, high_x - 1)
-            Erode3x3(low_y, high_y, 1, high_x - 1)
+            Erode3x3(low_y, high_y - 1, 1, high_x - 1)
         }
     }
     else
@@ -216,7 +216,7 @@ void Erode3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
 }
 
 
-void Dilate3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Dilate3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -302,7 +302,7 @@ void Dilate3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], voi
     }
 
 
-void Dilate3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Dilate3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -324,7 +324,7 @@ void Dilate3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
         else
         {
             Dilate3x3(1, low_y, low_x, high_x - 1)
-            Dilate3x3(low_y, high_y, 1, high_x - 1)
+            Dilate3x3(low_y, high_y - 1, 1, high_x - 1)
         }
     }
     else
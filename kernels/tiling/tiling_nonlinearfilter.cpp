@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 
 #include <tiling.h>
 
@@ -1069,7 +1069,7 @@ static void* filter_disk_5x5(vx_tile_ex_t *in, vx_tile_ex_t *out, vx_enum functi
     return dst_base;
 }
 
-void NonLinearFilter_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void NonLinearFilter_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 x = 0, y = 0;
     vx_enum *func = (vx_enum *)parameters[0];
@@ -1225,7 +1225,7 @@ static vx_uint32 readMaskedRectangle_U1(const void *base,
     return dest_index;
 }
 
-void NonLinearFilter_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void NonLinearFilter_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
     vx_enum *func = (vx_enum *)parameters[0];
@@ -1234,7 +1234,7 @@ void NonLinearFilter_image_tiling_flexible(void * VX_RESTRICT parameters[VX_REST
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[3];
 
     vx_uint8 v[C_MAX_NONLINEAR_DIM * C_MAX_NONLINEAR_DIM];
-    vx_uint8 res_val;
+    vx_uint8 res_val = 0;
 
     vx_uint8 *src_base = in->base[0] + in->tile_x;
     vx_uint8 *dst_base = out->base[0] + out->tile_x;
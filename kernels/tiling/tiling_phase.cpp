@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
 #include <math.h>
@@ -94,7 +94,7 @@ static float32x4_t vrecpq_f32(float32x4_t val)
     }
 
 
-void Phase_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Phase_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *grad_x = (vx_tile_ex_t *)parameters[0];
@@ -268,7 +268,7 @@ void Phase_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void *
     }
 
 
-void Phase_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Phase_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x, y;
     vx_tile_ex_t *grad_x = (vx_tile_ex_t *)parameters[0];
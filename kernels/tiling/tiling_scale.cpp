@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 #include <math.h>
 
@@ -164,13 +164,12 @@ static vx_bool read_pixel_16s(void *base, vx_imagepatch_addressing_t *addr, vx_u
     }
 
     // bounded x/y
-    bx = x < 0 ? 0 : src_width ? src_width - 1 : (vx_uint32)x;
-    by = y < 0 ? 0 : y >= src_height ? src_height - 1 : (vx_uint32)y;
+    bx = x < 0 ? 0 : x >= (vx_int32)src_width ? src_width - 1 : (vx_uint32)x;
+    by = y < 0 ? 0 : y >= (vx_int32)src_height ? src_height - 1 : (vx_uint32)y;
 
-    vx_int16 *new_ptr = nullptr;
+    /* the strides are in bytes */
     vx_uint32 offset = (addr->stride_y * by + addr->stride_x * bx);
-    new_ptr = (vx_int16*)base;
-    bpixel = &new_ptr[offset];
+    bpixel = (vx_int16 *)((vx_uint8 *)base + offset);
 
     *pixel = *bpixel;
 
@@ -248,7 +247,7 @@ static void vxNearestScaling_fast(vx_tile_ex_t *src_image, vx_tile_ex_t *dst_ima
     for (y2 = low_height; y2 < height; y2++)
     {
         vx_uint8* dst_u8 = (vx_uint8 *)dst_image->base[0] + dst_image->tile_x + y2 * dst_image->addr[0].stride_y;
-        vx_int16* dst_base_s16 = (vx_int16*)dst_image->base[0] + dst_image->tile_x + y2 * dst_image->addr[0].stride_y/2;
+        vx_int16* dst_base_s16 = (vx_int16*)dst_image->base[0] + y2 * dst_image->addr[0].stride_y/2;
         float32x4_t y2_32x4 = vdupq_n_f32((float32_t)y2);
         float32x4_t y_src_32x4 = vsubq_f32(vmulq_f32(vaddq_f32(y2_32x4,fv_0_5_32x4), fv_hr_32x4), fv_0_5_32x4);
 
@@ -278,28 +277,28 @@ static void vxNearestScaling_fast(vx_tile_ex_t *src_image, vx_tile_ex_t *dst_ima
             {
                 vx_int16 v = 0;
                 vx_int16* dst = dst_base_s16 + dst_image->addr[0].stride_x/2*x2;
-                if (dst && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 0),vgetq_lane_s32(y1_32x4, 0),&v, borders))
+                if (dst && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 0),vgetq_lane_s32(y1_32x4, 0),&v, borders))
                     *dst = v;
                 v=0;
-                if ((dst+1) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 1),vgetq_lane_s32(y1_32x4, 1),&v, borders))
+                if ((dst+1) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 1),vgetq_lane_s32(y1_32x4, 1),&v, borders))
                     *(dst+1) = v;
                 v=0;
-                if ((dst+2) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 2),vgetq_lane_s32(y1_32x4, 2),&v, borders))
+                if ((dst+2) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 2),vgetq_lane_s32(y1_32x4, 2),&v, borders))
                     *(dst+2) = v;
                 v=0;
-                if ((dst+3) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 3),vgetq_lane_s32(y1_32x4, 3),&v, borders))
+                if ((dst+3) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4, 3),vgetq_lane_s32(y1_32x4, 3),&v, borders))
                     *(dst+3) = v;
 
-                if ((dst+4) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 0),vgetq_lane_s32(y1_32x4, 0),&v, borders))
+                if ((dst+4) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 0),vgetq_lane_s32(y1_32x4, 0),&v, borders))
                     *(dst+4) = v;
                 v=0;
-                if ((dst+5) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 1),vgetq_lane_s32(y1_32x4, 1),&v, borders))
+                if ((dst+5) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 1),vgetq_lane_s32(y1_32x4, 1),&v, borders))
                     *(dst+5) = v;
                 v=0;
-                if ((dst+6) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 2),vgetq_lane_s32(y1_32x4, 2),&v, borders))
+                if ((dst+6) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 2),vgetq_lane_s32(y1_32x4, 2),&v, borders))
                     *(dst+6) = v;
                 v=0;
-                if ((dst+7) && vx_true_e == read_pixel_16s((vx_int16 *)src_image->base[0] + src_image->tile_x, src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 3),vgetq_lane_s32(y1_32x4, 3),&v, borders))
+                if ((dst+7) && vx_true_e == read_pixel_16s(src_image->base[0], src_image->addr,h1, w1,vgetq_lane_s32(x1_32x4_1, 3),vgetq_lane_s32(y1_32x4, 3),&v, borders))
                     *(dst+7) = v;
             }
         }
@@ -707,7 +706,7 @@ static void vxBilinearScaling_fast(vx_tile_ex_t *src_image, vx_tile_ex_t *dst_im
     }
 }
 
-void ScaleImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ScaleImage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 y, x;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -1011,7 +1010,7 @@ static void vxBilinearScaling(vx_tile_ex_t *src_image, vx_tile_ex_t *dst_image,
     }
 }
 
-void ScaleImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void ScaleImage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 y, x;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
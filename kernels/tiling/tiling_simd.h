@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2012-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _TILING_SIMD_H_
+#define _TILING_SIMD_H_
+
+/*!
+ * \file
+ * \brief The SIMD vocabulary of the tiling kernels.
+ *
+ * The kernels are written against the NEON intrinsics. On ARM this is arm_neon.h itself,
+ * on x86-64 the same types and the subset of intrinsics the kernels use are provided on
+ * top of SSE4.1, with AVX2 taking over the per-lane shifts when the build enables it.
+ * The vector types are GCC vector extensions of the NEON element types, so casts between
+ * them reinterpret the bits like they do on ARM and element-wise arithmetic is left to
+ * the compiler.
+ * \ingroup group_tiling
+ */
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+#if !defined(__SSE4_1__)
+#error "The x86 tiling kernels need at least SSE4.1 (-msse4.1)"
+#endif
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t  uint8x8_t   __attribute__((vector_size(8)));
+typedef int16_t  int16x4_t   __attribute__((vector_size(8)));
+typedef uint16_t uint16x4_t  __attribute__((vector_size(8)));
+typedef int32_t  int32x2_t   __attribute__((vector_size(8)));
+typedef float    float32x2_t __attribute__((vector_size(8)));
+typedef uint64_t uint64x1_t  __attribute__((vector_size(8)));
+
+typedef uint8_t  uint8x16_t  __attribute__((vector_size(16)));
+typedef int16_t  int16x8_t   __attribute__((vector_size(16)));
+typedef uint16_t uint16x8_t  __attribute__((vector_size(16)));
+typedef int32_t  int32x4_t   __attribute__((vector_size(16)));
+typedef uint32_t uint32x4_t  __attribute__((vector_size(16)));
+typedef uint64_t uint64x2_t  __attribute__((vector_size(16)));
+typedef float    float32x4_t __attribute__((vector_size(16)));
+
+typedef float float32_t;
+
+typedef struct { uint8x8_t val[2]; } uint8x8x2_t;
+typedef struct { uint8x8_t val[3]; } uint8x8x3_t;
+typedef struct { uint8x8_t val[4]; } uint8x8x4_t;
+typedef struct { uint8x16_t val[3]; } uint8x16x3_t;
+typedef struct { uint8x16_t val[4]; } uint8x16x4_t;
+typedef struct { int16x8_t val[2]; } int16x8x2_t;
+typedef struct { uint16x8_t val[2]; } uint16x8x2_t;
+typedef struct { int32x4_t val[2]; } int32x4x2_t;
+typedef struct { int32x4_t val[4]; } int32x4x4_t;
+typedef struct { uint32x4_t val[4]; } uint32x4x4_t;
+typedef struct { float32x4_t val[2]; } float32x4x2_t;
+
+#define TILING_SIMD static inline __attribute__((always_inline))
+
+/* a 64 bit vector in the low half of an SSE register and back */
+template <typename V>
+TILING_SIMD __m128i tiling_lo(V v) { return _mm_cvtsi64_si128((long long)v); }
+template <typename V>
+TILING_SIMD V tiling_d(__m128i v) { return (V)_mm_cvtsi128_si64(v); }
+template <typename V>
+TILING_SIMD V tiling_hi(__m128i v) { return (V)_mm_cvtsi128_si64(_mm_unpackhi_epi64(v, v)); }
+
+/* loads and stores */
+TILING_SIMD uint8x8_t vld1_u8(const uint8_t *p) { uint8x8_t r; memcpy(&r, p, sizeof(r)); return r; }
+TILING_SIMD uint8x16_t vld1q_u8(const uint8_t *p) { uint8x16_t r; memcpy(&r, p, sizeof(r)); return r; }
+TILING_SIMD int16x8_t vld1q_s16(const int16_t *p) { int16x8_t r; memcpy(&r, p, sizeof(r)); return r; }
+TILING_SIMD uint16x8_t vld1q_u16(const uint16_t *p) { uint16x8_t r; memcpy(&r, p, sizeof(r)); return r; }
+TILING_SIMD uint32x4_t vld1q_u32(const uint32_t *p) { uint32x4_t r; memcpy(&r, p, sizeof(r)); return r; }
+TILING_SIMD float32x4_t vld1q_f32(const float *p) { float32x4_t r; memcpy(&r, p, sizeof(r)); return r; }
+TILING_SIMD void vst1_u8(uint8_t *p, uint8x8_t v) { memcpy(p, &v, sizeof(v)); }
+TILING_SIMD void vst1q_u8(uint8_t *p, uint8x16_t v) { memcpy(p, &v, sizeof(v)); }
+TILING_SIMD void vst1q_s16(int16_t *p, int16x8_t v) { memcpy(p, &v, sizeof(v)); }
+TILING_SIMD void vst1q_u16(uint16_t *p, uint16x8_t v) { memcpy(p, &v, sizeof(v)); }
+TILING_SIMD void vst1q_s32(int32_t *p, int32x4_t v) { memcpy(p, &v, sizeof(v)); }
+TILING_SIMD void vst1q_u32(uint32_t *p, uint32x4_t v) { memcpy(p, &v, sizeof(v)); }
+
+TILING_SIMD uint8x8x2_t vld2_u8(const uint8_t *p)
+{
+    const __m128i even_odd = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)p), even_odd);
+    uint8x8x2_t r = {{tiling_d<uint8x8_t>(v), tiling_hi<uint8x8_t>(v)}};
+    return r;
+}
+TILING_SIMD uint8x8x3_t vld3_u8(const uint8_t *p)
+{
+    uint8x8x3_t r;
+    for (int i = 0; i < 8; i++)
+    {
+        r.val[0][i] = p[3 * i];
+        r.val[1][i] = p[3 * i + 1];
+        r.val[2][i] = p[3 * i + 2];
+    }
+    return r;
+}
+TILING_SIMD uint8x8x4_t vld4_u8(const uint8_t *p)
+{
+    const __m128i planar = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)p), planar);
+    __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p + 16)), planar);
+    __m128i lo = _mm_unpacklo_epi32(a, b);
+    __m128i hi = _mm_unpackhi_epi32(a, b);
+    uint8x8x4_t r = {{tiling_d<uint8x8_t>(lo), tiling_hi<uint8x8_t>(lo),
+                      tiling_d<uint8x8_t>(hi), tiling_hi<uint8x8_t>(hi)}};
+    return r;
+}
+TILING_SIMD float32x4x2_t vld2q_f32(const float *p)
+{
+    __m128 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4);
+    float32x4x2_t r = {{(float32x4_t)_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                        (float32x4_t)_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))}};
+    return r;
+}
+TILING_SIMD void vst2_u8(uint8_t *p, uint8x8x2_t v)
+{
+    _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi8(tiling_lo(v.val[0]), tiling_lo(v.val[1])));
+}
+TILING_SIMD void vst3_u8(uint8_t *p, uint8x8x3_t v)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        p[3 * i] = v.val[0][i];
+        p[3 * i + 1] = v.val[1][i];
+        p[3 * i + 2] = v.val[2][i];
+    }
+}
+TILING_SIMD void vst3q_u8(uint8_t *p, uint8x16x3_t v)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        p[3 * i] = v.val[0][i];
+        p[3 * i + 1] = v.val[1][i];
+        p[3 * i + 2] = v.val[2][i];
+    }
+}
+TILING_SIMD void vst4_u8(uint8_t *p, uint8x8x4_t v)
+{
+    __m128i ab = _mm_unpacklo_epi8(tiling_lo(v.val[0]), tiling_lo(v.val[1]));
+    __m128i cd = _mm_unpacklo_epi8(tiling_lo(v.val[2]), tiling_lo(v.val[3]));
+    _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(ab, cd));
+    _mm_storeu_si128((__m128i *)(p + 16), _mm_unpackhi_epi16(ab, cd));
+}
+TILING_SIMD void vst4q_u8(uint8_t *p, uint8x16x4_t v)
+{
+    __m128i ab_lo = _mm_unpacklo_epi8((__m128i)v.val[0], (__m128i)v.val[1]);
+    __m128i ab_hi = _mm_unpackhi_epi8((__m128i)v.val[0], (__m128i)v.val[1]);
+    __m128i cd_lo = _mm_unpacklo_epi8((__m128i)v.val[2], (__m128i)v.val[3]);
+    __m128i cd_hi = _mm_unpackhi_epi8((__m128i)v.val[2], (__m128i)v.val[3]);
+    _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i *)(p + 16), _mm_unpackhi_epi16(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i *)(p + 32), _mm_unpacklo_epi16(ab_hi, cd_hi));
+    _mm_storeu_si128((__m128i *)(p + 48), _mm_unpackhi_epi16(ab_hi, cd_hi));
+}
+TILING_SIMD void vst4q_s32(int32_t *p, int32x4x4_t v)
+{
+    __m128i ab_lo = _mm_unpacklo_epi32((__m128i)v.val[0], (__m128i)v.val[1]);
+    __m128i ab_hi = _mm_unpackhi_epi32((__m128i)v.val[0], (__m128i)v.val[1]);
+    __m128i cd_lo = _mm_unpacklo_epi32((__m128i)v.val[2], (__m128i)v.val[3]);
+    __m128i cd_hi = _mm_unpackhi_epi32((__m128i)v.val[2], (__m128i)v.val[3]);
+    _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi64(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i *)(p + 4), _mm_unpackhi_epi64(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i *)(p + 8), _mm_unpacklo_epi64(ab_hi, cd_hi));
+    _mm_storeu_si128((__m128i *)(p + 12), _mm_unpackhi_epi64(ab_hi, cd_hi));
+}
+TILING_SIMD void vst2q_f32(float *p, float32x4x2_t v)
+{
+    _mm_storeu_ps(p, _mm_unpacklo_ps((__m128)v.val[0], (__m128)v.val[1]));
+    _mm_storeu_ps(p + 4, _mm_unpackhi_ps((__m128)v.val[0], (__m128)v.val[1]));
+}
+
+/* broadcasts */
+TILING_SIMD uint8x8_t vdup_n_u8(uint8_t x) { return tiling_d<uint8x8_t>(_mm_set1_epi8((char)x)); }
+TILING_SIMD int16x4_t vdup_n_s16(int16_t x) { return tiling_d<int16x4_t>(_mm_set1_epi16(x)); }
+TILING_SIMD int32x2_t vdup_n_s32(int32_t x) { return tiling_d<int32x2_t>(_mm_set1_epi32(x)); }
+TILING_SIMD float32x2_t vdup_n_f32(float x) { return tiling_d<float32x2_t>(_mm_castps_si128(_mm_set1_ps(x))); }
+TILING_SIMD uint8x16_t vdupq_n_u8(uint8_t x) { return (uint8x16_t)_mm_set1_epi8((char)x); }
+TILING_SIMD int16x8_t vdupq_n_s16(int16_t x) { return (int16x8_t)_mm_set1_epi16(x); }
+TILING_SIMD uint16x8_t vdupq_n_u16(uint16_t x) { return (uint16x8_t)_mm_set1_epi16((short)x); }
+TILING_SIMD int32x4_t vdupq_n_s32(int32_t x) { return (int32x4_t)_mm_set1_epi32(x); }
+TILING_SIMD float32x4_t vdupq_n_f32(float x) { return (float32x4_t)_mm_set1_ps(x); }
+
+/* lanes, halves and reinterpretation */
+#define vget_lane_u8(v, n) ((uint8_t)(v)[n])
+#define vget_lane_u64(v, n) ((uint64_t)(v)[n])
+#define vgetq_lane_s16(v, n) ((int16_t)(v)[n])
+#define vgetq_lane_u16(v, n) ((uint16_t)(v)[n])
+#define vgetq_lane_s32(v, n) ((int32_t)(v)[n])
+#define vgetq_lane_u32(v, n) ((uint32_t)(v)[n])
+#define vgetq_lane_u64(v, n) ((uint64_t)(v)[n])
+#define vgetq_lane_f32(v, n) ((float)(v)[n])
+
+template <typename V, typename S>
+TILING_SIMD V tiling_set_lane(S x, V v, int n) { v[n] = x; return v; }
+TILING_SIMD uint8x8_t vset_lane_u8(uint8_t x, uint8x8_t v, int n) { return tiling_set_lane(x, v, n); }
+TILING_SIMD int16x4_t vset_lane_s16(int16_t x, int16x4_t v, int n) { return tiling_set_lane(x, v, n); }
+TILING_SIMD uint8x16_t vsetq_lane_u8(uint8_t x, uint8x16_t v, int n) { return tiling_set_lane(x, v, n); }
+TILING_SIMD int16x8_t vsetq_lane_s16(int16_t x, int16x8_t v, int n) { return tiling_set_lane(x, v, n); }
+TILING_SIMD int32x4_t vsetq_lane_s32(int32_t x, int32x4_t v, int n) { return tiling_set_lane(x, v, n); }
+TILING_SIMD float32x4_t vsetq_lane_f32(float x, float32x4_t v, int n) { return tiling_set_lane(x, v, n); }
+
+TILING_SIMD uint8x8_t vget_low_u8(uint8x16_t v) { return tiling_d<uint8x8_t>((__m128i)v); }
+TILING_SIMD uint8x8_t vget_high_u8(uint8x16_t v) { return tiling_hi<uint8x8_t>((__m128i)v); }
+TILING_SIMD int16x4_t vget_low_s16(int16x8_t v) { return tiling_d<int16x4_t>((__m128i)v); }
+TILING_SIMD int16x4_t vget_high_s16(int16x8_t v) { return tiling_hi<int16x4_t>((__m128i)v); }
+TILING_SIMD uint16x4_t vget_low_u16(uint16x8_t v) { return tiling_d<uint16x4_t>((__m128i)v); }
+TILING_SIMD uint16x4_t vget_high_u16(uint16x8_t v) { return tiling_hi<uint16x4_t>((__m128i)v); }
+TILING_SIMD uint8x16_t vcombine_u8(uint8x8_t lo, uint8x8_t hi) { return (uint8x16_t)_mm_unpacklo_epi64(tiling_lo(lo), tiling_lo(hi)); }
+TILING_SIMD int16x8_t vcombine_s16(int16x4_t lo, int16x4_t hi) { return (int16x8_t)_mm_unpacklo_epi64(tiling_lo(lo), tiling_lo(hi)); }
+TILING_SIMD uint16x8_t vcombine_u16(uint16x4_t lo, uint16x4_t hi) { return (uint16x8_t)_mm_unpacklo_epi64(tiling_lo(lo), tiling_lo(hi)); }
+
+TILING_SIMD int16x4_t vreinterpret_s16_u16(uint16x4_t v) { return (int16x4_t)v; }
+TILING_SIMD uint16x4_t vreinterpret_u16_s16(int16x4_t v) { return (uint16x4_t)v; }
+TILING_SIMD uint64x1_t vreinterpret_u64_u8(uint8x8_t v) { return (uint64x1_t)v; }
+TILING_SIMD int16x8_t vreinterpretq_s16_u16(uint16x8_t v) { return (int16x8_t)v; }
+TILING_SIMD uint16x8_t vreinterpretq_u16_s16(int16x8_t v) { return (uint16x8_t)v; }
+TILING_SIMD int32x4_t vreinterpretq_s32_u32(uint32x4_t v) { return (int32x4_t)v; }
+TILING_SIMD uint32x4_t vreinterpretq_u32_s32(int32x4_t v) { return (uint32x4_t)v; }
+TILING_SIMD uint64x2_t vreinterpretq_u64_u8(uint8x16_t v) { return (uint64x2_t)v; }
+
+/* the byte offsets of vext are immediates of palignr */
+#define vext_u8(a, b, n) \
+    tiling_d<uint8x8_t>(_mm_srli_si128(_mm_unpacklo_epi64(tiling_lo(a), tiling_lo(b)), (n)))
+#define vextq_u8(a, b, n) ((uint8x16_t)_mm_alignr_epi8((__m128i)(b), (__m128i)(a), (n)))
+#define vextq_s16(a, b, n) ((int16x8_t)_mm_alignr_epi8((__m128i)(b), (__m128i)(a), (n) * 2))
+
+/* element-wise arithmetic, which wraps like it does on ARM */
+TILING_SIMD int16x4_t vadd_s16(int16x4_t a, int16x4_t b) { return a + b; }
+TILING_SIMD uint8x16_t vaddq_u8(uint8x16_t a, uint8x16_t b) { return a + b; }
+TILING_SIMD int16x8_t vaddq_s16(int16x8_t a, int16x8_t b) { return a + b; }
+TILING_SIMD uint16x8_t vaddq_u16(uint16x8_t a, uint16x8_t b) { return a + b; }
+TILING_SIMD int32x4_t vaddq_s32(int32x4_t a, int32x4_t b) { return a + b; }
+TILING_SIMD uint32x4_t vaddq_u32(uint32x4_t a, uint32x4_t b) { return a + b; }
+TILING_SIMD float32x4_t vaddq_f32(float32x4_t a, float32x4_t b) { return a + b; }
+TILING_SIMD uint8x16_t vsubq_u8(uint8x16_t a, uint8x16_t b) { return a - b; }
+TILING_SIMD int16x8_t vsubq_s16(int16x8_t a, int16x8_t b) { return a - b; }
+TILING_SIMD int32x4_t vsubq_s32(int32x4_t a, int32x4_t b) { return a - b; }
+TILING_SIMD uint32x4_t vsubq_u32(uint32x4_t a, uint32x4_t b) { return a - b; }
+TILING_SIMD float32x4_t vsubq_f32(float32x4_t a, float32x4_t b) { return a - b; }
+TILING_SIMD int16x4_t vmul_s16(int16x4_t a, int16x4_t b) { return a * b; }
+TILING_SIMD uint8x16_t vmulq_u8(uint8x16_t a, uint8x16_t b) { return a * b; }
+TILING_SIMD int32x4_t vmulq_s32(int32x4_t a, int32x4_t b) { return a * b; }
+TILING_SIMD float32x4_t vmulq_f32(float32x4_t a, float32x4_t b) { return a * b; }
+TILING_SIMD float32x4_t vdivq_f32(float32x4_t a, float32x4_t b) { return a / b; }
+TILING_SIMD int16x8_t vmlaq_s16(int16x8_t a, int16x8_t b, int16x8_t c) { return a + b * c; }
+TILING_SIMD int32x4_t vmlaq_s32(int32x4_t a, int32x4_t b, int32x4_t c) { return a + b * c; }
+TILING_SIMD uint16x8_t vmlaq_n_u16(uint16x8_t a, uint16x8_t b, uint16_t c) { return a + b * c; }
+TILING_SIMD float32x4_t vmlaq_f32(float32x4_t a, float32x4_t b, float32x4_t c)
+{
+    return (float32x4_t)_mm_add_ps((__m128)a, _mm_mul_ps((__m128)b, (__m128)c));
+}
+TILING_SIMD float32x4_t vmlaq_n_f32(float32x4_t a, float32x4_t b, float c)
+{
+    return (float32x4_t)_mm_add_ps((__m128)a, _mm_mul_ps((__m128)b, _mm_set1_ps(c)));
+}
+TILING_SIMD int16x8_t vnegq_s16(int16x8_t a) { return -a; }
+
+/* widening and narrowing */
+TILING_SIMD uint16x8_t vmovl_u8(uint8x8_t a) { return (uint16x8_t)_mm_cvtepu8_epi16(tiling_lo(a)); }
+TILING_SIMD int32x4_t vmovl_s16(int16x4_t a) { return (int32x4_t)_mm_cvtepi16_epi32(tiling_lo(a)); }
+TILING_SIMD uint32x4_t vmovl_u16(uint16x4_t a) { return (uint32x4_t)_mm_cvtepu16_epi32(tiling_lo(a)); }
+TILING_SIMD uint16x8_t vaddl_u8(uint8x8_t a, uint8x8_t b) { return vmovl_u8(a) + vmovl_u8(b); }
+TILING_SIMD int32x4_t vsubl_s16(int16x4_t a, int16x4_t b) { return vmovl_s16(a) - vmovl_s16(b); }
+TILING_SIMD int32x4_t vmlal_n_s16(int32x4_t acc, int16x4_t a, int16_t b)
+{
+    /* the low and high halves of the 16 bit products interleave into 32 bit ones */
+    __m128i va = tiling_lo(a), vb = _mm_set1_epi16(b);
+    return acc + (int32x4_t)_mm_unpacklo_epi16(_mm_mullo_epi16(va, vb), _mm_mulhi_epi16(va, vb));
+}
+TILING_SIMD uint8x8_t vmovn_u16(uint16x8_t a)
+{
+    __m128i v = _mm_and_si128((__m128i)a, _mm_set1_epi16(0xFF));
+    return tiling_d<uint8x8_t>(_mm_packus_epi16(v, v));
+}
+TILING_SIMD uint16x4_t vmovn_u32(uint32x4_t a)
+{
+    __m128i v = _mm_and_si128((__m128i)a, _mm_set1_epi32(0xFFFF));
+    return tiling_d<uint16x4_t>(_mm_packus_epi32(v, v));
+}
+TILING_SIMD uint8x8_t vqmovn_u16(uint16x8_t a)
+{
+    __m128i v = _mm_min_epu16((__m128i)a, _mm_set1_epi16(0xFF));
+    return tiling_d<uint8x8_t>(_mm_packus_epi16(v, v));
+}
+TILING_SIMD int16x4_t vqmovn_s32(int32x4_t a) { return tiling_d<int16x4_t>(_mm_packs_epi32((__m128i)a, (__m128i)a)); }
+TILING_SIMD uint8x8_t vqmovun_s16(int16x8_t a) { return tiling_d<uint8x8_t>(_mm_packus_epi16((__m128i)a, (__m128i)a)); }
+TILING_SIMD uint8x8_t vqshrun_n_s16(int16x8_t a, int n)
+{
+    __m128i v = _mm_srai_epi16((__m128i)a, n);
+    return tiling_d<uint8x8_t>(_mm_packus_epi16(v, v));
+}
+
+/* saturation, absolute differences, min and max */
+TILING_SIMD uint8x16_t vqaddq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)_mm_adds_epu8((__m128i)a, (__m128i)b); }
+TILING_SIMD uint8x16_t vqsubq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)_mm_subs_epu8((__m128i)a, (__m128i)b); }
+TILING_SIMD uint8x16_t vabdq_u8(uint8x16_t a, uint8x16_t b)
+{
+    return (uint8x16_t)_mm_or_si128(_mm_subs_epu8((__m128i)a, (__m128i)b), _mm_subs_epu8((__m128i)b, (__m128i)a));
+}
+TILING_SIMD uint16x8_t vabdq_u16(uint16x8_t a, uint16x8_t b)
+{
+    return (uint16x8_t)_mm_or_si128(_mm_subs_epu16((__m128i)a, (__m128i)b), _mm_subs_epu16((__m128i)b, (__m128i)a));
+}
+TILING_SIMD int16x8_t vabdq_s16(int16x8_t a, int16x8_t b)
+{
+    return (int16x8_t)_mm_sub_epi16(_mm_max_epi16((__m128i)a, (__m128i)b), _mm_min_epi16((__m128i)a, (__m128i)b));
+}
+TILING_SIMD float32x4_t vabsq_f32(float32x4_t a) { return (float32x4_t)_mm_andnot_ps(_mm_set1_ps(-0.0f), (__m128)a); }
+TILING_SIMD uint8x8_t vmin_u8(uint8x8_t a, uint8x8_t b) { return tiling_d<uint8x8_t>(_mm_min_epu8(tiling_lo(a), tiling_lo(b))); }
+TILING_SIMD uint8x8_t vmax_u8(uint8x8_t a, uint8x8_t b) { return tiling_d<uint8x8_t>(_mm_max_epu8(tiling_lo(a), tiling_lo(b))); }
+TILING_SIMD uint8x16_t vminq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)_mm_min_epu8((__m128i)a, (__m128i)b); }
+TILING_SIMD uint8x16_t vmaxq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)_mm_max_epu8((__m128i)a, (__m128i)b); }
+TILING_SIMD uint16x8_t vminq_u16(uint16x8_t a, uint16x8_t b) { return (uint16x8_t)_mm_min_epu16((__m128i)a, (__m128i)b); }
+TILING_SIMD int16x8_t vminq_s16(int16x8_t a, int16x8_t b) { return (int16x8_t)_mm_min_epi16((__m128i)a, (__m128i)b); }
+TILING_SIMD int16x8_t vmaxq_s16(int16x8_t a, int16x8_t b) { return (int16x8_t)_mm_max_epi16((__m128i)a, (__m128i)b); }
+TILING_SIMD int32x4_t vminq_s32(int32x4_t a, int32x4_t b) { return (int32x4_t)_mm_min_epi32((__m128i)a, (__m128i)b); }
+TILING_SIMD int32x4_t vmaxq_s32(int32x4_t a, int32x4_t b) { return (int32x4_t)_mm_max_epi32((__m128i)a, (__m128i)b); }
+TILING_SIMD float32x4_t vminq_f32(float32x4_t a, float32x4_t b) { return (float32x4_t)_mm_min_ps((__m128)a, (__m128)b); }
+TILING_SIMD float32x4_t vmaxq_f32(float32x4_t a, float32x4_t b) { return (float32x4_t)_mm_max_ps((__m128)a, (__m128)b); }
+
+/* comparisons, all ones where true */
+TILING_SIMD uint8x8_t vceq_u8(uint8x8_t a, uint8x8_t b) { return (uint8x8_t)(a == b); }
+TILING_SIMD uint8x8_t vcge_u8(uint8x8_t a, uint8x8_t b) { return (uint8x8_t)(a >= b); }
+TILING_SIMD uint8x8_t vcgt_u8(uint8x8_t a, uint8x8_t b) { return (uint8x8_t)(a > b); }
+TILING_SIMD uint8x16_t vcgeq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a >= b); }
+TILING_SIMD uint8x16_t vcgtq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a > b); }
+TILING_SIMD uint8x16_t vcleq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a <= b); }
+TILING_SIMD uint8x16_t vcltq_u8(uint8x16_t a, uint8x16_t b) { return (uint8x16_t)(a < b); }
+TILING_SIMD uint16x8_t vcgeq_s16(int16x8_t a, int16x8_t b) { return (uint16x8_t)(a >= b); }
+TILING_SIMD uint16x8_t vcgtq_s16(int16x8_t a, int16x8_t b) { return (uint16x8_t)(a > b); }
+TILING_SIMD uint16x8_t vcleq_s16(int16x8_t a, int16x8_t b) { return (uint16x8_t)(a <= b); }
+TILING_SIMD uint16x8_t vcltq_s16(int16x8_t a, int16x8_t b) { return (uint16x8_t)(a < b); }
+TILING_SIMD uint32x4_t vcgeq_s32(int32x4_t a, int32x4_t b) { return (uint32x4_t)(a >= b); }
+TILING_SIMD uint32x4_t vcleq_s32(int32x4_t a, int32x4_t b) { return (uint32x4_t)(a <= b); }
+TILING_SIMD uint32x4_t vcltq_s32(int32x4_t a, int32x4_t b) { return (uint32x4_t)(a < b); }
+TILING_SIMD uint32x4_t vcgeq_f32(float32x4_t a, float32x4_t b) { return (uint32x4_t)(a >= b); }
+TILING_SIMD uint32x4_t vcltq_f32(float32x4_t a, float32x4_t b) { return (uint32x4_t)(a < b); }
+
+/* bitwise operations and selects */
+TILING_SIMD uint8x8_t vand_u8(uint8x8_t a, uint8x8_t b) { return a & b; }
+TILING_SIMD uint8x16_t vandq_u8(uint8x16_t a, uint8x16_t b) { return a & b; }
+TILING_SIMD uint16x8_t vandq_u16(uint16x8_t a, uint16x8_t b) { return a & b; }
+TILING_SIMD uint32x4_t vandq_u32(uint32x4_t a, uint32x4_t b) { return a & b; }
+TILING_SIMD uint8x16_t vorrq_u8(uint8x16_t a, uint8x16_t b) { return a | b; }
+TILING_SIMD uint16x8_t vorrq_u16(uint16x8_t a, uint16x8_t b) { return a | b; }
+TILING_SIMD uint32x4_t vorrq_u32(uint32x4_t a, uint32x4_t b) { return a | b; }
+TILING_SIMD uint8x16_t veorq_u8(uint8x16_t a, uint8x16_t b) { return a ^ b; }
+TILING_SIMD uint8x16_t vmvnq_u8(uint8x16_t a) { return ~a; }
+TILING_SIMD uint8x8_t vbsl_u8(uint8x8_t m, uint8x8_t a, uint8x8_t b) { return (m & a) | (~m & b); }
+TILING_SIMD uint8x16_t vbslq_u8(uint8x16_t m, uint8x16_t a, uint8x16_t b) { return (m & a) | (~m & b); }
+TILING_SIMD int16x8_t vbslq_s16(uint16x8_t m, int16x8_t a, int16x8_t b)
+{
+    return (int16x8_t)((m & (uint16x8_t)a) | (~m & (uint16x8_t)b));
+}
+TILING_SIMD int32x4_t vbslq_s32(uint32x4_t m, int32x4_t a, int32x4_t b)
+{
+    return (int32x4_t)((m & (uint32x4_t)a) | (~m & (uint32x4_t)b));
+}
+TILING_SIMD float32x4_t vbslq_f32(uint32x4_t m, float32x4_t a, float32x4_t b)
+{
+    return (float32x4_t)((m & (uint32x4_t)a) | (~m & (uint32x4_t)b));
+}
+
+/* shifts */
+TILING_SIMD uint8x16_t vshlq_n_u8(uint8x16_t a, int n) { return a << n; }
+TILING_SIMD uint16x8_t vshrq_n_u16(uint16x8_t a, int n) { return a >> n; }
+TILING_SIMD int32x4_t vshrq_n_s32(int32x4_t a, int n) { return a >> n; }
+
+/* per-lane shifts by a signed count, right shifts for negative counts. SSE has no
+ * 16 bit variable shift, AVX2 shifts the lanes widened to 32 bits in one register. */
+TILING_SIMD __m128i tiling_shl_s16(int16x8_t a, int16x8_t b, bool saturate)
+{
+#if defined(__AVX2__)
+    __m256i count = _mm256_cvtepi16_epi32(_mm_max_epi16(_mm_min_epi16((__m128i)b, _mm_set1_epi16(16)),
+                                                        _mm_set1_epi16(-16)));
+    __m256i value = _mm256_cvtepi16_epi32((__m128i)a);
+    __m256i left = _mm256_sllv_epi32(value, count);
+    __m256i right = _mm256_srav_epi32(value, _mm256_sub_epi32(_mm256_setzero_si256(), count));
+    __m256i r = _mm256_blendv_epi8(left, right, _mm256_cmpgt_epi32(_mm256_setzero_si256(), count));
+    if (!saturate)
+    {
+        r = _mm256_srai_epi32(_mm256_slli_epi32(r, 16), 16);
+    }
+    return _mm_packs_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1));
+#else
+    int16x8_t r;
+    for (int i = 0; i < 8; i++)
+    {
+        int32_t n = b[i] < -16 ? -16 : (b[i] > 16 ? 16 : b[i]);
+        int32_t v = n >= 0 ? (int32_t)((uint32_t)a[i] << n) : a[i] >> -n;
+        if (saturate)
+        {
+            v = v < INT16_MIN ? INT16_MIN : (v > INT16_MAX ? INT16_MAX : v);
+        }
+        r[i] = (int16_t)v;
+    }
+    return (__m128i)r;
+#endif
+}
+TILING_SIMD int16x8_t vshlq_s16(int16x8_t a, int16x8_t b) { return (int16x8_t)tiling_shl_s16(a, b, false); }
+TILING_SIMD int16x8_t vqshlq_s16(int16x8_t a, int16x8_t b) { return (int16x8_t)tiling_shl_s16(a, b, true); }
+
+/* conversions and reciprocals */
+TILING_SIMD float32x4_t vcvtq_f32_s32(int32x4_t a) { return (float32x4_t)_mm_cvtepi32_ps((__m128i)a); }
+TILING_SIMD int32x4_t vcvtq_s32_f32(float32x4_t a) { return (int32x4_t)_mm_cvttps_epi32((__m128)a); }
+TILING_SIMD uint32x4_t vcvtq_u32_f32(float32x4_t a)
+{
+    /* negative values clamp to zero, values past the signed range convert offset by 2^31 */
+    __m128 v = _mm_max_ps((__m128)a, _mm_setzero_ps());
+    __m128 big = _mm_set1_ps(2147483648.0f);
+    __m128 over = _mm_cmpge_ps(v, big);
+    __m128i r = _mm_cvttps_epi32(_mm_sub_ps(v, _mm_and_ps(over, big)));
+    return (uint32x4_t)_mm_xor_si128(r, _mm_slli_epi32(_mm_castps_si128(over), 31));
+}
+TILING_SIMD float32x4_t vrecpeq_f32(float32x4_t a) { return (float32x4_t)_mm_rcp_ps((__m128)a); }
+TILING_SIMD float32x4_t vrecpsq_f32(float32x4_t a, float32x4_t b) { return 2.0f - a * b; }
+
+/* table lookups, out of range indexes give 0 for vtbl and keep the lane for vtbx.
+ * Adding 0x70 with saturation keeps 0-15 in the low nibble and sets the pshufb zeroing
+ * bit for everything past it. */
+TILING_SIMD __m128i tiling_tbl16(__m128i table, __m128i idx)
+{
+    return _mm_shuffle_epi8(table, _mm_adds_epu8(idx, _mm_set1_epi8(0x70)));
+}
+TILING_SIMD uint8x8_t vtbl2_u8(uint8x8x2_t t, uint8x8_t idx)
+{
+    return tiling_d<uint8x8_t>(tiling_tbl16(_mm_unpacklo_epi64(tiling_lo(t.val[0]), tiling_lo(t.val[1])), tiling_lo(idx)));
+}
+TILING_SIMD uint8x8_t vtbl4_u8(uint8x8x4_t t, uint8x8_t idx)
+{
+    __m128i i = tiling_lo(idx);
+    __m128i lo = tiling_tbl16(_mm_unpacklo_epi64(tiling_lo(t.val[0]), tiling_lo(t.val[1])), i);
+    __m128i hi = tiling_tbl16(_mm_unpacklo_epi64(tiling_lo(t.val[2]), tiling_lo(t.val[3])),
+                              _mm_sub_epi8(i, _mm_set1_epi8(16)));
+    return tiling_d<uint8x8_t>(_mm_or_si128(lo, hi));
+}
+TILING_SIMD uint8x8_t vtbx2_u8(uint8x8_t a, uint8x8x2_t t, uint8x8_t idx)
+{
+    __m128i i = tiling_lo(idx);
+    __m128i out = _mm_cmpeq_epi8(_mm_max_epu8(i, _mm_set1_epi8(16)), i);
+    return tiling_d<uint8x8_t>(_mm_blendv_epi8(tiling_lo(vtbl2_u8(t, idx)), tiling_lo(a), out));
+}
+TILING_SIMD uint8x8_t vtbx3_u8(uint8x8_t a, uint8x8x3_t t, uint8x8_t idx)
+{
+    __m128i i = tiling_lo(idx);
+    __m128i lo = tiling_tbl16(_mm_unpacklo_epi64(tiling_lo(t.val[0]), tiling_lo(t.val[1])), i);
+    /* the third table sits in both halves, so 16-23 land on it through the 8-15 nibbles */
+    __m128i hi = _mm_shuffle_epi8(_mm_unpacklo_epi64(tiling_lo(t.val[2]), tiling_lo(t.val[2])),
+                                  _mm_adds_epu8(_mm_sub_epi8(i, _mm_set1_epi8(16)), _mm_set1_epi8(0x78)));
+    __m128i out = _mm_cmpeq_epi8(_mm_max_epu8(i, _mm_set1_epi8(24)), i);
+    return tiling_d<uint8x8_t>(_mm_blendv_epi8(_mm_or_si128(lo, hi), tiling_lo(a), out));
+}
+TILING_SIMD uint8x8x2_t vuzp_u8(uint8x8_t a, uint8x8_t b)
+{
+    const __m128i even_odd = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    __m128i v = _mm_shuffle_epi8(_mm_unpacklo_epi64(tiling_lo(a), tiling_lo(b)), even_odd);
+    uint8x8x2_t r = {{tiling_d<uint8x8_t>(v), tiling_hi<uint8x8_t>(v)}};
+    return r;
+}
+TILING_SIMD uint8x8x2_t vzip_u8(uint8x8_t a, uint8x8_t b)
+{
+    __m128i v = _mm_unpacklo_epi8(tiling_lo(a), tiling_lo(b));
+    uint8x8x2_t r = {{tiling_d<uint8x8_t>(v), tiling_hi<uint8x8_t>(v)}};
+    return r;
+}
+
+#undef TILING_SIMD
+
+#else
+#error "The tiling kernels need NEON or SSE4.1"
+#endif
+
+#endif /* _TILING_SIMD_H_ */
@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 
 #include <tiling.h>
 
@@ -46,7 +46,7 @@
         }                                                              \
     };
 
-void Sobel3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Sobel3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -195,7 +195,7 @@ void Sobel3x3_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void
         }
 
 
-void Sobel3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Sobel3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -216,7 +216,7 @@ void Sobel3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
         else
         {
             SOBEL3x3_X(1, low_y, low_x, high_x - 1)
-            SOBEL3x3_X(low_y, high_y, 1, high_x - 1)
+            SOBEL3x3_X(low_y, high_y - 1, 1, high_x - 1)
         }
     }
     if (grad_y)
@@ -232,7 +232,7 @@ void Sobel3x3_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT],
         else
         {
             SOBEL3x3_Y(1, low_y, low_x, high_x - 1)
-            SOBEL3x3_Y(low_y, high_y, 1, high_x - 1)
+            SOBEL3x3_Y(low_y, high_y - 1, 1, high_x - 1)
         }
     }
 }
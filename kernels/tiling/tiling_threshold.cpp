@@ -14,11 +14,11 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 
 #include <tiling.h>
 
-void Threshold_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Threshold_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
@@ -196,7 +196,7 @@ void Threshold_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], voi
     }                                                                                           \
 
 
-void Threshold_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Threshold_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
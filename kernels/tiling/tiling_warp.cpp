@@ -14,7 +14,7 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
 #include <math.h>
@@ -31,6 +31,56 @@ static vx_float32 * alignPtr_f(vx_float32* ptr, size_t n)
     return (vx_float32 *)(((size_t)ptr + n-1) & -n);
 }
 
+/* floorf per lane, floats past 2^23 are integers already and would overflow the conversion */
+static inline float32x4_t floorLanes(float32x4_t v)
+{
+    float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(v));
+    t = vbslq_f32(vcltq_f32(v, t), vsubq_f32(t, vdupq_n_f32(1.0f)), t);
+    return vbslq_f32(vcltq_f32(vabsq_f32(v), vdupq_n_f32(8388608.0f)), t, v);
+}
+
+/* the source offsets of four destination pixels, -1 where the source coordinates fall outside the image */
+static inline int32x4_t nearestIndex(float32x4_t xf, float32x4_t yf, float32x4_t v_width, float32x4_t v_height, int32x4_t v_step)
+{
+    float32x4_t v_zero = vdupq_n_f32(0.0f);
+    uint32x4_t v_inside = vandq_u32(vandq_u32(vcgeq_f32(xf, v_zero), vcltq_f32(xf, v_width)),
+                                    vandq_u32(vcgeq_f32(yf, v_zero), vcltq_f32(yf, v_height)));
+    int32x4_t v_index = vmlaq_s32(vcvtq_s32_f32(xf), vcvtq_s32_f32(yf), v_step);
+    return vbslq_s32(v_inside, v_index, vdupq_n_s32(-1));
+}
+
+/* the offsets of the four neighbours and the fractional parts of four destination pixels,
+ * with the bounds checked on the floored coordinates like the C model does */
+static inline void linearIndex(float32x4_t xf, float32x4_t yf, float32x4_t v_width, float32x4_t v_height, int32x4_t v_step,
+                               vx_int32 * map_row, vx_float32 * coeff_row)
+{
+    float32x4_t v_zero = vdupq_n_f32(0.0f), v_one = vdupq_n_f32(1.0f);
+    int32x4_t v_m1 = vdupq_n_s32(-1);
+
+    float32x4_t v_x0 = floorLanes(xf), v_y0 = floorLanes(yf);
+    float32x4_t v_x1 = vaddq_f32(v_x0, v_one), v_y1 = vaddq_f32(v_y0, v_one);
+
+    uint32x4_t v_mask_x0 = vandq_u32(vcgeq_f32(v_x0, v_zero), vcltq_f32(v_x0, v_width));
+    uint32x4_t v_mask_x1 = vandq_u32(vcgeq_f32(v_x1, v_zero), vcltq_f32(v_x1, v_width));
+    uint32x4_t v_mask_y0 = vandq_u32(vcgeq_f32(v_y0, v_zero), vcltq_f32(v_y0, v_height));
+    uint32x4_t v_mask_y1 = vandq_u32(vcgeq_f32(v_y1, v_zero), vcltq_f32(v_y1, v_height));
+
+    int32x4_t v_index = vmlaq_s32(vcvtq_s32_f32(v_x0), vcvtq_s32_f32(v_y0), v_step);
+
+    int32x4x4_t v_dst_index;
+    v_dst_index.val[0] = vbslq_s32(vandq_u32(v_mask_x0, v_mask_y0), v_index, v_m1);
+    v_dst_index.val[1] = vbslq_s32(vandq_u32(v_mask_x1, v_mask_y0), vaddq_s32(v_index, vdupq_n_s32(1)), v_m1);
+    v_dst_index.val[2] = vbslq_s32(vandq_u32(v_mask_x0, v_mask_y1), vaddq_s32(v_index, v_step), v_m1);
+    v_dst_index.val[3] = vbslq_s32(vandq_u32(v_mask_x1, v_mask_y1), vaddq_s32(vaddq_s32(v_index, v_step), vdupq_n_s32(1)), v_m1);
+
+    float32x4x2_t v_coeff;
+    v_coeff.val[0] = vsubq_f32(xf, v_x0);
+    v_coeff.val[1] = vsubq_f32(yf, v_y0);
+
+    vst2q_f32(coeff_row, v_coeff);
+    vst4q_s32(map_row, v_dst_index);
+}
+
 static void remapNearestNeighborConst(const size_t height,
                                       const size_t width,
                                       const vx_uint8 * srcBase,
@@ -59,7 +109,7 @@ static void remapLinearConst(const size_t height,
                              vx_uint8 * dstBase, ptrdiff_t dstStride,
                              vx_uint8 borderValue)
 {
-    int16x8_t v_zero16 = vdupq_n_s16(0);
+    float32x4_t v_one = vdupq_n_f32(1.0f);
 
     for (size_t y = 0; y < height; ++y)
     {
@@ -70,83 +120,48 @@ static void remapLinearConst(const size_t height,
 
         size_t x = 0;
 
-        for ( ; x + 8 < width; x += 8)
+        for ( ; x + 8 <= width; x += 8)
         {
-            int16x8_t v_src00 = vsetq_lane_s16(map_row[(x << 2)] >= 0 ? srcBase[map_row[(x << 2)]] : borderValue, v_zero16, 0);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) +  4] >= 0 ? srcBase[map_row[(x << 2) +  4]] : borderValue, v_src00, 1);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) +  8] >= 0 ? srcBase[map_row[(x << 2) +  8]] : borderValue, v_src00, 2);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) + 12] >= 0 ? srcBase[map_row[(x << 2) + 12]] : borderValue, v_src00, 3);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) + 16] >= 0 ? srcBase[map_row[(x << 2) + 16]] : borderValue, v_src00, 4);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) + 20] >= 0 ? srcBase[map_row[(x << 2) + 20]] : borderValue, v_src00, 5);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) + 24] >= 0 ? srcBase[map_row[(x << 2) + 24]] : borderValue, v_src00, 6);
-            v_src00 = vsetq_lane_s16(map_row[(x << 2) + 28] >= 0 ? srcBase[map_row[(x << 2) + 28]] : borderValue, v_src00, 7);
-
-            int16x8_t v_src01 = vsetq_lane_s16(map_row[(x << 2) + 1] >= 0 ? srcBase[map_row[(x << 2) + 1]] : borderValue, v_zero16, 0);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) +  5] >= 0 ? srcBase[map_row[(x << 2) +  5]] : borderValue, v_src01, 1);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) +  9] >= 0 ? srcBase[map_row[(x << 2) +  9]] : borderValue, v_src01, 2);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) + 13] >= 0 ? srcBase[map_row[(x << 2) + 13]] : borderValue, v_src01, 3);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) + 17] >= 0 ? srcBase[map_row[(x << 2) + 17]] : borderValue, v_src01, 4);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) + 21] >= 0 ? srcBase[map_row[(x << 2) + 21]] : borderValue, v_src01, 5);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) + 25] >= 0 ? srcBase[map_row[(x << 2) + 25]] : borderValue, v_src01, 6);
-            v_src01 = vsetq_lane_s16(map_row[(x << 2) + 29] >= 0 ? srcBase[map_row[(x << 2) + 29]] : borderValue, v_src01, 7);
-
-            int16x8_t v_src10 = vsetq_lane_s16(map_row[(x << 2) + 2] >= 0 ? srcBase[map_row[(x << 2) + 2]] : borderValue, v_zero16, 0);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) +  6] >= 0 ? srcBase[map_row[(x << 2) +  6]] : borderValue, v_src10, 1);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) + 10] >= 0 ? srcBase[map_row[(x << 2) + 10]] : borderValue, v_src10, 2);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) + 14] >= 0 ? srcBase[map_row[(x << 2) + 14]] : borderValue, v_src10, 3);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) + 18] >= 0 ? srcBase[map_row[(x << 2) + 18]] : borderValue, v_src10, 4);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) + 22] >= 0 ? srcBase[map_row[(x << 2) + 22]] : borderValue, v_src10, 5);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) + 26] >= 0 ? srcBase[map_row[(x << 2) + 26]] : borderValue, v_src10, 6);
-            v_src10 = vsetq_lane_s16(map_row[(x << 2) + 30] >= 0 ? srcBase[map_row[(x << 2) + 30]] : borderValue, v_src10, 7);
-
-            int16x8_t v_src11 = vsetq_lane_s16(map_row[(x << 2) + 3] >= 0 ? srcBase[map_row[(x << 2) + 3]] : borderValue, v_zero16, 0);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) +  7] >= 0 ? srcBase[map_row[(x << 2) +  7]] : borderValue, v_src11, 1);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) + 11] >= 0 ? srcBase[map_row[(x << 2) + 11]] : borderValue, v_src11, 2);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) + 15] >= 0 ? srcBase[map_row[(x << 2) + 15]] : borderValue, v_src11, 3);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) + 19] >= 0 ? srcBase[map_row[(x << 2) + 19]] : borderValue, v_src11, 4);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) + 23] >= 0 ? srcBase[map_row[(x << 2) + 23]] : borderValue, v_src11, 5);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) + 27] >= 0 ? srcBase[map_row[(x << 2) + 27]] : borderValue, v_src11, 6);
-            v_src11 = vsetq_lane_s16(map_row[(x << 2) + 31] >= 0 ? srcBase[map_row[(x << 2) + 31]] : borderValue, v_src11, 7);
-
-            // first part
-            float32x4_t v_src00_f = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v_src00)));
-            float32x4_t v_src10_f = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v_src10)));
-
-            float32x4x2_t v_coeff = vld2q_f32(coeff_row + (x << 1));
-            float32x4_t v_dst_0 = vmlaq_f32(v_src00_f, vcvtq_f32_s32(vsubl_s16(vget_low_s16(v_src01),
-                                                                               vget_low_s16(v_src00))), v_coeff.val[0]);
-            float32x4_t v_dst_1 = vmlaq_f32(v_src10_f, vcvtq_f32_s32(vsubl_s16(vget_low_s16(v_src11),
-                                                                               vget_low_s16(v_src10))), v_coeff.val[0]);
-
-            float32x4_t v_dst = vmlaq_f32(v_dst_0, vsubq_f32(v_dst_1, v_dst_0), v_coeff.val[1]);
-            uint16x4_t v_dst0 = vmovn_u32(vcvtq_u32_f32(v_dst));
-
-            // second part
-            v_src00_f = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v_src00)));
-            v_src10_f = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v_src10)));
-
-            v_coeff = vld2q_f32(coeff_row + (x << 1) + 8);
-            v_dst_0 = vmlaq_f32(v_src00_f, vcvtq_f32_s32(vsubl_s16(vget_high_s16(v_src01),
-                                                                   vget_high_s16(v_src00))), v_coeff.val[0]);
-            v_dst_1 = vmlaq_f32(v_src10_f, vcvtq_f32_s32(vsubl_s16(vget_high_s16(v_src11),
-                                                                   vget_high_s16(v_src10))), v_coeff.val[0]);
-
-            v_dst = vmlaq_f32(v_dst_0, vsubq_f32(v_dst_1, v_dst_0), v_coeff.val[1]);
-            uint16x4_t v_dst1 = vmovn_u32(vcvtq_u32_f32(v_dst));
-
-            // store
-            vst1_u8(dst_row + x, vmovn_u16(vcombine_u16(v_dst0, v_dst1)));
+            /* the four neighbours of eight pixels, top left, top right, bottom left, bottom right */
+            vx_float32 src[4][8];
+            for (size_t k = 0; k < 8; ++k)
+            {
+                for (size_t n = 0; n < 4; ++n)
+                {
+                    vx_int32 src_idx = map_row[((x + k) << 2) + n];
+                    src[n][k] = src_idx >= 0 ? srcBase[src_idx] : borderValue;
+                }
+            }
+
+            uint16x4_t v_dst_half[2];
+            for (size_t h = 0; h < 2; ++h)
+            {
+                /* the same products in the same order as the C model, so the results match bit for bit */
+                float32x4x2_t v_coeff = vld2q_f32(coeff_row + ((x + h * 4) << 1));
+                float32x4_t v_ar = v_coeff.val[0], v_ab = v_coeff.val[1];
+                float32x4_t v_al = vsubq_f32(v_one, v_ar), v_at = vsubq_f32(v_one, v_ab);
+
+                float32x4_t v_dst = vmulq_f32(vmulq_f32(vld1q_f32(&src[0][h * 4]), v_al), v_at);
+                v_dst = vaddq_f32(v_dst, vmulq_f32(vmulq_f32(vld1q_f32(&src[1][h * 4]), v_ar), v_at));
+                v_dst = vaddq_f32(v_dst, vmulq_f32(vmulq_f32(vld1q_f32(&src[2][h * 4]), v_al), v_ab));
+                v_dst = vaddq_f32(v_dst, vmulq_f32(vmulq_f32(vld1q_f32(&src[3][h * 4]), v_ar), v_ab));
+                v_dst_half[h] = vmovn_u32(vcvtq_u32_f32(v_dst));
+            }
+
+            vst1_u8(dst_row + x, vmovn_u16(vcombine_u16(v_dst_half[0], v_dst_half[1])));
         }
         for ( ; x < width; ++x)
         {
-            int16_t src00 = map_row[(x << 2) + 0] >= 0 ? srcBase[map_row[(x << 2) + 0]] : borderValue;
-            int16_t src01 = map_row[(x << 2) + 1] >= 0 ? srcBase[map_row[(x << 2) + 1]] : borderValue;
-            int16_t src10 = map_row[(x << 2) + 2] >= 0 ? srcBase[map_row[(x << 2) + 2]] : borderValue;
-            int16_t src11 = map_row[(x << 2) + 3] >= 0 ? srcBase[map_row[(x << 2) + 3]] : borderValue;
-
-            vx_float32 dst_val_0 = (src01 - src00) * coeff_row[(x << 1)] + src00;
-            vx_float32 dst_val_1 = (src11 - src10) * coeff_row[(x << 1)] + src10;
-            dst_row[x] = floorf((dst_val_1 - dst_val_0) * coeff_row[(x << 1) + 1] + dst_val_0);
+            vx_uint8 tl = map_row[(x << 2) + 0] >= 0 ? srcBase[map_row[(x << 2) + 0]] : borderValue;
+            vx_uint8 tr = map_row[(x << 2) + 1] >= 0 ? srcBase[map_row[(x << 2) + 1]] : borderValue;
+            vx_uint8 bl = map_row[(x << 2) + 2] >= 0 ? srcBase[map_row[(x << 2) + 2]] : borderValue;
+            vx_uint8 br = map_row[(x << 2) + 3] >= 0 ? srcBase[map_row[(x << 2) + 3]] : borderValue;
+
+            vx_float32 ar = coeff_row[(x << 1)];
+            vx_float32 ab = coeff_row[(x << 1) + 1];
+            vx_float32 al = 1.0f - ar;
+            vx_float32 at = 1.0f - ab;
+            dst_row[x] = (vx_uint8)(tl * al * at + tr * ar * at + bl * al * ab + br * ar * ab);
         }
     }
 }
@@ -154,7 +169,7 @@ static void remapLinearConst(const size_t height,
 //BLOCK_SIZE is the same as tile_size set in "vx_warp.c"
 #define BLOCK_SIZE 16
 
-void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 x = 0, y = 0;
 
@@ -174,7 +189,7 @@ void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], vo
     vx_uint32 dst_height = out->image.height;
     vx_uint32 dstStride = out->addr->stride_y;
 
-    int32x4_t v_width4 = vdupq_n_s32(src_width - 1), v_height4 = vdupq_n_s32(src_height - 1);
+    float32x4_t v_width4 = vdupq_n_f32((vx_float32)src_width), v_height4 = vdupq_n_f32((vx_float32)src_height);
     int32x4_t v_step4 = vdupq_n_s32(srcStride);
     float32x4_t v_4 = vdupq_n_f32(4.0f);
 
@@ -199,9 +214,6 @@ void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], vo
         vx_int32 _map[BLOCK_SIZE * BLOCK_SIZE + 16];
         vx_int32 * map = alignPtr(_map, 16);
 
-        int32x4_t v_m1_4 = vdupq_n_s32(-1);
-        float32x4_t v_zero4 = vdupq_n_f32(0.0f);
-
         // compute table
         for (size_t y = 0; y < blockHeight; ++y)
         {
@@ -210,19 +222,15 @@ void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], vo
             size_t x = 0, y_ = y + i;
             vx_float32 indeces[4] = { j + 0.0f, j + 1.0f, j + 2.0f, j + 3.0f };
             float32x4_t v_x = vld1q_f32(indeces), v_y = vdupq_n_f32(y_);
-            float32x4_t v_yx = vmlaq_f32(v_m4, v_m2, v_y), v_yy = vmlaq_f32(v_m5, v_m3, v_y);
+            float32x4_t v_yx = vmulq_f32(v_y, v_m2), v_yy = vmulq_f32(v_y, v_m3);
 
             for ( ; x + 4 <= blockWidth; x += 4)
             {
-                float32x4_t v_src_xf = vmlaq_f32(v_yx, v_m0, v_x);
-                float32x4_t v_src_yf = vmlaq_f32(v_yy, v_m1, v_x);
+                /* x * m0 + y * m2 + m4, evaluated left to right like the C model */
+                float32x4_t v_src_xf = vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m0), v_yx), v_m4);
+                float32x4_t v_src_yf = vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m1), v_yy), v_m5);
 
-                int32x4_t v_src_x = vcvtq_s32_f32(v_src_xf);
-                int32x4_t v_src_y = vcvtq_s32_f32(v_src_yf);
-                uint32x4_t v_mask = vandq_u32(vandq_u32(vcgeq_f32(v_src_xf, v_zero4), vcleq_s32(v_src_x, v_width4)),
-                                              vandq_u32(vcgeq_f32(v_src_yf, v_zero4), vcleq_s32(v_src_y, v_height4)));
-                int32x4_t v_src_index = vbslq_s32(v_mask, vmlaq_s32(v_src_x, v_src_y, v_step4), v_m1_4);
-                vst1q_s32(map_row + x, v_src_index);
+                vst1q_s32(map_row + x, nearestIndex(v_src_xf, v_src_yf, v_width4, v_height4, v_step4));
 
                 v_x = vaddq_f32(v_x, v_4);
             }
@@ -238,12 +246,6 @@ void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], vo
         vx_int32 * map = alignPtr(_map, 16);
         vx_float32 * coeffs = alignPtr_f(_coeffs, 16);
 
-        int32x4_t v_1 = vdupq_n_s32(1);
-        float32x4_t v_zero4f = vdupq_n_f32(0.0f), v_one4f = vdupq_n_f32(1.0f);
-
-        float32x4_t v_zero4 = vdupq_n_f32(0.0f);
-        int32x4_t v_m1_4 = vdupq_n_s32(-1);
-
         // compute table
         for (size_t y = 0; y < blockHeight; ++y)
         {
@@ -252,48 +254,15 @@ void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], vo
 
             size_t x = 0, y_ = y + i;
             vx_float32 indeces[4] = { j + 0.0f, j + 1.0f, j + 2.0f, j + 3.0f };
-            float32x4_t v_x = vld1q_f32(indeces), v_y = vdupq_n_f32(y_), v_4 = vdupq_n_f32(4.0f);
-            float32x4_t v_yx = vmlaq_f32(v_m4, v_m2, v_y), v_yy = vmlaq_f32(v_m5, v_m3, v_y);
+            float32x4_t v_x = vld1q_f32(indeces), v_y = vdupq_n_f32(y_);
+            float32x4_t v_yx = vmulq_f32(v_y, v_m2), v_yy = vmulq_f32(v_y, v_m3);
 
             for ( ; x + 4 <= blockWidth; x += 4)
             {
-                float32x4_t v_src_xf = vmlaq_f32(v_yx, v_m0, v_x);
-                float32x4_t v_src_yf = vmlaq_f32(v_yy, v_m1, v_x);
-
-                int32x4_t v_src_x0 = vcvtq_s32_f32(v_src_xf);
-                int32x4_t v_src_y0 = vcvtq_s32_f32(v_src_yf);
-
-                float32x4x2_t v_coeff;
-                v_coeff.val[0] = vsubq_f32(v_src_xf, vcvtq_f32_s32(v_src_x0));
-                v_coeff.val[1] = vsubq_f32(v_src_yf, vcvtq_f32_s32(v_src_y0));
-                uint32x4_t v_maskx = vcltq_f32(v_coeff.val[0], v_zero4f);
-                uint32x4_t v_masky = vcltq_f32(v_coeff.val[1], v_zero4f);
-                v_coeff.val[0] = vbslq_f32(v_maskx, vaddq_f32(v_one4f, v_coeff.val[0]), v_coeff.val[0]);
-                v_coeff.val[1] = vbslq_f32(v_masky, vaddq_f32(v_one4f, v_coeff.val[1]), v_coeff.val[1]);
-                v_src_x0 = vbslq_s32(v_maskx, vsubq_s32(v_src_x0, v_1), v_src_x0);
-                v_src_y0 = vbslq_s32(v_masky, vsubq_s32(v_src_y0, v_1), v_src_y0);
-
-                int32x4_t v_src_x1 = vaddq_s32(v_src_x0, v_1);
-                int32x4_t v_src_y1 = vaddq_s32(v_src_y0, v_1);
-
-                int32x4x4_t v_dst_index;
-                v_dst_index.val[0] = vmlaq_s32(v_src_x0, v_src_y0, v_step4);
-                v_dst_index.val[1] = vmlaq_s32(v_src_x1, v_src_y0, v_step4);
-                v_dst_index.val[2] = vmlaq_s32(v_src_x0, v_src_y1, v_step4);
-                v_dst_index.val[3] = vmlaq_s32(v_src_x1, v_src_y1, v_step4);
-
-                uint32x4_t v_mask_x0 = vandq_u32(vcgeq_f32(v_src_xf, v_zero4), vcleq_s32(v_src_x0, v_width4));
-                uint32x4_t v_mask_x1 = vandq_u32(vcgeq_f32(vaddq_f32(v_src_xf, v_one4f), v_zero4), vcleq_s32(v_src_x1, v_width4));
-                uint32x4_t v_mask_y0 = vandq_u32(vcgeq_f32(v_src_yf, v_zero4), vcleq_s32(v_src_y0, v_height4));
-                uint32x4_t v_mask_y1 = vandq_u32(vcgeq_f32(vaddq_f32(v_src_yf, v_one4f), v_zero4), vcleq_s32(v_src_y1, v_height4));
-
-                v_dst_index.val[0] = vbslq_s32(vandq_u32(v_mask_x0, v_mask_y0), v_dst_index.val[0], v_m1_4);
-                v_dst_index.val[1] = vbslq_s32(vandq_u32(v_mask_x1, v_mask_y0), v_dst_index.val[1], v_m1_4);
-                v_dst_index.val[2] = vbslq_s32(vandq_u32(v_mask_x0, v_mask_y1), v_dst_index.val[2], v_m1_4);
-                v_dst_index.val[3] = vbslq_s32(vandq_u32(v_mask_x1, v_mask_y1), v_dst_index.val[3], v_m1_4);
-
-                vst2q_f32(coeff_row + (x << 1), v_coeff);
-                vst4q_s32(map_row + (x << 2), v_dst_index);
+                float32x4_t v_src_xf = vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m0), v_yx), v_m4);
+                float32x4_t v_src_yf = vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m1), v_yy), v_m5);
+
+                linearIndex(v_src_xf, v_src_yf, v_width4, v_height4, v_step4, map_row + (x << 2), coeff_row + (x << 1));
 
                 v_x = vaddq_f32(v_x, v_4);
             }
@@ -305,15 +274,7 @@ void WarpAffine_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], vo
     }
 }
 
-static inline float32x4_t vrecpq_f32(float32x4_t val)
-{
-    float32x4_t reciprocal = vrecpeq_f32(val);
-    reciprocal = vmulq_f32(vrecpsq_f32(val, reciprocal), reciprocal);
-    reciprocal = vmulq_f32(vrecpsq_f32(val, reciprocal), reciprocal);
-    return reciprocal;
-}
-
-void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 x = 0, y = 0;
 
@@ -333,8 +294,8 @@ void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT
     vx_uint32 dst_height = out->image.height;
     vx_uint32 dstStride = out->addr->stride_y;
 
-    int32x4_t v_width4 = vdupq_n_s32(src_width - 1);
-    int32x4_t v_height4 = vdupq_n_s32(src_height - 1);
+    float32x4_t v_width4 = vdupq_n_f32((vx_float32)src_width);
+    float32x4_t v_height4 = vdupq_n_f32((vx_float32)src_height);
     int32x4_t v_step4 = vdupq_n_s32(srcStride);
     float32x4_t v_4 = vdupq_n_f32(4.0f);
 
@@ -362,9 +323,6 @@ void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT
         vx_int32 _map[BLOCK_SIZE * BLOCK_SIZE + 16];
         vx_int32 * map = alignPtr(_map, 16);
 
-        int32x4_t v_m1_4 = vdupq_n_s32(-1);
-        float32x4_t v_zero4 = vdupq_n_f32(0.0f);
-
         // compute table
         for (size_t y = 0; y < blockHeight; ++y)
         {
@@ -373,26 +331,18 @@ void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT
             size_t x = 0, y_ = y + i;
             vx_float32  indeces[4] = { j + 0.0f, j + 1.0f, j + 2.0f, j + 3.0f };
             float32x4_t v_x = vld1q_f32(indeces), v_y = vdupq_n_f32(y_);
-            float32x4_t v_yx = vmlaq_f32(v_m6, v_m3, v_y);
-            float32x4_t v_yy = vmlaq_f32(v_m7, v_m4, v_y);
-            float32x4_t v_yw = vmlaq_f32(v_m8, v_m5, v_y);
+            float32x4_t v_yx = vmulq_f32(v_y, v_m3);
+            float32x4_t v_yy = vmulq_f32(v_y, v_m4);
+            float32x4_t v_yw = vmulq_f32(v_y, v_m5);
 
             for ( ; x + 4 <= blockWidth; x += 4)
             {
-                float32x4_t v_src_xf = vmlaq_f32(v_yx, v_m0, v_x);
-                float32x4_t v_src_yf = vmlaq_f32(v_yy, v_m1, v_x);
-
-                float32x4_t v_wf = vrecpq_f32(vmlaq_f32(v_yw, v_m2, v_x));
+                /* a true division rather than a reciprocal estimate, so the coordinates match the C model */
+                float32x4_t v_wf = vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m2), v_yw), v_m8);
+                float32x4_t v_src_xf = vdivq_f32(vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m0), v_yx), v_m6), v_wf);
+                float32x4_t v_src_yf = vdivq_f32(vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m1), v_yy), v_m7), v_wf);
 
-                v_src_xf = vmulq_f32(v_wf, v_src_xf);
-                v_src_yf = vmulq_f32(v_wf, v_src_yf);
-
-                int32x4_t v_src_x = vcvtq_s32_f32(v_src_xf);
-                int32x4_t v_src_y = vcvtq_s32_f32(v_src_yf);
-                uint32x4_t v_mask = vandq_u32(vandq_u32(vcgeq_f32(v_src_xf, v_zero4), vcleq_s32(v_src_x, v_width4)),
-                vandq_u32(vcgeq_f32(v_src_yf, v_zero4), vcleq_s32(v_src_y, v_height4)));
-                int32x4_t v_src_index = vbslq_s32(v_mask, vmlaq_s32(v_src_x, v_src_y, v_step4), v_m1_4);
-                vst1q_s32(map_row + x, v_src_index);
+                vst1q_s32(map_row + x, nearestIndex(v_src_xf, v_src_yf, v_width4, v_height4, v_step4));
 
                 v_x = vaddq_f32(v_x, v_4);
             }
@@ -409,12 +359,6 @@ void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT
         vx_int32 * map = alignPtr(_map, 16);
         vx_float32 * coeffs = alignPtr_f(_coeffs, 16);
 
-        int32x4_t v_1 = vdupq_n_s32(1);
-        float32x4_t v_zero4f = vdupq_n_f32(0.0f), v_one4f = vdupq_n_f32(1.0f);
-
-        float32x4_t v_zero4 = vdupq_n_f32(0.0f);
-        int32x4_t v_m1_4 = vdupq_n_s32(-1);
-
         // compute table
         for (size_t y = 0; y < blockHeight; ++y)
         {
@@ -424,51 +368,16 @@ void WarpPerspective_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT
             size_t x = 0, y_ = y + i;
             vx_float32 indeces[4] = { j + 0.0f, j + 1.0f, j + 2.0f, j + 3.0f };
             float32x4_t v_x = vld1q_f32(indeces), v_y = vdupq_n_f32(y_);
-            float32x4_t v_yx = vmlaq_f32(v_m6, v_m3, v_y), v_yy = vmlaq_f32(v_m7, v_m4, v_y),
-            v_yw = vmlaq_f32(v_m8, v_m5, v_y);
+            float32x4_t v_yx = vmulq_f32(v_y, v_m3), v_yy = vmulq_f32(v_y, v_m4),
+            v_yw = vmulq_f32(v_y, v_m5);
 
             for ( ; x + 4 <= blockWidth; x += 4)
             {
-                float32x4_t v_src_xf = vmlaq_f32(v_yx, v_m0, v_x);
-                float32x4_t v_src_yf = vmlaq_f32(v_yy, v_m1, v_x);
-                float32x4_t v_wf = vrecpq_f32(vmlaq_f32(v_yw, v_m2, v_x));
-                v_src_xf = vmulq_f32(v_wf, v_src_xf);
-                v_src_yf = vmulq_f32(v_wf, v_src_yf);
-
-                int32x4_t v_src_x0 = vcvtq_s32_f32(v_src_xf);
-                int32x4_t v_src_y0 = vcvtq_s32_f32(v_src_yf);
-
-                float32x4x2_t v_coeff;
-                v_coeff.val[0] = vsubq_f32(v_src_xf, vcvtq_f32_s32(v_src_x0));
-                v_coeff.val[1] = vsubq_f32(v_src_yf, vcvtq_f32_s32(v_src_y0));
-                uint32x4_t v_maskx = vcltq_f32(v_coeff.val[0], v_zero4f);
-                uint32x4_t v_masky = vcltq_f32(v_coeff.val[1], v_zero4f);
-                v_coeff.val[0] = vbslq_f32(v_maskx, vaddq_f32(v_one4f, v_coeff.val[0]), v_coeff.val[0]);
-                v_coeff.val[1] = vbslq_f32(v_masky, vaddq_f32(v_one4f, v_coeff.val[1]), v_coeff.val[1]);
-                v_src_x0 = vbslq_s32(v_maskx, vsubq_s32(v_src_x0, v_1), v_src_x0);
-                v_src_y0 = vbslq_s32(v_masky, vsubq_s32(v_src_y0, v_1), v_src_y0);
-
-                int32x4_t v_src_x1 = vaddq_s32(v_src_x0, v_1);
-                int32x4_t v_src_y1 = vaddq_s32(v_src_y0, v_1);
-
-                int32x4x4_t v_dst_index;
-                v_dst_index.val[0] = vmlaq_s32(v_src_x0, v_src_y0, v_step4);
-                v_dst_index.val[1] = vmlaq_s32(v_src_x1, v_src_y0, v_step4);
-                v_dst_index.val[2] = vmlaq_s32(v_src_x0, v_src_y1, v_step4);
-                v_dst_index.val[3] = vmlaq_s32(v_src_x1, v_src_y1, v_step4);
-
-                uint32x4_t v_mask_x0 = vandq_u32(vcgeq_f32(v_src_xf, v_zero4), vcleq_s32(v_src_x0, v_width4));
-                uint32x4_t v_mask_x1 = vandq_u32(vcgeq_f32(vaddq_f32(v_src_xf, v_one4f), v_zero4), vcleq_s32(v_src_x1, v_width4));
-                uint32x4_t v_mask_y0 = vandq_u32(vcgeq_f32(v_src_yf, v_zero4), vcleq_s32(v_src_y0, v_height4));
-                uint32x4_t v_mask_y1 = vandq_u32(vcgeq_f32(vaddq_f32(v_src_yf, v_one4f), v_zero4), vcleq_s32(v_src_y1, v_height4));
-
-                v_dst_index.val[0] = vbslq_s32(vandq_u32(v_mask_x0, v_mask_y0), v_dst_index.val[0], v_m1_4);
-                v_dst_index.val[1] = vbslq_s32(vandq_u32(v_mask_x1, v_mask_y0), v_dst_index.val[1], v_m1_4);
-                v_dst_index.val[2] = vbslq_s32(vandq_u32(v_mask_x0, v_mask_y1), v_dst_index.val[2], v_m1_4);
-                v_dst_index.val[3] = vbslq_s32(vandq_u32(v_mask_x1, v_mask_y1), v_dst_index.val[3], v_m1_4);
-
-                vst2q_f32(coeff_row + (x << 1), v_coeff);
-                vst4q_s32(map_row + (x << 2), v_dst_index);
+                float32x4_t v_wf = vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m2), v_yw), v_m8);
+                float32x4_t v_src_xf = vdivq_f32(vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m0), v_yx), v_m6), v_wf);
+                float32x4_t v_src_yf = vdivq_f32(vaddq_f32(vaddq_f32(vmulq_f32(v_x, v_m1), v_yy), v_m7), v_wf);
+
+                linearIndex(v_src_xf, v_src_yf, v_width4, v_height4, v_step4, map_row + (x << 2), coeff_row + (x << 1));
 
                 v_x = vaddq_f32(v_x, v_4);
             }
@@ -668,7 +577,7 @@ static void transform_perspective(vx_uint32 dst_x, vx_uint32 dst_y, vx_float32 m
     }
 
 
-void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -683,7 +592,8 @@ void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT]
     vx_uint32 low_x = out->tile_x;
     vx_uint32 high_x = vxTileWidth(out, 0);
 
-    vx_uint8 *src_base = in->base[0] + in->tile_x;
+    /* the source coordinates come from the transform and are absolute */
+    vx_uint8 *src_base = in->base[0];
     vx_uint8 *dst_base = out->base[0] + out->tile_x;
 
     vx_border_t borders = in->border;
@@ -698,7 +608,6 @@ void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT]
         {
             WARP(0, low_y, low_x, transform_affine)
 
-            src_base = in->base[0];
             dst_base = out->base[0];
             WARP(low_y, high_y, 0, transform_affine)
         }
@@ -709,7 +618,7 @@ void WarpAffine_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT]
     }
 }
 
-void WarpPerspective_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void WarpPerspective_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
@@ -724,7 +633,8 @@ void WarpPerspective_image_tiling_flexible(void * VX_RESTRICT parameters[VX_REST
     vx_uint32 low_x = out->tile_x;
     vx_uint32 high_x = vxTileWidth(out, 0);
 
-    vx_uint8 *src_base = in->base[0] + in->tile_x;
+    /* the source coordinates come from the transform and are absolute */
+    vx_uint8 *src_base = in->base[0];
     vx_uint8 *dst_base = out->base[0] + out->tile_x;
 
     vx_border_t borders = in->border;
@@ -739,7 +649,6 @@ void WarpPerspective_image_tiling_flexible(void * VX_RESTRICT parameters[VX_REST
         {
             WARP(0, low_y, low_x, transform_perspective)
 
-            src_base = in->base[0];
             dst_base = out->base[0];
             WARP(low_y, high_y, 0, transform_perspective)
         }
@@ -15,10 +15,10 @@
 * limitations under the License.
 */
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 #include <tiling.h>
 
-void WeightedAverage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void WeightedAverage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
 	vx_uint32 y, x;    
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -95,7 +95,7 @@ void WeightedAverage_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT
 		}                                                                                                \
 	}                                                                                                    \
 
-void WeightedAverage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void WeightedAverage_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
 	vx_uint32 y, x;    
     vx_tile_ex_t *in_1 = (vx_tile_ex_t *)parameters[0];
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _VX_X86SIMD_H_
+#define _VX_X86SIMD_H_
+
+#include <VX/vx.h>
+#include <VX/vx_helper.h>
+/* TODO: remove vx_compatibility.h after transition period */
+#include <VX/vx_compatibility.h>
+#include <math.h>
+#include <stdbool.h>
+
+/*! \brief The largest convolution matrix the specification requires support for is 15x15.
+ */
+#define X86SIMD_MAX_CONVOLUTION_DIM (15)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+vx_status vxAbsDiff(vx_image in1, vx_image in2, vx_image output);
+vx_status vxAddition(vx_image in0, vx_image in1, vx_scalar policy_param, vx_image output);
+vx_status vxSubtraction(vx_image in0, vx_image in1, vx_scalar policy_param, vx_image output);
+vx_status vxAnd(vx_image in0, vx_image in1, vx_image output);
+vx_status vxOr(vx_image in0, vx_image in1, vx_image output);
+vx_status vxXor(vx_image in0, vx_image in1, vx_image output);
+vx_status vxNot(vx_image input, vx_image output);
+vx_status vxChannelCombine(vx_image inputs[4], vx_image output);
+vx_status vxChannelExtract(vx_image src, vx_scalar channel, vx_image dst);
+vx_status vxConvertColor(vx_image src, vx_image dst);
+vx_status vxConvertDepth(vx_image input, vx_image output, vx_scalar spol, vx_scalar sshf);
+vx_status vxConvolve(vx_image src, vx_convolution conv, vx_image dst, vx_border_t *bordermode);
+vx_status vxMedian3x3(vx_image src, vx_image dst, vx_border_t *bordermode);
+vx_status vxBox3x3(vx_image src, vx_image dst, vx_border_t *bordermode);
+vx_status vxGaussian3x3(vx_image src, vx_image dst, vx_border_t *bordermode);
+vx_status vxErode3x3(vx_image src, vx_image dst, vx_border_t *bordermode);
+vx_status vxDilate3x3(vx_image src, vx_image dst, vx_border_t *bordermode);
+vx_status vxHistogram(vx_image src, vx_distribution dist);
+vx_status vxEqualizeHist(vx_image src, vx_image dst);
+vx_status vxIntegralImage(vx_image src, vx_image dst);
+vx_status vxTableLookup(vx_image src, vx_lut lut, vx_image dst);
+vx_status vxMagnitude(vx_image grad_x, vx_image grad_y, vx_image output);
+vx_status vxPhase(vx_image grad_x, vx_image grad_y, vx_image output);
+vx_status vxMin(vx_image in0, vx_image in1, vx_image output);
+vx_status vxMax(vx_image in0, vx_image in1, vx_image output);
+vx_status vxMultiply(vx_image in0, vx_image in1, vx_scalar scale_param, vx_scalar opolicy_param, vx_scalar rpolicy_param, vx_image output);
+vx_status vxScaleImage(vx_image src_image, vx_image dst_image, vx_scalar stype, vx_border_t *bordermode, vx_float64 *interm, vx_size size);
+vx_status vxThreshold(vx_image src_image, vx_threshold threshold, vx_image dst_image);
+vx_status vxWarpPerspective(vx_image src_image, vx_matrix matrix, vx_scalar stype, vx_image dst_image, const vx_border_t *borders);
+vx_status vxWarpAffine(vx_image src_image, vx_matrix matrix, vx_scalar stype, vx_image dst_image, const vx_border_t *borders);
+vx_status vxWeightedAverage(vx_image img1, vx_scalar alpha, vx_image img2, vx_image output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the AbsDiff kernel
+vx_status vxAbsDiff(vx_image in1, vx_image in2, vx_image output)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_uint32 y, width = 0, height = 0;
+    void *dst_base = nullptr;
+    void *src_base[2] = {nullptr, nullptr};
+    vx_imagepatch_addressing_t dst_addr, src_addr[2];
+    vx_rectangle_t rect, r_in1, r_in2;
+    vx_df_image format = 0, dst_format = 0;
+    vx_map_id src_map_id[2] = {0, 0};
+    vx_map_id dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    vxQueryImage(in1, VX_IMAGE_FORMAT, &format, sizeof(format));
+    vxQueryImage(output, VX_IMAGE_FORMAT, &dst_format, sizeof(dst_format));
+    status  = vxGetValidRegionImage(in1, &r_in1);
+    status |= vxGetValidRegionImage(in2, &r_in2);
+    vxFindOverlapRectangle(&r_in1, &r_in2, &rect);
+    status |= vxMapImagePatch(in1, &rect, 0, &src_map_id[0], &src_addr[0], &src_base[0], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(in2, &rect, 0, &src_map_id[1], &src_addr[1], &src_base[1], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    width = src_addr[0].dim_x;
+    height = src_addr[0].dim_y;
+
+    if (status == VX_SUCCESS)
+    {
+        for (y = 0; y < height; y++)
+        {
+            rows->absdiff(x86simdRow(src_base[0], &src_addr[0], y), x86simdRow(src_base[1], &src_addr[1], y),
+                          x86simdRow(dst_base, &dst_addr, y), format, dst_format, width);
+        }
+    }
+
+    status |= vxUnmapImagePatch(in1, src_map_id[0]);
+    status |= vxUnmapImagePatch(in2, src_map_id[1]);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
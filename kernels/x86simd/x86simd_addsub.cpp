@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// generic U8/S16 arithmetic op, also used by Min and Max
+vx_status x86simdArithmetic(vx_image in0, vx_image in1, vx_enum policy, vx_image output, enum x86simd_arith_e op)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_uint32 y, width = 0, height = 0;
+    void *dst_base = nullptr;
+    void *src_base[2] = {nullptr, nullptr};
+    vx_imagepatch_addressing_t dst_addr, src_addr[2];
+    vx_rectangle_t rect;
+    vx_df_image in0_format = 0, in1_format = 0, out_format = 0;
+    vx_map_id src_map_id[2] = {0, 0};
+    vx_map_id dst_map_id = 0;
+    vx_bool saturate = policy == VX_CONVERT_POLICY_SATURATE ? vx_true_e : vx_false_e;
+    vx_status status = VX_SUCCESS;
+
+    vxQueryImage(output, VX_IMAGE_FORMAT, &out_format, sizeof(out_format));
+    vxQueryImage(in0, VX_IMAGE_FORMAT, &in0_format, sizeof(in0_format));
+    vxQueryImage(in1, VX_IMAGE_FORMAT, &in1_format, sizeof(in1_format));
+    status  = vxGetValidRegionImage(in0, &rect);
+    status |= vxMapImagePatch(in0, &rect, 0, &src_map_id[0], &src_addr[0], &src_base[0], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(in1, &rect, 0, &src_map_id[1], &src_addr[1], &src_base[1], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    width = src_addr[0].dim_x;
+    height = src_addr[0].dim_y;
+
+    if (status == VX_SUCCESS)
+    {
+        for (y = 0; y < height; y++)
+        {
+            rows->arithmetic(x86simdRow(src_base[0], &src_addr[0], y), in0_format,
+                             x86simdRow(src_base[1], &src_addr[1], y), in1_format,
+                             x86simdRow(dst_base, &dst_addr, y), out_format, op, saturate, width);
+        }
+    }
+
+    status |= vxUnmapImagePatch(in0, src_map_id[0]);
+    status |= vxUnmapImagePatch(in1, src_map_id[1]);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
+
+// nodeless version of the Addition kernel
+vx_status vxAddition(vx_image in0, vx_image in1, vx_scalar policy_param, vx_image output)
+{
+    vx_enum policy = -1;
+    vx_status status = vxCopyScalar(policy_param, &policy, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    if (status != VX_SUCCESS)
+        return status;
+    return x86simdArithmetic(in0, in1, policy, output, X86SIMD_ARITH_ADD);
+}
+
+// nodeless version of the Subtraction kernel
+vx_status vxSubtraction(vx_image in0, vx_image in1, vx_scalar policy_param, vx_image output)
+{
+    vx_enum policy = -1;
+    vx_status status = vxCopyScalar(policy_param, &policy, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    if (status != VX_SUCCESS)
+        return status;
+    return x86simdArithmetic(in0, in1, policy, output, X86SIMD_ARITH_SUB);
+}
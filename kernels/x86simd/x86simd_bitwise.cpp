@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+// generic U8/U1 bitwise op, U1 rows run over whole bytes and only the bits of the valid region are written
+static vx_status x86simdBitwise(vx_image in1, vx_image in2, vx_image output, enum x86simd_bitwise_e op)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_uint32 y, width = 0, height = 0;
+    void *dst_base = nullptr;
+    void *src_base[2] = {nullptr, nullptr};
+    vx_imagepatch_addressing_t dst_addr, src_addr[2];
+    vx_rectangle_t rect;
+    vx_df_image format = 0;
+    vx_map_id src_map_id[2] = {0, 0};
+    vx_map_id dst_map_id = 0;
+    vx_uint8 *tmp = nullptr;
+    vx_status status = VX_SUCCESS;
+
+    status  = vxQueryImage(in1, VX_IMAGE_FORMAT, &format, sizeof(format));
+    status |= vxGetValidRegionImage(in1, &rect);
+    status |= vxMapImagePatch(in1, &rect, 0, &src_map_id[0], &src_addr[0], &src_base[0], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    if (in2)
+        status |= vxMapImagePatch(in2, &rect, 0, &src_map_id[1], &src_addr[1], &src_base[1], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    width = src_addr[0].dim_x;
+    height = src_addr[0].dim_y;
+
+    if (status == VX_SUCCESS && format == VX_DF_IMAGE_U1)
+    {
+        /* the patch starts at the byte holding the first valid bit */
+        vx_uint32 first = rect.start_x % 8;
+        vx_uint32 bytes = (width + 7) / 8;
+        tmp = (vx_uint8 *)malloc(bytes);
+        if (tmp == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+        for (y = 0; status == VX_SUCCESS && y < height; y++)
+        {
+            const vx_uint8 *a = x86simdRow(src_base[0], &src_addr[0], y);
+            const vx_uint8 *b = in2 ? x86simdRow(src_base[1], &src_addr[1], y) : a;
+            vx_uint8 *d = x86simdRow(dst_base, &dst_addr, y);
+            rows->bitwise(a, b, tmp, op, bytes);
+            for (vx_uint32 i = 0; i < bytes; i++)
+            {
+                vx_uint32 lo = i == 0 ? first : 0;
+                vx_uint32 hi = (i + 1) * 8 > width ? width - i * 8 : 8;
+                vx_uint8 mask = (vx_uint8)(((1u << hi) - 1) & ~((1u << lo) - 1));
+                d[i] = (vx_uint8)((d[i] & ~mask) | (tmp[i] & mask));
+            }
+        }
+        free(tmp);
+    }
+    else if (status == VX_SUCCESS)
+    {
+        for (y = 0; y < height; y++)
+        {
+            const vx_uint8 *a = x86simdRow(src_base[0], &src_addr[0], y);
+            rows->bitwise(a, in2 ? x86simdRow(src_base[1], &src_addr[1], y) : a,
+                          x86simdRow(dst_base, &dst_addr, y), op, width);
+        }
+    }
+
+    status |= vxUnmapImagePatch(in1, src_map_id[0]);
+    if (in2)
+        status |= vxUnmapImagePatch(in2, src_map_id[1]);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
+
+// nodeless version of the And kernel
+vx_status vxAnd(vx_image in1, vx_image in2, vx_image output)
+{
+    return x86simdBitwise(in1, in2, output, X86SIMD_BITWISE_AND);
+}
+
+// nodeless version of the Or kernel
+vx_status vxOr(vx_image in1, vx_image in2, vx_image output)
+{
+    return x86simdBitwise(in1, in2, output, X86SIMD_BITWISE_OR);
+}
+
+// nodeless version of the Xor kernel
+vx_status vxXor(vx_image in1, vx_image in2, vx_image output)
+{
+    return x86simdBitwise(in1, in2, output, X86SIMD_BITWISE_XOR);
+}
+
+// nodeless version of the Not kernel
+vx_status vxNot(vx_image input, vx_image output)
+{
+    return x86simdBitwise(input, nullptr, output, X86SIMD_BITWISE_NOT);
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+/* copies plane 0 of a single plane image into plane p of the output, the
+ * output plane is addressed in its own (subsampled) rows and columns */
+static vx_status x86simdCopyPlane(vx_image input, vx_image output, const vx_rectangle_t *rect, vx_uint32 p)
+{
+    vx_uint32 y, width, height;
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    vx_rectangle_t src_rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    status  = vxGetValidRegionImage(input, &src_rect);
+    status |= vxMapImagePatch(input, &src_rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, rect, p, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    width = (dst_addr.dim_x + dst_addr.step_x - 1) / dst_addr.step_x;
+    height = (dst_addr.dim_y + dst_addr.step_y - 1) / dst_addr.step_y;
+    if (width > src_addr.dim_x)
+        width = src_addr.dim_x;
+    if (height > src_addr.dim_y)
+        height = src_addr.dim_y;
+
+    if (status == VX_SUCCESS)
+    {
+        for (y = 0; y < height; y++)
+            memcpy(x86simdRow(dst_base, &dst_addr, y), x86simdRow(src_base, &src_addr, y), width);
+    }
+
+    status |= vxUnmapImagePatch(input, src_map_id);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
+
+// nodeless version of the ChannelCombine kernel
+vx_status vxChannelCombine(vx_image inputs[4], vx_image output)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_df_image format = 0;
+    vx_rectangle_t rect;
+    vx_uint32 p, y, numplanes = 0;
+    void *src_base[4] = {nullptr, nullptr, nullptr, nullptr};
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr[4], dst_addr;
+    vx_map_id src_map_id[4] = {0, 0, 0, 0};
+    vx_map_id dst_map_id = 0;
+    vx_uint8 *tmp = nullptr;
+    vx_status status = VX_SUCCESS;
+
+    status  = vxQueryImage(output, VX_IMAGE_FORMAT, &format, sizeof(format));
+    status |= vxGetValidRegionImage(inputs[0], &rect);
+    if (status != VX_SUCCESS)
+        return status;
+
+    if (format == VX_DF_IMAGE_YUV4 || format == VX_DF_IMAGE_IYUV)
+    {
+        for (p = 0; p < 3; p++)
+            status |= x86simdCopyPlane(inputs[p], output, &rect, p);
+        return status;
+    }
+    if (format == VX_DF_IMAGE_NV12 || format == VX_DF_IMAGE_NV21)
+    {
+        status = x86simdCopyPlane(inputs[0], output, &rect, 0);
+        if (status != VX_SUCCESS)
+            return status;
+        /* the chroma plane interleaves U and V (NV12) or V and U (NV21) */
+        for (p = 1; p < 3; p++)
+        {
+            vx_rectangle_t src_rect;
+            status |= vxGetValidRegionImage(inputs[p], &src_rect);
+            status |= vxMapImagePatch(inputs[p], &src_rect, 0, &src_map_id[p], &src_addr[p], &src_base[p], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+        }
+        status |= vxMapImagePatch(output, &rect, 1, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+        if (status == VX_SUCCESS)
+        {
+            vx_uint32 u = format == VX_DF_IMAGE_NV12 ? 1 : 2;
+            vx_uint32 width = (dst_addr.dim_x + dst_addr.step_x - 1) / dst_addr.step_x;
+            vx_uint32 height = (dst_addr.dim_y + dst_addr.step_y - 1) / dst_addr.step_y;
+            for (y = 0; y < height; y++)
+            {
+                const vx_uint8 *planes[2] = {
+                    x86simdRow(src_base[u], &src_addr[u], y),
+                    x86simdRow(src_base[3 - u], &src_addr[3 - u], y),
+                };
+                rows->interleave(planes, 2, x86simdRow(dst_base, &dst_addr, y), width);
+            }
+        }
+        for (p = 1; p < 3; p++)
+            status |= vxUnmapImagePatch(inputs[p], src_map_id[p]);
+        status |= vxUnmapImagePatch(output, dst_map_id);
+        return status;
+    }
+
+    if (format == VX_DF_IMAGE_RGB || format == VX_DF_IMAGE_RGBX || format == VX_DF_IMAGE_YUYV || format == VX_DF_IMAGE_UYVY)
+    {
+        numplanes = format == VX_DF_IMAGE_RGBX ? 4 : 3;
+        for (p = 0; p < numplanes; p++)
+        {
+            /* the chroma planes of YUYV and UYVY are half as wide as the output */
+            vx_rectangle_t src_rect = rect;
+            if (p > 0 && numplanes == 3 && format != VX_DF_IMAGE_RGB)
+                status |= vxGetValidRegionImage(inputs[p], &src_rect);
+            status |= vxMapImagePatch(inputs[p], &src_rect, 0, &src_map_id[p], &src_addr[p], &src_base[p], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+        }
+        status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    }
+    if (status == VX_SUCCESS && (format == VX_DF_IMAGE_RGB || format == VX_DF_IMAGE_RGBX))
+    {
+        for (y = 0; y < dst_addr.dim_y; y++)
+        {
+            const vx_uint8 *planes[4];
+            for (p = 0; p < numplanes; p++)
+                planes[p] = x86simdRow(src_base[p], &src_addr[p], y);
+            rows->interleave(planes, numplanes, x86simdRow(dst_base, &dst_addr, y), dst_addr.dim_x);
+        }
+    }
+    else if (status == VX_SUCCESS && (format == VX_DF_IMAGE_YUYV || format == VX_DF_IMAGE_UYVY))
+    {
+        /* pairs of pixels are Y0 U Y1 V (YUYV) or U Y0 V Y1 (UYVY): interleave U and V
+         * first, then interleave the result with Y */
+        vx_uint32 pairs = dst_addr.dim_x / 2;
+        tmp = (vx_uint8 *)malloc(pairs * 2 + 1);
+        if (tmp == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+        for (y = 0; status == VX_SUCCESS && y < dst_addr.dim_y; y++)
+        {
+            const vx_uint8 *chroma[2] = {
+                x86simdRow(src_base[1], &src_addr[1], y),
+                x86simdRow(src_base[2], &src_addr[2], y),
+            };
+            rows->interleave(chroma, 2, tmp, pairs);
+            const vx_uint8 *luma = x86simdRow(src_base[0], &src_addr[0], y);
+            const vx_uint8 *planes[2] = {
+                format == VX_DF_IMAGE_YUYV ? luma : tmp,
+                format == VX_DF_IMAGE_YUYV ? tmp : luma,
+            };
+            rows->interleave(planes, 2, x86simdRow(dst_base, &dst_addr, y), pairs * 2);
+        }
+        free(tmp);
+    }
+
+    for (p = 0; p < numplanes; p++)
+        status |= vxUnmapImagePatch(inputs[p], src_map_id[p]);
+    if (numplanes > 0)
+        status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
+
+/* picks \a component of every \a x_subsampling pixel of one plane of \a src into \a dst */
+static vx_status x86simdCopyPlaneToImage(vx_image src, vx_uint32 src_plane, vx_uint8 src_component,
+                                          vx_uint32 x_subsampling, vx_image dst)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst);
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr = {};
+    vx_imagepatch_addressing_t dst_addr = {};
+    vx_rectangle_t src_rect, dst_rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_uint32 y;
+    vx_status status = VX_SUCCESS;
+
+    status  = vxGetValidRegionImage(src, &src_rect);
+    status |= vxMapImagePatch(src, &src_rect, src_plane, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    if (status == VX_SUCCESS)
+    {
+        dst_rect = src_rect;
+        dst_rect.start_x /= VX_SCALE_UNITY / src_addr.scale_x * x_subsampling;
+        dst_rect.start_y /= VX_SCALE_UNITY / src_addr.scale_y;
+        dst_rect.end_x /= VX_SCALE_UNITY / src_addr.scale_x * x_subsampling;
+        dst_rect.end_y /= VX_SCALE_UNITY / src_addr.scale_y;
+
+        status = vxMapImagePatch(dst, &dst_rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+        if (status == VX_SUCCESS)
+        {
+            for (y = 0; y < dst_addr.dim_y; y++)
+            {
+                rows->deinterleave(x86simdRow(src_base, &src_addr, y), src_addr.stride_x * x_subsampling, src_component,
+                                   x86simdRow(dst_base, &dst_addr, y), dst_addr.dim_x);
+            }
+            status |= vxUnmapImagePatch(dst, dst_map_id);
+        }
+        status |= vxUnmapImagePatch(src, src_map_id);
+    }
+    return status;
+}
+
+// nodeless version of the ChannelExtract kernel
+vx_status vxChannelExtract(vx_image src, vx_scalar channel, vx_image dst)
+{
+    vx_enum chan = -1;
+    vx_df_image format = 0;
+    vx_uint32 cidx = 0;
+    vx_status status = VX_ERROR_INVALID_PARAMETERS;
+
+    vxCopyScalar(channel, &chan, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    vxQueryImage(src, VX_IMAGE_FORMAT, &format, sizeof(format));
+
+    switch (format)
+    {
+        case VX_DF_IMAGE_RGB:
+        case VX_DF_IMAGE_RGBX:
+            switch (chan)
+            {
+                case VX_CHANNEL_R:
+                    cidx = 0; break;
+                case VX_CHANNEL_G:
+                    cidx = 1; break;
+                case VX_CHANNEL_B:
+                    cidx = 2; break;
+                case VX_CHANNEL_A:
+                    cidx = 3; break;
+                default:
+                    return VX_ERROR_INVALID_PARAMETERS;
+            }
+            status = x86simdCopyPlaneToImage(src, 0, cidx, 1, dst);
+            break;
+        case VX_DF_IMAGE_NV12:
+        case VX_DF_IMAGE_NV21:
+            if (chan == VX_CHANNEL_Y)
+                status = x86simdCopyPlaneToImage(src, 0, 0, 1, dst);
+            else if ((chan == VX_CHANNEL_U && format == VX_DF_IMAGE_NV12) ||
+                     (chan == VX_CHANNEL_V && format == VX_DF_IMAGE_NV21))
+                status = x86simdCopyPlaneToImage(src, 1, 0, 1, dst);
+            else
+                status = x86simdCopyPlaneToImage(src, 1, 1, 1, dst);
+            break;
+        case VX_DF_IMAGE_IYUV:
+        case VX_DF_IMAGE_YUV4:
+            switch (chan)
+            {
+                case VX_CHANNEL_Y:
+                    cidx = 0; break;
+                case VX_CHANNEL_U:
+                    cidx = 1; break;
+                case VX_CHANNEL_V:
+                    cidx = 2; break;
+                default:
+                    return VX_ERROR_INVALID_PARAMETERS;
+            }
+            status = x86simdCopyPlaneToImage(src, cidx, 0, 1, dst);
+            break;
+        case VX_DF_IMAGE_YUYV:
+        case VX_DF_IMAGE_UYVY:
+            if (chan == VX_CHANNEL_Y)
+                status = x86simdCopyPlaneToImage(src, 0, format == VX_DF_IMAGE_YUYV ? 0 : 1, 1, dst);
+            else
+                status = x86simdCopyPlaneToImage(src, 0,
+                    (format == VX_DF_IMAGE_YUYV ? 1 : 0) + (chan == VX_CHANNEL_U ? 0 : 2),
+                    2, dst);
+            break;
+    }
+    return status;
+}
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+// helpers -------------------------------------------------------------------
+
+static vx_uint8 usat8(vx_int32 a)
+{
+    if (a > 255)
+        a = 255;
+    if (a < 0)
+        a = 0;
+    return (vx_uint8)a;
+}
+
+static void yuv2yuv_601to709(vx_uint8 y0, vx_uint8 cb0, vx_uint8 cr0,
+                             vx_uint8 *y1, vx_uint8 *cb1, vx_uint8 *cr1)
+{
+    vx_float64 f_y0 = (vx_float64)y0;
+    vx_float64 f_cb0 = (vx_float64)cb0;
+    vx_float64 f_cr0 = (vx_float64)cr0;
+    vx_float64 f_y1  = 1.0090*f_y0 - 0.11826430*f_cb0 - 0.2000311*f_cr0;
+    vx_float64 f_cb1 = 0.0000*f_y0 + 1.01911200*f_cb0 + 0.1146035*f_cr0;
+    vx_float64 f_cr1 = 0.0001*f_y0 + 0.07534570*f_cb0 + 1.0290932*f_cr0;
+    *y1 = usat8((vx_int32)f_y1);
+    *cb1 = usat8((vx_int32)f_cb1);
+    *cr1 = usat8((vx_int32)f_cr1);
+}
+
+/* the {V->R, U->G, V->G, U->B} coefficients of the yuv2rgb row kernel */
+static const vx_float64 x86simd_bt601[4] = {1.403f, 0.344f, 0.714f, 1.773f};
+static const vx_float64 x86simd_bt709[4] = {1.5748f, 0.1873f, 0.4681f, 1.8556f};
+
+/* repeats every pixel of a half resolution row twice */
+static void x86simdUpsample2(const vx_uint8 *half, vx_uint8 *full, vx_uint32 width)
+{
+    for (vx_uint32 x = 0; x < width; x++)
+        full[x] = half[x / 2];
+}
+
+/* the mean of each 2x2 block of two full resolution chroma rows, as RGB sources subsample */
+static void x86simdMean2x2(const vx_uint8 *top, const vx_uint8 *bottom, vx_uint8 *half, vx_uint32 half_width)
+{
+    for (vx_uint32 x = 0; x < half_width; x++)
+        half[x] = (vx_uint8)((top[2 * x] + top[2 * x + 1] + bottom[2 * x] + bottom[2 * x + 1]) / 4);
+}
+
+/* the mean of two half resolution chroma rows, as packed YUV sources subsample */
+static void x86simdMean2x1(const vx_uint8 *top, const vx_uint8 *bottom, vx_uint8 *half, vx_uint32 half_width)
+{
+    for (vx_uint32 x = 0; x < half_width; x++)
+        half[x] = (vx_uint8)((top[x] + bottom[x]) / 2);
+}
+
+/* Fills full resolution U and V rows of row \a y of a NV12, NV21, IYUV, YUYV or UYVY
+ * image. Returns the luma row, which is the plane row itself for planar formats and
+ * \a luma (filled here) for packed formats. */
+static const vx_uint8 *x86simdReadYUV(const x86simd_rows_t *rows, vx_df_image format, void *base[],
+                                      const vx_imagepatch_addressing_t addr[], vx_uint32 y, vx_uint32 width,
+                                      vx_uint8 *luma, vx_uint8 *u, vx_uint8 *v, vx_uint8 *half)
+{
+    vx_uint32 half_width = (width + 1) / 2;
+
+    if (format == VX_DF_IMAGE_NV12 || format == VX_DF_IMAGE_NV21)
+    {
+        const vx_uint8 *chroma = x86simdRow(base[1], &addr[1], y / 2);
+        rows->deinterleave(chroma, 2, format == VX_DF_IMAGE_NV12 ? 0 : 1, half, half_width);
+        x86simdUpsample2(half, u, width);
+        rows->deinterleave(chroma, 2, format == VX_DF_IMAGE_NV12 ? 1 : 0, half, half_width);
+        x86simdUpsample2(half, v, width);
+        return x86simdRow(base[0], &addr[0], y);
+    }
+    if (format == VX_DF_IMAGE_IYUV)
+    {
+        x86simdUpsample2(x86simdRow(base[1], &addr[1], y / 2), u, width);
+        x86simdUpsample2(x86simdRow(base[2], &addr[2], y / 2), v, width);
+        return x86simdRow(base[0], &addr[0], y);
+    }
+    /* YUYV and UYVY */
+    const vx_uint8 *packed = x86simdRow(base[0], &addr[0], y);
+    vx_uint32 chroma = format == VX_DF_IMAGE_YUYV ? 1 : 0;
+    rows->deinterleave(packed, 2, format == VX_DF_IMAGE_YUYV ? 0 : 1, luma, width);
+    rows->deinterleave(packed, 4, chroma, half, width / 2);
+    x86simdUpsample2(half, u, width);
+    rows->deinterleave(packed, 4, chroma + 2, half, width / 2);
+    x86simdUpsample2(half, v, width);
+    return luma;
+}
+
+// kernel --------------------------------------------------------------------
+
+// nodeless version of the ConvertColor kernel
+vx_status vxConvertColor(vx_image src, vx_image dst)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst);
+    vx_imagepatch_addressing_t src_addr[4], dst_addr[4];
+    void *src_base[4] = {nullptr};
+    void *dst_base[4] = {nullptr};
+    vx_map_id src_map_id[4] = {0, 0, 0, 0};
+    vx_map_id dst_map_id[4] = {0, 0, 0, 0};
+    vx_uint32 y, x, p;
+    vx_df_image src_format = 0, dst_format = 0;
+    vx_size src_planes = 0, dst_planes = 0;
+    vx_enum src_space = VX_COLOR_SPACE_DEFAULT;
+    vx_rectangle_t rect;
+    vx_uint8 *buf = nullptr;
+
+    vx_status status = VX_SUCCESS;
+    status |= vxQueryImage(src, VX_IMAGE_FORMAT, &src_format, sizeof(src_format));
+    status |= vxQueryImage(dst, VX_IMAGE_FORMAT, &dst_format, sizeof(dst_format));
+    status |= vxQueryImage(src, VX_IMAGE_PLANES, &src_planes, sizeof(src_planes));
+    status |= vxQueryImage(dst, VX_IMAGE_PLANES, &dst_planes, sizeof(dst_planes));
+    status |= vxQueryImage(src, VX_IMAGE_SPACE, &src_space, sizeof(src_space));
+    status |= vxGetValidRegionImage(src, &rect);
+    if (status != VX_SUCCESS || src_planes > 4 || dst_planes > 4)
+        return status != VX_SUCCESS ? status : VX_ERROR_INVALID_PARAMETERS;
+    for (p = 0; p < src_planes; p++)
+        status |= vxMapImagePatch(src, &rect, p, &src_map_id[p], &src_addr[p], &src_base[p], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    for (p = 0; p < dst_planes; p++)
+        status |= vxMapImagePatch(dst, &rect, p, &dst_map_id[p], &dst_addr[p], &dst_base[p], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    vx_uint32 width = dst_addr[0].dim_x;
+    vx_uint32 height = dst_addr[0].dim_y;
+    vx_uint32 half_width = (width + 1) / 2;
+    const vx_float64 *coeffs = (src_space == VX_COLOR_SPACE_BT601_525 || src_space == VX_COLOR_SPACE_BT601_625)
+                             ? x86simd_bt601 : x86simd_bt709;
+    vx_bool src_rgb = (src_format == VX_DF_IMAGE_RGB || src_format == VX_DF_IMAGE_RGBX) ? vx_true_e : vx_false_e;
+    vx_bool dst_rgb = (dst_format == VX_DF_IMAGE_RGB || dst_format == VX_DF_IMAGE_RGBX) ? vx_true_e : vx_false_e;
+    vx_uint32 src_step = src_format == VX_DF_IMAGE_RGBX ? 4 : 3;
+    vx_uint32 dst_step = dst_format == VX_DF_IMAGE_RGBX ? 4 : 3;
+
+    /* planar rows: r, g, b, alpha, then Y, U and V of two rows and a half row */
+    if (status == VX_SUCCESS)
+    {
+        buf = (vx_uint8 *)malloc((vx_size)width * 11 + 64);
+        if (buf == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+    if (status == VX_SUCCESS)
+    {
+        vx_uint8 *r = buf, *g = r + width, *b = g + width, *alpha = b + width;
+        vx_uint8 *lu[2] = {alpha + width, alpha + 2 * width};
+        vx_uint8 *cu[2] = {alpha + 3 * width, alpha + 4 * width};
+        vx_uint8 *cv[2] = {alpha + 5 * width, alpha + 6 * width};
+        vx_uint8 *half = alpha + 7 * width;
+        const vx_uint8 *planes[4] = {r, g, b, alpha};
+        memset(alpha, 255, width);
+
+        if (src_rgb && dst_rgb)
+        {
+            for (y = 0; y < height; y++)
+            {
+                const vx_uint8 *s = x86simdRow(src_base[0], &src_addr[0], y);
+                rows->deinterleave(s, src_step, 0, r, width);
+                rows->deinterleave(s, src_step, 1, g, width);
+                rows->deinterleave(s, src_step, 2, b, width);
+                rows->interleave(planes, dst_step, x86simdRow(dst_base[0], &dst_addr[0], y), width);
+            }
+        }
+        else if (src_rgb && dst_format == VX_DF_IMAGE_YUV4)
+        {
+            for (y = 0; y < height; y++)
+            {
+                const vx_uint8 *s = x86simdRow(src_base[0], &src_addr[0], y);
+                rows->deinterleave(s, src_step, 0, r, width);
+                rows->deinterleave(s, src_step, 1, g, width);
+                rows->deinterleave(s, src_step, 2, b, width);
+                rows->rgb2yuv(r, g, b, x86simdRow(dst_base[0], &dst_addr[0], y),
+                              x86simdRow(dst_base[1], &dst_addr[1], y), x86simdRow(dst_base[2], &dst_addr[2], y), width);
+            }
+        }
+        else if (src_rgb && (dst_format == VX_DF_IMAGE_NV12 || dst_format == VX_DF_IMAGE_IYUV))
+        {
+            /* the chroma of each 2x2 block is the mean of its four pixels */
+            for (y = 0; y + 1 < height; y += 2)
+            {
+                for (vx_uint32 i = 0; i < 2; i++)
+                {
+                    const vx_uint8 *s = x86simdRow(src_base[0], &src_addr[0], y + i);
+                    rows->deinterleave(s, src_step, 0, r, width);
+                    rows->deinterleave(s, src_step, 1, g, width);
+                    rows->deinterleave(s, src_step, 2, b, width);
+                    rows->rgb2yuv(r, g, b, x86simdRow(dst_base[0], &dst_addr[0], y + i), cu[i], cv[i], width);
+                }
+                if (dst_format == VX_DF_IMAGE_IYUV)
+                {
+                    x86simdMean2x2(cu[0], cu[1], x86simdRow(dst_base[1], &dst_addr[1], y / 2), width / 2);
+                    x86simdMean2x2(cv[0], cv[1], x86simdRow(dst_base[2], &dst_addr[2], y / 2), width / 2);
+                }
+                else
+                {
+                    x86simdMean2x2(cu[0], cu[1], lu[0], width / 2);
+                    x86simdMean2x2(cv[0], cv[1], lu[1], width / 2);
+                    const vx_uint8 *chroma[2] = {lu[0], lu[1]};
+                    rows->interleave(chroma, 2, x86simdRow(dst_base[1], &dst_addr[1], y / 2), width / 2);
+                }
+            }
+        }
+        else if (dst_rgb && (src_format == VX_DF_IMAGE_NV12 || src_format == VX_DF_IMAGE_NV21 ||
+                             src_format == VX_DF_IMAGE_IYUV || src_format == VX_DF_IMAGE_YUYV ||
+                             src_format == VX_DF_IMAGE_UYVY))
+        {
+            for (y = 0; y < height; y++)
+            {
+                const vx_uint8 *luma = x86simdReadYUV(rows, src_format, src_base, src_addr, y, width,
+                                                      lu[0], cu[0], cv[0], half);
+                rows->yuv2rgb(luma, cu[0], cv[0], r, g, b, coeffs, width);
+                rows->interleave(planes, dst_step, x86simdRow(dst_base[0], &dst_addr[0], y), width);
+            }
+        }
+        else if ((src_format == VX_DF_IMAGE_NV12 || src_format == VX_DF_IMAGE_NV21) &&
+                 (dst_format == VX_DF_IMAGE_NV12 || dst_format == VX_DF_IMAGE_NV21))
+        {
+            /* every pixel rewrites the chroma of its block, so the last pixel of the block wins */
+            for (y = 0; y < height; y++)
+            {
+                const vx_uint8 *luma = x86simdRow(src_base[0], &src_addr[0], y);
+                const vx_uint8 *cbcr = x86simdRow(src_base[1], &src_addr[1], y / 2);
+                vx_uint8 *yout = x86simdRow(dst_base[0], &dst_addr[0], y);
+                vx_uint8 *crcb = x86simdRow(dst_base[1], &dst_addr[1], y / 2);
+                for (x = 0; x < width; x++)
+                {
+                    const vx_uint8 *c = cbcr + (x / 2) * 2;
+                    vx_uint8 *d = crcb + (x / 2) * 2;
+                    yuv2yuv_601to709(luma[x], c[0], c[1], &yout[x], &d[1], &d[0]);
+                }
+            }
+        }
+        else if (dst_format == VX_DF_IMAGE_YUV4 &&
+                 (src_format == VX_DF_IMAGE_NV12 || src_format == VX_DF_IMAGE_NV21 ||
+                  src_format == VX_DF_IMAGE_YUYV || src_format == VX_DF_IMAGE_UYVY))
+        {
+            for (y = 0; y < height; y++)
+            {
+                vx_uint8 *yout = x86simdRow(dst_base[0], &dst_addr[0], y);
+                const vx_uint8 *luma = x86simdReadYUV(rows, src_format, src_base, src_addr, y, width, yout,
+                                                      x86simdRow(dst_base[1], &dst_addr[1], y),
+                                                      x86simdRow(dst_base[2], &dst_addr[2], y), half);
+                if (luma != yout)
+                    memcpy(yout, luma, width);
+            }
+        }
+        else if (src_format == VX_DF_IMAGE_IYUV && dst_format == VX_DF_IMAGE_YUV4)
+        {
+            for (y = 0; y < height; y++)
+            {
+                memcpy(x86simdRow(dst_base[0], &dst_addr[0], y), x86simdRow(src_base[0], &src_addr[0], y), width);
+                x86simdUpsample2(x86simdRow(src_base[1], &src_addr[1], y / 2), x86simdRow(dst_base[1], &dst_addr[1], y), width);
+                x86simdUpsample2(x86simdRow(src_base[2], &src_addr[2], y / 2), x86simdRow(dst_base[2], &dst_addr[2], y), width);
+            }
+        }
+        else if ((src_format == VX_DF_IMAGE_NV12 || src_format == VX_DF_IMAGE_NV21) && dst_format == VX_DF_IMAGE_IYUV)
+        {
+            for (y = 0; y < height; y++)
+                memcpy(x86simdRow(dst_base[0], &dst_addr[0], y), x86simdRow(src_base[0], &src_addr[0], y), width);
+            for (y = 0; y < (height + 1) / 2; y++)
+            {
+                const vx_uint8 *chroma = x86simdRow(src_base[1], &src_addr[1], y);
+                rows->deinterleave(chroma, 2, src_format == VX_DF_IMAGE_NV12 ? 0 : 1, x86simdRow(dst_base[1], &dst_addr[1], y), half_width);
+                rows->deinterleave(chroma, 2, src_format == VX_DF_IMAGE_NV12 ? 1 : 0, x86simdRow(dst_base[2], &dst_addr[2], y), half_width);
+            }
+        }
+        else if (src_format == VX_DF_IMAGE_IYUV && dst_format == VX_DF_IMAGE_NV12)
+        {
+            for (y = 0; y < height; y++)
+                memcpy(x86simdRow(dst_base[0], &dst_addr[0], y), x86simdRow(src_base[0], &src_addr[0], y), width);
+            for (y = 0; y < (height + 1) / 2; y++)
+            {
+                const vx_uint8 *chroma[2] = {x86simdRow(src_base[1], &src_addr[1], y), x86simdRow(src_base[2], &src_addr[2], y)};
+                rows->interleave(chroma, 2, x86simdRow(dst_base[1], &dst_addr[1], y), half_width);
+            }
+        }
+        else if ((src_format == VX_DF_IMAGE_YUYV || src_format == VX_DF_IMAGE_UYVY) &&
+                 (dst_format == VX_DF_IMAGE_NV12 || dst_format == VX_DF_IMAGE_IYUV))
+        {
+            /* the chroma of each block is the mean of the two rows */
+            vx_uint32 coff = src_format == VX_DF_IMAGE_YUYV ? 1 : 0;
+            for (y = 0; y + 1 < height; y += 2)
+            {
+                for (vx_uint32 i = 0; i < 2; i++)
+                {
+                    const vx_uint8 *packed = x86simdRow(src_base[0], &src_addr[0], y + i);
+                    rows->deinterleave(packed, 2, 1 - coff, x86simdRow(dst_base[0], &dst_addr[0], y + i), width);
+                    rows->deinterleave(packed, 4, coff, cu[i], width / 2);
+                    rows->deinterleave(packed, 4, coff + 2, cv[i], width / 2);
+                }
+                if (dst_format == VX_DF_IMAGE_IYUV)
+                {
+                    x86simdMean2x1(cu[0], cu[1], x86simdRow(dst_base[1], &dst_addr[1], y / 2), width / 2);
+                    x86simdMean2x1(cv[0], cv[1], x86simdRow(dst_base[2], &dst_addr[2], y / 2), width / 2);
+                }
+                else
+                {
+                    x86simdMean2x1(cu[0], cu[1], lu[0], width / 2);
+                    x86simdMean2x1(cv[0], cv[1], lu[1], width / 2);
+                    const vx_uint8 *chroma[2] = {lu[0], lu[1]};
+                    rows->interleave(chroma, 2, x86simdRow(dst_base[1], &dst_addr[1], y / 2), width / 2);
+                }
+            }
+        }
+        free(buf);
+    }
+
+    for (p = 0; p < src_planes; p++)
+        status |= vxUnmapImagePatch(src, src_map_id[p]);
+    for (p = 0; p < dst_planes; p++)
+        status |= vxUnmapImagePatch(dst, dst_map_id[p]);
+
+    return status;
+}
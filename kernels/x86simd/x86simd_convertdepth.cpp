@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+#include <VX/vx_lib_extras.h>
+
+// nodeless version of the ConvertDepth kernel
+vx_status vxConvertDepth(vx_image input, vx_image output, vx_scalar spol, vx_scalar sshf)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_uint32 y, x, width = 0, height = 0;
+    void *dst_base = nullptr;
+    void *src_base = nullptr;
+    vx_imagepatch_addressing_t dst_addr, src_addr;
+    vx_rectangle_t rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_df_image format[2] = {0, 0};
+    vx_enum policy = 0;
+    vx_int32 shift = 0;
+    vx_uint8 *bytes = nullptr;
+    vx_status status = VX_SUCCESS;
+
+    status |= vxCopyScalar(spol, &policy, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxCopyScalar(sshf, &shift, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxQueryImage(input, VX_IMAGE_FORMAT, &format[0], sizeof(format[0]));
+    status |= vxQueryImage(output, VX_IMAGE_FORMAT, &format[1], sizeof(format[1]));
+    status |= vxGetValidRegionImage(input, &rect);
+    status |= vxMapImagePatch(input, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    width  = (format[0] == VX_DF_IMAGE_U1) ? src_addr.dim_x - rect.start_x % 8 : src_addr.dim_x;
+    height = src_addr.dim_y;
+
+    if (status == VX_SUCCESS && (format[0] == VX_DF_IMAGE_U1 || format[1] == VX_DF_IMAGE_U1))
+    {
+        bytes = (vx_uint8 *)malloc(width);
+        if (bytes == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+
+    for (y = 0; status == VX_SUCCESS && y < height; y++)
+    {
+        vx_uint8 *src = x86simdRow(src_base, &src_addr, y);
+        vx_uint8 *dst = x86simdRow(dst_base, &dst_addr, y);
+
+        if (format[0] == VX_DF_IMAGE_U1)
+        {
+            /* set bits become the all ones value of the output */
+            x86simdUnpackU1(src, rect.start_x % 8, bytes, width);
+            for (x = 0; x < width; x++)
+            {
+                vx_uint32 v = bytes[x] ? 0xFFFFFFFFu : 0u;
+                if (format[1] == VX_DF_IMAGE_U8)
+                    dst[x] = (vx_uint8)v;
+                else if (format[1] == VX_DF_IMAGE_U16 || format[1] == VX_DF_IMAGE_S16)
+                    ((vx_uint16 *)dst)[x] = (vx_uint16)v;
+                else
+                    ((vx_uint32 *)dst)[x] = v;
+            }
+        }
+        else if (format[1] == VX_DF_IMAGE_U1)
+        {
+            for (x = 0; x < width; x++)
+            {
+                if (format[0] == VX_DF_IMAGE_U8)
+                    bytes[x] = src[x];
+                else if (format[0] == VX_DF_IMAGE_U16 || format[0] == VX_DF_IMAGE_S16)
+                    bytes[x] = ((vx_uint16 *)src)[x] != 0;
+                else
+                    bytes[x] = ((vx_uint32 *)src)[x] != 0;
+            }
+            x86simdPackU1(bytes, dst, rect.start_x % 8, width);
+        }
+        else if (format[0] == VX_DF_IMAGE_F32)
+        {
+            for (x = 0; x < width; x++)
+            {
+                vx_float32 pf = floorf(log10f(((vx_float32 *)src)[x]));
+                vx_int32 p32 = (vx_int32)pf;
+                vx_uint8 p8 = (vx_uint8)(p32 > 255 ? 255 : (p32 < 0 ? 0 : p32));
+                dst[x] = (vx_uint8)(p8 << shift);
+            }
+        }
+        else
+        {
+            rows->convertdepth(src, format[0], dst, format[1], shift,
+                               policy == VX_CONVERT_POLICY_SATURATE ? vx_true_e : vx_false_e, width);
+        }
+    }
+    free(bytes);
+
+    status |= vxUnmapImagePatch(input, src_map_id);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
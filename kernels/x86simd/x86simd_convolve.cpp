@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+// nodeless version of the Convolve kernel
+vx_status vxConvolve(vx_image src, vx_convolution conv, vx_image dst, vx_border_t *bordermode)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst);
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    vx_rectangle_t rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_size conv_width = 0, conv_height = 0;
+    vx_uint32 conv_radius_x, conv_radius_y;
+    vx_int16 conv_mat[X86SIMD_MAX_CONVOLUTION_DIM * X86SIMD_MAX_CONVOLUTION_DIM] = {0};
+    vx_int16 coeffs[X86SIMD_MAX_CONVOLUTION_DIM * X86SIMD_MAX_CONVOLUTION_DIM] = {0};
+    vx_uint32 scale = 1, shift = 0;
+    vx_df_image src_format = 0;
+    vx_df_image dst_format = 0;
+    vx_uint32 low_x, low_y, high_x, high_y;
+    vx_uint8 *buffer = nullptr;
+    vx_status status = VX_SUCCESS;
+
+    status |= vxQueryImage(src, VX_IMAGE_FORMAT, &src_format, sizeof(src_format));
+    status |= vxQueryImage(dst, VX_IMAGE_FORMAT, &dst_format, sizeof(dst_format));
+    status |= vxQueryConvolution(conv, VX_CONVOLUTION_COLUMNS, &conv_width, sizeof(conv_width));
+    status |= vxQueryConvolution(conv, VX_CONVOLUTION_ROWS, &conv_height, sizeof(conv_height));
+    status |= vxQueryConvolution(conv, VX_CONVOLUTION_SCALE, &scale, sizeof(scale));
+    status |= vxCopyConvolutionCoefficients(conv, conv_mat, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    if (status != VX_SUCCESS)
+        return status;
+    if (conv_width > X86SIMD_MAX_CONVOLUTION_DIM || conv_height > X86SIMD_MAX_CONVOLUTION_DIM || scale == 0 ||
+        (scale & (scale - 1)) != 0)
+        return VX_ERROR_INVALID_PARAMETERS;
+    conv_radius_x = (vx_uint32)conv_width / 2;
+    conv_radius_y = (vx_uint32)conv_height / 2;
+    while ((1u << shift) < scale)
+        shift++;
+
+    /* the C model walks the matrix backwards against the window, flip it once */
+    for (vx_uint32 i = 0; i < conv_width * conv_height; i++)
+        coeffs[i] = conv_mat[conv_width * conv_height - 1 - i];
+
+    status |= vxGetValidRegionImage(src, &rect);
+    status |= vxMapImagePatch(src, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    if (bordermode->mode == VX_BORDER_UNDEFINED)
+    {
+        low_x = conv_radius_x;
+        high_x = ((src_addr.dim_x >= conv_radius_x) ? src_addr.dim_x - conv_radius_x : 0);
+        low_y = conv_radius_y;
+        high_y = ((src_addr.dim_y >= conv_radius_y) ? src_addr.dim_y - conv_radius_y : 0);
+    }
+    else
+    {
+        low_x = 0;
+        high_x = src_addr.dim_x;
+        low_y = 0;
+        high_y = src_addr.dim_y;
+    }
+
+    if (status == VX_SUCCESS && low_x < high_x && low_y < high_y)
+    {
+        /* one padded row per matrix row, row sy of the source lives in ring slot sy mod height */
+        vx_size elem = src_format == VX_DF_IMAGE_S16 ? sizeof(vx_int16) : sizeof(vx_uint8);
+        vx_size padded = (src_addr.dim_x + 2 * conv_radius_x) * elem;
+        buffer = (vx_uint8 *)malloc(conv_height * padded);
+        if (buffer == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+        for (vx_uint32 y = low_y; status == VX_SUCCESS && y < high_y; y++)
+        {
+            const void *window[X86SIMD_MAX_CONVOLUTION_DIM];
+            vx_int32 first = (vx_int32)y - (vx_int32)conv_radius_y;
+            vx_int32 last = (vx_int32)y + (vx_int32)conv_radius_y;
+            /* fill all rows of the window the first time, then only the new bottom row */
+            for (vx_int32 sy = (y == low_y ? first : last); sy <= last; sy++)
+            {
+                vx_uint32 slot = (vx_uint32)(sy + (vx_int32)conv_height) % conv_height;
+                x86simdBorderRow(src_base, &src_addr, src_format, 0, sy, conv_radius_x, bordermode, buffer + slot * padded);
+            }
+            for (vx_uint32 ky = 0; ky < conv_height; ky++)
+            {
+                vx_uint32 slot = (vx_uint32)(first + (vx_int32)ky + (vx_int32)conv_height) % conv_height;
+                window[ky] = buffer + slot * padded + low_x * elem;
+            }
+            rows->convolve(window, src_format, coeffs, (vx_uint32)conv_width, (vx_uint32)conv_height, shift,
+                           x86simdRow(dst_base, &dst_addr, y) + low_x * (dst_format == VX_DF_IMAGE_S16 ? 2 : 1),
+                           dst_format, high_x - low_x);
+        }
+        free(buffer);
+    }
+
+    status |= vxUnmapImagePatch(src, src_map_id);
+    status |= vxUnmapImagePatch(dst, dst_map_id);
+
+    return status;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*!
+ * \file
+ * \brief Selects the row kernels of the x86 SIMD target.
+ * \details The context reads the CPU variant from cpuid once when it is
+ * created, every kernel looks the table of that variant up from the context of
+ * the image it writes. Only the table of that variant is ever called, so the
+ * wider instruction sets stay out of the code a smaller host runs, and contexts
+ * created with different variants never share a selection.
+ */
+
+#include "x86simd_rows.h"
+
+const x86simd_rows_t *x86simdRowsForVariant(vx_enum variant)
+{
+    static const x86simd_rows_t *const tables[] = {
+        &x86simd_rows_scalar,
+        &x86simd_rows_sse42,
+        &x86simd_rows_avx2,
+        &x86simd_rows_avx512,
+    };
+    for (const x86simd_rows_t *table : tables)
+    {
+        if (table->variant == variant)
+        {
+            return table;
+        }
+    }
+    return nullptr;
+}
+
+const x86simd_rows_t *x86simdRows(vx_reference ref)
+{
+    vx_enum variant = VX_CPU_VARIANT_SCALAR;
+    if (vxQueryContext(vxGetContext(ref), VX_CONTEXT_CPU_VARIANT, &variant, sizeof(variant)) != VX_SUCCESS)
+    {
+        variant = VX_CPU_VARIANT_SCALAR;
+    }
+    const x86simd_rows_t *table = x86simdRowsForVariant(variant);
+    return table ? table : &x86simd_rows_scalar;
+}
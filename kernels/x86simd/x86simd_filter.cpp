@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+vx_status x86simdFilter3x3(vx_image src, vx_image dst, const vx_border_t *borders, enum x86simd_filter_e op)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst);
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_df_image format = 0;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    vx_rectangle_t rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_uint32 low_x = 0, low_y = 0, high_x, high_y, shift_x_u1;
+    vx_uint8 *buffer = nullptr;
+
+    vx_status status = vxGetValidRegionImage(src, &rect);
+    status |= vxQueryImage(src, VX_IMAGE_FORMAT, &format, sizeof(format));
+    if (status != VX_SUCCESS)
+        return status;
+    /* the C model reads U1 images as U8 for these two, which has no meaning to match */
+    if (format == VX_DF_IMAGE_U1 && (op == X86SIMD_FILTER_BOX || op == X86SIMD_FILTER_GAUSSIAN))
+        return VX_ERROR_NOT_SUPPORTED;
+
+    status |= vxMapImagePatch(src, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    shift_x_u1 = (format == VX_DF_IMAGE_U1) ? rect.start_x % 8 : 0;
+    high_x = src_addr.dim_x - shift_x_u1;   // U1 addressing rounds down imagepatch start_x to nearest byte boundary
+    high_y = src_addr.dim_y;
+
+    if (borders->mode == VX_BORDER_UNDEFINED)
+    {
+        ++low_x; --high_x;
+        ++low_y; --high_y;
+    }
+
+    if (status == VX_SUCCESS && low_x < high_x && low_y < high_y)
+    {
+        /* three padded source rows rotating down the image, and the unpacked output of U1 rows */
+        vx_uint32 width = high_x - low_x;
+        vx_uint32 padded = src_addr.dim_x - shift_x_u1 + 2;
+        buffer = (vx_uint8 *)malloc(3 * padded + width);
+        if (buffer == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+        if (status == VX_SUCCESS)
+        {
+            vx_uint8 *ring[3] = { buffer, buffer + padded, buffer + 2 * padded };
+            vx_uint8 *out = buffer + 3 * padded;
+            for (vx_uint32 k = 0; k < 2; k++)
+                x86simdBorderRow(src_base, &src_addr, format, shift_x_u1, (vx_int32)low_y - 1 + (vx_int32)k, 1, borders, ring[k + 1]);
+            for (vx_uint32 y = low_y; y < high_y; y++)
+            {
+                vx_uint8 *next = ring[0];
+                ring[0] = ring[1];
+                ring[1] = ring[2];
+                ring[2] = next;
+                x86simdBorderRow(src_base, &src_addr, format, shift_x_u1, (vx_int32)y + 1, 1, borders, next);
+
+                const vx_uint8 *window[3] = { ring[0] + low_x, ring[1] + low_x, ring[2] + low_x };
+                vx_uint8 *dst_row = x86simdRow(dst_base, &dst_addr, y);
+                if (format == VX_DF_IMAGE_U1)
+                {
+                    rows->filter3x3(window, out, op, width);
+                    x86simdPackU1(out, dst_row, shift_x_u1 + low_x, width);
+                }
+                else
+                {
+                    rows->filter3x3(window, dst_row + low_x, op, width);
+                }
+            }
+        }
+        free(buffer);
+    }
+
+    status |= vxUnmapImagePatch(src, src_map_id);
+    status |= vxUnmapImagePatch(dst, dst_map_id);
+
+    return status;
+}
+
+// nodeless version of the Median3x3 kernel
+vx_status vxMedian3x3(vx_image src, vx_image dst, vx_border_t *bordermode)
+{
+    return x86simdFilter3x3(src, dst, bordermode, X86SIMD_FILTER_MEDIAN);
+}
+
+// nodeless version of the Box3x3 kernel
+vx_status vxBox3x3(vx_image src, vx_image dst, vx_border_t *bordermode)
+{
+    return x86simdFilter3x3(src, dst, bordermode, X86SIMD_FILTER_BOX);
+}
+
+// nodeless version of the Gaussian3x3 kernel
+vx_status vxGaussian3x3(vx_image src, vx_image dst, vx_border_t *bordermode)
+{
+    return x86simdFilter3x3(src, dst, bordermode, X86SIMD_FILTER_GAUSSIAN);
+}
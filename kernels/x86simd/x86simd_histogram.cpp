@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+/* Counting goes through four interleaved sub-histograms so that runs of equal
+ * pixels do not serialize on the same counter, and U8/U16 pixels go through a
+ * table of their bin (or -1 when they are outside the distribution).
+ */
+
+#define X86SIMD_SUB_HISTOGRAMS (4)
+
+// nodeless version of the Histogram kernel
+vx_status vxHistogram(vx_image src, vx_distribution dist)
+{
+    vx_rectangle_t src_rect;
+    vx_imagepatch_addressing_t src_addr = VX_IMAGEPATCH_ADDR_INIT;
+    void *src_base = nullptr;
+    void *dist_ptr = nullptr;
+    vx_df_image format = 0;
+    vx_int32 offset = 0;
+    vx_uint32 range = 0;
+    vx_size numBins = 0;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_int32 *bins = nullptr;
+    vx_uint32 *counts = nullptr;
+    vx_status status = VX_SUCCESS;
+
+    vxQueryImage(src, VX_IMAGE_FORMAT, &format, sizeof(format));
+    vxQueryDistribution(dist, VX_DISTRIBUTION_BINS, &numBins, sizeof(numBins));
+    vxQueryDistribution(dist, VX_DISTRIBUTION_RANGE, &range, sizeof(range));
+    vxQueryDistribution(dist, VX_DISTRIBUTION_OFFSET, &offset, sizeof(offset));
+
+    status = vxGetValidRegionImage(src, &src_rect);
+    status |= vxMapImagePatch(src, &src_rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapDistribution(dist, &dst_map_id, &dist_ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, 0);
+
+    if (status == VX_SUCCESS)
+    {
+        vx_uint32 values = format == VX_DF_IMAGE_U16 ? 65536u : 256u;
+        bins = (vx_int32 *)malloc(values * sizeof(vx_int32));
+        counts = (vx_uint32 *)calloc(X86SIMD_SUB_HISTOGRAMS * numBins, sizeof(vx_uint32));
+        if (bins == nullptr || counts == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+    if (status == VX_SUCCESS)
+    {
+        vx_int32 *dist_tmp = (vx_int32 *)dist_ptr;
+        vx_uint32 values = format == VX_DF_IMAGE_U16 ? 65536u : 256u;
+
+        /* the bin of every pixel value, with the arithmetic of the C model */
+        for (vx_uint32 pixel = 0; pixel < values; pixel++)
+        {
+            bins[pixel] = -1;
+            if (((vx_size)offset <= (vx_size)pixel) && ((vx_size)pixel < (vx_size)(offset + range)))
+                bins[pixel] = (vx_int32)((pixel - (vx_uint16)offset) * numBins / range);
+        }
+
+        for (vx_uint32 y = 0; y < src_addr.dim_y; y++)
+        {
+            const vx_uint8 *row = x86simdRow(src_base, &src_addr, y);
+            for (vx_uint32 x = 0; x < src_addr.dim_x; x++)
+            {
+                vx_uint32 pixel = format == VX_DF_IMAGE_U16 ? ((const vx_uint16 *)row)[x] : row[x];
+                vx_int32 bin = bins[pixel];
+                if (bin >= 0)
+                    counts[(x % X86SIMD_SUB_HISTOGRAMS) * numBins + bin]++;
+            }
+        }
+
+        for (vx_size b = 0; b < numBins; b++)
+        {
+            vx_uint32 sum = 0;
+            for (vx_uint32 k = 0; k < X86SIMD_SUB_HISTOGRAMS; k++)
+                sum += counts[k * numBins + b];
+            dist_tmp[b] = (vx_int32)sum;
+        }
+    }
+    free(bins);
+    free(counts);
+
+    status |= vxUnmapDistribution(dist, dst_map_id);
+    status |= vxUnmapImagePatch(src, src_map_id);
+
+    return status;
+}
+
+// nodeless version of the EqualizeHist kernel
+vx_status vxEqualizeHist(vx_image src, vx_image dst)
+{
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_imagepatch_addressing_t dst_addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_rectangle_t rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    status = vxGetValidRegionImage(src, &rect);
+    status |= vxMapImagePatch(src, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    if (status == VX_SUCCESS)
+    {
+        vx_uint32 hist[X86SIMD_SUB_HISTOGRAMS][256] = {{0}};
+        vx_uint32 cdf[256] = {0};
+        vx_uint8 lut[256];
+        vx_uint32 sum = 0, div;
+        vx_uint32 minv = 0xFF;
+
+        for (vx_uint32 y = 0; y < src_addr.dim_y; y++)
+        {
+            const vx_uint8 *row = x86simdRow(src_base, &src_addr, y);
+            for (vx_uint32 x = 0; x < src_addr.dim_x; x++)
+                hist[x % X86SIMD_SUB_HISTOGRAMS][row[x]]++;
+        }
+        for (vx_uint32 x = 0; x < 256; x++)
+        {
+            for (vx_uint32 k = 0; k < X86SIMD_SUB_HISTOGRAMS; k++)
+                sum += hist[k][x];
+            cdf[x] = sum;
+            if (minv == 0xFF && sum != 0)
+                minv = x;
+        }
+        div = (src_addr.dim_x * src_addr.dim_y) - cdf[minv];
+        for (vx_uint32 x = 0; x < 256; x++)
+        {
+            if (div > 0)
+            {
+                uint32_t cdfx = cdf[x] - cdf[minv];
+                vx_float32 p = (vx_float32)cdfx / (vx_float32)div;
+                lut[x] = (uint8_t)(p * 255.0f + 0.5f);
+            }
+            else
+            {
+                lut[x] = (vx_uint8)x;
+            }
+        }
+
+        for (vx_uint32 y = 0; y < src_addr.dim_y; y++)
+        {
+            const vx_uint8 *src_row = x86simdRow(src_base, &src_addr, y);
+            vx_uint8 *dst_row = x86simdRow(dst_base, &dst_addr, y);
+            for (vx_uint32 x = 0; x < src_addr.dim_x; x++)
+                dst_row[x] = lut[src_row[x]];
+        }
+    }
+
+    status |= vxUnmapImagePatch(src, src_map_id);
+    status |= vxUnmapImagePatch(dst, dst_map_id);
+
+    return status;
+}
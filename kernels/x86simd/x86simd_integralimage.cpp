@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the IntegralImage kernel
+vx_status vxIntegralImage(vx_image src, vx_image dst)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst);
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_imagepatch_addressing_t dst_addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_rectangle_t rect;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    status = vxGetValidRegionImage(src, &rect);
+    status |= vxMapImagePatch(src, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    for (vx_uint32 y = 0; (y < src_addr.dim_y) && (status == VX_SUCCESS); y++)
+    {
+        const vx_uint32 *prev = y ? (const vx_uint32 *)x86simdRow(dst_base, &dst_addr, y - 1) : nullptr;
+        rows->integral(x86simdRow(src_base, &src_addr, y), prev, (vx_uint32 *)x86simdRow(dst_base, &dst_addr, y), src_addr.dim_x);
+    }
+
+    status |= vxUnmapImagePatch(src, src_map_id);
+    status |= vxUnmapImagePatch(dst, dst_map_id);
+
+    return status;
+}
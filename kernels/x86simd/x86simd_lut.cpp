@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+/* A table lookup has no gather before AVX-512 VBMI, the rows are plain loads. */
+
+// nodeless version of the TableLookup kernel
+vx_status vxTableLookup(vx_image src, vx_lut lut, vx_image dst)
+{
+    vx_enum type = 0;
+    vx_rectangle_t rect;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    void *src_base = nullptr, *dst_base = nullptr, *lut_ptr = nullptr;
+    vx_map_id src_map_id = 0, dst_map_id = 0, lut_map_id = 0;
+    vx_size count = 0;
+    vx_uint32 offset = 0;
+    vx_status status = VX_SUCCESS;
+
+    vxQueryLUT(lut, VX_LUT_TYPE, &type, sizeof(type));
+    vxQueryLUT(lut, VX_LUT_COUNT, &count, sizeof(count));
+    vxQueryLUT(lut, VX_LUT_OFFSET, &offset, sizeof(offset));
+    status = vxGetValidRegionImage(src, &rect);
+    status |= vxMapImagePatch(src, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapLUT(lut, &lut_map_id, &lut_ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0);
+
+    for (vx_uint32 y = 0; (y < src_addr.dim_y) && (status == VX_SUCCESS); y++)
+    {
+        const vx_uint8 *src_row = x86simdRow(src_base, &src_addr, y);
+        vx_uint8 *dst_row = x86simdRow(dst_base, &dst_addr, y);
+        if (type == VX_TYPE_UINT8)
+        {
+            const vx_uint8 *table = (const vx_uint8 *)lut_ptr;
+            for (vx_uint32 x = 0; x < src_addr.dim_x; x++)
+            {
+                vx_int32 index = (vx_int32)offset + (vx_int32)src_row[x];
+                if (index >= 0 && index < (vx_int32)count)
+                    dst_row[x] = table[index];
+            }
+        }
+        else if (type == VX_TYPE_INT16)
+        {
+            const vx_int16 *table = (const vx_int16 *)lut_ptr;
+            for (vx_uint32 x = 0; x < src_addr.dim_x; x++)
+            {
+                vx_int32 index = (vx_int32)offset + (vx_int32)((const vx_int16 *)src_row)[x];
+                if (index >= 0 && index < (vx_int32)count)
+                    ((vx_int16 *)dst_row)[x] = table[index];
+            }
+        }
+    }
+
+    status |= vxUnmapLUT(lut, lut_map_id);
+    status |= vxUnmapImagePatch(src, src_map_id);
+    status |= vxUnmapImagePatch(dst, dst_map_id);
+
+    return status;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the Magnitude kernel
+vx_status vxMagnitude(vx_image grad_x, vx_image grad_y, vx_image output)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_uint32 y;
+    vx_df_image format = 0;
+    void *dst_base = nullptr;
+    void *src_base_x = nullptr;
+    void *src_base_y = nullptr;
+    vx_imagepatch_addressing_t src_addr_x, src_addr_y, dst_addr;
+    vx_rectangle_t rect;
+    vx_map_id map_id_x = 0, map_id_y = 0, dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    if (grad_x == 0 || grad_y == 0)
+        return VX_ERROR_INVALID_PARAMETERS;
+
+    vxQueryImage(output, VX_IMAGE_FORMAT, &format, sizeof(format));
+    status  = vxGetValidRegionImage(grad_x, &rect);
+    status |= vxMapImagePatch(grad_x, &rect, 0, &map_id_x, &src_addr_x, &src_base_x, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(grad_y, &rect, 0, &map_id_y, &src_addr_y, &src_base_y, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    if (status == VX_SUCCESS)
+    {
+        for (y = 0; y < src_addr_x.dim_y; y++)
+        {
+            rows->magnitude((const vx_int16 *)x86simdRow(src_base_x, &src_addr_x, y),
+                            (const vx_int16 *)x86simdRow(src_base_y, &src_addr_y, y),
+                            x86simdRow(dst_base, &dst_addr, y), format, src_addr_x.dim_x);
+        }
+    }
+
+    status |= vxUnmapImagePatch(grad_x, map_id_x);
+    status |= vxUnmapImagePatch(grad_y, map_id_y);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the Min kernel
+vx_status vxMin(vx_image in0, vx_image in1, vx_image output)
+{
+    return x86simdArithmetic(in0, in1, VX_CONVERT_POLICY_WRAP, output, X86SIMD_ARITH_MIN);
+}
+
+// nodeless version of the Max kernel
+vx_status vxMax(vx_image in0, vx_image in1, vx_image output)
+{
+    return x86simdArithmetic(in0, in1, VX_CONVERT_POLICY_WRAP, output, X86SIMD_ARITH_MAX);
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the Erode3x3 kernel
+vx_status vxErode3x3(vx_image src, vx_image dst, vx_border_t *bordermode)
+{
+    return x86simdFilter3x3(src, dst, bordermode, X86SIMD_FILTER_ERODE);
+}
+
+// nodeless version of the Dilate3x3 kernel
+vx_status vxDilate3x3(vx_image src, vx_image dst, vx_border_t *bordermode)
+{
+    return x86simdFilter3x3(src, dst, bordermode, X86SIMD_FILTER_DILATE);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the Multiply kernel, the rounding policy is ignored like in the C model
+vx_status vxMultiply(vx_image in0, vx_image in1, vx_scalar scale_param, vx_scalar opolicy_param, vx_scalar rpolicy_param, vx_image output)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_float32 scale = 0.0f;
+    vx_enum overflow_policy = -1;
+    vx_enum rounding_policy = -1;
+    vx_uint32 y;
+    void *dst_base = nullptr;
+    void *src_base[2] = {nullptr, nullptr};
+    vx_imagepatch_addressing_t dst_addr, src_addr[2];
+    vx_rectangle_t rect;
+    vx_df_image in0_format = 0, in1_format = 0, out_format = 0;
+    vx_map_id src_map_id[2] = {0, 0};
+    vx_map_id dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    vxQueryImage(output, VX_IMAGE_FORMAT, &out_format, sizeof(out_format));
+    vxQueryImage(in0, VX_IMAGE_FORMAT, &in0_format, sizeof(in0_format));
+    vxQueryImage(in1, VX_IMAGE_FORMAT, &in1_format, sizeof(in1_format));
+    status  = vxGetValidRegionImage(in0, &rect);
+    status |= vxCopyScalar(scale_param, &scale, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxCopyScalar(opolicy_param, &overflow_policy, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxCopyScalar(rpolicy_param, &rounding_policy, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxMapImagePatch(in0, &rect, 0, &src_map_id[0], &src_addr[0], &src_base[0], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(in1, &rect, 0, &src_map_id[1], &src_addr[1], &src_base[1], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    if (status == VX_SUCCESS)
+    {
+        vx_bool saturate = overflow_policy == VX_CONVERT_POLICY_SATURATE ? vx_true_e : vx_false_e;
+        for (y = 0; y < dst_addr.dim_y; y++)
+        {
+            rows->multiply(x86simdRow(src_base[0], &src_addr[0], y), in0_format,
+                           x86simdRow(src_base[1], &src_addr[1], y), in1_format,
+                           x86simdRow(dst_base, &dst_addr, y), out_format, scale, saturate, dst_addr.dim_x);
+        }
+    }
+
+    status |= vxUnmapImagePatch(in0, src_map_id[0]);
+    status |= vxUnmapImagePatch(in1, src_map_id[1]);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+#include <VX/vx_lib_extras.h>
+
+/* atan2 has no vector form here, the rows stay scalar on top of the row addressing */
+
+// nodeless version of the Phase kernel
+vx_status vxPhase(vx_image grad_x, vx_image grad_y, vx_image output)
+{
+    vx_uint32 x, y;
+    vx_df_image format = 0;
+    void *dst_base = nullptr;
+    void *src_base_x = nullptr;
+    void *src_base_y = nullptr;
+    vx_imagepatch_addressing_t src_addr_x, src_addr_y, dst_addr;
+    vx_rectangle_t rect;
+    vx_map_id map_id_x = 0, map_id_y = 0, dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    if (grad_x == 0 && grad_y == 0)
+        return VX_ERROR_INVALID_PARAMETERS;
+
+    status  = vxGetValidRegionImage(grad_x, &rect);
+    status |= vxQueryImage(grad_x, VX_IMAGE_FORMAT, &format, sizeof(format));
+    status |= vxMapImagePatch(grad_x, &rect, 0, &map_id_x, &src_addr_x, &src_base_x, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(grad_y, &rect, 0, &map_id_y, &src_addr_y, &src_base_y, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    for (y = 0; status == VX_SUCCESS && y < dst_addr.dim_y; y++)
+    {
+        const vx_uint8 *gx = x86simdRow(src_base_x, &src_addr_x, y);
+        const vx_uint8 *gy = x86simdRow(src_base_y, &src_addr_y, y);
+        vx_uint8 *dst = x86simdRow(dst_base, &dst_addr, y);
+        for (x = 0; x < dst_addr.dim_x; x++)
+        {
+            double val_x, val_y;
+            if (format == VX_DF_IMAGE_F32)
+            {
+                val_x = (double)((const vx_float32 *)gx)[x];
+                val_y = (double)((const vx_float32 *)gy)[x];
+            }
+            else
+            {
+                val_x = (double)((const vx_int16 *)gx)[x];
+                val_y = (double)((const vx_int16 *)gy)[x];
+            }
+            /* 0 - TAU, then 0 - 255 */
+            double norm = atan2(val_y, val_x);
+            if (norm < 0.0f)
+                norm = VX_TAU + norm;
+            norm = norm / VX_TAU;
+            dst[x] = (vx_uint8)((vx_uint32)(norm * 256u + 0.5) & 0xFFu);
+        }
+    }
+
+    status |= vxUnmapImagePatch(grad_x, map_id_x);
+    status |= vxUnmapImagePatch(grad_y, map_id_y);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
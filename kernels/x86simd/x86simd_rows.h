@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _VX_X86SIMD_ROWS_H_
+#define _VX_X86SIMD_ROWS_H_
+
+#include <VX/vx.h>
+
+/*!
+ * \file
+ * \brief The row kernels of the x86 SIMD target and their runtime dispatch.
+ * \details The kernels in this directory map their images, walk the rows and
+ * handle borders, U1 packing and odd formats themselves, and hand every row of
+ * the common formats to one of the functions below. The row functions are
+ * compiled once per CPU variant (x86simd_rows_<variant>.cpp) and every kernel
+ * calls the table of the variant its context chose.
+ */
+
+/*! \brief The operations of the two input arithmetic row kernel. */
+enum x86simd_arith_e {
+    X86SIMD_ARITH_ADD,
+    X86SIMD_ARITH_SUB,
+    X86SIMD_ARITH_MIN,
+    X86SIMD_ARITH_MAX,
+};
+
+/*! \brief The operations of the bitwise row kernel, NOT ignores the second input. */
+enum x86simd_bitwise_e {
+    X86SIMD_BITWISE_AND,
+    X86SIMD_BITWISE_OR,
+    X86SIMD_BITWISE_XOR,
+    X86SIMD_BITWISE_NOT,
+};
+
+/*! \brief The 3x3 neighborhood operations of the filter row kernel. */
+enum x86simd_filter_e {
+    X86SIMD_FILTER_BOX,
+    X86SIMD_FILTER_GAUSSIAN,
+    X86SIMD_FILTER_MEDIAN,
+    X86SIMD_FILTER_ERODE,
+    X86SIMD_FILTER_DILATE,
+};
+
+/*! \brief The table of row kernels of one instruction set.
+ * \details All functions process \a n pixels of one row with the exact
+ * arithmetic of the C model, image pointers are the first pixel of the row.
+ * Neighborhood functions take padded rows, where element 0 is the pixel left
+ * of the first output pixel by the radius of the neighborhood.
+ */
+typedef struct _x86simd_rows_t {
+    /*! \brief The vx_cpu_variant_e the table was compiled for */
+    vx_enum variant;
+    /*! \brief The printable name of the variant */
+    const char *name;
+    /*! \brief |a - b| of U8, S16 (to S16 or U16) or U16 rows */
+    void (*absdiff)(const void *a, const void *b, void *dst, vx_df_image in_format, vx_df_image out_format, vx_uint32 n);
+    /*! \brief Add, subtract, min or max of U8/S16 rows into a U8/S16 row */
+    void (*arithmetic)(const void *a, vx_df_image a_format, const void *b, vx_df_image b_format,
+                       void *dst, vx_df_image out_format, enum x86simd_arith_e op, vx_bool saturate, vx_uint32 n);
+    /*! \brief Scaled product of U8/S16 rows into a U8/S16 row, truncating */
+    void (*multiply)(const void *a, vx_df_image a_format, const void *b, vx_df_image b_format,
+                     void *dst, vx_df_image out_format, vx_float32 scale, vx_bool saturate, vx_uint32 n);
+    /*! \brief Bitwise operation on byte rows */
+    void (*bitwise)(const vx_uint8 *a, const vx_uint8 *b, vx_uint8 *dst, enum x86simd_bitwise_e op, vx_uint32 n);
+    /*! \brief (1 - alpha) * b + alpha * a of U8 rows */
+    void (*weighted)(const vx_uint8 *a, const vx_uint8 *b, vx_uint8 *dst, vx_float32 alpha, vx_uint32 n);
+    /*! \brief Binary (src > lower) or range (lower <= src <= upper) threshold of a U8/S16 row into a U8 row */
+    void (*threshold)(const void *src, vx_df_image format, vx_uint8 *dst, vx_int32 lower, vx_int32 upper,
+                      vx_uint8 true_value, vx_uint8 false_value, vx_bool range, vx_uint32 n);
+    /*! \brief Shifting depth conversion between the non U1 formats of ConvertDepth */
+    void (*convertdepth)(const void *src, vx_df_image in_format, void *dst, vx_df_image out_format,
+                         vx_int32 shift, vx_bool saturate, vx_uint32 n);
+    /*! \brief Gradient magnitude of S16 rows into a U8 or S16 row */
+    void (*magnitude)(const vx_int16 *gx, const vx_int16 *gy, void *dst, vx_df_image out_format, vx_uint32 n);
+    /*! \brief 3x3 filter of three padded U8 rows */
+    void (*filter3x3)(const vx_uint8 *rows[3], vx_uint8 *dst, enum x86simd_filter_e op, vx_uint32 n);
+    /*! \brief Convolution of height padded U8/S16 rows with the flipped coefficients into a U8/S16 row,
+     * \a shift is log2 of the power of two scale */
+    void (*convolve)(const void *rows[], vx_df_image in_format, const vx_int16 *coeffs, vx_uint32 width,
+                     vx_uint32 height, vx_uint32 shift, void *dst, vx_df_image out_format, vx_uint32 n);
+    /*! \brief Integral image row, \a prev is the previous output row or nullptr on the first */
+    void (*integral)(const vx_uint8 *src, const vx_uint32 *prev, vx_uint32 *dst, vx_uint32 n);
+    /*! \brief BT.709 RGB to full resolution Y, U and V */
+    void (*rgb2yuv)(const vx_uint8 *r, const vx_uint8 *g, const vx_uint8 *b,
+                    vx_uint8 *y, vx_uint8 *u, vx_uint8 *v, vx_uint32 n);
+    /*! \brief Full resolution Y, U and V to RGB with the {V->R, U->G, V->G, U->B} coefficients */
+    void (*yuv2rgb)(const vx_uint8 *y, const vx_uint8 *u, const vx_uint8 *v,
+                    vx_uint8 *r, vx_uint8 *g, vx_uint8 *b, const vx_float64 coeffs[4], vx_uint32 n);
+    /*! \brief Picks channel \a offset of every \a step bytes */
+    void (*deinterleave)(const vx_uint8 *src, vx_uint32 step, vx_uint32 offset, vx_uint8 *dst, vx_uint32 n);
+    /*! \brief Interleaves \a count planes into a packed row */
+    void (*interleave)(const vx_uint8 *planes[], vx_uint32 count, vx_uint8 *dst, vx_uint32 n);
+    /*! \brief Bilinear U8 resampling between two source rows at columns \a xs, weights \a ss and \a t */
+    void (*bilinear)(const vx_uint8 *top, const vx_uint8 *bottom, const vx_int32 *xs, const vx_float32 *ss,
+                     vx_float32 t, vx_uint8 *dst, vx_uint32 n);
+    /*! \brief Source coordinates of the affine (2x3) or perspective (3x3) warp matrix for a row,
+     * minus the origin of the source patch */
+    void (*warp)(const vx_float32 m[9], vx_bool perspective, vx_uint32 x, vx_uint32 y,
+                 vx_float32 origin_x, vx_float32 origin_y, vx_float32 *xf, vx_float32 *yf, vx_uint32 n);
+} x86simd_rows_t;
+
+extern const x86simd_rows_t x86simd_rows_scalar;
+extern const x86simd_rows_t x86simd_rows_sse42;
+extern const x86simd_rows_t x86simd_rows_avx2;
+extern const x86simd_rows_t x86simd_rows_avx512;
+
+/*! \brief Returns the table of the vx_cpu_variant_e \a variant, NULL for a variant without one. */
+const x86simd_rows_t *x86simdRowsForVariant(vx_enum variant);
+
+/*! \brief Returns the row kernels of the CPU variant the context of \a ref picked,
+ * the scalar ones for a variant without a table.
+ */
+const x86simd_rows_t *x86simdRows(vx_reference ref);
+
+#endif
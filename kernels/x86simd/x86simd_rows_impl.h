@@ -0,0 +1,970 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _VX_X86SIMD_ROWS_IMPL_H_
+#define _VX_X86SIMD_ROWS_IMPL_H_
+
+/*!
+ * \file
+ * \brief The row kernels of the x86 SIMD target, written once against
+ * x86simd_vec.h and compiled by every x86simd_rows_<isa>.cpp.
+ * \details Each function runs whole registers first and finishes the row with
+ * the scalar code of the C model, so the vector and the scalar pixels agree
+ * bit for bit with the C model kernel, including its truncations.
+ * x86simd_rows_scalar.cpp defines X86SIMD_SCALAR, which leaves the vector
+ * code out so that table runs the scalar code alone on any x86-64 host.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "x86simd_rows.h"
+#if !defined(X86SIMD_SCALAR)
+#include "x86simd_vec.h"
+#endif
+
+namespace {
+
+inline vx_uint8 usat8(vx_int32 v) { return (vx_uint8)(v < 0 ? 0 : (v > UINT8_MAX ? UINT8_MAX : v)); }
+inline vx_int16 ssat16(vx_int32 v) { return (vx_int16)(v < INT16_MIN ? INT16_MIN : (v > INT16_MAX ? INT16_MAX : v)); }
+
+/* the conversion of cvttsd2si: out of range and NaN become INT32_MIN */
+inline vx_int32 cvtt32(vx_float64 v)
+{
+    return (v > -2147483649.0 && v < 2147483648.0) ? (vx_int32)v : INT32_MIN;
+}
+
+inline vx_int32 load_s32(const void *p, vx_df_image format, vx_uint32 x)
+{
+    return format == VX_DF_IMAGE_U8 ? ((const vx_uint8 *)p)[x] : ((const vx_int16 *)p)[x];
+}
+
+inline void store_s32(void *p, vx_df_image format, vx_uint32 x, vx_int32 v, vx_bool saturate)
+{
+    if (format == VX_DF_IMAGE_U8)
+        ((vx_uint8 *)p)[x] = saturate ? usat8(v) : (vx_uint8)v;
+    else
+        ((vx_int16 *)p)[x] = saturate ? ssat16(v) : (vx_int16)v;
+}
+
+#if !defined(X86SIMD_SCALAR)
+/* VN16 pixels of a U8 or S16 row as 16 bit lanes */
+inline vi load_s16(const void *p, vx_df_image format, vx_uint32 x)
+{
+    return format == VX_DF_IMAGE_U8 ? vloadu8x16((const vx_uint8 *)p + x) : vload((const vx_int16 *)p + x);
+}
+
+/* VN32 lanes of 32 bits into VN32 bytes, saturating */
+inline void store_u8x32(vx_uint8 *p, vi v)
+{
+    vi t = vpacks32(v, v);
+    qstore(p, vpackus16(t, t));
+}
+
+/* VN16 lanes of 16 bits into VN16 bytes, saturating */
+inline void store_u8x16(vx_uint8 *p, vi v)
+{
+    hstore(p, vlo(vpackus16(v, v)));
+}
+#endif
+
+void absdiff_row(const void *a, const void *b, void *dst, vx_df_image in_format, vx_df_image out_format, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+    if (in_format == VX_DF_IMAGE_U8)
+    {
+        const vx_uint8 *pa = (const vx_uint8 *)a, *pb = (const vx_uint8 *)b;
+        vx_uint8 *d = (vx_uint8 *)dst;
+#if !defined(X86SIMD_SCALAR)
+        for (; x + VN8 <= n; x += VN8)
+        {
+            vi va = vload(pa + x), vb = vload(pb + x);
+            vstore(d + x, vsub8(vmaxu8(va, vb), vminu8(va, vb)));
+        }
+#endif
+        for (; x < n; x++)
+            d[x] = (vx_uint8)(pa[x] > pb[x] ? pa[x] - pb[x] : pb[x] - pa[x]);
+    }
+    else if (in_format == VX_DF_IMAGE_S16)
+    {
+        const vx_int16 *pa = (const vx_int16 *)a, *pb = (const vx_int16 *)b;
+        vx_uint16 *d = (vx_uint16 *)dst;
+        vx_int32 limit = out_format == VX_DF_IMAGE_S16 ? INT16_MAX : UINT16_MAX;
+#if !defined(X86SIMD_SCALAR)
+        vi vlimit = vset16(limit);
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi va = vload(pa + x), vb = vload(pb + x);
+            vstore(d + x, vminu16(vsub16(vmaxs16(va, vb), vmins16(va, vb)), vlimit));
+        }
+#endif
+        for (; x < n; x++)
+        {
+            vx_int32 v = pa[x] > pb[x] ? pa[x] - pb[x] : pb[x] - pa[x];
+            d[x] = (vx_uint16)(v > limit ? limit : v);
+        }
+    }
+    else
+    {
+        const vx_uint16 *pa = (const vx_uint16 *)a, *pb = (const vx_uint16 *)b;
+        vx_uint16 *d = (vx_uint16 *)dst;
+#if !defined(X86SIMD_SCALAR)
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi va = vload(pa + x), vb = vload(pb + x);
+            vstore(d + x, vsub16(vmaxu16(va, vb), vminu16(va, vb)));
+        }
+#endif
+        for (; x < n; x++)
+            d[x] = (vx_uint16)(pa[x] > pb[x] ? pa[x] - pb[x] : pb[x] - pa[x]);
+    }
+}
+
+void arithmetic_row(const void *a, vx_df_image a_format, const void *b, vx_df_image b_format,
+                    void *dst, vx_df_image out_format, enum x86simd_arith_e op, vx_bool saturate, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    if (a_format == VX_DF_IMAGE_U8 && b_format == VX_DF_IMAGE_U8 && out_format == VX_DF_IMAGE_U8)
+    {
+        const vx_uint8 *pa = (const vx_uint8 *)a, *pb = (const vx_uint8 *)b;
+        vx_uint8 *d = (vx_uint8 *)dst;
+        for (; x + VN8 <= n; x += VN8)
+        {
+            vi va = vload(pa + x), vb = vload(pb + x), r;
+            switch (op)
+            {
+                case X86SIMD_ARITH_ADD: r = saturate ? vaddsu8(va, vb) : vadd8(va, vb); break;
+                case X86SIMD_ARITH_SUB: r = saturate ? vsubsu8(va, vb) : vsub8(va, vb); break;
+                case X86SIMD_ARITH_MIN: r = vminu8(va, vb); break;
+                default: r = vmaxu8(va, vb); break;
+            }
+            vstore(d + x, r);
+        }
+    }
+    else
+    {
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi va = load_s16(a, a_format, x), vb = load_s16(b, b_format, x), r;
+            switch (op)
+            {
+                case X86SIMD_ARITH_ADD: r = saturate ? vaddss16(va, vb) : vadd16(va, vb); break;
+                case X86SIMD_ARITH_SUB: r = saturate ? vsubss16(va, vb) : vsub16(va, vb); break;
+                case X86SIMD_ARITH_MIN: r = vmins16(va, vb); break;
+                default: r = vmaxs16(va, vb); break;
+            }
+            if (out_format == VX_DF_IMAGE_S16)
+                vstore((vx_int16 *)dst + x, r);
+            else if (saturate && (op == X86SIMD_ARITH_ADD || op == X86SIMD_ARITH_SUB))
+                store_u8x16((vx_uint8 *)dst + x, r);
+            else
+                hstore((vx_uint8 *)dst + x, vlo(vnarrow16(r, r)));
+        }
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_int32 va = load_s32(a, a_format, x), vb = load_s32(b, b_format, x), r;
+        switch (op)
+        {
+            case X86SIMD_ARITH_ADD: r = va + vb; break;
+            case X86SIMD_ARITH_SUB: r = va - vb; break;
+            case X86SIMD_ARITH_MIN: r = va < vb ? va : vb; break;
+            default: r = va > vb ? va : vb; break;
+        }
+        store_s32(dst, out_format, x, r, (op == X86SIMD_ARITH_ADD || op == X86SIMD_ARITH_SUB) ? saturate : vx_false_e);
+    }
+}
+
+#if !defined(X86SIMD_SCALAR)
+/* scale * (vx_float64)p of the 32 bit products p, truncated like the C model */
+inline vi scale_product(vi p, vd scale)
+{
+    return vcvttd(vmuld(scale, vcvtdlo(p)), vmuld(scale, vcvtdhi(p)));
+}
+#endif
+
+void multiply_row(const void *a, vx_df_image a_format, const void *b, vx_df_image b_format,
+                  void *dst, vx_df_image out_format, vx_float32 scale, vx_bool saturate, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    vd vscale = vsetd((vx_float64)scale);
+    vi mask = vset32(out_format == VX_DF_IMAGE_U8 ? 0xFF : 0xFFFF);
+    for (; x + VN16 <= n; x += VN16)
+    {
+        vi va = load_s16(a, a_format, x), vb = load_s16(b, b_format, x);
+        vi lo = vmullo16(va, vb), hi = vmulhi16(va, vb);
+        /* the products stay in the lane order of the unpacks until the lane packs undo it */
+        vi r0 = scale_product(vunpacklo16(lo, hi), vscale);
+        vi r1 = scale_product(vunpackhi16(lo, hi), vscale);
+        vi r = saturate ? vpacks32lane(r0, r1) : vpackus32lane(vand(r0, mask), vand(r1, mask));
+        if (out_format == VX_DF_IMAGE_S16)
+            vstore((vx_int16 *)dst + x, r);
+        else
+            store_u8x16((vx_uint8 *)dst + x, r);
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_int32 p = load_s32(a, a_format, x) * load_s32(b, b_format, x);
+        store_s32(dst, out_format, x, cvtt32(scale * (vx_float64)p), saturate);
+    }
+}
+
+void bitwise_row(const vx_uint8 *a, const vx_uint8 *b, vx_uint8 *dst, enum x86simd_bitwise_e op, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+    switch (op)
+    {
+        case X86SIMD_BITWISE_AND:
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN8 <= n; x += VN8)
+                vstore(dst + x, vand(vload(a + x), vload(b + x)));
+#endif
+            for (; x < n; x++)
+                dst[x] = a[x] & b[x];
+            break;
+        case X86SIMD_BITWISE_OR:
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN8 <= n; x += VN8)
+                vstore(dst + x, vor(vload(a + x), vload(b + x)));
+#endif
+            for (; x < n; x++)
+                dst[x] = a[x] | b[x];
+            break;
+        case X86SIMD_BITWISE_XOR:
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN8 <= n; x += VN8)
+                vstore(dst + x, vxor(vload(a + x), vload(b + x)));
+#endif
+            for (; x < n; x++)
+                dst[x] = a[x] ^ b[x];
+            break;
+        default:
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN8 <= n; x += VN8)
+                vstore(dst + x, vnot(vload(a + x)));
+#endif
+            for (; x < n; x++)
+                dst[x] = (vx_uint8)~a[x];
+            break;
+    }
+}
+
+void weighted_row(const vx_uint8 *a, const vx_uint8 *b, vx_uint8 *dst, vx_float32 alpha, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+    vx_float32 beta = 1 - alpha;
+#if !defined(X86SIMD_SCALAR)
+    vf valpha = vsetf(alpha), vbeta = vsetf(beta);
+    vi mask = vset32(0xFF);
+    for (; x + VN32 <= n; x += VN32)
+    {
+        vf fa = vcvtf(vloadu8x32(a + x)), fb = vcvtf(vloadu8x32(b + x));
+        store_u8x32(dst + x, vand(vcvttf(vaddf(vmulf(vbeta, fb), vmulf(valpha, fa))), mask));
+    }
+#endif
+    for (; x < n; x++)
+        dst[x] = (vx_uint8)(vx_int32)(beta * (vx_float32)b[x] + alpha * (vx_float32)a[x]);
+}
+
+void threshold_row(const void *src, vx_df_image format, vx_uint8 *dst, vx_int32 lower, vx_int32 upper,
+                   vx_uint8 true_value, vx_uint8 false_value, vx_bool range, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    vi vtrue = vset8(true_value), vfalse = vset8(false_value);
+    if (format == VX_DF_IMAGE_U8)
+    {
+        const vx_uint8 *s = (const vx_uint8 *)src;
+        vi vlower = vset8(lower), vupper = vset8(upper);
+        for (; x + VN8 <= n; x += VN8)
+        {
+            vi v = vload(s + x);
+            if (range)
+                vstore(dst + x, vselect(vor(vcmpgtu8(v, vupper), vcmpgtu8(vlower, v)), vfalse, vtrue));
+            else
+                vstore(dst + x, vselect(vcmpgtu8(v, vlower), vtrue, vfalse));
+        }
+    }
+    else
+    {
+        const vx_int16 *s = (const vx_int16 *)src;
+        vi vlower = vset16(lower), vupper = vset16(upper);
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi v = vload(s + x), m;
+            if (range)
+            {
+                m = vor(vcmpgts16(v, vupper), vcmpgts16(vlower, v));
+                m = vpacks16(m, m);
+                hstore(dst + x, vlo(vselect(m, vfalse, vtrue)));
+            }
+            else
+            {
+                m = vcmpgts16(v, vlower);
+                m = vpacks16(m, m);
+                hstore(dst + x, vlo(vselect(m, vtrue, vfalse)));
+            }
+        }
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_int32 v = load_s32(src, format, x);
+        if (range)
+            dst[x] = (v > upper || v < lower) ? false_value : true_value;
+        else
+            dst[x] = v > lower ? true_value : false_value;
+    }
+}
+
+void convertdepth_row(const void *src, vx_df_image in_format, void *dst, vx_df_image out_format,
+                      vx_int32 shift, vx_bool saturate, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+    if (in_format == VX_DF_IMAGE_U8 && (out_format == VX_DF_IMAGE_U16 || out_format == VX_DF_IMAGE_S16))
+    {
+        const vx_uint8 *s = (const vx_uint8 *)src;
+        vx_uint16 *d = (vx_uint16 *)dst;
+#if !defined(X86SIMD_SCALAR)
+        for (; x + VN16 <= n; x += VN16)
+            vstore(d + x, vsll16(vloadu8x16(s + x), shift));
+#endif
+        for (; x < n; x++)
+            d[x] = (vx_uint16)((vx_uint32)s[x] << shift);
+    }
+    else if (out_format == VX_DF_IMAGE_U32 || out_format == VX_DF_IMAGE_S32)
+    {
+        vx_uint32 *d = (vx_uint32 *)dst;
+        if (in_format == VX_DF_IMAGE_U8)
+        {
+            const vx_uint8 *s = (const vx_uint8 *)src;
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN32 <= n; x += VN32)
+                vstore(d + x, vsll32(vloadu8x32(s + x), shift));
+#endif
+            for (; x < n; x++)
+                d[x] = (vx_uint32)s[x] << shift;
+        }
+        else if (in_format == VX_DF_IMAGE_U16)
+        {
+            const vx_uint16 *s = (const vx_uint16 *)src;
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN32 <= n; x += VN32)
+                vstore(d + x, vsll32(vloadu16x32(s + x), shift));
+#endif
+            for (; x < n; x++)
+                d[x] = (vx_uint32)s[x] << shift;
+        }
+        else
+        {
+            const vx_int16 *s = (const vx_int16 *)src;
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN32 <= n; x += VN32)
+                vstore(d + x, vsll32(vloads16x32(s + x), shift));
+#endif
+            for (; x < n; x++)
+                d[x] = (vx_uint32)(vx_int32)s[x] << shift;
+        }
+    }
+    else if ((in_format == VX_DF_IMAGE_U16 || in_format == VX_DF_IMAGE_S16) && out_format == VX_DF_IMAGE_U8)
+    {
+        vx_uint8 *d = (vx_uint8 *)dst;
+        if (in_format == VX_DF_IMAGE_U16)
+        {
+            const vx_uint16 *s = (const vx_uint16 *)src;
+#if !defined(X86SIMD_SCALAR)
+            vi vmax = vset16(UINT8_MAX);
+            for (; x + VN8 <= n; x += VN8)
+            {
+                vi v0 = vsrl16(vload(s + x), shift), v1 = vsrl16(vload(s + x + VN16), shift);
+                vstore(d + x, saturate ? vpackus16(vminu16(v0, vmax), vminu16(v1, vmax)) : vnarrow16(v0, v1));
+            }
+#endif
+            for (; x < n; x++)
+            {
+                vx_uint32 v = (vx_uint32)s[x] >> shift;
+                d[x] = saturate ? (vx_uint8)(v > UINT8_MAX ? UINT8_MAX : v) : (vx_uint8)v;
+            }
+        }
+        else
+        {
+            const vx_int16 *s = (const vx_int16 *)src;
+#if !defined(X86SIMD_SCALAR)
+            for (; x + VN8 <= n; x += VN8)
+            {
+                vi v0 = vsra16(vload(s + x), shift), v1 = vsra16(vload(s + x + VN16), shift);
+                vstore(d + x, saturate ? vpackus16(v0, v1) : vnarrow16(v0, v1));
+            }
+#endif
+            for (; x < n; x++)
+            {
+                vx_int32 v = (vx_int32)s[x] >> shift;
+                d[x] = saturate ? usat8(v) : (vx_uint8)v;
+            }
+        }
+    }
+    else if (in_format == VX_DF_IMAGE_U32)
+    {
+        const vx_uint32 *s = (const vx_uint32 *)src;
+        vx_uint32 limit = out_format == VX_DF_IMAGE_U8 ? UINT8_MAX : UINT16_MAX;
+#if !defined(X86SIMD_SCALAR)
+        vi vlimit = vset32((vx_int32)limit);
+        for (; x + VN32 <= n; x += VN32)
+        {
+            vi v = vsrl32(vload(s + x), shift);
+            v = saturate ? vminu32(v, vlimit) : vand(v, vlimit);
+            if (out_format == VX_DF_IMAGE_U8)
+                store_u8x32((vx_uint8 *)dst + x, v);
+            else
+                hstore((vx_uint16 *)dst + x, vlo(vpackus32(v, v)));
+        }
+#endif
+        for (; x < n; x++)
+        {
+            vx_uint32 v = s[x] >> shift;
+            if (saturate)
+                v = v > limit ? limit : v;
+            if (out_format == VX_DF_IMAGE_U8)
+                ((vx_uint8 *)dst)[x] = (vx_uint8)v;
+            else
+                ((vx_uint16 *)dst)[x] = (vx_uint16)v;
+        }
+    }
+    else
+    {
+        /* S32 to S16 */
+        const vx_int32 *s = (const vx_int32 *)src;
+        vx_int16 *d = (vx_int16 *)dst;
+#if !defined(X86SIMD_SCALAR)
+        vi mask = vset32(0xFFFF);
+        for (; x + VN32 <= n; x += VN32)
+        {
+            vi v = vsra32(vload(s + x), shift);
+            hstore(d + x, vlo(saturate ? vpacks32(v, v) : vpackus32(vand(v, mask), vand(v, mask))));
+        }
+#endif
+        for (; x < n; x++)
+        {
+            vx_int32 v = s[x] >> shift;
+            d[x] = saturate ? ssat16(v) : (vx_int16)v;
+        }
+    }
+}
+
+void magnitude_row(const vx_int16 *gx, const vx_int16 *gy, void *dst, vx_df_image out_format, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+    if (out_format == VX_DF_IMAGE_U8)
+    {
+        vx_uint8 *d = (vx_uint8 *)dst;
+#if !defined(X86SIMD_SCALAR)
+        vi vmax = vset32(UINT8_MAX), three = vset32(3);
+        for (; x + VN32 <= n; x += VN32)
+        {
+            vi a = vloads16x32(gx + x), b = vloads16x32(gy + x);
+            /* the sum of squares wraps in 32 bits like the C model */
+            vi s = vadd32(vmullo32(a, a), vmullo32(b, b));
+            vi v = vcvttd(vsqrtd(vcvtdlo(s)), vsqrtd(vcvtdhi(s)));
+            v = vsra32(vadd32(v, vand(vsra32(v, 31), three)), 2);
+            store_u8x32(d + x, vand(vmins32(v, vmax), vmax));
+        }
+#endif
+        for (; x < n; x++)
+        {
+            vx_int32 s = (vx_int32)((vx_uint32)(gx[x] * gx[x]) + (vx_uint32)(gy[x] * gy[x]));
+            vx_int32 v = cvtt32(sqrt((vx_float64)s)) / 4;
+            d[x] = (vx_uint8)(v > UINT8_MAX ? UINT8_MAX : v);
+        }
+    }
+    else
+    {
+        vx_int16 *d = (vx_int16 *)dst;
+#if !defined(X86SIMD_SCALAR)
+        vd half = vsetd(0.5);
+        vi vmax = vset32(INT16_MAX);
+        for (; x + VN32 <= n; x += VN32)
+        {
+            vi a = vloads16x32(gx + x), b = vloads16x32(gy + x);
+            vd alo = vcvtdlo(a), ahi = vcvtdhi(a), blo = vcvtdlo(b), bhi = vcvtdhi(b);
+            vd slo = vaddd(vmuld(alo, alo), vmuld(blo, blo)), shi = vaddd(vmuld(ahi, ahi), vmuld(bhi, bhi));
+            vi v = vmins32(vcvttd(vaddd(vsqrtd(slo), half), vaddd(vsqrtd(shi), half)), vmax);
+            hstore(d + x, vlo(vpacks32(v, v)));
+        }
+#endif
+        for (; x < n; x++)
+        {
+            vx_float64 s = (vx_float64)gx[x] * gx[x] + (vx_float64)gy[x] * gy[x];
+            vx_int32 v = (vx_int32)(sqrt(s) + 0.5);
+            d[x] = (vx_int16)(v > INT16_MAX ? INT16_MAX : v);
+        }
+    }
+}
+
+/* the 19 exchange median network of nine values, the result is p[4] */
+#define X86SIMD_SORT(a, b) { auto t_ = min8(p[a], p[b]); p[b] = max8(p[a], p[b]); p[a] = t_; }
+#define X86SIMD_MEDIAN9(p) \
+    X86SIMD_SORT(1, 2) X86SIMD_SORT(4, 5) X86SIMD_SORT(7, 8) \
+    X86SIMD_SORT(0, 1) X86SIMD_SORT(3, 4) X86SIMD_SORT(6, 7) \
+    X86SIMD_SORT(1, 2) X86SIMD_SORT(4, 5) X86SIMD_SORT(7, 8) \
+    X86SIMD_SORT(0, 3) X86SIMD_SORT(5, 8) X86SIMD_SORT(4, 7) \
+    X86SIMD_SORT(3, 6) X86SIMD_SORT(1, 4) X86SIMD_SORT(2, 5) \
+    X86SIMD_SORT(4, 7) X86SIMD_SORT(4, 2) X86SIMD_SORT(6, 4) \
+    X86SIMD_SORT(4, 2)
+
+inline vx_uint8 min8(vx_uint8 a, vx_uint8 b) { return a < b ? a : b; }
+inline vx_uint8 max8(vx_uint8 a, vx_uint8 b) { return a > b ? a : b; }
+#if !defined(X86SIMD_SCALAR)
+inline vi min8(vi a, vi b) { return vminu8(a, b); }
+inline vi max8(vi a, vi b) { return vmaxu8(a, b); }
+
+/* the sum of three neighbors of VN16 pixels, the middle one weighted by \a w */
+inline vi sum3(const vx_uint8 *p, int w)
+{
+    vi m = vloadu8x16(p + 1);
+    return vadd16(vadd16(vloadu8x16(p), w == 2 ? vadd16(m, m) : m), vloadu8x16(p + 2));
+}
+#endif
+
+void filter3x3_row(const vx_uint8 *rows[3], vx_uint8 *dst, enum x86simd_filter_e op, vx_uint32 n)
+{
+    const vx_uint8 *r0 = rows[0], *r1 = rows[1], *r2 = rows[2];
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    if (op == X86SIMD_FILTER_BOX)
+    {
+        /* sum / 9 as the high half of sum * 7282, exact up to 9 * 255 */
+        vi ninth = vset16(7282);
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi s = vadd16(vadd16(sum3(r0 + x, 1), sum3(r1 + x, 1)), sum3(r2 + x, 1));
+            store_u8x16(dst + x, vmulhiu16(s, ninth));
+        }
+    }
+    else if (op == X86SIMD_FILTER_GAUSSIAN)
+    {
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi m = sum3(r1 + x, 2);
+            vi s = vadd16(vadd16(sum3(r0 + x, 2), vadd16(m, m)), sum3(r2 + x, 2));
+            store_u8x16(dst + x, vsrl16(s, 4));
+        }
+    }
+    else if (op == X86SIMD_FILTER_MEDIAN)
+    {
+        for (; x + VN8 <= n; x += VN8)
+        {
+            vi p[9] = {
+                vload(r0 + x), vload(r0 + x + 1), vload(r0 + x + 2),
+                vload(r1 + x), vload(r1 + x + 1), vload(r1 + x + 2),
+                vload(r2 + x), vload(r2 + x + 1), vload(r2 + x + 2),
+            };
+            X86SIMD_MEDIAN9(p)
+            vstore(dst + x, p[4]);
+        }
+    }
+    else
+    {
+        vx_bool erode = op == X86SIMD_FILTER_ERODE ? vx_true_e : vx_false_e;
+        for (; x + VN8 <= n; x += VN8)
+        {
+            vi v = vload(r0 + x);
+            for (vx_uint32 k = 0; k < 9; k++)
+            {
+                vi p = vload(rows[k / 3] + x + k % 3);
+                v = erode ? vminu8(v, p) : vmaxu8(v, p);
+            }
+            vstore(dst + x, v);
+        }
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_uint8 p[9] = {
+            r0[x], r0[x + 1], r0[x + 2],
+            r1[x], r1[x + 1], r1[x + 2],
+            r2[x], r2[x + 1], r2[x + 2],
+        };
+        vx_int32 s = 0;
+        switch (op)
+        {
+            case X86SIMD_FILTER_BOX:
+                for (vx_uint32 k = 0; k < 9; k++)
+                    s += p[k];
+                dst[x] = usat8(s / 9);
+                break;
+            case X86SIMD_FILTER_GAUSSIAN:
+                s = p[0] + 2 * p[1] + p[2] + 2 * p[3] + 4 * p[4] + 2 * p[5] + p[6] + 2 * p[7] + p[8];
+                dst[x] = usat8(s / 16);
+                break;
+            case X86SIMD_FILTER_MEDIAN:
+                X86SIMD_MEDIAN9(p)
+                dst[x] = p[4];
+                break;
+            default:
+                dst[x] = p[0];
+                for (vx_uint32 k = 1; k < 9; k++)
+                    dst[x] = op == X86SIMD_FILTER_ERODE ? min8(dst[x], p[k]) : max8(dst[x], p[k]);
+                break;
+        }
+    }
+}
+
+#undef X86SIMD_MEDIAN9
+#undef X86SIMD_SORT
+
+#if !defined(X86SIMD_SCALAR)
+/* sum / 2^shift truncating toward zero */
+inline vi div_pow2(vi s, vx_uint32 shift, vi round)
+{
+    return vsra32(vadd32(s, vand(vsra32(s, 31), round)), (int)shift);
+}
+#endif
+
+void convolve_row(const void *rows[], vx_df_image in_format, const vx_int16 *coeffs, vx_uint32 width,
+                  vx_uint32 height, vx_uint32 shift, void *dst, vx_df_image out_format, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    /* a scale of 2^31 does not survive the rounding add, leave it to the scalar code */
+    if (shift < 31)
+    {
+        vi round = vset32((vx_int32)((1u << shift) - 1));
+        for (; x + VN16 <= n; x += VN16)
+        {
+            vi lo = vzero(), hi = vzero();
+            for (vx_uint32 ky = 0; ky < height; ky++)
+            {
+                const void *row = rows[ky];
+                for (vx_uint32 kx = 0; kx < width; kx += 2)
+                {
+                    vx_uint32 c0 = (vx_uint16)coeffs[ky * width + kx];
+                    vx_uint32 c1 = kx + 1 < width ? (vx_uint16)coeffs[ky * width + kx + 1] : 0u;
+                    vi c = vset32((vx_int32)(c0 | (c1 << 16)));
+                    vi p0 = load_s16(row, in_format, x + kx);
+                    vi p1 = kx + 1 < width ? load_s16(row, in_format, x + kx + 1) : vzero();
+                    lo = vadd32(lo, vmadd16(vunpacklo16(p0, p1), c));
+                    hi = vadd32(hi, vmadd16(vunpackhi16(p0, p1), c));
+                }
+            }
+            vi r = vpacks32lane(div_pow2(lo, shift, round), div_pow2(hi, shift, round));
+            if (out_format == VX_DF_IMAGE_U8)
+                store_u8x16((vx_uint8 *)dst + x, r);
+            else
+                vstore((vx_int16 *)dst + x, r);
+        }
+    }
+#endif
+    vx_int32 scale = (vx_int32)(1u << shift);
+    for (; x < n; x++)
+    {
+        vx_uint32 sum = 0;
+        for (vx_uint32 ky = 0; ky < height; ky++)
+            for (vx_uint32 kx = 0; kx < width; kx++)
+                sum += (vx_uint32)(coeffs[ky * width + kx] * load_s32(rows[ky], in_format, x + kx));
+        vx_int32 v = (vx_int32)sum / scale;
+        if (out_format == VX_DF_IMAGE_U8)
+            ((vx_uint8 *)dst)[x] = usat8(v);
+        else
+            ((vx_int16 *)dst)[x] = ssat16(v);
+    }
+}
+
+void integral_row(const vx_uint8 *src, const vx_uint32 *prev, vx_uint32 *dst, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    vi carry = vzero();
+    for (; x + VN32 <= n; x += VN32)
+    {
+        vi s = vadd32(vprefix32(vloadu8x32(src + x)), carry);
+        carry = vbroadcastlast32(s);
+        vstore(dst + x, prev ? vadd32(s, vload(prev + x)) : s);
+    }
+#endif
+    vx_uint32 sum = x ? dst[x - 1] - (prev ? prev[x - 1] : 0u) : 0u;
+    for (; x < n; x++)
+    {
+        sum += src[x];
+        dst[x] = sum + (prev ? prev[x] : 0u);
+    }
+}
+
+void rgb2yuv_row(const vx_uint8 *r, const vx_uint8 *g, const vx_uint8 *b,
+                 vx_uint8 *y, vx_uint8 *u, vx_uint8 *v, vx_uint32 n)
+{
+    /* BT.709 with the float constants of the C model, evaluated in double */
+    const vx_float64 ry = 0.2126f, gy = 0.7152f, by = 0.0722f;
+    const vx_float64 ru = 0.1146f, gu = 0.3854f, bu = 0.5f;
+    const vx_float64 rv = 0.5f, gv = 0.4542f, bv = 0.0458f;
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    vd cry = vsetd(ry), cgy = vsetd(gy), cby = vsetd(by);
+    vd cru = vsetd(ru), cgu = vsetd(gu), cbu = vsetd(bu);
+    vd crv = vsetd(rv), cgv = vsetd(gv), cbv = vsetd(bv);
+    vd zero = vsetd(0.0);
+    vi bias = vset32(128);
+    for (; x + VN32 <= n; x += VN32)
+    {
+        vi ir = vloadu8x32(r + x), ig = vloadu8x32(g + x), ib = vloadu8x32(b + x);
+        vd fr[2] = { vcvtdlo(ir), vcvtdhi(ir) };
+        vd fg[2] = { vcvtdlo(ig), vcvtdhi(ig) };
+        vd fb[2] = { vcvtdlo(ib), vcvtdhi(ib) };
+        vd fy[2], fu[2], fv[2];
+        for (int h = 0; h < 2; h++)
+        {
+            fy[h] = vaddd(vaddd(vmuld(fr[h], cry), vmuld(fg[h], cgy)), vmuld(fb[h], cby));
+            fu[h] = vaddd(vsubd(vsubd(zero, vmuld(cru, fr[h])), vmuld(cgu, fg[h])), vmuld(cbu, fb[h]));
+            fv[h] = vsubd(vsubd(vmuld(crv, fr[h]), vmuld(cgv, fg[h])), vmuld(cbv, fb[h]));
+        }
+        store_u8x32(y + x, vcvttd(fy[0], fy[1]));
+        store_u8x32(u + x, vadd32(vcvttd(fu[0], fu[1]), bias));
+        store_u8x32(v + x, vadd32(vcvttd(fv[0], fv[1]), bias));
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_float64 fr = r[x], fg = g[x], fb = b[x];
+        y[x] = usat8((vx_int32)((fr * ry + fg * gy) + fb * by));
+        u[x] = usat8((vx_int32)(((0 - ru * fr) - gu * fg) + bu * fb) + 128);
+        v[x] = usat8((vx_int32)((rv * fr - gv * fg) - bv * fb) + 128);
+    }
+}
+
+void yuv2rgb_row(const vx_uint8 *y, const vx_uint8 *u, const vx_uint8 *v,
+                 vx_uint8 *r, vx_uint8 *g, vx_uint8 *b, const vx_float64 coeffs[4], vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    vd crv = vsetd(coeffs[0]), cgu = vsetd(coeffs[1]), cgv = vsetd(coeffs[2]), cbu = vsetd(coeffs[3]);
+    vi bias = vset32(128);
+    for (; x + VN32 <= n; x += VN32)
+    {
+        vi iy = vloadu8x32(y + x);
+        vi iu = vsub32(vloadu8x32(u + x), bias), iv = vsub32(vloadu8x32(v + x), bias);
+        vd fy[2] = { vcvtdlo(iy), vcvtdhi(iy) };
+        vd fu[2] = { vcvtdlo(iu), vcvtdhi(iu) };
+        vd fv[2] = { vcvtdlo(iv), vcvtdhi(iv) };
+        vd fr[2], fg[2], fb[2];
+        for (int h = 0; h < 2; h++)
+        {
+            fr[h] = vaddd(fy[h], vmuld(crv, fv[h]));
+            fg[h] = vsubd(vsubd(fy[h], vmuld(cgu, fu[h])), vmuld(cgv, fv[h]));
+            fb[h] = vaddd(fy[h], vmuld(cbu, fu[h]));
+        }
+        store_u8x32(r + x, vcvttd(fr[0], fr[1]));
+        store_u8x32(g + x, vcvttd(fg[0], fg[1]));
+        store_u8x32(b + x, vcvttd(fb[0], fb[1]));
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_float64 fy = y[x], fu = (vx_float64)u[x] - 128, fv = (vx_float64)v[x] - 128;
+        r[x] = usat8((vx_int32)(fy + coeffs[0] * fv));
+        g[x] = usat8((vx_int32)((fy - coeffs[1] * fu) - coeffs[2] * fv));
+        b[x] = usat8((vx_int32)(fy + coeffs[3] * fu));
+    }
+}
+
+/* The byte shuffles below stay at 128 bits on every instruction set: the wider
+ * pshufb only moves bytes within a 128 bit lane, which the packed layouts cross.
+ */
+
+void deinterleave_row(const vx_uint8 *src, vx_uint32 step, vx_uint32 offset, vx_uint8 *dst, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+    if (step == 1)
+    {
+        memcpy(dst, src + offset, n);
+        return;
+    }
+#if !defined(X86SIMD_SCALAR)
+    if (step <= 4)
+    {
+        __m128i masks[4];
+        for (vx_uint32 k = 0; k < step; k++)
+        {
+            vx_uint8 m[16];
+            for (vx_uint32 i = 0; i < 16; i++)
+            {
+                vx_uint32 at = i * step + offset;
+                m[i] = (at >= 16 * k && at < 16 * (k + 1)) ? (vx_uint8)(at - 16 * k) : 0x80;
+            }
+            masks[k] = _mm_loadu_si128((const __m128i *)m);
+        }
+        /* 16 pixels read 16 * step bytes, one pixel of slack keeps them inside the row */
+        for (; x + 17 <= n; x += 16)
+        {
+            const vx_uint8 *s = src + x * step;
+            __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)s), masks[0]);
+            for (vx_uint32 k = 1; k < step; k++)
+                v = _mm_or_si128(v, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(s + 16 * k)), masks[k]));
+            _mm_storeu_si128((__m128i *)(dst + x), v);
+        }
+    }
+#endif
+    for (; x < n; x++)
+        dst[x] = src[x * step + offset];
+}
+
+void interleave_row(const vx_uint8 *planes[], vx_uint32 count, vx_uint8 *dst, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    if (count >= 2 && count <= 4)
+    {
+        /* masks[k][p] picks the bytes of plane p for the k-th 16 bytes of output */
+        __m128i masks[4][4];
+        for (vx_uint32 k = 0; k < count; k++)
+        {
+            for (vx_uint32 p = 0; p < count; p++)
+            {
+                vx_uint8 m[16];
+                for (vx_uint32 j = 0; j < 16; j++)
+                {
+                    vx_uint32 at = 16 * k + j;
+                    m[j] = at % count == p ? (vx_uint8)(at / count) : 0x80;
+                }
+                masks[k][p] = _mm_loadu_si128((const __m128i *)m);
+            }
+        }
+        for (; x + 16 <= n; x += 16)
+        {
+            __m128i v[4];
+            for (vx_uint32 p = 0; p < count; p++)
+                v[p] = _mm_loadu_si128((const __m128i *)(planes[p] + x));
+            for (vx_uint32 k = 0; k < count; k++)
+            {
+                __m128i o = _mm_shuffle_epi8(v[0], masks[k][0]);
+                for (vx_uint32 p = 1; p < count; p++)
+                    o = _mm_or_si128(o, _mm_shuffle_epi8(v[p], masks[k][p]));
+                _mm_storeu_si128((__m128i *)(dst + x * count + 16 * k), o);
+            }
+        }
+    }
+#endif
+    for (; x < n; x++)
+        for (vx_uint32 p = 0; p < count; p++)
+            dst[x * count + p] = planes[p][x];
+}
+
+#if !defined(X86SIMD_SCALAR)
+/* VN32 bytes of \a row at the columns \a xs as 32 bit lanes */
+inline vi gather_u8(const vx_uint8 *row, const vx_int32 *xs)
+{
+    vx_int32 v[VN32];
+    for (vx_uint32 i = 0; i < VN32; i++)
+        v[i] = row[xs[i]];
+    return vload(v);
+}
+#endif
+
+void bilinear_row(const vx_uint8 *top, const vx_uint8 *bottom, const vx_int32 *xs, const vx_float32 *ss,
+                  vx_float32 t, vx_uint8 *dst, vx_uint32 n)
+{
+    vx_uint32 x = 0;
+#if !defined(X86SIMD_SCALAR)
+    vf one = vsetf(1.0f), vt = vsetf(t), vt1 = vsetf(1 - t);
+    vi vmax = vset32(UINT8_MAX);
+    for (; x + VN32 <= n; x += VN32)
+    {
+        vf s = vloadf(ss + x), s1 = vsubf(one, s);
+        vx_int32 xr[VN32];
+        for (vx_uint32 i = 0; i < VN32; i++)
+            xr[i] = xs[x + i] + 1;
+        vf tl = vcvtf(gather_u8(top, xs + x)), tr = vcvtf(gather_u8(top, xr));
+        vf bl = vcvtf(gather_u8(bottom, xs + x)), br = vcvtf(gather_u8(bottom, xr));
+        vf ref = vaddf(vaddf(vaddf(vmulf(vmulf(s1, vt1), tl), vmulf(vmulf(s, vt1), tr)),
+                             vmulf(vmulf(s1, vt), bl)), vmulf(vmulf(s, vt), br));
+        /* ref is never negative, so the 255 clamp can follow the truncation */
+        store_u8x32(dst + x, vminu32(vcvttf(ref), vmax));
+    }
+#endif
+    for (; x < n; x++)
+    {
+        vx_float32 s = ss[x];
+        vx_int32 x1 = xs[x];
+        vx_float32 ref = (1 - s) * (1 - t) * top[x1] + s * (1 - t) * top[x1 + 1] +
+                         (1 - s) * t * bottom[x1] + s * t * bottom[x1 + 1];
+        dst[x] = ref > 255 ? 255 : (vx_uint8)ref;
+    }
+}
+
+void warp_row(const vx_float32 m[9], vx_bool perspective, vx_uint32 x, vx_uint32 y,
+              vx_float32 origin_x, vx_float32 origin_y, vx_float32 *xf, vx_float32 *yf, vx_uint32 n)
+{
+    vx_uint32 i = 0;
+    vx_float32 fy = (vx_float32)y;
+#if !defined(X86SIMD_SCALAR)
+    vx_int32 lanes[VN32];
+    for (vx_uint32 k = 0; k < VN32; k++)
+        lanes[k] = (vx_int32)k;
+    vi vlanes = vload(lanes);
+    vf ox = vsetf(origin_x), oy = vsetf(origin_y);
+    vf m0 = vsetf(m[0]), m1 = vsetf(m[1]), m2 = vsetf(m[2]);
+    /* the row constant terms in the C model order: x*m0 + y*m3 + m6 etc. */
+    for (; i + VN32 <= n; i += VN32)
+    {
+        vf fx = vcvtf(vadd32(vset32((vx_int32)(x + i)), vlanes));
+        if (perspective)
+        {
+            vf xs = vaddf(vaddf(vmulf(fx, m0), vsetf(fy * m[3])), vsetf(m[6]));
+            vf ys = vaddf(vaddf(vmulf(fx, m1), vsetf(fy * m[4])), vsetf(m[7]));
+            vf zs = vaddf(vaddf(vmulf(fx, m2), vsetf(fy * m[5])), vsetf(m[8]));
+            vstoref(xf + i, vsubf(vdivf(xs, zs), ox));
+            vstoref(yf + i, vsubf(vdivf(ys, zs), oy));
+        }
+        else
+        {
+            vstoref(xf + i, vsubf(vaddf(vaddf(vmulf(fx, m0), vsetf(fy * m[2])), vsetf(m[4])), ox));
+            vstoref(yf + i, vsubf(vaddf(vaddf(vmulf(fx, m1), vsetf(fy * m[3])), vsetf(m[5])), oy));
+        }
+    }
+#endif
+    for (; i < n; i++)
+    {
+        vx_float32 fx = (vx_float32)(x + i);
+        if (perspective)
+        {
+            vx_float32 xs = fx * m[0] + fy * m[3] + m[6];
+            vx_float32 ys = fx * m[1] + fy * m[4] + m[7];
+            vx_float32 zs = fx * m[2] + fy * m[5] + m[8];
+            xf[i] = xs / zs - origin_x;
+            yf[i] = ys / zs - origin_y;
+        }
+        else
+        {
+            xf[i] = fx * m[0] + fy * m[2] + m[4] - origin_x;
+            yf[i] = fx * m[1] + fy * m[3] + m[5] - origin_y;
+        }
+    }
+}
+
+} // namespace
+
+/*! \brief Defines the row table \a table of the instruction set \a isa from the functions above. */
+#define X86SIMD_DEFINE_ROWS(table, isa_, name_) \
+    const x86simd_rows_t table = { \
+        isa_, name_, \
+        absdiff_row, arithmetic_row, multiply_row, bitwise_row, weighted_row, threshold_row, \
+        convertdepth_row, magnitude_row, filter3x3_row, convolve_row, integral_row, \
+        rgb2yuv_row, yuv2rgb_row, deinterleave_row, interleave_row, bilinear_row, warp_row, \
+    }
+
+#endif
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*!
+ * \file
+ * \brief The row kernels of the x86 SIMD target built for SSE4.2.
+ */
+
+#if !defined(__SSE4_2__)
+#error "x86simd_rows_sse42.cpp must be built with -msse4.2"
+#endif
+
+#include "x86simd_rows_impl.h"
+
+X86SIMD_DEFINE_ROWS(x86simd_rows_sse42, VX_CPU_VARIANT_SSE42, "SSE4.2");
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+// helpers
+
+/* reads pixel (x, y) of a mapped U1, U8 or S16 patch with the border rules of the C model,
+ * U1 patches start \a shift_u1 bits into their first byte */
+static vx_bool read_pixel(void *base, const vx_imagepatch_addressing_t *addr, vx_df_image format,
+                          vx_int32 x, vx_int32 y, const vx_border_t *borders, vx_uint32 shift_u1, vx_int32 *pixel)
+{
+    vx_int32 first = format == VX_DF_IMAGE_U1 ? (vx_int32)shift_u1 : 0;
+    vx_bool out_of_bounds = (x < first || y < 0 || x >= (vx_int32)addr->dim_x || y >= (vx_int32)addr->dim_y);
+    if (out_of_bounds)
+    {
+        if (borders->mode == VX_BORDER_UNDEFINED)
+            return vx_false_e;
+        if (borders->mode == VX_BORDER_CONSTANT)
+        {
+            if (format == VX_DF_IMAGE_U1)
+                *pixel = borders->constant_value.U1 ? 1 : 0;
+            else if (format == VX_DF_IMAGE_U8)
+                *pixel = borders->constant_value.U8;
+            else
+                *pixel = (vx_int16)borders->constant_value.S16;
+            return vx_true_e;
+        }
+    }
+
+    // bounded x/y
+    vx_uint32 bx = x < first ? (vx_uint32)first : x >= (vx_int32)addr->dim_x ? addr->dim_x - 1 : (vx_uint32)x;
+    vx_uint32 by = y < 0 ? 0 : y >= (vx_int32)addr->dim_y ? addr->dim_y - 1 : (vx_uint32)y;
+    const vx_uint8 *row = x86simdRow(base, addr, by);
+    if (format == VX_DF_IMAGE_U1)
+        *pixel = (row[bx / 8] >> (bx % 8)) & 1;
+    else if (format == VX_DF_IMAGE_U8)
+        *pixel = row[bx];
+    else
+        *pixel = ((const vx_int16 *)row)[bx];
+
+    return vx_true_e;
+}
+
+/* writes pixel \a x of a U1, U8 or S16 row */
+static void write_pixel(vx_uint8 *row, vx_df_image format, vx_uint32 x, vx_int32 v)
+{
+    if (format == VX_DF_IMAGE_U1)
+        row[x / 8] = (vx_uint8)((row[x / 8] & ~(1 << (x % 8))) | (v << (x % 8)));
+    else if (format == VX_DF_IMAGE_U8)
+        row[x] = (vx_uint8)v;
+    else
+        ((vx_int16 *)row)[x] = (vx_int16)v;
+}
+
+/* the source coordinate of output pixel \a x2 in the mapped patch, rounded down with fraction */
+static vx_float32 x86simdSourceCoord(vx_int32 x2, vx_float32 ratio, vx_uint32 start, vx_uint32 shift_u1, vx_int32 *x1)
+{
+    vx_float32 src = ((vx_float32)x2 + 0.5f) * ratio - 0.5f;
+    src = src - start + shift_u1;
+    vx_float32 min = floorf(src);
+    *x1 = (vx_int32)min;
+    return src - min;
+}
+
+// nearest neighbor, with the source columns of the output columns computed once
+static vx_status x86simdNearestScaling(vx_image src_image, vx_image dst_image, const vx_border_t *borders)
+{
+    vx_status status = VX_SUCCESS;
+    void *src_base = nullptr, *dst_base = nullptr;
+    vx_rectangle_t src_rect, dst_rect;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    vx_map_id src_map_id = 0, dst_map_id = 0;
+    vx_uint32 w1 = 0, h1 = 0, w2 = 0, h2 = 0;
+    vx_float32 wr, hr;
+    vx_df_image format = 0;
+    vx_int32 *xs = nullptr;
+
+    vxQueryImage(src_image, VX_IMAGE_WIDTH, &w1, sizeof(w1));
+    vxQueryImage(src_image, VX_IMAGE_HEIGHT, &h1, sizeof(h1));
+    vxQueryImage(src_image, VX_IMAGE_FORMAT, &format, sizeof(format));
+
+    vxQueryImage(dst_image, VX_IMAGE_WIDTH, &w2, sizeof(w2));
+    vxQueryImage(dst_image, VX_IMAGE_HEIGHT, &h2, sizeof(h2));
+
+    dst_rect.start_x = dst_rect.start_y = 0;
+    dst_rect.end_x = w2;
+    dst_rect.end_y = h2;
+
+    status |= vxGetValidRegionImage(src_image, &src_rect);
+    status |= vxMapImagePatch(src_image, &src_rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst_image, &dst_rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    wr = (vx_float32)w1/(vx_float32)w2;
+    hr = (vx_float32)h1/(vx_float32)h2;
+
+    if (status == VX_SUCCESS)
+    {
+        xs = (vx_int32 *)malloc(w2 * sizeof(vx_int32));
+        if (xs == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+    if (status == VX_SUCCESS)
+    {
+        vx_uint32 shift_u1 = format == VX_DF_IMAGE_U1 ? src_rect.start_x % 8 : 0;
+        for (vx_uint32 x2 = 0; x2 < w2; x2++)
+        {
+            if (x86simdSourceCoord((vx_int32)x2, wr, src_rect.start_x, shift_u1, &xs[x2]) >= 0.5f)
+                xs[x2]++;
+        }
+        for (vx_uint32 y2 = 0; y2 < h2; y2++)
+        {
+            vx_int32 y1;
+            if (x86simdSourceCoord((vx_int32)y2, hr, src_rect.start_y, 0, &y1) >= 0.5f)
+                y1++;
+            vx_uint8 *dst = x86simdRow(dst_base, &dst_addr, y2);
+            if (format == VX_DF_IMAGE_U8 && y1 >= 0 && y1 < (vx_int32)src_addr.dim_y)
+            {
+                /* rows inside the patch only go through the border rules at their ends */
+                const vx_uint8 *src = x86simdRow(src_base, &src_addr, (vx_uint32)y1);
+                for (vx_uint32 x2 = 0; x2 < w2; x2++)
+                {
+                    vx_int32 v;
+                    if (xs[x2] >= 0 && xs[x2] < (vx_int32)src_addr.dim_x)
+                        dst[x2] = src[xs[x2]];
+                    else if (read_pixel(src_base, &src_addr, format, xs[x2], y1, borders, shift_u1, &v))
+                        dst[x2] = (vx_uint8)v;
+                }
+            }
+            else
+            {
+                for (vx_uint32 x2 = 0; x2 < w2; x2++)
+                {
+                    vx_int32 v;
+                    if (read_pixel(src_base, &src_addr, format, xs[x2], y1, borders, shift_u1, &v))
+                        write_pixel(dst, format, x2, v);
+                }
+            }
+        }
+    }
+    free(xs);
+
+    status |= vxUnmapImagePatch(src_image, src_map_id);
+    status |= vxUnmapImagePatch(dst_image, dst_map_id);
+
+    return status;
+}
+
+/* one bilinear output pixel with the border fixups of the C model, vx_false_e when undefined */
+static vx_bool x86simdBilinearPixel(void *base, const vx_imagepatch_addressing_t *addr, vx_df_image format,
+                                    vx_int32 x1, vx_int32 y1, vx_float32 s, vx_float32 t,
+                                    const vx_border_t *borders, vx_uint32 shift_u1, vx_uint8 *out)
+{
+    vx_int32 tl = 0, tr = 0, bl = 0, br = 0;
+    vx_bool defined_tl = read_pixel(base, addr, format, x1 + 0, y1 + 0, borders, shift_u1, &tl);
+    vx_bool defined_tr = read_pixel(base, addr, format, x1 + 1, y1 + 0, borders, shift_u1, &tr);
+    vx_bool defined_bl = read_pixel(base, addr, format, x1 + 0, y1 + 1, borders, shift_u1, &bl);
+    vx_bool defined_br = read_pixel(base, addr, format, x1 + 1, y1 + 1, borders, shift_u1, &br);
+    vx_bool defined = (vx_bool)(defined_tl & defined_tr & defined_bl & defined_br);
+    if (defined == vx_false_e)
+    {
+        vx_bool defined_any = (vx_bool)(defined_tl | defined_tr | defined_bl | defined_br);
+        if (defined_any)
+        {
+            if ((defined_tl == vx_false_e || defined_tr == vx_false_e) && fabs(t - 1.0) <= 0.001)
+                defined_tl = defined_tr = vx_true_e;
+            else if ((defined_bl == vx_false_e || defined_br == vx_false_e) && fabs(t - 0.0) <= 0.001)
+                defined_bl = defined_br = vx_true_e;
+            if ((defined_tl == vx_false_e || defined_bl == vx_false_e) && fabs(s - 1.0) <= 0.001)
+                defined_tl = defined_bl = vx_true_e;
+            else if ((defined_tr == vx_false_e || defined_br == vx_false_e) && fabs(s - 0.0) <= 0.001)
+                defined_tr = defined_br = vx_true_e;
+            defined = (vx_bool)(defined_tl & defined_tr & defined_bl & defined_br);
+        }
+    }
+    if (defined == vx_false_e)
+        return vx_false_e;
+
+    vx_float32 ref =
+            (1 - s) * (1 - t) * (vx_uint8)tl +
+            (    s) * (1 - t) * (vx_uint8)tr +
+            (1 - s) * (    t) * (vx_uint8)bl +
+            (    s) * (    t) * (vx_uint8)br;
+    if (format == VX_DF_IMAGE_U1)   // Rounding instead of thresholding for U1 images
+        ref = ref + 0.5f;
+
+    if (format == VX_DF_IMAGE_U8 && ref > 255)
+        *out = 255;
+    else if (format == VX_DF_IMAGE_U1 && ref > 1)
+        *out = 1;
+    else
+        *out = (vx_uint8)ref;
+    return vx_true_e;
+}
+
+// bilinear, runs of output pixels with all four taps inside the patch go to the row kernel
+static vx_status x86simdBilinearScaling(vx_image src_image, vx_image dst_image, const vx_border_t *borders)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst_image);
+    vx_status status = VX_SUCCESS;
+    void *src_base = nullptr, *dst_base = nullptr;
+    vx_rectangle_t src_rect, dst_rect;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    vx_map_id src_map_id = 0, dst_map_id = 0;
+    vx_uint32 w1 = 0, h1 = 0, w2 = 0, h2 = 0;
+    vx_float32 wr, hr;
+    vx_df_image format = 0;
+    vx_int32 *xs = nullptr;
+    vx_float32 *ss = nullptr;
+
+    vxQueryImage(src_image, VX_IMAGE_WIDTH, &w1, sizeof(w1));
+    vxQueryImage(src_image, VX_IMAGE_HEIGHT, &h1, sizeof(h1));
+    vxQueryImage(src_image, VX_IMAGE_FORMAT, &format, sizeof(format));
+
+    vxQueryImage(dst_image, VX_IMAGE_WIDTH, &w2, sizeof(w2));
+    vxQueryImage(dst_image, VX_IMAGE_HEIGHT, &h2, sizeof(h2));
+
+    /* like the C model, only U1 and U8 images are written */
+    if (format != VX_DF_IMAGE_U1 && format != VX_DF_IMAGE_U8)
+        return VX_SUCCESS;
+
+    dst_rect.start_x = dst_rect.start_y = 0;
+    dst_rect.end_x = w2;
+    dst_rect.end_y = h2;
+
+    status |= vxGetValidRegionImage(src_image, &src_rect);
+    status |= vxMapImagePatch(src_image, &src_rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst_image, &dst_rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    wr = (vx_float32)w1/(vx_float32)w2;
+    hr = (vx_float32)h1/(vx_float32)h2;
+
+    if (status == VX_SUCCESS)
+    {
+        xs = (vx_int32 *)malloc(w2 * sizeof(vx_int32));
+        ss = (vx_float32 *)malloc(w2 * sizeof(vx_float32));
+        if (xs == nullptr || ss == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+    if (status == VX_SUCCESS)
+    {
+        vx_uint32 shift_u1 = format == VX_DF_IMAGE_U1 ? src_rect.start_x % 8 : 0;
+        for (vx_uint32 x2 = 0; x2 < w2; x2++)
+            ss[x2] = x86simdSourceCoord((vx_int32)x2, wr, src_rect.start_x, shift_u1, &xs[x2]);
+        for (vx_uint32 y2 = 0; y2 < h2; y2++)
+        {
+            vx_int32 y1;
+            vx_float32 t = x86simdSourceCoord((vx_int32)y2, hr, src_rect.start_y, 0, &y1);
+            vx_bool rows_inside = (format == VX_DF_IMAGE_U8 && y1 >= 0 && y1 + 1 < (vx_int32)src_addr.dim_y)
+                                ? vx_true_e : vx_false_e;
+            vx_uint8 *dst = x86simdRow(dst_base, &dst_addr, y2);
+            vx_uint32 x2 = 0;
+            while (x2 < w2)
+            {
+                vx_uint32 run = x2;
+                while (rows_inside && run < w2 && xs[run] >= 0 && xs[run] + 1 < (vx_int32)src_addr.dim_x)
+                    run++;
+                if (run > x2)
+                {
+                    rows->bilinear(x86simdRow(src_base, &src_addr, (vx_uint32)y1), x86simdRow(src_base, &src_addr, (vx_uint32)y1 + 1),
+                                   xs + x2, ss + x2, t, dst + x2, run - x2);
+                    x2 = run;
+                    continue;
+                }
+                vx_uint8 v;
+                if (x86simdBilinearPixel(src_base, &src_addr, format, xs[x2], y1, ss[x2], t, borders, shift_u1, &v))
+                    write_pixel(dst, format, x2, v);
+                x2++;
+            }
+        }
+    }
+    free(xs);
+    free(ss);
+
+    status |= vxUnmapImagePatch(src_image, src_map_id);
+    status |= vxUnmapImagePatch(dst_image, dst_map_id);
+
+    return status;
+}
+
+// nodeless version of the Scale Image kernel
+vx_status vxScaleImage(vx_image src_image, vx_image dst_image, vx_scalar stype, vx_border_t *bordermode, vx_float64 *interm, vx_size size)
+{
+    vx_status status = VX_FAILURE;
+    vx_enum type = 0;
+
+    vxCopyScalar(stype, &type, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    if (interm && size)
+    {
+        if (type == VX_INTERPOLATION_BILINEAR)
+        {
+            status = x86simdBilinearScaling(src_image, dst_image, bordermode);
+        }
+        else if (type == VX_INTERPOLATION_AREA || type == VX_INTERPOLATION_NEAREST_NEIGHBOR)
+        {
+            /* area sampling is nearest neighbor, as in the C model */
+            status = x86simdNearestScaling(src_image, dst_image, bordermode);
+        }
+    }
+    else
+    {
+        status = VX_ERROR_NO_RESOURCES;
+    }
+
+    return status;
+}
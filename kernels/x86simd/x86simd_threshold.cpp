@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+// nodeless version of the Threshold kernel
+vx_status vxThreshold(vx_image src_image, vx_threshold threshold, vx_image dst_image)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst_image);
+    vx_enum type = 0;
+    vx_rectangle_t rect;
+    vx_imagepatch_addressing_t src_addr, dst_addr;
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_pixel_value_t value, lower, upper, true_value, false_value;
+    vx_enum in_format = 0, out_format = 0;
+    vx_int32 lo = 0, hi = 0;
+    vx_uint8 t = 0, f = 0;
+    vx_uint8 *bytes = nullptr;
+    vx_status status = VX_SUCCESS;
+
+    vxQueryThreshold(threshold, VX_THRESHOLD_TYPE, &type, sizeof(type));
+    vxQueryThreshold(threshold, VX_THRESHOLD_INPUT_FORMAT, &in_format, sizeof(in_format));
+    vxQueryThreshold(threshold, VX_THRESHOLD_OUTPUT_FORMAT, &out_format, sizeof(out_format));
+    vxQueryThreshold(threshold, VX_THRESHOLD_TRUE_VALUE, &true_value, sizeof(true_value));
+    vxQueryThreshold(threshold, VX_THRESHOLD_FALSE_VALUE, &false_value, sizeof(false_value));
+    if (type == VX_THRESHOLD_TYPE_BINARY)
+    {
+        vxQueryThreshold(threshold, VX_THRESHOLD_THRESHOLD_VALUE, &value, sizeof(value));
+        lo = hi = in_format == VX_DF_IMAGE_S16 ? value.S16 : value.U8;
+    }
+    else
+    {
+        vxQueryThreshold(threshold, VX_THRESHOLD_THRESHOLD_LOWER, &lower, sizeof(lower));
+        vxQueryThreshold(threshold, VX_THRESHOLD_THRESHOLD_UPPER, &upper, sizeof(upper));
+        lo = in_format == VX_DF_IMAGE_S16 ? lower.S16 : lower.U8;
+        hi = in_format == VX_DF_IMAGE_S16 ? upper.S16 : upper.U8;
+    }
+    if (out_format == VX_DF_IMAGE_U1)
+    {
+        /* the C model reads the false value of a binary U8 threshold from its U8 member */
+        t = true_value.U1 ? 1 : 0;
+        if (type == VX_THRESHOLD_TYPE_BINARY && in_format != VX_DF_IMAGE_S16)
+            f = false_value.U8 ? 1 : 0;
+        else
+            f = false_value.U1 ? 1 : 0;
+    }
+    else
+    {
+        t = true_value.U8;
+        f = false_value.U8;
+    }
+
+    status  = vxGetValidRegionImage(src_image, &rect);
+    status |= vxMapImagePatch(src_image, &rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst_image, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    if (status == VX_SUCCESS && out_format == VX_DF_IMAGE_U1)
+    {
+        bytes = (vx_uint8 *)malloc(src_addr.dim_x);
+        if (bytes == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+    if (status == VX_SUCCESS)
+    {
+        vx_bool range = type == VX_THRESHOLD_TYPE_RANGE ? vx_true_e : vx_false_e;
+        for (vx_uint32 y = 0; y < src_addr.dim_y; y++)
+        {
+            vx_uint8 *d = x86simdRow(dst_base, &dst_addr, y);
+            rows->threshold(x86simdRow(src_base, &src_addr, y), in_format, bytes ? bytes : d, lo, hi, t, f, range, src_addr.dim_x);
+            if (bytes)
+                x86simdPackU1(bytes, d, rect.start_x % 8, src_addr.dim_x);
+        }
+    }
+    free(bytes);
+
+    status |= vxUnmapImagePatch(src_image, src_map_id);
+    status |= vxUnmapImagePatch(dst_image, dst_map_id);
+
+    return status;
+}
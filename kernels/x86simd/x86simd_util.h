@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _VX_X86SIMD_UTIL_H_
+#define _VX_X86SIMD_UTIL_H_
+
+/*!
+ * \file
+ * \brief Row helpers shared by the kernels of the x86 SIMD target.
+ * \details These give the row kernels plain arrays to work on: row pointers of
+ * mapped patches, neighborhood rows padded by the border mode with the rules of
+ * vxReadRectangle, and U1 rows unpacked to one byte per pixel and back.
+ */
+
+#include <string.h>
+#include "x86simd.h"
+#include "x86simd_rows.h"
+
+/*! \brief The first byte of row \a y of a mapped patch. */
+static inline vx_uint8 *x86simdRow(void *base, const vx_imagepatch_addressing_t *addr, vx_uint32 y)
+{
+    return (vx_uint8 *)base + (vx_size)y * addr->stride_y;
+}
+
+/*! \brief Unpacks \a n pixels of a U1 row, starting at bit \a first, to 0 or 1 per byte. */
+static inline void x86simdUnpackU1(const vx_uint8 *row, vx_uint32 first, vx_uint8 *dst, vx_uint32 n)
+{
+    for (vx_uint32 i = 0; i < n; i++)
+    {
+        vx_uint32 bit = first + i;
+        dst[i] = (vx_uint8)((row[bit / 8] >> (bit % 8)) & 1);
+    }
+}
+
+/*! \brief Packs \a n bytes into a U1 row from bit \a first on, any non zero byte sets its bit. */
+static inline void x86simdPackU1(const vx_uint8 *src, vx_uint8 *row, vx_uint32 first, vx_uint32 n)
+{
+    for (vx_uint32 i = 0; i < n; i++)
+    {
+        vx_uint32 bit = first + i;
+        row[bit / 8] = (vx_uint8)((row[bit / 8] & ~(1 << (bit % 8))) | ((src[i] != 0 ? 1 : 0) << (bit % 8)));
+    }
+}
+
+/*! \brief Copies row \a y of a U1, U8 or S16 patch into \a dst with \a radius pixels of
+ * border on both sides, U1 rows are unpacked to bytes from bit \a shift_u1 on.
+ * \details Rows and columns outside the patch take the constant of a constant border
+ * and replicate the nearest pixel otherwise, like vxReadRectangle does. \a dst holds
+ * width + 2 * radius pixels, where width excludes the \a shift_u1 bits of U1 rows.
+ */
+static inline void x86simdBorderRow(void *base, const vx_imagepatch_addressing_t *addr, vx_df_image format,
+                                    vx_uint32 shift_u1, vx_int32 y, vx_uint32 radius,
+                                    const vx_border_t *border, void *dst)
+{
+    vx_uint32 width = addr->dim_x - (format == VX_DF_IMAGE_U1 ? shift_u1 : 0);
+    vx_int32 height = (vx_int32)addr->dim_y;
+    vx_uint32 padded = width + 2 * radius;
+    vx_bool constant = border->mode == VX_BORDER_CONSTANT ? vx_true_e : vx_false_e;
+
+    if (format == VX_DF_IMAGE_S16)
+    {
+        vx_int16 *d = (vx_int16 *)dst;
+        vx_int16 cval = (vx_int16)border->constant_value.U16;
+        if (constant && (y < 0 || y >= height))
+        {
+            for (vx_uint32 i = 0; i < padded; i++)
+                d[i] = cval;
+            return;
+        }
+        const vx_int16 *s = (const vx_int16 *)x86simdRow(base, addr, y < 0 ? 0 : (y >= height ? height - 1 : y));
+        memcpy(d + radius, s, width * sizeof(vx_int16));
+        for (vx_uint32 i = 0; i < radius; i++)
+        {
+            d[i] = constant ? cval : s[0];
+            d[radius + width + i] = constant ? cval : s[width - 1];
+        }
+    }
+    else
+    {
+        vx_uint8 *d = (vx_uint8 *)dst;
+        vx_uint8 cval = format == VX_DF_IMAGE_U1 ? (vx_uint8)(border->constant_value.U1 ? 1 : 0) : border->constant_value.U8;
+        if (constant && (y < 0 || y >= height))
+        {
+            memset(d, cval, padded);
+            return;
+        }
+        const vx_uint8 *s = x86simdRow(base, addr, y < 0 ? 0 : (y >= height ? height - 1 : y));
+        if (format == VX_DF_IMAGE_U1)
+            x86simdUnpackU1(s, shift_u1, d + radius, width);
+        else
+            memcpy(d + radius, s, width);
+        memset(d, constant ? cval : d[radius], radius);
+        memset(d + radius + width, constant ? cval : d[radius + width - 1], radius);
+    }
+}
+
+/*! \brief Add, subtract, min or max of U8/S16 images with the \a policy of add and subtract. */
+vx_status x86simdArithmetic(vx_image in0, vx_image in1, vx_enum policy, vx_image output, enum x86simd_arith_e op);
+
+/*! \brief 3x3 neighborhood filter of a U8 (or U1 for median, erode and dilate) image. */
+vx_status x86simdFilter3x3(vx_image src, vx_image dst, const vx_border_t *borders, enum x86simd_filter_e op);
+
+#endif
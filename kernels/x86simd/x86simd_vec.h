@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _VX_X86SIMD_VEC_H_
+#define _VX_X86SIMD_VEC_H_
+
+/*!
+ * \file
+ * \brief The width agnostic vector vocabulary of the x86 SIMD row kernels.
+ * \details One register of the widest instruction set the translation unit is
+ * built for: SSE4.2 (16 bytes, of which SSE4.1 is used), AVX2 (32 bytes) or
+ * AVX-512BW (64 bytes). The
+ * packs return their lanes in natural order on all of them, the AVX2 and
+ * AVX-512 packs work per 128 bit lane and are permuted back. Only included by
+ * the x86simd_rows_<isa>.cpp translation units, each of which gets its own
+ * copy through the anonymous namespace.
+ */
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#if !defined(__SSE4_1__)
+#error "The x86simd row kernels need at least SSE4.1 (-msse4.1)"
+#endif
+
+namespace {
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+typedef __m512i vi;
+typedef __m512 vf;
+typedef __m512d vd;
+typedef __m256i vh;
+#define X86SIMD_VB (64)
+
+inline vi vload(const void *p) { return _mm512_loadu_si512(p); }
+inline void vstore(void *p, vi v) { _mm512_storeu_si512(p, v); }
+inline vh hload(const void *p) { return _mm256_loadu_si256((const __m256i *)p); }
+inline void hstore(void *p, vh v) { _mm256_storeu_si256((__m256i *)p, v); }
+inline void qstore(void *p, vi v) { _mm_storeu_si128((__m128i *)p, _mm512_castsi512_si128(v)); }
+inline vi vzero() { return _mm512_setzero_si512(); }
+inline vi vset8(int x) { return _mm512_set1_epi8((char)x); }
+inline vi vset16(int x) { return _mm512_set1_epi16((short)x); }
+inline vi vset32(int x) { return _mm512_set1_epi32(x); }
+
+inline vi vand(vi a, vi b) { return _mm512_and_si512(a, b); }
+inline vi vor(vi a, vi b) { return _mm512_or_si512(a, b); }
+inline vi vxor(vi a, vi b) { return _mm512_xor_si512(a, b); }
+inline vi vnot(vi a) { return _mm512_ternarylogic_epi32(a, a, a, 0x55); }
+inline vi vselect(vi m, vi a, vi b) { return _mm512_ternarylogic_epi32(m, a, b, 0xCA); }
+
+inline vi vadd8(vi a, vi b) { return _mm512_add_epi8(a, b); }
+inline vi vsub8(vi a, vi b) { return _mm512_sub_epi8(a, b); }
+inline vi vaddsu8(vi a, vi b) { return _mm512_adds_epu8(a, b); }
+inline vi vsubsu8(vi a, vi b) { return _mm512_subs_epu8(a, b); }
+inline vi vminu8(vi a, vi b) { return _mm512_min_epu8(a, b); }
+inline vi vmaxu8(vi a, vi b) { return _mm512_max_epu8(a, b); }
+inline vi vcmpgts8(vi a, vi b) { return _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a, b)); }
+
+inline vi vadd16(vi a, vi b) { return _mm512_add_epi16(a, b); }
+inline vi vsub16(vi a, vi b) { return _mm512_sub_epi16(a, b); }
+inline vi vaddss16(vi a, vi b) { return _mm512_adds_epi16(a, b); }
+inline vi vsubss16(vi a, vi b) { return _mm512_subs_epi16(a, b); }
+inline vi vmins16(vi a, vi b) { return _mm512_min_epi16(a, b); }
+inline vi vmaxs16(vi a, vi b) { return _mm512_max_epi16(a, b); }
+inline vi vminu16(vi a, vi b) { return _mm512_min_epu16(a, b); }
+inline vi vmaxu16(vi a, vi b) { return _mm512_max_epu16(a, b); }
+inline vi vmullo16(vi a, vi b) { return _mm512_mullo_epi16(a, b); }
+inline vi vmulhi16(vi a, vi b) { return _mm512_mulhi_epi16(a, b); }
+inline vi vmulhiu16(vi a, vi b) { return _mm512_mulhi_epu16(a, b); }
+inline vi vmadd16(vi a, vi b) { return _mm512_madd_epi16(a, b); }
+inline vi vsll16(vi a, int n) { return _mm512_sll_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vsrl16(vi a, int n) { return _mm512_srl_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vsra16(vi a, int n) { return _mm512_sra_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vcmpgts16(vi a, vi b) { return _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a, b)); }
+inline vi vunpacklo16(vi a, vi b) { return _mm512_unpacklo_epi16(a, b); }
+inline vi vunpackhi16(vi a, vi b) { return _mm512_unpackhi_epi16(a, b); }
+
+inline vi vadd32(vi a, vi b) { return _mm512_add_epi32(a, b); }
+inline vi vsub32(vi a, vi b) { return _mm512_sub_epi32(a, b); }
+inline vi vmins32(vi a, vi b) { return _mm512_min_epi32(a, b); }
+inline vi vmaxs32(vi a, vi b) { return _mm512_max_epi32(a, b); }
+inline vi vminu32(vi a, vi b) { return _mm512_min_epu32(a, b); }
+inline vi vmullo32(vi a, vi b) { return _mm512_mullo_epi32(a, b); }
+inline vi vsll32(vi a, int n) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+inline vi vsrl32(vi a, int n) { return _mm512_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+inline vi vsra32(vi a, int n) { return _mm512_sra_epi32(a, _mm_cvtsi32_si128(n)); }
+
+/* widening loads of half and quarter registers */
+inline vi vloadu8x16(const void *p) { return _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)p)); }
+inline vi vloadu8x32(const void *p) { return _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)p)); }
+inline vi vloads16x32(const void *p) { return _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)p)); }
+inline vi vloadu16x32(const void *p) { return _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)p)); }
+
+/* natural order narrowing */
+inline vi vfix64(vi v) { return _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), v); }
+inline vi vpacks32(vi a, vi b) { return vfix64(_mm512_packs_epi32(a, b)); }
+inline vi vpackus32(vi a, vi b) { return vfix64(_mm512_packus_epi32(a, b)); }
+inline vi vpacks16(vi a, vi b) { return vfix64(_mm512_packs_epi16(a, b)); }
+inline vi vpackus16(vi a, vi b) { return vfix64(_mm512_packus_epi16(a, b)); }
+inline vi vpacks32lane(vi a, vi b) { return _mm512_packs_epi32(a, b); }
+inline vi vpackus32lane(vi a, vi b) { return _mm512_packus_epi32(a, b); }
+inline vh vlo(vi v) { return _mm512_castsi512_si256(v); }
+inline vh vhi(vi v) { return _mm512_extracti64x4_epi64(v, 1); }
+
+/* inclusive prefix sum of the 32 bit lanes */
+inline vi vprefix32(vi v)
+{
+    v = _mm512_add_epi32(v, _mm512_bslli_epi128(v, 4));
+    v = _mm512_add_epi32(v, _mm512_bslli_epi128(v, 8));
+    vi s = _mm512_shuffle_epi32(v, _MM_PERM_DDDD);
+    vi p = _mm512_maskz_shuffle_i32x4(0xFFF0, s, s, 0x90);
+    vi q = _mm512_add_epi32(p, _mm512_maskz_shuffle_i32x4(0xFF00, _mm512_add_epi32(s, p), _mm512_add_epi32(s, p), 0x40));
+    return _mm512_add_epi32(v, q);
+}
+inline vi vbroadcastlast32(vi v) { return _mm512_permutexvar_epi32(_mm512_set1_epi32(15), v); }
+
+inline vf vsetf(float x) { return _mm512_set1_ps(x); }
+inline vf vaddf(vf a, vf b) { return _mm512_add_ps(a, b); }
+inline vf vsubf(vf a, vf b) { return _mm512_sub_ps(a, b); }
+inline vf vmulf(vf a, vf b) { return _mm512_mul_ps(a, b); }
+inline vf vdivf(vf a, vf b) { return _mm512_div_ps(a, b); }
+inline vf vloadf(const float *p) { return _mm512_loadu_ps(p); }
+inline void vstoref(float *p, vf v) { _mm512_storeu_ps(p, v); }
+inline vf vcvtf(vi v) { return _mm512_cvtepi32_ps(v); }
+inline vi vcvttf(vf v) { return _mm512_cvttps_epi32(v); }
+
+inline vd vsetd(double x) { return _mm512_set1_pd(x); }
+inline vd vaddd(vd a, vd b) { return _mm512_add_pd(a, b); }
+inline vd vsubd(vd a, vd b) { return _mm512_sub_pd(a, b); }
+inline vd vmuld(vd a, vd b) { return _mm512_mul_pd(a, b); }
+inline vd vsqrtd(vd a) { return _mm512_sqrt_pd(a); }
+inline vd vcvtdlo(vi v) { return _mm512_cvtepi32_pd(vlo(v)); }
+inline vd vcvtdhi(vi v) { return _mm512_cvtepi32_pd(vhi(v)); }
+inline vi vcvttd(vd lo, vd hi) { return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(lo)), _mm512_cvttpd_epi32(hi), 1); }
+
+#elif defined(__AVX2__)
+
+typedef __m256i vi;
+typedef __m256 vf;
+typedef __m256d vd;
+typedef __m128i vh;
+#define X86SIMD_VB (32)
+
+inline vi vload(const void *p) { return _mm256_loadu_si256((const __m256i *)p); }
+inline void vstore(void *p, vi v) { _mm256_storeu_si256((__m256i *)p, v); }
+inline vh hload(const void *p) { return _mm_loadu_si128((const __m128i *)p); }
+inline void hstore(void *p, vh v) { _mm_storeu_si128((__m128i *)p, v); }
+inline void qstore(void *p, vi v) { _mm_storel_epi64((__m128i *)p, _mm256_castsi256_si128(v)); }
+inline vi vzero() { return _mm256_setzero_si256(); }
+inline vi vset8(int x) { return _mm256_set1_epi8((char)x); }
+inline vi vset16(int x) { return _mm256_set1_epi16((short)x); }
+inline vi vset32(int x) { return _mm256_set1_epi32(x); }
+
+inline vi vand(vi a, vi b) { return _mm256_and_si256(a, b); }
+inline vi vor(vi a, vi b) { return _mm256_or_si256(a, b); }
+inline vi vxor(vi a, vi b) { return _mm256_xor_si256(a, b); }
+inline vi vnot(vi a) { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+inline vi vselect(vi m, vi a, vi b) { return _mm256_blendv_epi8(b, a, m); }
+
+inline vi vadd8(vi a, vi b) { return _mm256_add_epi8(a, b); }
+inline vi vsub8(vi a, vi b) { return _mm256_sub_epi8(a, b); }
+inline vi vaddsu8(vi a, vi b) { return _mm256_adds_epu8(a, b); }
+inline vi vsubsu8(vi a, vi b) { return _mm256_subs_epu8(a, b); }
+inline vi vminu8(vi a, vi b) { return _mm256_min_epu8(a, b); }
+inline vi vmaxu8(vi a, vi b) { return _mm256_max_epu8(a, b); }
+inline vi vcmpgts8(vi a, vi b) { return _mm256_cmpgt_epi8(a, b); }
+
+inline vi vadd16(vi a, vi b) { return _mm256_add_epi16(a, b); }
+inline vi vsub16(vi a, vi b) { return _mm256_sub_epi16(a, b); }
+inline vi vaddss16(vi a, vi b) { return _mm256_adds_epi16(a, b); }
+inline vi vsubss16(vi a, vi b) { return _mm256_subs_epi16(a, b); }
+inline vi vmins16(vi a, vi b) { return _mm256_min_epi16(a, b); }
+inline vi vmaxs16(vi a, vi b) { return _mm256_max_epi16(a, b); }
+inline vi vminu16(vi a, vi b) { return _mm256_min_epu16(a, b); }
+inline vi vmaxu16(vi a, vi b) { return _mm256_max_epu16(a, b); }
+inline vi vmullo16(vi a, vi b) { return _mm256_mullo_epi16(a, b); }
+inline vi vmulhi16(vi a, vi b) { return _mm256_mulhi_epi16(a, b); }
+inline vi vmulhiu16(vi a, vi b) { return _mm256_mulhi_epu16(a, b); }
+inline vi vmadd16(vi a, vi b) { return _mm256_madd_epi16(a, b); }
+inline vi vsll16(vi a, int n) { return _mm256_sll_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vsrl16(vi a, int n) { return _mm256_srl_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vsra16(vi a, int n) { return _mm256_sra_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vcmpgts16(vi a, vi b) { return _mm256_cmpgt_epi16(a, b); }
+inline vi vunpacklo16(vi a, vi b) { return _mm256_unpacklo_epi16(a, b); }
+inline vi vunpackhi16(vi a, vi b) { return _mm256_unpackhi_epi16(a, b); }
+
+inline vi vadd32(vi a, vi b) { return _mm256_add_epi32(a, b); }
+inline vi vsub32(vi a, vi b) { return _mm256_sub_epi32(a, b); }
+inline vi vmins32(vi a, vi b) { return _mm256_min_epi32(a, b); }
+inline vi vmaxs32(vi a, vi b) { return _mm256_max_epi32(a, b); }
+inline vi vminu32(vi a, vi b) { return _mm256_min_epu32(a, b); }
+inline vi vmullo32(vi a, vi b) { return _mm256_mullo_epi32(a, b); }
+inline vi vsll32(vi a, int n) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+inline vi vsrl32(vi a, int n) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+inline vi vsra32(vi a, int n) { return _mm256_sra_epi32(a, _mm_cvtsi32_si128(n)); }
+
+inline vi vloadu8x16(const void *p) { return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)p)); }
+inline vi vloadu8x32(const void *p) { return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)p)); }
+inline vi vloads16x32(const void *p) { return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)p)); }
+inline vi vloadu16x32(const void *p) { return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)p)); }
+
+inline vi vfix64(vi v) { return _mm256_permute4x64_epi64(v, 0xD8); }
+inline vi vpacks32(vi a, vi b) { return vfix64(_mm256_packs_epi32(a, b)); }
+inline vi vpackus32(vi a, vi b) { return vfix64(_mm256_packus_epi32(a, b)); }
+inline vi vpacks16(vi a, vi b) { return vfix64(_mm256_packs_epi16(a, b)); }
+inline vi vpackus16(vi a, vi b) { return vfix64(_mm256_packus_epi16(a, b)); }
+inline vi vpacks32lane(vi a, vi b) { return _mm256_packs_epi32(a, b); }
+inline vi vpackus32lane(vi a, vi b) { return _mm256_packus_epi32(a, b); }
+inline vh vlo(vi v) { return _mm256_castsi256_si128(v); }
+inline vh vhi(vi v) { return _mm256_extracti128_si256(v, 1); }
+
+inline vi vprefix32(vi v)
+{
+    v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+    v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+    /* the last lane of the low half carries into the high half */
+    vi carry = _mm256_shuffle_epi32(_mm256_permute2x128_si256(v, v, 0x08), 0xFF);
+    return _mm256_add_epi32(v, carry);
+}
+inline vi vbroadcastlast32(vi v) { return _mm256_permutevar8x32_epi32(v, _mm256_set1_epi32(7)); }
+
+inline vf vsetf(float x) { return _mm256_set1_ps(x); }
+inline vf vaddf(vf a, vf b) { return _mm256_add_ps(a, b); }
+inline vf vsubf(vf a, vf b) { return _mm256_sub_ps(a, b); }
+inline vf vmulf(vf a, vf b) { return _mm256_mul_ps(a, b); }
+inline vf vdivf(vf a, vf b) { return _mm256_div_ps(a, b); }
+inline vf vloadf(const float *p) { return _mm256_loadu_ps(p); }
+inline void vstoref(float *p, vf v) { _mm256_storeu_ps(p, v); }
+inline vf vcvtf(vi v) { return _mm256_cvtepi32_ps(v); }
+inline vi vcvttf(vf v) { return _mm256_cvttps_epi32(v); }
+
+inline vd vsetd(double x) { return _mm256_set1_pd(x); }
+inline vd vaddd(vd a, vd b) { return _mm256_add_pd(a, b); }
+inline vd vsubd(vd a, vd b) { return _mm256_sub_pd(a, b); }
+inline vd vmuld(vd a, vd b) { return _mm256_mul_pd(a, b); }
+inline vd vsqrtd(vd a) { return _mm256_sqrt_pd(a); }
+inline vd vcvtdlo(vi v) { return _mm256_cvtepi32_pd(vlo(v)); }
+inline vd vcvtdhi(vi v) { return _mm256_cvtepi32_pd(vhi(v)); }
+inline vi vcvttd(vd lo, vd hi) { return _mm256_set_m128i(_mm256_cvttpd_epi32(hi), _mm256_cvttpd_epi32(lo)); }
+
+#else
+
+typedef __m128i vi;
+typedef __m128 vf;
+typedef __m128d vd;
+typedef __m128i vh;
+#define X86SIMD_VB (16)
+
+inline vi vload(const void *p) { return _mm_loadu_si128((const __m128i *)p); }
+inline void vstore(void *p, vi v) { _mm_storeu_si128((__m128i *)p, v); }
+inline vh hload(const void *p) { return _mm_loadl_epi64((const __m128i *)p); }
+inline void hstore(void *p, vh v) { _mm_storel_epi64((__m128i *)p, v); }
+inline void qstore(void *p, vi v) { _mm_storeu_si32(p, v); }
+inline vi vzero() { return _mm_setzero_si128(); }
+inline vi vset8(int x) { return _mm_set1_epi8((char)x); }
+inline vi vset16(int x) { return _mm_set1_epi16((short)x); }
+inline vi vset32(int x) { return _mm_set1_epi32(x); }
+
+inline vi vand(vi a, vi b) { return _mm_and_si128(a, b); }
+inline vi vor(vi a, vi b) { return _mm_or_si128(a, b); }
+inline vi vxor(vi a, vi b) { return _mm_xor_si128(a, b); }
+inline vi vnot(vi a) { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+inline vi vselect(vi m, vi a, vi b) { return _mm_blendv_epi8(b, a, m); }
+
+inline vi vadd8(vi a, vi b) { return _mm_add_epi8(a, b); }
+inline vi vsub8(vi a, vi b) { return _mm_sub_epi8(a, b); }
+inline vi vaddsu8(vi a, vi b) { return _mm_adds_epu8(a, b); }
+inline vi vsubsu8(vi a, vi b) { return _mm_subs_epu8(a, b); }
+inline vi vminu8(vi a, vi b) { return _mm_min_epu8(a, b); }
+inline vi vmaxu8(vi a, vi b) { return _mm_max_epu8(a, b); }
+inline vi vcmpgts8(vi a, vi b) { return _mm_cmpgt_epi8(a, b); }
+
+inline vi vadd16(vi a, vi b) { return _mm_add_epi16(a, b); }
+inline vi vsub16(vi a, vi b) { return _mm_sub_epi16(a, b); }
+inline vi vaddss16(vi a, vi b) { return _mm_adds_epi16(a, b); }
+inline vi vsubss16(vi a, vi b) { return _mm_subs_epi16(a, b); }
+inline vi vmins16(vi a, vi b) { return _mm_min_epi16(a, b); }
+inline vi vmaxs16(vi a, vi b) { return _mm_max_epi16(a, b); }
+inline vi vminu16(vi a, vi b) { return _mm_min_epu16(a, b); }
+inline vi vmaxu16(vi a, vi b) { return _mm_max_epu16(a, b); }
+inline vi vmullo16(vi a, vi b) { return _mm_mullo_epi16(a, b); }
+inline vi vmulhi16(vi a, vi b) { return _mm_mulhi_epi16(a, b); }
+inline vi vmulhiu16(vi a, vi b) { return _mm_mulhi_epu16(a, b); }
+inline vi vmadd16(vi a, vi b) { return _mm_madd_epi16(a, b); }
+inline vi vsll16(vi a, int n) { return _mm_sll_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vsrl16(vi a, int n) { return _mm_srl_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vsra16(vi a, int n) { return _mm_sra_epi16(a, _mm_cvtsi32_si128(n)); }
+inline vi vcmpgts16(vi a, vi b) { return _mm_cmpgt_epi16(a, b); }
+inline vi vunpacklo16(vi a, vi b) { return _mm_unpacklo_epi16(a, b); }
+inline vi vunpackhi16(vi a, vi b) { return _mm_unpackhi_epi16(a, b); }
+
+inline vi vadd32(vi a, vi b) { return _mm_add_epi32(a, b); }
+inline vi vsub32(vi a, vi b) { return _mm_sub_epi32(a, b); }
+inline vi vmins32(vi a, vi b) { return _mm_min_epi32(a, b); }
+inline vi vmaxs32(vi a, vi b) { return _mm_max_epi32(a, b); }
+inline vi vminu32(vi a, vi b) { return _mm_min_epu32(a, b); }
+inline vi vmullo32(vi a, vi b) { return _mm_mullo_epi32(a, b); }
+inline vi vsll32(vi a, int n) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+inline vi vsrl32(vi a, int n) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+inline vi vsra32(vi a, int n) { return _mm_sra_epi32(a, _mm_cvtsi32_si128(n)); }
+
+inline vi vloadu8x16(const void *p) { return _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)p)); }
+inline vi vloadu8x32(const void *p) { return _mm_cvtepu8_epi32(_mm_loadu_si32(p)); }
+inline vi vloads16x32(const void *p) { return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)p)); }
+inline vi vloadu16x32(const void *p) { return _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)p)); }
+
+inline vi vpacks32(vi a, vi b) { return _mm_packs_epi32(a, b); }
+inline vi vpackus32(vi a, vi b) { return _mm_packus_epi32(a, b); }
+inline vi vpacks16(vi a, vi b) { return _mm_packs_epi16(a, b); }
+inline vi vpackus16(vi a, vi b) { return _mm_packus_epi16(a, b); }
+inline vi vpacks32lane(vi a, vi b) { return _mm_packs_epi32(a, b); }
+inline vi vpackus32lane(vi a, vi b) { return _mm_packus_epi32(a, b); }
+inline vh vlo(vi v) { return v; }
+inline vh vhi(vi v) { return _mm_unpackhi_epi64(v, v); }
+
+inline vi vprefix32(vi v)
+{
+    v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+    return _mm_add_epi32(v, _mm_slli_si128(v, 8));
+}
+inline vi vbroadcastlast32(vi v) { return _mm_shuffle_epi32(v, 0xFF); }
+
+inline vf vsetf(float x) { return _mm_set1_ps(x); }
+inline vf vaddf(vf a, vf b) { return _mm_add_ps(a, b); }
+inline vf vsubf(vf a, vf b) { return _mm_sub_ps(a, b); }
+inline vf vmulf(vf a, vf b) { return _mm_mul_ps(a, b); }
+inline vf vdivf(vf a, vf b) { return _mm_div_ps(a, b); }
+inline vf vloadf(const float *p) { return _mm_loadu_ps(p); }
+inline void vstoref(float *p, vf v) { _mm_storeu_ps(p, v); }
+inline vf vcvtf(vi v) { return _mm_cvtepi32_ps(v); }
+inline vi vcvttf(vf v) { return _mm_cvttps_epi32(v); }
+
+inline vd vsetd(double x) { return _mm_set1_pd(x); }
+inline vd vaddd(vd a, vd b) { return _mm_add_pd(a, b); }
+inline vd vsubd(vd a, vd b) { return _mm_sub_pd(a, b); }
+inline vd vmuld(vd a, vd b) { return _mm_mul_pd(a, b); }
+inline vd vsqrtd(vd a) { return _mm_sqrt_pd(a); }
+inline vd vcvtdlo(vi v) { return _mm_cvtepi32_pd(v); }
+inline vd vcvtdhi(vi v) { return _mm_cvtepi32_pd(_mm_unpackhi_epi64(v, v)); }
+inline vi vcvttd(vd lo, vd hi) { return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi)); }
+
+#endif
+
+/*! \brief The number of 8, 16 and 32 bit lanes of one register */
+enum {
+    VN8 = X86SIMD_VB,
+    VN16 = X86SIMD_VB / 2,
+    VN32 = X86SIMD_VB / 4,
+};
+
+/* u8 lanes of one register compared as unsigned, all ones where a > b */
+inline vi vcmpgtu8(vi a, vi b) { return vcmpgts8(vxor(a, vset8(0x80)), vxor(b, vset8(0x80))); }
+
+/* 16 bit lanes truncated to their low 8 bits, two registers into one */
+inline vi vnarrow16(vi a, vi b) { return vpackus16(vand(a, vset16(0xFF)), vand(b, vset16(0xFF))); }
+
+/* 32 bit lanes truncated to their low 16 bits, two registers into one */
+inline vi vnarrow32(vi a, vi b) { return vpackus32(vand(a, vset32(0xFFFF)), vand(b, vset32(0xFFFF))); }
+
+} // namespace
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include "x86simd_util.h"
+
+/* reads the U1 or U8 pixel at the truncated position (x, y) with the border rules of the C model */
+static vx_bool read_pixel(void *base, const vx_imagepatch_addressing_t *addr, vx_df_image format,
+                          vx_float32 x, vx_float32 y, const vx_border_t *borders, vx_uint32 shift_x_u1, vx_uint8 *pixel)
+{
+    vx_uint32 first = format == VX_DF_IMAGE_U1 ? shift_x_u1 : 0;
+    vx_bool out_of_bounds = (x < first || y < 0 || x >= addr->dim_x || y >= addr->dim_y);
+    if (out_of_bounds)
+    {
+        if (borders->mode == VX_BORDER_UNDEFINED)
+            return vx_false_e;
+        if (borders->mode == VX_BORDER_CONSTANT)
+        {
+            *pixel = format == VX_DF_IMAGE_U1 ? (vx_uint8)(borders->constant_value.U1 ? 1 : 0) : borders->constant_value.U8;
+            return vx_true_e;
+        }
+    }
+
+    // bounded x/y
+    vx_uint32 bx = x < first ? first : x >= addr->dim_x ? addr->dim_x - 1 : (vx_uint32)x;
+    vx_uint32 by = y < 0 ? 0 : y >= addr->dim_y ? addr->dim_y - 1 : (vx_uint32)y;
+    const vx_uint8 *row = x86simdRow(base, addr, by);
+    *pixel = format == VX_DF_IMAGE_U1 ? (vx_uint8)((row[bx / 8] >> (bx % 8)) & 1) : row[bx];
+
+    return vx_true_e;
+}
+
+// generic warp, the source coordinates of each row come from the row kernel
+static vx_status x86simdWarp(vx_image src_image, vx_matrix matrix, vx_scalar stype, vx_image dst_image,
+                             const vx_border_t *borders, vx_bool perspective)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)dst_image);
+    vx_status status = VX_SUCCESS;
+    void *src_base = nullptr;
+    void *dst_base = nullptr;
+    vx_imagepatch_addressing_t src_addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_imagepatch_addressing_t dst_addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_uint32 dst_width = 0;
+    vx_uint32 dst_height = 0;
+    vx_rectangle_t src_rect;
+    vx_rectangle_t dst_rect;
+    vx_df_image format = 0;
+    vx_float32 m[9];
+    vx_enum type = 0;
+    vx_uint32 x, y;
+    vx_map_id src_map_id = 0;
+    vx_map_id dst_map_id = 0;
+    vx_float32 *xs = nullptr;
+
+    status |= vxQueryImage(dst_image, VX_IMAGE_WIDTH, &dst_width, sizeof(dst_width));
+    status |= vxQueryImage(dst_image, VX_IMAGE_HEIGHT, &dst_height, sizeof(dst_height));
+    status |= vxQueryImage(dst_image, VX_IMAGE_FORMAT, &format, sizeof(format));
+
+    status |= vxGetValidRegionImage(src_image, &src_rect);
+    vx_uint32 shift_x_u1 = src_rect.start_x % 8;  // Bit-shift offset for U1 images
+
+    dst_rect.start_x = 0;
+    dst_rect.start_y = 0;
+    dst_rect.end_x   = dst_width;
+    dst_rect.end_y   = dst_height;
+
+    status |= vxMapImagePatch(src_image, &src_rect, 0, &src_map_id, &src_addr, &src_base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(dst_image, &dst_rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    status |= vxCopyMatrix(matrix, m, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxCopyScalar(stype, &type, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+
+    if (status == VX_SUCCESS)
+    {
+        xs = (vx_float32 *)malloc(2 * (vx_size)dst_addr.dim_x * sizeof(vx_float32));
+        if (xs == nullptr)
+            status = VX_ERROR_NO_MEMORY;
+    }
+    if (status == VX_SUCCESS)
+    {
+        vx_float32 *ys = xs + dst_addr.dim_x;
+        for (y = 0u; y < dst_addr.dim_y; y++)
+        {
+            vx_uint8 *dst = x86simdRow(dst_base, &dst_addr, y);
+            rows->warp(m, perspective, 0, y, (vx_float32)src_rect.start_x, (vx_float32)src_rect.start_y, xs, ys, dst_addr.dim_x);
+            for (x = 0u; x < dst_addr.dim_x; x++)
+            {
+                vx_float32 xf = xs[x];
+                vx_float32 yf = ys[x];
+                vx_uint8 v = 0;
+                if (format == VX_DF_IMAGE_U1)   // Add bit-shift offset
+                    xf += shift_x_u1;
+
+                if (type == VX_INTERPOLATION_NEAREST_NEIGHBOR)
+                {
+                    if (!read_pixel(src_base, &src_addr, format, xf, yf, borders, shift_x_u1, &v))
+                        continue;
+                }
+                else if (type == VX_INTERPOLATION_BILINEAR)
+                {
+                    vx_uint8 tl = 0, tr = 0, bl = 0, br = 0;
+                    vx_float32 x0 = floorf(xf), y0 = floorf(yf);
+                    vx_bool defined = vx_true_e;
+                    defined = (vx_bool)(defined & read_pixel(src_base, &src_addr, format, x0, y0, borders, shift_x_u1, &tl));
+                    defined = (vx_bool)(defined & read_pixel(src_base, &src_addr, format, x0 + 1, y0, borders, shift_x_u1, &tr));
+                    defined = (vx_bool)(defined & read_pixel(src_base, &src_addr, format, x0, y0 + 1, borders, shift_x_u1, &bl));
+                    defined = (vx_bool)(defined & read_pixel(src_base, &src_addr, format, x0 + 1, y0 + 1, borders, shift_x_u1, &br));
+                    if (!defined)
+                        continue;
+
+                    vx_float32 ar = xf - x0;
+                    vx_float32 ab = yf - y0;
+                    vx_float32 al = 1.0f - ar;
+                    vx_float32 at = 1.0f - ab;
+                    if (format == VX_DF_IMAGE_U1)
+                        // Arithmetic rounding instead of truncation for U1 images
+                        v = (vx_uint8)(tl * al * at + tr * ar * at + bl * al * ab + br * ar * ab + 0.5);
+                    else
+                        v = (vx_uint8)(tl * al * at + tr * ar * at + bl * al * ab + br * ar * ab);
+                }
+                else
+                {
+                    continue;
+                }
+
+                if (format == VX_DF_IMAGE_U1)
+                    dst[x / 8] = (vx_uint8)((dst[x / 8] & ~(1 << (x % 8))) | (v << (x % 8)));
+                else
+                    dst[x] = v;
+            }
+        }
+
+        /*! \todo compute maximum area rectangle */
+    }
+    free(xs);
+
+    status |= vxCopyMatrix(matrix, m, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxUnmapImagePatch(src_image, src_map_id);
+    status |= vxUnmapImagePatch(dst_image, dst_map_id);
+
+    return status;
+}
+
+// nodeless version of the WarpAffine kernel
+vx_status vxWarpAffine(vx_image src_image, vx_matrix matrix, vx_scalar stype, vx_image dst_image, const vx_border_t *borders)
+{
+    return x86simdWarp(src_image, matrix, stype, dst_image, borders, vx_false_e);
+}
+
+// nodeless version of the WarpPerspective kernel
+vx_status vxWarpPerspective(vx_image src_image, vx_matrix matrix, vx_scalar stype, vx_image dst_image, const vx_border_t *borders)
+{
+    return x86simdWarp(src_image, matrix, stype, dst_image, borders, vx_true_e);
+}
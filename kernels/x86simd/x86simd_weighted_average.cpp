@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2011-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "x86simd_util.h"
+
+// nodeless version of the Weighted Average kernel
+vx_status vxWeightedAverage(vx_image img1, vx_scalar alpha, vx_image img2, vx_image output)
+{
+    const x86simd_rows_t *rows = x86simdRows((vx_reference)output);
+    vx_uint32 y;
+    vx_float32 scale = 0.0f;
+    void *dst_base = nullptr;
+    void *src_base[2] = {nullptr, nullptr};
+    vx_imagepatch_addressing_t dst_addr, src_addr[2];
+    vx_rectangle_t rect;
+    vx_map_id src_map_id[2] = {0, 0};
+    vx_map_id dst_map_id = 0;
+    vx_status status = VX_SUCCESS;
+
+    status  = vxGetValidRegionImage(img1, &rect);
+    status |= vxCopyScalar(alpha, &scale, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    status |= vxMapImagePatch(img1, &rect, 0, &src_map_id[0], &src_addr[0], &src_base[0], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(img2, &rect, 0, &src_map_id[1], &src_addr[1], &src_base[1], VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+    status |= vxMapImagePatch(output, &rect, 0, &dst_map_id, &dst_addr, &dst_base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X);
+
+    if (status == VX_SUCCESS)
+    {
+        for (y = 0; y < src_addr[0].dim_y; y++)
+        {
+            rows->weighted(x86simdRow(src_base[0], &src_addr[0], y), x86simdRow(src_base[1], &src_addr[1], y),
+                           x86simdRow(dst_base, &dst_addr, y), scale, src_addr[0].dim_x);
+        }
+    }
+
+    status |= vxUnmapImagePatch(img1, src_map_id[0]);
+    status |= vxUnmapImagePatch(img2, src_map_id[1]);
+    status |= vxUnmapImagePatch(output, dst_map_id);
+
+    return status;
+}
@@ -223,73 +223,8 @@ extern "C" vx_action vxTargetProcess(vx_target target, vx_node nodes[], vx_size
 
         if (nodes[n]->is_replicated == vx_true_e)
         {
-            vx_size num_replicas = 0;
-            vx_uint32 param;
-            vx_uint32 num_parameters = nodes[n]->kernel->signature.num_parameters;
-            vx_reference parameters[VX_INT_MAX_PARAMS] = {nullptr};
-
-            for (param = 0; param < num_parameters; ++param)
-            {
-                if (nodes[n]->replicated_flags[param] == vx_true_e)
-                {
-                    vx_size numItems = 0;
-                    if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_PYRAMID)
-                    {
-                        vx_pyramid pyr = (vx_pyramid)(nodes[n]->parameters[param])->scope;
-                        numItems = pyr->numLevels;
-                    }
-                    else if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_OBJECT_ARRAY)
-                    {
-                        vx_object_array arr = (vx_object_array)(nodes[n]->parameters[param])->scope;
-                        numItems = arr->num_items;
-                    }
-                    else
-                    {
-                        status = VX_ERROR_INVALID_PARAMETERS;
-                        break;
-                    }
-
-                    if (num_replicas == 0)
-                        num_replicas = numItems;
-                    else if (numItems != num_replicas)
-                    {
-                        status = VX_ERROR_INVALID_PARAMETERS;
-                        break;
-                    }
-                }
-                else
-                {
-                    parameters[param] = nodes[n]->parameters[param];
-                }
-            }
-
-            if (status == VX_SUCCESS)
-            {
-                vx_size replica;
-                for (replica = 0; replica < num_replicas; ++replica)
-                {
-                    for (param = 0; param < num_parameters; ++param)
-                    {
-                        if (nodes[n]->replicated_flags[param] == vx_true_e)
-                        {
-                            if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_PYRAMID)
-                            {
-                                vx_pyramid pyr = (vx_pyramid)(nodes[n]->parameters[param])->scope;
-                                parameters[param] = (vx_reference)pyr->levels[replica];
-                            }
-                            else if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_OBJECT_ARRAY)
-                            {
-                                vx_object_array arr = (vx_object_array)(nodes[n]->parameters[param])->scope;
-                                parameters[param] = (vx_reference)arr->items[replica];
-                            }
-                        }
-                    }
-
-                    status = nodes[n]->kernel->function((vx_node)nodes[n],
-                                                        parameters,
-                                                        num_parameters);
-                }
-            }
+            /* the replicas are independent, the framework runs them across the workers */
+            status = nodes[n]->processReplicas();
         }
         else
         {
@@ -8,6 +8,7 @@
  *
  */
 #include <string>
+#include <vector>
 
 #include <VX/vx.h>
 #include <VX/vx_compatibility.h>
@@ -64,10 +65,12 @@ public:
 
         if (VX_SUCCESS == status)
         {
+            stagedInputs.clear();
+            stagedOutputs.clear();
             // Process input tensors
-            status = processTensors((vx_object_array)parameters[1], inputTensors);
+            status = processTensors((vx_object_array)parameters[1], inputTensors, stagedInputs);
             // Process output tensors if input processing was successful
-            status |= processTensors((vx_object_array)parameters[2], outputTensors);
+            status |= processTensors((vx_object_array)parameters[2], outputTensors, stagedOutputs);
         }
 
         if (VX_SUCCESS == status)
@@ -155,14 +158,40 @@ public:
 
         if (VX_SUCCESS == status)
         {
+            copyStaged(stagedInputs, vx_true_e);
             // Call the run member function
             status = kernel->run();
         }
 
+        if (VX_SUCCESS == status)
+        {
+            copyStaged(stagedOutputs, vx_false_e);
+        }
+
         return status;
     }
 
 private:
+    /**
+     * @brief A strided view of a tensor, which the runtime reads and writes through a packed copy
+     */
+    struct StagedTensor
+    {
+        vx_uint8 *view;
+        vx_size numDims;
+        vx_size dims[VX_MAX_TENSOR_DIMENSIONS];
+        vx_size stride[VX_MAX_TENSOR_DIMENSIONS];
+        vx_size packedStride[VX_MAX_TENSOR_DIMENSIONS];
+        vx_size elementSize;
+        std::vector<vx_uint8> packed;
+    };
+
+    /**
+     * @brief The strided views bound at initialization, refreshed around every run
+     */
+    static inline std::vector<StagedTensor> stagedInputs;
+    static inline std::vector<StagedTensor> stagedOutputs;
+
     /**
      * @brief Helper function to read a string from a VX char array
      *
@@ -226,9 +255,11 @@ private:
      *
      * @param[in]  objArr  Object array containing tensors
      * @param[out] tensors Vector of pairs containing tensor data and size
+     * @param[out] staged  The strided views among them, which the runtime sees as packed copies
      * @return vx_status   VX_SUCCESS on success, otherwise an error code
      */
-    static vx_status processTensors(vx_object_array objArr, std::vector<std::pair<float *, size_t>> &tensors)
+    static vx_status processTensors(vx_object_array objArr, std::vector<std::pair<float *, size_t>> &tensors,
+                                    std::vector<StagedTensor> &staged)
     {
         vx_status status = VX_SUCCESS;
         vx_size numItems = 0;
@@ -252,17 +283,61 @@ private:
 
             if (VX_SUCCESS != status)
             {
-                std::cerr << "Error: Unable to prep tensor in " << __func__
-                          << ", status: " << status << std::endl;
+                VX_PRINT(VX_ZONE_ERROR, "Unable to prep tensor in %s, status: %d\n", __func__, status);
                 break;
             }
 
+            // Views are mapped in place, the runtime needs them packed in dimension order
+            if (vx_false_e == tensor->isContiguous())
+            {
+                StagedTensor view = {};
+                view.view = (vx_uint8 *)ptr;
+                view.numDims = numDims;
+                view.elementSize = coreflow::Reference::sizeOfType(tensor->dataType());
+                vx_size packed = view.elementSize;
+                for (vx_size d = 0; d < numDims; ++d)
+                {
+                    view.dims[d] = dims[d];
+                    view.stride[d] = stride[d];
+                    view.packedStride[d] = packed;
+                    packed *= dims[d];
+                }
+                view.packed.resize(size);
+                VX_PRINT(VX_ZONE_INFO, "Tensor %u is a strided view, staged through a packed copy\n", i);
+                ptr = view.packed.data();
+                staged.push_back(std::move(view));
+            }
+
             tensors.emplace_back((float *)ptr, size);
             status |= vxUnmapTensorPatch(tensor, map_id);
         }
 
         return status;
     }
+
+    /**
+     * @brief Helper function to copy staged views into or out of their packed copies
+     *
+     * @param[in] staged   The staged views
+     * @param[in] toPacked vx_true_e to copy the views into the packed copies, before a run,
+     *                     vx_false_e to copy the packed copies back into the views, after it
+     */
+    static void copyStaged(std::vector<StagedTensor> &staged, vx_bool toPacked)
+    {
+        for (StagedTensor &view : staged)
+        {
+            if (vx_true_e == toPacked)
+            {
+                coreflow::Tensor::copyStrided(view.packed.data(), view.packedStride, view.view, view.stride,
+                                              view.dims, view.numDims, view.elementSize);
+            }
+            else
+            {
+                coreflow::Tensor::copyStrided(view.view, view.stride, view.packed.data(), view.packedStride,
+                                              view.dims, view.numDims, view.elementSize);
+            }
+        }
+    }
 };
 
 /**
@@ -144,7 +144,7 @@ vx_tiling_kernel_t absdiff_kernel =
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
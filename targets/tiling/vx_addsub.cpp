@@ -191,7 +191,7 @@ vx_tiling_kernel_t add_kernel = {
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
@@ -212,7 +212,7 @@ vx_tiling_kernel_t subtract_kernel = {
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
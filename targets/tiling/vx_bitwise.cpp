@@ -126,7 +126,7 @@ vx_tiling_kernel_t And_kernel =
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 vx_tiling_kernel_t Or_kernel =
@@ -146,7 +146,7 @@ vx_tiling_kernel_t Or_kernel =
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 vx_tiling_kernel_t Xor_kernel =
@@ -166,7 +166,7 @@ vx_tiling_kernel_t Xor_kernel =
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
@@ -238,7 +238,7 @@ vx_tiling_kernel_t Not_kernel =
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
@@ -188,6 +188,6 @@ vx_tiling_kernel_t channelcombine_kernel =
     nullptr,
     nullptr,
     { 16, 16 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
@@ -188,7 +188,7 @@ vx_tiling_kernel_t colorconvert_kernel =
     nullptr,
     nullptr,
     { 8, 8 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
@@ -42,7 +42,6 @@ static vx_status VX_CALLBACK own_sobel3x3_validator(vx_node node, const vx_refer
         vx_parameter param3 = vxGetParameterByIndex(node, 2);
 
         if (VX_SUCCESS == vxGetStatus((vx_reference)param1) &&
-            (param1->type == sobel3x3_kernel_params[0].data_type) &&
             ((VX_SUCCESS == vxGetStatus((vx_reference)param2)) || (VX_SUCCESS == vxGetStatus((vx_reference)param3))))
         {
             vx_uint32   src_width = 0;
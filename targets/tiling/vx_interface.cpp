@@ -24,10 +24,26 @@
 #include "vx_interface.h"
 #include "tiling.h"
 
+#include <algorithm>
+#include <vector>
+
+using namespace coreflow;
+
 vx_status VX_CALLBACK vxTilingKernel(vx_node node, const vx_reference parameters[], vx_uint32 num);
 
 static const vx_char name[VX_MAX_TARGET_NAME] = "khronos.tiling";
 
+#if defined(__x86_64__) || defined(_M_X64)
+/*! \brief The CPU variant the x86-64 tiling kernels are compiled for, SSE4.1 needs the
+ * SSE4.2 variant and a build with AVX2 enabled the AVX2 one.
+ */
+#if defined(__AVX2__)
+static const vx_enum compiled_variant = VX_CPU_VARIANT_AVX2;
+#else
+static const vx_enum compiled_variant = VX_CPU_VARIANT_SSE42;
+#endif
+#endif
+
 vx_tiling_kernel_t *tiling_kernels[] =
 {
     &box_3x3_kernels,
@@ -178,8 +194,13 @@ vx_status VX_API_CALL vxPublishKernels(vx_context context)
                 &tiling_kernels[k]->nbhd, sizeof(vx_neighborhood_size_t));
             status |= vxSetKernelAttribute(kernel, VX_KERNEL_OUTPUT_TILE_BLOCK_SIZE,
                 &tiling_kernels[k]->block, sizeof(vx_tile_block_size_t));
-            status |= vxSetKernelAttribute(kernel, VX_KERNEL_BORDER,
-                &tiling_kernels[k]->border, sizeof(vx_border_t));
+            /* a kernel implementing a defined border reads the mode from the node itself */
+            vx_border_t border = tiling_kernels[k]->border;
+            if (border.mode != VX_BORDER_UNDEFINED)
+            {
+                border.mode = VX_BORDER_MODE_SELF;
+            }
+            status |= vxSetKernelAttribute(kernel, VX_KERNEL_BORDER, &border, sizeof(vx_border_t));
             if (status != VX_SUCCESS)
             {
                 vxRemoveKernel(kernel);
@@ -208,11 +229,11 @@ vx_status VX_API_CALL vxPublishKernels(vx_context context)
     for (k = 0; k < dimof(tiling_kernels); k++)
     {
         vx_kernel kernel = vxGetKernelByName(context, tiling_kernels[k]->name);
-        kernel->user_kernel = 1;
         vx_kernel kernelcpy = kernel;
 
         if (kernel)
         {
+            kernel->user_kernel = 1;
             status = vxReleaseKernel(&kernelcpy);
             if (status != VX_SUCCESS)
             {
@@ -237,22 +258,33 @@ vx_status VX_API_CALL vxPublishKernels(vx_context context)
     return status;
 }
 
-vx_status vxTargetInit(vx_target target)
+extern "C" vx_status vxTargetInit(vx_target target)
 {
     if (target)
     {
         strncpy(target->name, name, VX_MAX_TARGET_NAME);
         target->priority = VX_TARGET_PRIORITY_TILING;
     }
+#if defined(__x86_64__) || defined(_M_X64)
+    /* the kernels are built for one instruction set, they stay out of a context which
+     * picked a smaller CPU variant, as VX_CPU_VARIANT=scalar does */
+    if (target->context->cpuVariant() < compiled_variant)
+    {
+        VX_PRINT(VX_ZONE_WARNING, "Tiling kernels need CPU variant %d, the context uses %d\n",
+                 compiled_variant, target->context->cpuVariant());
+        return VX_ERROR_NOT_SUPPORTED;
+    }
+#endif
     return vxPublishKernels(target->context);
 }
 
-vx_status vxTargetDeinit(vx_target target)
+extern "C" vx_status vxTargetDeinit(vx_target target)
 {
-    return vxUnpublishKernels(target->context);
+    /* the kernel slots are target owned, as on the other targets */
+    return target->deinitializeTarget();
 }
 
-vx_status vxTargetSupports(vx_target target,
+extern "C" vx_status vxTargetSupports(vx_target target,
                            vx_char targetName[VX_MAX_TARGET_NAME],
                            vx_char kernelName[VX_MAX_KERNEL_NAME],
                            vx_uint32 *pIndex)
@@ -270,6 +302,9 @@ vx_status vxTargetSupports(vx_target target,
             vx_char *kernel;
             vx_char def[8] = "default";
 
+            if (target->kernels[k] == nullptr)
+                continue;
+
             strncpy(targetKernelName, target->kernels[k]->name, VX_MAX_KERNEL_NAME);
             kernel = strtok(targetKernelName, ":");
             if (kernel == nullptr)
@@ -286,7 +321,7 @@ vx_status vxTargetSupports(vx_target target,
     return status;
 }
 
-vx_action vxTargetProcess(vx_target target, vx_node nodes[], vx_size startIndex, vx_size numNodes)
+extern "C" vx_action vxTargetProcess(vx_target target, vx_node nodes[], vx_size startIndex, vx_size numNodes)
 {
     vx_action action = VX_ACTION_CONTINUE;
     vx_status status = VX_SUCCESS;
@@ -305,73 +340,8 @@ vx_action vxTargetProcess(vx_target target, vx_node nodes[], vx_size startIndex,
 
         if (nodes[n]->is_replicated == vx_true_e)
         {
-            vx_size num_replicas = 0;
-            vx_uint32 param;
-            vx_uint32 num_parameters = nodes[n]->kernel->signature.num_parameters;
-            vx_reference parameters[VX_INT_MAX_PARAMS] = { nullptr };
-
-            for (param = 0; param < num_parameters; ++param)
-            {
-                if (nodes[n]->replicated_flags[param] == vx_true_e)
-                {
-                    vx_size numItems = 0;
-                    if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_PYRAMID)
-                    {
-                        vx_pyramid pyr = (vx_pyramid)(nodes[n]->parameters[param])->scope;
-                        numItems = pyr->numLevels;
-                    }
-                    else if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_OBJECT_ARRAY)
-                    {
-                        vx_object_array arr = (vx_object_array)(nodes[n]->parameters[param])->scope;
-                        numItems = arr->num_items;
-                    }
-                    else
-                    {
-                        status = VX_ERROR_INVALID_PARAMETERS;
-                        break;
-                    }
-
-                    if (num_replicas == 0)
-                        num_replicas = numItems;
-                    else if (numItems != num_replicas)
-                    {
-                        status = VX_ERROR_INVALID_PARAMETERS;
-                        break;
-                    }
-                }
-                else
-                {
-                    parameters[param] = nodes[n]->parameters[param];
-                }
-            }
-
-            if (status == VX_SUCCESS)
-            {
-                vx_size replica;
-                for (replica = 0; replica < num_replicas; ++replica)
-                {
-                    for (param = 0; param < num_parameters; ++param)
-                    {
-                        if (nodes[n]->replicated_flags[param] == vx_true_e)
-                        {
-                            if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_PYRAMID)
-                            {
-                                vx_pyramid pyr = (vx_pyramid)(nodes[n]->parameters[param])->scope;
-                                parameters[param] = (vx_reference)pyr->levels[replica];
-                            }
-                            else if ((nodes[n]->parameters[param])->scope->type == VX_TYPE_OBJECT_ARRAY)
-                            {
-                                vx_object_array arr = (vx_object_array)(nodes[n]->parameters[param])->scope;
-                                parameters[param] = (vx_reference)arr->items[replica];
-                            }
-                        }
-                    }
-
-                    status = nodes[n]->kernel->function((vx_node)nodes[n],
-                        parameters,
-                        num_parameters);
-                }
-            }
+            /* the replicas are independent, the framework runs them across the workers */
+            status = nodes[n]->processReplicas();
         }
         else
         {
@@ -406,13 +376,41 @@ vx_action vxTargetProcess(vx_target target, vx_node nodes[], vx_size startIndex,
     return action;
 }
 
-vx_status vxTargetVerify(vx_target target, vx_node node)
+/*! \brief Whether a tiling kernel computes the node's border. Every kernel implements the undefined
+ * border and some the one mode they declare besides it, a kernel reading no neighborhood does not
+ * depend on the border at all.
+ */
+static vx_bool supportsBorder(const vx_tiling_kernel_t *kernel, vx_border_t border)
+{
+    const vx_neighborhood_size_t &nbhd = kernel->nbhd;
+    return (border.mode == VX_BORDER_UNDEFINED || border.mode == kernel->border.mode ||
+            (nbhd.left == 0 && nbhd.right == 0 && nbhd.top == 0 && nbhd.bottom == 0))
+               ? vx_true_e
+               : vx_false_e;
+}
+
+extern "C" vx_status vxTargetVerify(vx_target target, vx_node node)
 {
     vx_status status = VX_SUCCESS;
+    (void)target;
+
+    /* the tiles only carry the border mode, so a node with a border its kernel leaves out is
+     * declined and the graph moves it to the next target */
+    for (vx_uint32 k = 0; k < dimof(tiling_kernels); k++)
+    {
+        if (strncmp(node->kernel->name, tiling_kernels[k]->name, VX_MAX_KERNEL_NAME) == 0 &&
+            supportsBorder(tiling_kernels[k], node->border()) == vx_false_e)
+        {
+            VX_PRINT(VX_ZONE_GRAPH, "Tiling kernel %s does not implement border mode %x\n",
+                     node->kernel->name, node->border().mode);
+            status = VX_ERROR_NOT_SUPPORTED;
+            break;
+        }
+    }
     return status;
 }
 
-vx_kernel vxTargetAddKernel(vx_target target,
+extern "C" vx_kernel vxTargetAddKernel(vx_target target,
                             vx_char name[VX_MAX_KERNEL_NAME],
                             vx_enum enumeration,
                             vx_kernel_f func_ptr,
@@ -428,6 +426,10 @@ vx_kernel vxTargetAddKernel(vx_target target,
     Osal::semWait(&target->lock);
     for (k = 0; k < VX_INT_MAX_KERNELS; k++)
     {
+        if (target->kernels[k] == nullptr)
+        {
+            target->kernels[k] = reinterpret_cast<vx_kernel>(Reference::createReference(target->context, VX_TYPE_KERNEL, VX_INTERNAL, target->context));
+        }
         kernel = target->kernels[k];
         if (kernel->enabled == vx_false_e)
         {
@@ -444,7 +446,7 @@ vx_kernel vxTargetAddKernel(vx_target target,
     return (vx_kernel)kernel;
 }
 
-vx_kernel vxTargetAddTilingKernel(vx_target target,
+extern "C" vx_kernel vxTargetAddTilingKernel(vx_target target,
                             vx_char name[VX_MAX_KERNEL_NAME],
                             vx_enum enumeration,
                             vx_kernel_f function,
@@ -461,6 +463,10 @@ vx_kernel vxTargetAddTilingKernel(vx_target target,
     vx_kernel kernel = nullptr;
     for (k = 0; k < VX_INT_MAX_KERNELS; k++)
     {
+        if (target->kernels[k] == nullptr)
+        {
+            target->kernels[k] = reinterpret_cast<vx_kernel>(Reference::createReference(target->context, VX_TYPE_KERNEL, VX_INTERNAL, target->context));
+        }
         kernel = target->kernels[k];
         if (kernel->enabled == vx_false_e)
         {
@@ -533,6 +539,58 @@ static void* ownAllocateTensorMemory_tiling(vx_tensor tensor)
     return tensor->addr;
 }
 
+/*! \brief The full-block tile rows of one tiling kernel call, handed out one row per chunk.
+ * Each thread works on its own copy of the tile descriptors and its own tile memory, so
+ * rows only share the images they read and the disjoint output blocks they write.
+ */
+typedef struct _vx_tile_rows_t {
+    vx_node node;
+    vx_uint32 num;
+    const vx_enum *types;
+    const vx_tile_ex_t *tiles;
+    void *const *params;
+    vx_uint32 tile_size_x;
+    vx_uint32 tile_size_y;
+    vx_uint32 blkCntX;
+    vx_size size;
+    /*! \brief The tile memory of the helpers, slot 0 uses the node's own */
+    vx_uint8 *scratch;
+} vx_tile_rows_t;
+
+static vx_status vxTilingRow(void *arg, vx_uint32 row, vx_uint32 slot)
+{
+    vx_tile_rows_t *rows = (vx_tile_rows_t *)arg;
+    vx_tile_ex_t tiles[VX_INT_MAX_PARAMS];
+    void *params[VX_INT_MAX_PARAMS];
+    void *tile_memory = (slot == 0u) ? rows->node->attributes.tileDataPtr
+                                     : (void *)(rows->scratch + (slot - 1u) * rows->size);
+    vx_uint32 p = 0u, tx = 0u;
+    vx_uint32 ty = row * rows->tile_size_y;
+
+    for (p = 0u; p < rows->num; p++)
+    {
+        params[p] = rows->params[p];
+        if (rows->types[p] == VX_TYPE_IMAGE)
+        {
+            tiles[p] = rows->tiles[p];
+            tiles[p].tile_y = ty;
+            params[p] = &tiles[p];
+        }
+    }
+    for (tx = 0u; tx < rows->blkCntX; tx += rows->tile_size_x)
+    {
+        for (p = 0u; p < rows->num; p++)
+        {
+            if (rows->types[p] == VX_TYPE_IMAGE)
+            {
+                tiles[p].tile_x = tx;
+            }
+        }
+        rows->node->kernel->tilingfast_function(params, tile_memory, rows->size);
+    }
+    return VX_SUCCESS;
+}
+
 vx_status VX_CALLBACK vxTilingKernel(vx_node node, const vx_reference parameters[], vx_uint32 num)
 {
     vx_status status = VX_ERROR_INVALID_PARAMETERS;
@@ -751,14 +809,15 @@ vx_status VX_CALLBACK vxTilingKernel(vx_node node, const vx_reference parameters
     }
     else
     {
-        rect.start_x = 0;
-        rect.start_y = 0;
-        rect.end_x = width;
-        rect.end_y = height;
         for (p = 0u; p < num; p++)
         {
             if (types[p] == VX_TYPE_IMAGE && images[p] != nullptr)
             {
+                /* each image is accessed at its own size, the inputs of scale and warp differ from the output */
+                rect.start_x = 0;
+                rect.start_y = 0;
+                rect.end_x = tiles[p].image.width;
+                rect.end_y = tiles[p].image.height;
                 tiles[p].tile_x = 0;
                 tiles[p].tile_y = 0;
                 status |= vxGetPatchToTile(images[p], &rect, &tiles[p]);
@@ -772,22 +831,37 @@ vx_status VX_CALLBACK vxTilingKernel(vx_node node, const vx_reference parameters
     //tiling fast function
     if (node->kernel->tilingfast_function && is_U1 == 0)
     {
-        for (ty = 0u; (ty < blkCntY) && (status == VX_SUCCESS); ty += tile_size_y)
+        /* the full-block rows only write their own output blocks, so they run spread
+         * over the context workers unless the kernel also produces non-image results
+         * or, like the integral image, reads back what earlier rows wrote */
+        vx_uint32 numRows = blkCntY / tile_size_y;
+        vx_uint32 threads = 1u;
+        std::vector<vx_uint8> scratch;
+        if (node->kernel->enumeration != VX_KERNEL_INTEGRAL_IMAGE && node->context->workers != nullptr)
         {
-            for (tx = 0u; tx < blkCntX; tx += tile_size_x)
+            threads = std::min(numRows, node->context->workers->numWorkers + 1u);
+            for (p = 0u; p < num; p++)
             {
-                for (p = 0u; p < num; p++)
+                if (dirs[p] != VX_INPUT && types[p] != VX_TYPE_IMAGE)
                 {
-                    if (types[p] == VX_TYPE_IMAGE)
-                    {
-                        tiles[p].tile_x = tx;
-                        tiles[p].tile_y = ty;
-                    }
+                    threads = 1u;
                 }
-                tile_memory = node->attributes.tileDataPtr;
-                node->kernel->tilingfast_function(params, tile_memory, size);
             }
         }
+        if (threads > 1u && size > 0u)
+        {
+            scratch.resize((threads - 1u) * size);
+        }
+
+        vx_tile_rows_t rows = {node, num, types, tiles, params, tile_size_x, tile_size_y,
+                               blkCntX, size, scratch.data()};
+        if (status == VX_SUCCESS)
+        {
+            status = node->processChunks(numRows, threads, vxTilingRow, &rows);
+        }
+        /* the border strips start where the full blocks end */
+        ty = blkCntY;
+        tx = (blkCntY > 0u) ? blkCntX : 0u;
 
         if (node->kernel->tilingflexible_function && ((blkCntY < height) || (blkCntX < width)))
         {
@@ -116,7 +116,7 @@ vx_tiling_kernel_t Magnitude_kernel =
     nullptr,
     nullptr,
     { 8, 8 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
 
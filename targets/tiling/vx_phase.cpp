@@ -131,6 +131,6 @@ vx_tiling_kernel_t phase_kernel =
     nullptr,
     nullptr,
     { 8, 8 },
-    { -1, 1, -1, 1 },
+    { 0, 0, 0, 0 },
     { VX_BORDER_MODE_UNDEFINED, {{0}} },
 };
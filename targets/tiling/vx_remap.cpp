@@ -23,7 +23,7 @@
 
 #include "vx_internal.h"
 
-#include <arm_neon.h>
+#include <tiling_simd.h>
 
 #include "tiling.h"
 
@@ -164,13 +164,13 @@ static void remapLinearConst(const size_t height,
 //BLOCK_SIZE is the same as tile_size set in "vx_remap.c"
 #define BLOCK_SIZE 16
 
-void Remap_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Remap_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     // vx_uint32 x = 0, y = 0;
 
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
     vx_remap *table = (vx_remap *)parameters[1];
-    vx_scalar *stype = (vx_scalar *)parameters[2];
+    vx_enum *type = (vx_enum *)parameters[2];
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[3];
 
     vx_uint8 *src_base = in->base[0];
@@ -181,7 +181,7 @@ void Remap_image_tiling_fast(void * VX_RESTRICT parameters[VX_RESTRICT], void *
     __attribute__((unused))
     vx_uint32 high_y = out->tile_y + out->tile_block.height;
 
-    vx_int32 policy = (*stype)->data.s32;
+    vx_int32 policy = *type;
 
     vx_uint32 src_width = in->image.width;
     vx_uint32 src_height = in->image.height;
@@ -387,13 +387,13 @@ static vx_bool read_pixel(void *base, vx_imagepatch_addressing_t *addr, vx_uint3
     }
 
 
-void Remap_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
+void Remap_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT_ARRAY], void * VX_RESTRICT tile_memory, vx_size tile_memory_size)
 {
     vx_uint32 x = 0, y = 0;
 
     vx_tile_ex_t *in = (vx_tile_ex_t *)parameters[0];
     vx_remap *table = (vx_remap *)parameters[1];
-    vx_scalar *stype = (vx_scalar *)parameters[2];
+    vx_enum *type = (vx_enum *)parameters[2];
     vx_tile_ex_t *out = (vx_tile_ex_t *)parameters[3];
 
     vx_uint32 low_y = in->tile_y;
@@ -405,7 +405,7 @@ void Remap_image_tiling_flexible(void * VX_RESTRICT parameters[VX_RESTRICT], voi
     vx_uint8 *src_base = in->base[0] + in->tile_x;
     vx_uint8 *dst_base = out->base[0] + out->tile_x;
 
-    vx_int32 policy = (*stype)->data.s32;
+    vx_int32 policy = *type;
 
     vx_border_t borders = in->border;
 
@@ -568,5 +568,5 @@ vx_tiling_kernel_t remap_kernel =
     nullptr,
     { 16, 16 },
     { -1, 1, -1, 1 },
-    { VX_BORDER_MODE_UNDEFINED, {{0}} },
+    { VX_BORDER_CONSTANT, {{0}} },
 };
@@ -311,7 +311,6 @@ static vx_status VX_CALLBACK vxHalfscaleGaussianOutputValidator(vx_node node, vx
         vx_parameter src_param = vxGetParameterByIndex(node, 0);
         vx_parameter dst_param = vxGetParameterByIndex(node, index);
         if ((vxGetStatus((vx_reference)src_param) == VX_SUCCESS) &&
-            (src_param->type == scale_kernel_params[0].data_type) &&
             (vxGetStatus((vx_reference)dst_param) == VX_SUCCESS))
         {
             vx_image src = 0;
@@ -194,7 +194,7 @@ vx_tiling_kernel_t warp_affine_kernel =
     nullptr,
     { 16, 16 },
     { -1, 1, -1, 1 },
-    { VX_BORDER_MODE_UNDEFINED, {{0}} },
+    { VX_BORDER_CONSTANT, {{0}} },
 };
 
 
@@ -217,5 +217,5 @@ vx_tiling_kernel_t warp_perspective_kernel =
     nullptr,
     { 16, 16 },
     { -1, 1, -1, 1 },
-    { VX_BORDER_MODE_UNDEFINED, {{0}} },
+    { VX_BORDER_CONSTANT, {{0}} },
 };
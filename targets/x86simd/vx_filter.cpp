@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2012-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*!
+ * \file
+ * \brief The Filter Kernels.
+ * \author Erik Rainey <erik.rainey@gmail.com>
+ */
+
+#include <VX/vx.h>
+#include <VX/vx_helper.h>
+
+#include "vx_internal.h"
+#include <x86simd.h>
+
+
+static vx_status VX_CALLBACK vxMedian3x3Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_status status = VX_ERROR_INVALID_PARAMETERS;
+    if (num == 2)
+    {
+        vx_border_t bordermode;
+        vx_image src = (vx_image)parameters[0];
+        vx_image dst = (vx_image)parameters[1];
+        status = vxQueryNode(node, VX_NODE_BORDER, &bordermode, sizeof(bordermode));
+        if (status == VX_SUCCESS)
+        {
+            status = vxMedian3x3(src, dst, &bordermode);
+        }
+    }
+    return status;
+}
+
+static vx_status VX_CALLBACK vxBox3x3Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_status status = VX_ERROR_INVALID_PARAMETERS;
+    if (num == 2)
+    {
+        vx_border_t bordermode;
+        vx_image src  = (vx_image)parameters[0];
+        vx_image dst = (vx_image)parameters[1];
+        status = vxQueryNode(node, VX_NODE_BORDER, &bordermode, sizeof(bordermode));
+        if (status == VX_SUCCESS)
+        {
+            status = vxBox3x3(src, dst, &bordermode);
+        }
+    }
+    return status;
+}
+
+static vx_status VX_CALLBACK vxGaussian3x3Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_status status = VX_ERROR_INVALID_PARAMETERS;
+    if (num == 2)
+    {
+        vx_border_t bordermode;
+        vx_image src  = (vx_image)parameters[0];
+        vx_image dst = (vx_image)parameters[1];
+        status = vxQueryNode(node, VX_NODE_BORDER, &bordermode, sizeof(bordermode));
+        if (status == VX_SUCCESS)
+        {
+            status = vxGaussian3x3(src, dst, &bordermode);
+        }
+    }
+    return status;
+}
+
+static vx_status VX_CALLBACK vxFilterInputValidator(vx_node node, vx_uint32 index)
+{
+    vx_status status = VX_ERROR_INVALID_PARAMETERS;
+    if (index == 0)
+    {
+        vx_image input = 0;
+        vx_parameter param = vxGetParameterByIndex(node, index);
+
+        vxQueryParameter(param, VX_PARAMETER_REF, &input, sizeof(input));
+        if (input)
+        {
+            vx_df_image format = 0;
+            vxQueryImage(input, VX_IMAGE_FORMAT, &format, sizeof(format));
+            if (format == VX_DF_IMAGE_U1 || format == VX_DF_IMAGE_U8)
+            {
+                status = VX_SUCCESS;
+            }
+            vxReleaseImage(&input);
+        }
+        vxReleaseParameter(&param);
+    }
+    return status;
+}
+
+static vx_status VX_CALLBACK vxFilterOutputValidator(vx_node node, vx_uint32 index, vx_meta_format ptr)
+{
+    vx_status status = VX_ERROR_INVALID_PARAMETERS;
+    if (index == 1)
+    {
+        vx_parameter param = vxGetParameterByIndex(node, 0); /* we reference the input image */
+        if (vxGetStatus((vx_reference)param) == VX_SUCCESS)
+        {
+            vx_image input = 0;
+            vxQueryParameter(param, VX_PARAMETER_REF, &input, sizeof(input));
+            if (input)
+            {
+                vx_df_image format = 0;
+                vx_uint32 width = 0, height = 0;
+                vxQueryImage(input, VX_IMAGE_WIDTH, &width, sizeof(width));
+                vxQueryImage(input, VX_IMAGE_HEIGHT, &height, sizeof(height));
+                vxQueryImage(input, VX_IMAGE_FORMAT, &format, sizeof(format));
+                ptr->type = VX_TYPE_IMAGE;
+                ptr->dim.image.format = format;
+                ptr->dim.image.width = width;
+                ptr->dim.image.height = height;
+                status = VX_SUCCESS;
+                vxReleaseImage(&input);
+            }
+            vxReleaseParameter(&param);
+        }
+    }
+    return status;
+}
+
+static vx_param_description_t filter_kernel_params[] = {
+    {VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED},
+    {VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED},
+};
+
+vx_kernel_description_t box3x3_kernel = {
+    VX_KERNEL_BOX_3x3,
+    "org.khronos.openvx.box_3x3:default",
+    vxBox3x3Kernel,
+    filter_kernel_params, dimof(filter_kernel_params),
+    nullptr,
+    vxFilterInputValidator,
+    vxFilterOutputValidator,
+    nullptr,
+    nullptr,
+};
+
+vx_kernel_description_t box3x3_kernel_2 = {
+    VX_KERNEL_BOX_3x3,
+    "org.khronos.openvx.box_3x3:duplicate",
+    vxBox3x3Kernel,
+    filter_kernel_params, dimof(filter_kernel_params),
+    nullptr,
+    vxFilterInputValidator,
+    vxFilterOutputValidator,
+    nullptr,
+    nullptr,
+};
+
+vx_kernel_description_t median3x3_kernel = {
+    VX_KERNEL_MEDIAN_3x3,
+    "org.khronos.openvx.median_3x3",
+    vxMedian3x3Kernel,
+    filter_kernel_params, dimof(filter_kernel_params),
+    nullptr,
+    vxFilterInputValidator,
+    vxFilterOutputValidator,
+    nullptr,
+    nullptr,
+};
+
+vx_kernel_description_t gaussian3x3_kernel = {
+    VX_KERNEL_GAUSSIAN_3x3,
+    "org.khronos.openvx.gaussian_3x3",
+    vxGaussian3x3Kernel,
+    filter_kernel_params, dimof(filter_kernel_params),
+    nullptr,
+    vxFilterInputValidator,
+    vxFilterOutputValidator,
+    nullptr,
+    nullptr,
+};
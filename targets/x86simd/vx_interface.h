@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2012-2017 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _OPENVX_INTERFACE_H_
+#define _OPENVX_INTERFACE_H_
+
+/*!
+ * \file
+ * \brief The x86 SIMD Kernel Interface Header.
+ */
+
+#include <x86simd.h>
+#include <VX/vx_helper.h>
+
+extern vx_kernel_description_t colorconvert_kernel;
+extern vx_kernel_description_t channelextract_kernel;
+extern vx_kernel_description_t magnitude_kernel;
+extern vx_kernel_description_t phase_kernel;
+extern vx_kernel_description_t channelcombine_kernel;
+extern vx_kernel_description_t scale_image_kernel;
+extern vx_kernel_description_t lut_kernel;
+extern vx_kernel_description_t histogram_kernel;
+extern vx_kernel_description_t equalize_hist_kernel;
+extern vx_kernel_description_t absdiff_kernel;
+extern vx_kernel_description_t threshold_kernel;
+extern vx_kernel_description_t integral_image_kernel;
+extern vx_kernel_description_t erode3x3_kernel;
+extern vx_kernel_description_t dilate3x3_kernel;
+extern vx_kernel_description_t median3x3_kernel;
+extern vx_kernel_description_t box3x3_kernel;
+extern vx_kernel_description_t box3x3_kernel_2;
+extern vx_kernel_description_t gaussian3x3_kernel;
+extern vx_kernel_description_t convolution_kernel;
+extern vx_kernel_description_t weightedaverage_kernel;
+extern vx_kernel_description_t convertdepth_kernel;
+extern vx_kernel_description_t and_kernel;
+extern vx_kernel_description_t or_kernel;
+extern vx_kernel_description_t xor_kernel;
+extern vx_kernel_description_t not_kernel;
+extern vx_kernel_description_t multiply_kernel;
+extern vx_kernel_description_t add_kernel;
+extern vx_kernel_description_t subtract_kernel;
+extern vx_kernel_description_t warp_affine_kernel;
+extern vx_kernel_description_t warp_perspective_kernel;
+extern vx_kernel_description_t halfscale_gaussian_kernel;
+
+extern vx_kernel_description_t min_kernel;
+extern vx_kernel_description_t max_kernel;
+
+#endif /* _OPENVX_INTERFACE_H_ */
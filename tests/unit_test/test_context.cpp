@@ -9,6 +9,12 @@
  */
 #include <gtest/gtest.h>
 #include <VX/vx.h>
+#include <VX/vx_corevx_ext.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
 
 #include "vx_internal.h"
 
@@ -58,6 +64,25 @@ TEST_F(ContextTest, QueryContext)
     EXPECT_EQ(version, VX_VERSION);
 }
 
+TEST_F(ContextTest, CpuVariantOverride)
+{
+    vx_enum variant = VX_CPU_VARIANT_SCALAR - 1;
+    vx_status status = vxQueryContext(context, VX_CONTEXT_CPU_VARIANT, &variant, sizeof(variant));
+    EXPECT_EQ(status, VX_SUCCESS);
+    EXPECT_GE(variant, VX_CPU_VARIANT_SCALAR);
+    EXPECT_LE(variant, VX_CPU_VARIANT_AVX512);
+
+    /* the variant is picked when the context is created */
+    vxReleaseContext(&context);
+    setenv("VX_CPU_VARIANT", "scalar", 1);
+    context = vxCreateContext();
+    unsetenv("VX_CPU_VARIANT");
+    ASSERT_NE(context, nullptr);
+    status = vxQueryContext(context, VX_CONTEXT_CPU_VARIANT, &variant, sizeof(variant));
+    EXPECT_EQ(status, VX_SUCCESS);
+    EXPECT_EQ(variant, VX_CPU_VARIANT_SCALAR);
+}
+
 TEST_F(ContextTest, AddAndRemoveReference)
 {
     vx_image image = vxCreateImage(context, 128, 128, VX_DF_IMAGE_U8);
@@ -73,6 +98,53 @@ TEST_F(ContextTest, AddAndRemoveReference)
     vxReleaseImage(&image);
 }
 
+TEST_F(ContextTest, ReferenceSlotsAreRecycled)
+{
+    vx_image image = vxCreateImage(context, 16, 16, VX_DF_IMAGE_U8);
+    ASSERT_NE(image, nullptr);
+    auto found = context->reftable_index.find((vx_reference)image);
+    ASSERT_NE(found, context->reftable_index.end());
+    vx_uint32 slot = found->second;
+    EXPECT_EQ(context->reftable[slot], (vx_reference)image);
+
+    /* the slot of a released reference is the next one handed out */
+    vx_uint32 count = context->num_references;
+    vxReleaseImage(&image);
+    EXPECT_EQ(context->num_references, count - 1u);
+    EXPECT_EQ(context->reftable[slot], nullptr);
+
+    vx_scalar scalar = vxCreateScalar(context, VX_TYPE_UINT32, &count);
+    ASSERT_NE(scalar, nullptr);
+    EXPECT_EQ(context->reftable[slot], (vx_reference)scalar);
+    vxReleaseScalar(&scalar);
+}
+
+TEST_F(ContextTest, AccessorSlotsAreRecycled)
+{
+    vx_uint32 first, second, third;
+    void* ptr = nullptr;
+    ASSERT_TRUE(context->addAccessor(16, VX_READ_ONLY, ptr, nullptr, &first, nullptr));
+    ptr = nullptr;
+    ASSERT_TRUE(context->addAccessor(16, VX_READ_ONLY, ptr, nullptr, &second, nullptr));
+    EXPECT_NE(first, second);
+
+    context->removeAccessor(first);
+    /* removing twice must not hand the slot out twice */
+    context->removeAccessor(first);
+    ptr = nullptr;
+    ASSERT_TRUE(context->addAccessor(16, VX_READ_ONLY, ptr, nullptr, &third, nullptr));
+    EXPECT_EQ(third, first);
+    vx_uint32 fourth;
+    ptr = nullptr;
+    ASSERT_TRUE(context->addAccessor(16, VX_READ_ONLY, ptr, nullptr, &fourth, nullptr));
+    EXPECT_NE(fourth, first);
+    EXPECT_NE(fourth, second);
+
+    context->removeAccessor(second);
+    context->removeAccessor(third);
+    context->removeAccessor(fourth);
+}
+
 TEST_F(ContextTest, MemoryMapAndUnmap)
 {
     vx_image image = vxCreateImage(context, 128, 128, VX_DF_IMAGE_U8);
@@ -154,6 +226,130 @@ TEST_F(ContextTest, FindMemoryMap)
     vxReleaseImage(&image);
 }
 
+TEST_F(ContextTest, MemoryMapSlotsAreRecycled)
+{
+    vx_image image = vxCreateImage(context, 16, 16, VX_DF_IMAGE_U8);
+    ASSERT_NE(image, nullptr);
+
+    vx_memory_map_extra extra = {};
+    void* ptr = nullptr;
+    std::vector<vx_map_id> ids(VX_INT_MAX_REF);
+    for (vx_map_id &id : ids)
+    {
+        ASSERT_TRUE(context->memoryMap((vx_reference)image, 0, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0, &extra, &ptr, &id));
+    }
+
+    /* every slot is handed out once, and a full table refuses further maps */
+    std::set<vx_map_id> unique(ids.begin(), ids.end());
+    EXPECT_EQ(unique.size(), (size_t)VX_INT_MAX_REF);
+    vx_map_id extra_id;
+    EXPECT_FALSE(context->memoryMap((vx_reference)image, 0, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0, &extra, &ptr, &extra_id));
+
+    /* the last slot given back is the next one handed out */
+    vx_map_id freed = ids[VX_INT_MAX_REF / 2];
+    context->memoryUnmap(freed);
+    EXPECT_FALSE(context->findMemoryMap((vx_reference)image, freed));
+    vx_map_id again;
+    ASSERT_TRUE(context->memoryMap((vx_reference)image, 0, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0, &extra, &ptr, &again));
+    EXPECT_EQ(again, freed);
+
+    for (vx_map_id id : ids)
+    {
+        context->memoryUnmap(id);
+    }
+    vxReleaseImage(&image);
+}
+
+TEST_F(ContextTest, ConcurrentMemoryMaps)
+{
+    vx_image image = vxCreateImage(context, 16, 16, VX_DF_IMAGE_U8);
+    ASSERT_NE(image, nullptr);
+
+    const int threads = 4, rounds = 2000, held = 8;
+    std::atomic<int> failures(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&]() {
+            vx_memory_map_extra extra = {};
+            for (int r = 0; r < rounds; r++)
+            {
+                vx_map_id ids[held];
+                void* ptrs[held];
+                for (int h = 0; h < held; h++)
+                {
+                    if (!context->memoryMap((vx_reference)image, 64, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0, &extra, &ptrs[h], &ids[h]))
+                    {
+                        failures++;
+                        return;
+                    }
+                    /* nobody else may be handed the slot or the buffer while we hold it */
+                    memset(ptrs[h], h, 64);
+                }
+                for (int h = 0; h < held; h++)
+                {
+                    if (!context->findMemoryMap((vx_reference)image, ids[h]) ||
+                        ((vx_uint8*)ptrs[h])[63] != h)
+                    {
+                        failures++;
+                    }
+                    context->memoryUnmap(ids[h]);
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+
+    vxReleaseImage(&image);
+}
+
+TEST_F(ContextTest, ConcurrentAccessors)
+{
+    const int threads = 4, rounds = 2000, held = 8;
+    std::atomic<int> failures(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&]() {
+            for (int r = 0; r < rounds; r++)
+            {
+                vx_uint32 indices[held];
+                void* ptrs[held];
+                for (int h = 0; h < held; h++)
+                {
+                    ptrs[h] = nullptr;
+                    if (!context->addAccessor(64, VX_READ_ONLY, ptrs[h], nullptr, &indices[h], nullptr))
+                    {
+                        failures++;
+                        return;
+                    }
+                    /* nobody else may be handed the slot or the buffer while we hold it */
+                    memset(ptrs[h], h, 64);
+                }
+                for (int h = 0; h < held; h++)
+                {
+                    vx_uint32 found = 0;
+                    if (!context->findAccessor(ptrs[h], &found) || found != indices[h] ||
+                        ((vx_uint8*)ptrs[h])[63] != h)
+                    {
+                        failures++;
+                    }
+                    context->removeAccessor(indices[h]);
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+}
+
 TEST_F(ContextTest, RemoveAccessor)
 {
     vx_uint32 index;
@@ -0,0 +1,1261 @@
+/**
+ * @file test_graph.cpp
+ * @brief Test Internal Graph Execution
+ * @version 0.1
+ * @date 2025-08-20
+ *
+ * @copyright Copyright (c) 2025 Edge.AI
+ *
+ */
+#include <gtest/gtest.h>
+#include <VX/vx.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+class GraphTest : public ::testing::Test
+{
+protected:
+    vx_context context;
+    vx_graph graph;
+    const vx_uint32 width = 64;
+    const vx_uint32 height = 48;
+
+    void SetUp() override
+    {
+        context = vxCreateContext();
+        ASSERT_EQ(vxGetStatus((vx_reference)context), VX_SUCCESS);
+        graph = vxCreateGraph(context);
+        ASSERT_EQ(vxGetStatus((vx_reference)graph), VX_SUCCESS);
+    }
+
+    void TearDown() override
+    {
+        vxReleaseGraph(&graph);
+        vxReleaseContext(&context);
+    }
+
+    vx_image createPattern(vx_uint32 seed)
+    {
+        vx_image image = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        std::vector<vx_uint8> data(width * height);
+        for (vx_uint32 i = 0; i < data.size(); i++)
+        {
+            data[i] = (vx_uint8)((i * 31u + seed * 7u) ^ (i >> 3));
+        }
+        vx_rectangle_t rect = {0, 0, width, height};
+        vx_imagepatch_addressing_t addr = {};
+        addr.dim_x = width;
+        addr.dim_y = height;
+        addr.stride_x = 1;
+        addr.stride_y = (vx_int32)width;
+        EXPECT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, data.data(), VX_WRITE_ONLY,
+                                   VX_MEMORY_TYPE_HOST),
+                  VX_SUCCESS);
+        return image;
+    }
+
+    std::vector<vx_uint8> readImage(vx_image image)
+    {
+        std::vector<vx_uint8> data(width * height);
+        vx_rectangle_t rect = {0, 0, width, height};
+        vx_imagepatch_addressing_t addr = {};
+        addr.dim_x = width;
+        addr.dim_y = height;
+        addr.stride_x = 1;
+        addr.stride_y = (vx_int32)width;
+        EXPECT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, data.data(), VX_READ_ONLY,
+                                   VX_MEMORY_TYPE_HOST),
+                  VX_SUCCESS);
+        return data;
+    }
+};
+
+TEST_F(GraphTest, WideGraphExecutesEveryNode)
+{
+    const vx_uint32 branches = 16;
+    vx_image input = createPattern(1);
+    std::vector<vx_image> outputs(branches);
+    std::vector<vx_node> nodes(branches);
+
+    for (vx_uint32 b = 0; b < branches; b++)
+    {
+        outputs[b] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        nodes[b] = vxNotNode(graph, input, outputs[b]);
+        ASSERT_EQ(vxGetStatus((vx_reference)nodes[b]), VX_SUCCESS);
+    }
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+
+    std::vector<vx_uint8> in = readImage(input);
+    for (vx_uint32 b = 0; b < branches; b++)
+    {
+        EXPECT_EQ(nodes[b]->executed, vx_true_e);
+        std::vector<vx_uint8> out = readImage(outputs[b]);
+        for (vx_uint32 i = 0; i < out.size(); i++)
+        {
+            ASSERT_EQ(out[i], (vx_uint8)~in[i]);
+        }
+        vxReleaseNode(&nodes[b]);
+        vxReleaseImage(&outputs[b]);
+    }
+    vxReleaseImage(&input);
+}
+
+TEST_F(GraphTest, NodeAndReferenceTablesGrowPastTheOldLimit)
+{
+    EXPECT_TRUE(graph->nodes.empty());
+    EXPECT_TRUE(graph->heads.empty());
+    EXPECT_TRUE(graph->delays.empty());
+
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    const vx_uint32 count = VX_INT_MAX_REF + 16u;
+    vx_node last = nullptr;
+    for (vx_uint32 n = 0; n < count; n++)
+    {
+        vx_node node = vxNotNode(graph, input, output);
+        ASSERT_EQ(vxGetStatus((vx_reference)node), VX_SUCCESS);
+        if (last)
+        {
+            vxReleaseNode(&last);
+        }
+        last = node;
+    }
+    EXPECT_EQ(graph->numNodes, count);
+    EXPECT_EQ(graph->nodes.size(), (size_t)count);
+    EXPECT_GT(context->num_references, (vx_uint32)VX_INT_MAX_REF);
+
+    ASSERT_EQ(vxRemoveNode(&last), VX_SUCCESS);
+    EXPECT_EQ(graph->numNodes, count - 1u);
+    EXPECT_EQ(graph->nodes.size(), (size_t)(count - 1u));
+
+    vxReleaseImage(&input);
+    vxReleaseImage(&output);
+}
+
+TEST_F(GraphTest, ParallelExecutionMatchesSerial)
+{
+    vx_image in0 = createPattern(2);
+    vx_image in1 = createPattern(3);
+    vx_image out = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image v[6];
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        v[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    }
+
+    /* two independent branches which join, followed by a short tail */
+    vx_node stencils[3];
+    stencils[0] = vxBox3x3Node(graph, in0, v[0]);
+    vxNotNode(graph, v[0], v[1]);
+    stencils[1] = vxGaussian3x3Node(graph, in1, v[2]);
+    vxAbsDiffNode(graph, in0, in1, v[3]);
+    vxAndNode(graph, v[2], v[3], v[4]);
+    vxOrNode(graph, v[1], v[4], v[5]);
+    stencils[2] = vxMedian3x3Node(graph, v[5], out);
+
+    /* an undefined border leaves the edge to the target, which need not repeat itself */
+    vx_border_t border = {VX_BORDER_REPLICATE, {{0}}};
+    for (vx_node node : stencils)
+    {
+        ASSERT_EQ(vxSetNodeAttribute(node, VX_NODE_BORDER, &border, sizeof(border)), VX_SUCCESS);
+    }
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+
+    graph->shouldSerialize = vx_false_e;
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    std::vector<vx_uint8> parallel = readImage(out);
+
+    graph->shouldSerialize = vx_true_e;
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    std::vector<vx_uint8> serial = readImage(out);
+
+    EXPECT_EQ(parallel, serial);
+
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        vxReleaseImage(&v[i]);
+    }
+    vxReleaseImage(&in0);
+    vxReleaseImage(&in1);
+    vxReleaseImage(&out);
+}
+
+TEST_F(GraphTest, VerifyBuildsDependencyTables)
+{
+    vx_image in = createPattern(4);
+    vx_image out = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image v[3];
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        v[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    }
+
+    /* diamond: top feeds left and right, both feed bottom */
+    vx_node top = vxNotNode(graph, in, v[0]);
+    vx_node left = vxBox3x3Node(graph, v[0], v[1]);
+    vx_node right = vxGaussian3x3Node(graph, v[0], v[2]);
+    vx_node bottom = vxAndNode(graph, v[1], v[2], out);
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(graph->inDegree.size(), 4u);
+    ASSERT_EQ(graph->successorOffsets.size(), 5u);
+    ASSERT_EQ(graph->successors.size(), 4u);
+
+    auto indexOf = [&](vx_node node) {
+        for (vx_uint32 n = 0; n < graph->numNodes; n++)
+            if (graph->nodes[n] == node) return n;
+        return graph->numNodes;
+    };
+    auto consumersOf = [&](vx_node node) {
+        vx_uint32 n = indexOf(node);
+        std::vector<vx_uint32> list(graph->successors.begin() + graph->successorOffsets[n],
+                                    graph->successors.begin() + graph->successorOffsets[n + 1]);
+        std::sort(list.begin(), list.end());
+        return list;
+    };
+
+    EXPECT_EQ(graph->inDegree[indexOf(top)], 0u);
+    EXPECT_EQ(graph->inDegree[indexOf(left)], 1u);
+    EXPECT_EQ(graph->inDegree[indexOf(right)], 1u);
+    EXPECT_EQ(graph->inDegree[indexOf(bottom)], 2u);
+
+    std::vector<vx_uint32> expected = {indexOf(left), indexOf(right)};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(consumersOf(top), expected);
+    EXPECT_EQ(consumersOf(left), std::vector<vx_uint32>{indexOf(bottom)});
+    EXPECT_EQ(consumersOf(right), std::vector<vx_uint32>{indexOf(bottom)});
+    EXPECT_TRUE(consumersOf(bottom).empty());
+
+    EXPECT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(bottom->executed, vx_true_e);
+
+    vxReleaseNode(&top);
+    vxReleaseNode(&left);
+    vxReleaseNode(&right);
+    vxReleaseNode(&bottom);
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        vxReleaseImage(&v[i]);
+    }
+    vxReleaseImage(&in);
+    vxReleaseImage(&out);
+}
+
+TEST_F(GraphTest, ReadyNodesFollowCriticalPath)
+{
+    vx_image in = createPattern(5);
+    vx_image shortOut = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image longOut = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image v[3];
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        v[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    }
+
+    /* the short branch is added first, so graph order alone would run it first */
+    vx_node shortNode = vxNotNode(graph, in, shortOut);
+    vx_node chain[4] = {
+        vxBox3x3Node(graph, in, v[0]),
+        vxNotNode(graph, v[0], v[1]),
+        vxGaussian3x3Node(graph, v[1], v[2]),
+        vxMedian3x3Node(graph, v[2], longOut),
+    };
+
+    ASSERT_EQ(vxDirective((vx_reference)context, VX_DIRECTIVE_ENABLE_PERFORMANCE), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+
+    auto levelOf = [&](vx_node node) {
+        for (vx_uint32 n = 0; n < graph->numNodes; n++)
+            if (graph->nodes[n] == node) return graph->bottomLevel[n];
+        return (vx_uint64)0u;
+    };
+    for (vx_uint32 i = 1; i < dimof(chain); i++)
+    {
+        EXPECT_GT(levelOf(chain[i - 1]), levelOf(chain[i]));
+    }
+    EXPECT_GT(levelOf(chain[0]), levelOf(shortNode));
+
+    vx_uint64 estimated = levelOf(chain[0]);
+    graph->shouldSerialize = vx_true_e;
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    EXPECT_LT(chain[0]->perf.beg, shortNode->perf.beg);
+
+    /* execution leaves the levels alone, a reverify switches them to the measured times */
+    EXPECT_EQ(levelOf(chain[0]), estimated);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    EXPECT_GT(levelOf(chain[0]), levelOf(shortNode));
+
+    vxDirective((vx_reference)context, VX_DIRECTIVE_DISABLE_PERFORMANCE);
+    vxReleaseNode(&shortNode);
+    for (vx_uint32 i = 0; i < dimof(chain); i++)
+    {
+        vxReleaseNode(&chain[i]);
+    }
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        vxReleaseImage(&v[i]);
+    }
+    vxReleaseImage(&in);
+    vxReleaseImage(&shortOut);
+    vxReleaseImage(&longOut);
+}
+
+TEST_F(GraphTest, QueueAutoPipelinesFramesInOrder)
+{
+    const vx_uint32 depth = 4, frames = 12;
+    vx_image inputs[depth], outputs[depth];
+    vx_image v[2];
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        inputs[i] = createPattern(10 + i);
+        outputs[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    }
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        v[i] = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    }
+
+    vx_node head = vxNotNode(graph, inputs[0], v[0]);
+    vx_node box = vxBox3x3Node(graph, v[0], v[1]);
+    vx_node tail = vxNotNode(graph, v[1], outputs[0]);
+    vx_parameter in = vxGetParameterByIndex(head, 0);
+    vx_parameter out = vxGetParameterByIndex(tail, 1);
+    ASSERT_EQ(vxAddParameterToGraph(graph, in), VX_SUCCESS);
+    ASSERT_EQ(vxAddParameterToGraph(graph, out), VX_SUCCESS);
+
+    vx_graph_parameter_queue_params_t qparams[2] = {};
+    qparams[0].graph_parameter_index = 0;
+    qparams[0].refs_list_size = depth;
+    qparams[0].refs_list = (vx_reference *)inputs;
+    qparams[1].graph_parameter_index = 1;
+    qparams[1].refs_list_size = depth;
+    qparams[1].refs_list = (vx_reference *)outputs;
+    ASSERT_EQ(vxSetGraphScheduleConfig(graph, VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO, 2, qparams),
+              VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+
+    /* expected output per buffer, from the same chain run one frame at a time */
+    std::vector<std::vector<vx_uint8>> expected(depth);
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        vx_graph serial = vxCreateGraph(context);
+        vx_image a = vxCreateVirtualImage(serial, width, height, VX_DF_IMAGE_U8);
+        vx_image b = vxCreateVirtualImage(serial, width, height, VX_DF_IMAGE_U8);
+        vx_image c = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        vxNotNode(serial, inputs[i], a);
+        vxBox3x3Node(serial, a, b);
+        vxNotNode(serial, b, c);
+        ASSERT_EQ(vxProcessGraph(serial), VX_SUCCESS);
+        expected[i] = readImage(c);
+        vxReleaseImage(&a);
+        vxReleaseImage(&b);
+        vxReleaseImage(&c);
+        vxReleaseGraph(&serial);
+    }
+
+    /* fill the pipeline in one go, then keep it full: one frame in for every frame out */
+    ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 1, (vx_reference *)outputs, depth), VX_SUCCESS);
+    ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 0, (vx_reference *)inputs, depth), VX_SUCCESS);
+    EXPECT_EQ(graph->pipeline.configured.load(), vx_true_e);
+    EXPECT_EQ(graph->pipeline.frames.size(), depth);
+    for (vx_uint32 f = 0; f < frames; f++)
+    {
+        vx_reference done = nullptr, used = nullptr;
+        vx_uint32 num = 0;
+        ASSERT_EQ(vxGraphParameterDequeueDoneRef(graph, 1, &done, 1, &num), VX_SUCCESS);
+        ASSERT_EQ(num, 1u);
+        ASSERT_EQ(done, (vx_reference)outputs[f % depth]);
+        EXPECT_EQ(readImage((vx_image)done), expected[f % depth]) << "frame " << f;
+        ASSERT_EQ(vxGraphParameterDequeueDoneRef(graph, 0, &used, 1, &num), VX_SUCCESS);
+        ASSERT_EQ(used, (vx_reference)inputs[f % depth]);
+
+        if (f + depth < frames)
+        {
+            ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 0, &used, 1), VX_SUCCESS);
+            ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 1, &done, 1), VX_SUCCESS);
+        }
+    }
+    EXPECT_EQ(vxWaitGraph(graph), VX_SUCCESS);
+    /* frames really overlapped: nodes of a frame started before the previous one finished */
+    EXPECT_GT(graph->pipeline.overlapped, 0u);
+
+    /* the graph is left bound to its original references */
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(box->parameters[0], (vx_reference)v[0]);
+    EXPECT_EQ(tail->parameters[1], (vx_reference)outputs[0]);
+
+    vxReleaseParameter(&in);
+    vxReleaseParameter(&out);
+    vxReleaseNode(&head);
+    vxReleaseNode(&box);
+    vxReleaseNode(&tail);
+    for (vx_uint32 i = 0; i < dimof(v); i++)
+    {
+        vxReleaseImage(&v[i]);
+    }
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        vxReleaseImage(&inputs[i]);
+        vxReleaseImage(&outputs[i]);
+    }
+}
+
+TEST_F(GraphTest, QueueAutoGivesEveryFrameItsOwnDataObjects)
+{
+    const vx_uint32 depth = 3;
+    vx_image inputs[depth], outputs[depth];
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        inputs[i] = createPattern(20 + i);
+        outputs[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    }
+    vx_scalar mean = vxCreateVirtualScalar(graph, VX_TYPE_FLOAT32);
+    vx_scalar stddev = vxCreateVirtualScalar(graph, VX_TYPE_FLOAT32);
+    vx_distribution hist = vxCreateVirtualDistribution(graph, 16, 0, 256);
+
+    vx_node head = vxNotNode(graph, inputs[0], outputs[0]);
+    vx_node stats = vxMeanStdDevNode(graph, inputs[0], mean, stddev);
+    vx_node histogram = vxHistogramNode(graph, inputs[0], hist);
+    vx_parameter in = vxGetParameterByIndex(head, 0);
+    vx_parameter out = vxGetParameterByIndex(head, 1);
+    ASSERT_EQ(vxAddParameterToGraph(graph, in), VX_SUCCESS);
+    ASSERT_EQ(vxAddParameterToGraph(graph, out), VX_SUCCESS);
+
+    vx_graph_parameter_queue_params_t qparams[2] = {};
+    qparams[0].graph_parameter_index = 0;
+    qparams[0].refs_list_size = depth;
+    qparams[0].refs_list = (vx_reference *)inputs;
+    qparams[1].graph_parameter_index = 1;
+    qparams[1].refs_list_size = depth;
+    qparams[1].refs_list = (vx_reference *)outputs;
+    ASSERT_EQ(vxSetGraphScheduleConfig(graph, VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO, 2, qparams),
+              VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+
+    ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 1, (vx_reference *)outputs, depth), VX_SUCCESS);
+    ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 0, (vx_reference *)inputs, depth), VX_SUCCESS);
+    EXPECT_EQ(vxWaitGraph(graph), VX_SUCCESS);
+
+    /* scalars and distributions are duplicated per frame slot just like images */
+    vx_uint32 scalars = 0, distributions = 0;
+    for (vx_reference clone : graph->pipeline.clones)
+    {
+        scalars += (clone->type == VX_TYPE_SCALAR) ? 1u : 0u;
+        distributions += (clone->type == VX_TYPE_DISTRIBUTION) ? 1u : 0u;
+    }
+    EXPECT_EQ(scalars, 2u * (depth - 1));
+    EXPECT_EQ(distributions, depth - 1);
+
+    vx_reference done[depth];
+    vx_uint32 num = 0;
+    EXPECT_EQ(vxGraphParameterDequeueDoneRef(graph, 1, done, depth, &num), VX_SUCCESS);
+    EXPECT_EQ(num, depth);
+    EXPECT_EQ(vxGraphParameterDequeueDoneRef(graph, 0, done, depth, &num), VX_SUCCESS);
+    EXPECT_EQ(num, depth);
+
+    vxReleaseParameter(&in);
+    vxReleaseParameter(&out);
+    vxReleaseNode(&head);
+    vxReleaseNode(&stats);
+    vxReleaseNode(&histogram);
+    vxReleaseScalar(&mean);
+    vxReleaseScalar(&stddev);
+    vxReleaseDistribution(&hist);
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        vxReleaseImage(&inputs[i]);
+        vxReleaseImage(&outputs[i]);
+    }
+}
+
+TEST_F(GraphTest, IndependentGraphsRunOnExecutors)
+{
+    const vx_uint32 count = 8;
+    vx_image input = createPattern(20);
+    vx_graph graphs[count];
+    vx_image outputs[count];
+
+    EXPECT_GE(context->proc.numThreads, 1u);
+    EXPECT_LE(context->proc.numThreads, (vx_uint32)VX_INT_MAX_GRAPH_EXECUTORS);
+
+    /* one graph per camera, each with its own chain */
+    for (vx_uint32 g = 0; g < count; g++)
+    {
+        graphs[g] = vxCreateGraph(context);
+        outputs[g] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+        vx_image v = vxCreateVirtualImage(graphs[g], width, height, VX_DF_IMAGE_U8);
+        vxBox3x3Node(graphs[g], input, v);
+        vxNotNode(graphs[g], v, outputs[g]);
+        vxReleaseImage(&v);
+        ASSERT_EQ(vxVerifyGraph(graphs[g]), VX_SUCCESS);
+    }
+
+    for (vx_uint32 round = 0; round < 4; round++)
+    {
+        for (vx_uint32 g = 0; g < count; g++)
+        {
+            ASSERT_EQ(vxScheduleGraph(graphs[g]), VX_SUCCESS);
+        }
+        /* waiting in the opposite order only collects the graph asked for */
+        for (vx_uint32 g = count; g-- > 0;)
+        {
+            ASSERT_EQ(vxWaitGraph(graphs[g]), VX_SUCCESS);
+            EXPECT_EQ(graphs[g]->execQueued, 0u);
+        }
+    }
+
+    std::vector<vx_uint8> first = readImage(outputs[0]);
+    for (vx_uint32 g = 0; g < count; g++)
+    {
+        EXPECT_EQ(readImage(outputs[g]), first);
+        /* nothing is scheduled, so waiting again returns at once */
+        EXPECT_EQ(vxWaitGraph(graphs[g]), VX_SUCCESS);
+        vxReleaseGraph(&graphs[g]);
+        vxReleaseImage(&outputs[g]);
+    }
+    vxReleaseImage(&input);
+}
+
+TEST_F(GraphTest, StreamingWaitsForInputsAndStopsPromptly)
+{
+    const vx_uint32 depth = 3;
+    vx_image inputs[depth], outputs[depth];
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        inputs[i] = createPattern(30 + i);
+        outputs[i] = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    }
+    vx_node node = vxNotNode(graph, inputs[0], outputs[0]);
+    vx_parameter in = vxGetParameterByIndex(node, 0);
+    vx_parameter out = vxGetParameterByIndex(node, 1);
+    ASSERT_EQ(vxAddParameterToGraph(graph, in), VX_SUCCESS);
+    ASSERT_EQ(vxAddParameterToGraph(graph, out), VX_SUCCESS);
+
+    vx_graph_parameter_queue_params_t qparams[2] = {};
+    qparams[0].graph_parameter_index = 0;
+    qparams[0].refs_list_size = depth;
+    qparams[0].refs_list = (vx_reference *)inputs;
+    qparams[1].graph_parameter_index = 1;
+    qparams[1].refs_list_size = depth;
+    qparams[1].refs_list = (vx_reference *)outputs;
+    ASSERT_EQ(vxSetGraphScheduleConfig(graph, VX_GRAPH_SCHEDULE_MODE_QUEUE_AUTO, 2, qparams),
+              VX_SUCCESS);
+    ASSERT_EQ(vxDirective((vx_reference)context, VX_DIRECTIVE_ENABLE_PERFORMANCE), VX_SUCCESS);
+    ASSERT_EQ(vxEnableGraphStreaming(graph, node), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxStartGraphStreaming(graph), VX_SUCCESS);
+
+    /* nothing is enqueued yet, so the streaming thread must not run the graph */
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(graph->perf.num, 0u);
+
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 0, (vx_reference *)&inputs[i], 1), VX_SUCCESS);
+        ASSERT_EQ(vxGraphParameterEnqueueReadyRef(graph, 1, (vx_reference *)&outputs[i], 1), VX_SUCCESS);
+    }
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        vx_reference done = nullptr;
+        vx_uint32 num = 0;
+        ASSERT_EQ(vxGraphParameterDequeueDoneRef(graph, 1, &done, 1, &num), VX_SUCCESS);
+        EXPECT_EQ(done, (vx_reference)outputs[i]);
+        std::vector<vx_uint8> src = readImage(inputs[i]);
+        std::vector<vx_uint8> dst = readImage(outputs[i]);
+        for (vx_uint32 p = 0; p < dst.size(); p++)
+        {
+            ASSERT_EQ(dst[p], (vx_uint8)~src[p]);
+        }
+    }
+
+    /* idle again: one execution per enqueued set, and stopping does not wait on a timer */
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(graph->perf.num, (vx_uint64)depth);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(vxStopGraphStreaming(graph), VX_SUCCESS);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+    EXPECT_EQ(vxStopGraphStreaming(graph), VX_ERROR_INVALID_PARAMETERS);
+
+    vxDirective((vx_reference)context, VX_DIRECTIVE_DISABLE_PERFORMANCE);
+    vxReleaseParameter(&in);
+    vxReleaseParameter(&out);
+    vxReleaseNode(&node);
+    for (vx_uint32 i = 0; i < depth; i++)
+    {
+        vxReleaseImage(&inputs[i]);
+        vxReleaseImage(&outputs[i]);
+    }
+}
+
+/* A stand-in for a capture node: blocks until the test hands it a frame */
+static struct
+{
+    std::mutex lock;
+    std::condition_variable cond;
+    vx_uint32 frames = 0;
+    vx_bool closed = vx_false_e;
+} camera;
+
+static vx_status VX_CALLBACK cameraCapture(vx_node, const vx_reference *, vx_uint32)
+{
+    std::unique_lock<std::mutex> guard(camera.lock);
+    camera.cond.wait(guard, [] { return camera.frames > 0 || camera.closed == vx_true_e; });
+    if (camera.frames == 0)
+    {
+        return VX_FAILURE;
+    }
+    camera.frames--;
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK cameraValidate(vx_node, const vx_reference[], vx_uint32, vx_meta_format metas[])
+{
+    vx_uint32 w = 64, h = 48;
+    vx_df_image format = VX_DF_IMAGE_U8;
+    vxSetMetaFormatAttribute(metas[0], VX_IMAGE_WIDTH, &w, sizeof(w));
+    vxSetMetaFormatAttribute(metas[0], VX_IMAGE_HEIGHT, &h, sizeof(h));
+    vxSetMetaFormatAttribute(metas[0], VX_IMAGE_FORMAT, &format, sizeof(format));
+    return VX_SUCCESS;
+}
+
+TEST_F(GraphTest, StreamingTriggerNodePacesFreeRunningGraph)
+{
+    vx_enum id = 0;
+    ASSERT_EQ(vxAllocateUserKernelId(context, &id), VX_SUCCESS);
+    vx_kernel kernel = vxAddUserKernel(context, "test.camera", id, cameraCapture, 1, cameraValidate,
+                                       nullptr, nullptr);
+    ASSERT_EQ(vxGetStatus((vx_reference)kernel), VX_SUCCESS);
+    ASSERT_EQ(vxAddParameterToKernel(kernel, 0, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED),
+              VX_SUCCESS);
+    ASSERT_EQ(vxFinalizeKernel(kernel), VX_SUCCESS);
+
+    vx_image frame = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image out = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_node source = vxCreateGenericNode(graph, kernel);
+    ASSERT_EQ(vxSetParameterByIndex(source, 0, (vx_reference)frame), VX_SUCCESS);
+    vx_node sink = vxNotNode(graph, frame, out);
+    camera.frames = 0;
+    camera.closed = vx_false_e;
+
+    ASSERT_EQ(vxDirective((vx_reference)context, VX_DIRECTIVE_ENABLE_PERFORMANCE), VX_SUCCESS);
+    ASSERT_EQ(vxEnableGraphStreaming(graph, source), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxStartGraphStreaming(graph), VX_SUCCESS);
+
+    /* no frame yet: the thread sits in the source instead of re-running the graph */
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(sink->perf.num, 0u);
+
+    /* one execution of the rest of the graph per captured frame */
+    const vx_uint32 frames = 3;
+    for (vx_uint32 f = 0; f < frames; f++)
+    {
+        {
+            std::lock_guard<std::mutex> guard(camera.lock);
+            camera.frames++;
+        }
+        camera.cond.notify_all();
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (sink->perf.num < f + 1 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(sink->perf.num, (vx_uint64)frames);
+    EXPECT_EQ(source->perf.num, (vx_uint64)frames);
+
+    /* closing the source ends the stream, stopping then only joins */
+    {
+        std::lock_guard<std::mutex> guard(camera.lock);
+        camera.closed = vx_true_e;
+    }
+    camera.cond.notify_all();
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(vxStopGraphStreaming(graph), VX_SUCCESS);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+
+    vxDirective((vx_reference)context, VX_DIRECTIVE_DISABLE_PERFORMANCE);
+    vxReleaseNode(&source);
+    vxReleaseNode(&sink);
+    vxReleaseImage(&frame);
+    vxReleaseImage(&out);
+    vxRemoveKernel(kernel);
+}
+
+TEST_F(GraphTest, FreeRunningStreamStopsAfterCurrentExecution)
+{
+    vx_image in = createPattern(40);
+    vx_image out = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_node node = vxBox3x3Node(graph, in, out);
+
+    ASSERT_EQ(vxEnableGraphStreaming(graph, node), VX_SUCCESS);
+    ASSERT_EQ(vxStartGraphStreaming(graph), VX_SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(vxStopGraphStreaming(graph), VX_SUCCESS);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+    EXPECT_EQ(graph->isStreaming, vx_false_e);
+
+    /* a stopped graph can be started again */
+    ASSERT_EQ(vxEnableGraphStreaming(graph, node), VX_SUCCESS);
+    ASSERT_EQ(vxStartGraphStreaming(graph), VX_SUCCESS);
+    ASSERT_EQ(vxStopGraphStreaming(graph), VX_SUCCESS);
+
+    vxReleaseNode(&node);
+    vxReleaseImage(&in);
+    vxReleaseImage(&out);
+}
+
+TEST_F(GraphTest, ReplicatedNodeRunsEveryReplica)
+{
+    const vx_uint32 numItems = 8;
+    vx_image exemplar = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_object_array inputs = vxCreateObjectArray(context, (vx_reference)exemplar, numItems);
+    vx_object_array outputs = vxCreateObjectArray(context, (vx_reference)exemplar, numItems);
+    std::vector<std::vector<vx_uint8>> expected(numItems);
+    for (vx_uint32 i = 0; i < numItems; i++)
+    {
+        vx_image pattern = createPattern(50 + i);
+        vx_image item = (vx_image)vxGetObjectArrayItem(inputs, i);
+        expected[i] = readImage(pattern);
+        std::vector<vx_uint8> data = expected[i];
+        vx_rectangle_t rect = {0, 0, width, height};
+        vx_imagepatch_addressing_t addr = {};
+        addr.dim_x = width;
+        addr.dim_y = height;
+        addr.stride_x = 1;
+        addr.stride_y = (vx_int32)width;
+        ASSERT_EQ(vxCopyImagePatch(item, &rect, 0, &addr, data.data(), VX_WRITE_ONLY,
+                                   VX_MEMORY_TYPE_HOST),
+                  VX_SUCCESS);
+        vxReleaseImage(&item);
+        vxReleaseImage(&pattern);
+    }
+
+    vx_image in0 = (vx_image)vxGetObjectArrayItem(inputs, 0);
+    vx_image out0 = (vx_image)vxGetObjectArrayItem(outputs, 0);
+    vx_node node = vxNotNode(graph, in0, out0);
+    vx_bool replicate[] = {vx_true_e, vx_true_e};
+    ASSERT_EQ(vxReplicateNode(graph, node, replicate, 2), VX_SUCCESS);
+    ASSERT_EQ(vxDirective((vx_reference)context, VX_DIRECTIVE_ENABLE_PERFORMANCE), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+
+    for (vx_uint32 i = 0; i < numItems; i++)
+    {
+        vx_image item = (vx_image)vxGetObjectArrayItem(outputs, i);
+        std::vector<vx_uint8> dst = readImage(item);
+        for (vx_uint32 p = 0; p < dst.size(); p++)
+        {
+            ASSERT_EQ(dst[p], (vx_uint8)~expected[i][p]);
+        }
+        vxReleaseImage(&item);
+    }
+
+    /* each replica keeps its own counters */
+    std::vector<vx_perf_t> perf(numItems);
+    ASSERT_EQ(vxQueryNode(node, VX_NODE_ATTRIBUTE_REPLICA_PERFORMANCE, perf.data(),
+                          numItems * sizeof(vx_perf_t)),
+              VX_SUCCESS);
+    for (vx_uint32 i = 0; i < numItems; i++)
+    {
+        EXPECT_EQ(perf[i].num, 1u);
+    }
+    EXPECT_EQ(vxQueryNode(node, VX_NODE_ATTRIBUTE_REPLICA_PERFORMANCE, perf.data(), sizeof(vx_perf_t)),
+              VX_ERROR_INVALID_PARAMETERS);
+
+    vxDirective((vx_reference)context, VX_DIRECTIVE_DISABLE_PERFORMANCE);
+    vxReleaseNode(&node);
+    vxReleaseImage(&in0);
+    vxReleaseImage(&out0);
+    vxReleaseObjectArray(&inputs);
+    vxReleaseObjectArray(&outputs);
+    vxReleaseImage(&exemplar);
+}
+
+TEST_F(GraphTest, NodeChunksRunOncePerChunkWithinSlots)
+{
+    struct Chunks
+    {
+        std::vector<std::atomic<vx_uint32>> runs;
+        vx_uint32 maxThreads;
+        std::atomic<vx_uint32> badSlots;
+    };
+    auto run = [](void *arg, vx_uint32 chunk, vx_uint32 slot) -> vx_status {
+        Chunks *chunks = (Chunks *)arg;
+        chunks->runs[chunk]++;
+        if (slot >= chunks->maxThreads)
+            chunks->badSlots++;
+        return (chunk == 5u) ? VX_ERROR_INVALID_VALUE : VX_SUCCESS;
+    };
+
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_node node = vxNotNode(graph, input, output);
+    ASSERT_EQ(vxGetStatus((vx_reference)node), VX_SUCCESS);
+
+    for (vx_uint32 maxThreads : {1u, 3u, 64u})
+    {
+        Chunks chunks{std::vector<std::atomic<vx_uint32>>(67), maxThreads, {0}};
+        EXPECT_EQ(node->processChunks(67, maxThreads, run, &chunks), VX_ERROR_INVALID_VALUE);
+        for (auto &r : chunks.runs)
+            EXPECT_EQ(r.load(), 1u);
+        EXPECT_EQ(chunks.badSlots.load(), 0u);
+    }
+
+    vxReleaseNode(&node);
+    vxReleaseImage(&input);
+    vxReleaseImage(&output);
+}
+
+TEST_F(GraphTest, PointwiseChainFusesBitExact)
+{
+    vx_image in0 = createPattern(4);
+    vx_image in1 = createPattern(5);
+    vx_image in2 = createPattern(6);
+    vx_graph reference = vxCreateGraph(context);
+    vx_image fusedOut = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image referenceOut = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_float32 scale = 1.0f / 3.0f;
+    vx_int32 shiftUp = 2, shiftDown = 1;
+    vx_scalar sUp = vxCreateScalar(context, VX_TYPE_INT32, &shiftUp);
+    vx_scalar sDown = vxCreateScalar(context, VX_TYPE_INT32, &shiftDown);
+    vx_scalar sScale = vxCreateScalar(context, VX_TYPE_FLOAT32, &scale);
+    vx_threshold thresh = vxCreateThresholdForImage(context, VX_THRESHOLD_TYPE_BINARY,
+                                                    VX_DF_IMAGE_U8, VX_DF_IMAGE_U8);
+    vx_pixel_value_t value = {};
+    value.U8 = 100;
+    ASSERT_EQ(vxCopyThresholdValue(thresh, &value, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    vx_lut lut = vxCreateLUT(context, VX_TYPE_UINT8, 256);
+    std::vector<vx_uint8> table(256);
+    for (vx_uint32 i = 0; i < table.size(); i++)
+    {
+        table[i] = (vx_uint8)(255 - i / 2);
+    }
+    ASSERT_EQ(vxCopyLUT(lut, table.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+
+    /* ConvertDepth -> Multiply -> Add -> ConvertDepth -> TableLookup -> Threshold, through
+     * virtual images in one graph and real images in the other */
+    auto build = [&](vx_graph g, vx_bool isVirtual, vx_image out) {
+        std::vector<vx_image> t;
+        vx_df_image formats[] = {VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16,
+                                 VX_DF_IMAGE_U8, VX_DF_IMAGE_U8};
+        for (vx_df_image format : formats)
+        {
+            t.push_back(isVirtual ? vxCreateVirtualImage(g, width, height, format)
+                                  : vxCreateImage(context, width, height, format));
+        }
+        vxConvertDepthNode(g, in0, t[0], VX_CONVERT_POLICY_WRAP, sUp);
+        vxMultiplyNode(g, t[0], in1, sScale, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO,
+                       t[1]);
+        vxAddNode(g, t[1], in2, VX_CONVERT_POLICY_WRAP, t[2]);
+        vxConvertDepthNode(g, t[2], t[3], VX_CONVERT_POLICY_SATURATE, sDown);
+        vxTableLookupNode(g, t[3], lut, t[4]);
+        vxThresholdNode(g, t[4], thresh, out);
+        for (vx_image &image : t)
+        {
+            vxReleaseImage(&image);
+        }
+    };
+    build(graph, vx_true_e, fusedOut);
+    build(reference, vx_false_e, referenceOut);
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(reference), VX_SUCCESS);
+    ASSERT_EQ(graph->fusedChains.size(), 1u);
+    EXPECT_EQ(graph->fusedChains[0].size(), 6u);
+    EXPECT_TRUE(reference->fusedChains.empty());
+
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(readImage(fusedOut), readImage(referenceOut));
+
+    /* parameters are read at execution time */
+    scale = 0.75f;
+    ASSERT_EQ(vxCopyScalar(sScale, &scale, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(readImage(fusedOut), readImage(referenceOut));
+
+    /* a partial valid region runs the chain node by node */
+    vx_rectangle_t rect = {3, 2, width - 5, height - 1};
+    ASSERT_EQ(vxSetImageValidRectangle(in0, &rect), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(readImage(fusedOut), readImage(referenceOut));
+
+    vxReleaseLUT(&lut);
+    vxReleaseThreshold(&thresh);
+    vxReleaseScalar(&sUp);
+    vxReleaseScalar(&sDown);
+    vxReleaseScalar(&sScale);
+    vxReleaseImage(&fusedOut);
+    vxReleaseImage(&referenceOut);
+    vxReleaseImage(&in0);
+    vxReleaseImage(&in1);
+    vxReleaseImage(&in2);
+    vxReleaseGraph(&reference);
+}
+
+TEST_F(GraphTest, StencilChainFusesInBands)
+{
+    /* large enough for the chain to run in many bands */
+    const vx_uint32 w = 640, h = 480;
+    vx_rectangle_t rect = {0, 0, w, h};
+    vx_imagepatch_addressing_t addr = {};
+    addr.dim_x = w;
+    addr.dim_y = h;
+    addr.stride_x = 1;
+    addr.stride_y = (vx_int32)w;
+    std::vector<vx_uint8> data(w * h);
+    for (vx_uint32 i = 0; i < data.size(); i++)
+    {
+        data[i] = (vx_uint8)((i * 31u) ^ (i >> 5) ^ (i / w * 13u));
+    }
+    auto read = [&](vx_image image) {
+        std::vector<vx_uint8> out(w * h);
+        EXPECT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, out.data(), VX_READ_ONLY,
+                                   VX_MEMORY_TYPE_HOST),
+                  VX_SUCCESS);
+        return out;
+    };
+    vx_image input = vxCreateImage(context, w, h, VX_DF_IMAGE_U8);
+    ASSERT_EQ(vxCopyImagePatch(input, &rect, 0, &addr, data.data(), VX_WRITE_ONLY,
+                               VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    vx_int32 shift = 2;
+    vx_scalar sShift = vxCreateScalar(context, VX_TYPE_INT32, &shift);
+    vx_threshold thresh = vxCreateThresholdForImage(context, VX_THRESHOLD_TYPE_BINARY,
+                                                    VX_DF_IMAGE_U8, VX_DF_IMAGE_U8);
+    vx_pixel_value_t value = {};
+    value.U8 = 40;
+    ASSERT_EQ(vxCopyThresholdValue(thresh, &value, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+
+    vx_border_t replicate = {};
+    replicate.mode = VX_BORDER_REPLICATE;
+    vx_border_t constant = {};
+    constant.mode = VX_BORDER_CONSTANT;
+    constant.constant_value.U8 = 200;
+
+    /* Gaussian -> Sobel -> Magnitude -> ConvertDepth -> Threshold, and
+     * Box -> Median -> Dilate with a constant border */
+    auto build = [&](vx_graph g, vx_bool isVirtual, vx_image edges, vx_image morph) {
+        auto image = [&](vx_df_image format) {
+            return isVirtual ? vxCreateVirtualImage(g, w, h, format)
+                             : vxCreateImage(context, w, h, format);
+        };
+        std::vector<vx_image> t = {image(VX_DF_IMAGE_U8),  image(VX_DF_IMAGE_S16),
+                                   image(VX_DF_IMAGE_S16), image(VX_DF_IMAGE_S16),
+                                   image(VX_DF_IMAGE_U8),  image(VX_DF_IMAGE_U8),
+                                   image(VX_DF_IMAGE_U8)};
+        std::vector<vx_node> nodes = {
+            vxGaussian3x3Node(g, input, t[0]),
+            vxSobel3x3Node(g, t[0], t[1], t[2]),
+            vxMagnitudeNode(g, t[1], t[2], t[3]),
+            vxConvertDepthNode(g, t[3], t[4], VX_CONVERT_POLICY_SATURATE, sShift),
+            vxThresholdNode(g, t[4], thresh, edges),
+            vxBox3x3Node(g, input, t[5]),
+            vxMedian3x3Node(g, t[5], t[6]),
+            vxDilate3x3Node(g, t[6], morph)};
+        for (vx_uint32 i = 0; i < nodes.size(); i++)
+        {
+            vx_border_t *border = i < 5 ? &replicate : &constant;
+            EXPECT_EQ(vxSetNodeAttribute(nodes[i], VX_NODE_BORDER, border, sizeof(*border)),
+                      VX_SUCCESS);
+            vxReleaseNode(&nodes[i]);
+        }
+        for (vx_image &i : t)
+        {
+            vxReleaseImage(&i);
+        }
+    };
+    vx_graph reference = vxCreateGraph(context);
+    vx_image edges = vxCreateImage(context, w, h, VX_DF_IMAGE_U8);
+    vx_image morph = vxCreateImage(context, w, h, VX_DF_IMAGE_U8);
+    vx_image referenceEdges = vxCreateImage(context, w, h, VX_DF_IMAGE_U8);
+    vx_image referenceMorph = vxCreateImage(context, w, h, VX_DF_IMAGE_U8);
+    build(graph, vx_true_e, edges, morph);
+    build(reference, vx_false_e, referenceEdges, referenceMorph);
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(reference), VX_SUCCESS);
+    ASSERT_EQ(graph->fusedChains.size(), 2u);
+    EXPECT_EQ(graph->fusedChains[0].size() + graph->fusedChains[1].size(), 8u);
+
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(read(edges), read(referenceEdges));
+    EXPECT_EQ(read(morph), read(referenceMorph));
+
+    /* the five intermediates of the edge chain and two of the other never hit memory */
+    vx_size saved = 0;
+    ASSERT_EQ(vxQueryGraph(graph, VX_GRAPH_FUSED_BYTES_SAVED, &saved, sizeof(saved)), VX_SUCCESS);
+    EXPECT_EQ(saved, 2u * (3u * w * h + 3u * 2u * w * h + w * h));
+
+    vxReleaseThreshold(&thresh);
+    vxReleaseScalar(&sShift);
+    vxReleaseImage(&edges);
+    vxReleaseImage(&morph);
+    vxReleaseImage(&referenceEdges);
+    vxReleaseImage(&referenceMorph);
+    vxReleaseImage(&input);
+    vxReleaseGraph(&reference);
+}
+
+TEST_F(GraphTest, EdgeChainFusesOnDefaultTargets)
+{
+    vx_image input = createPattern(9);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image referenceOutput = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_threshold thresh = vxCreateThresholdForImage(context, VX_THRESHOLD_TYPE_BINARY,
+                                                    VX_DF_IMAGE_S16, VX_DF_IMAGE_U8);
+    vx_pixel_value_t value = {};
+    value.S16 = 90;
+    ASSERT_EQ(vxCopyThresholdValue(thresh, &value, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    vx_border_t replicate = {};
+    replicate.mode = VX_BORDER_REPLICATE;
+
+    /* Gaussian -> Sobel -> Magnitude -> Threshold, left on the targets the context picks */
+    auto build = [&](vx_graph g, vx_bool isVirtual, vx_image out) {
+        auto image = [&](vx_df_image format) {
+            return isVirtual ? vxCreateVirtualImage(g, width, height, format)
+                             : vxCreateImage(context, width, height, format);
+        };
+        std::vector<vx_image> t = {image(VX_DF_IMAGE_U8), image(VX_DF_IMAGE_S16),
+                                   image(VX_DF_IMAGE_S16), image(VX_DF_IMAGE_S16)};
+        std::vector<vx_node> nodes = {vxGaussian3x3Node(g, input, t[0]),
+                                      vxSobel3x3Node(g, t[0], t[1], t[2]),
+                                      vxMagnitudeNode(g, t[1], t[2], t[3]),
+                                      vxThresholdNode(g, t[3], thresh, out)};
+        for (vx_uint32 i = 0; i < nodes.size(); i++)
+        {
+            if (i < 2)
+            {
+                EXPECT_EQ(vxSetNodeAttribute(nodes[i], VX_NODE_BORDER, &replicate, sizeof(replicate)),
+                          VX_SUCCESS);
+            }
+            vxReleaseNode(&nodes[i]);
+        }
+        for (vx_image &i : t)
+        {
+            vxReleaseImage(&i);
+        }
+    };
+    vx_graph reference = vxCreateGraph(context);
+    build(graph, vx_true_e, output);
+    build(reference, vx_false_e, referenceOutput);
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(reference), VX_SUCCESS);
+    ASSERT_EQ(graph->fusedChains.size(), 1u);
+    EXPECT_EQ(graph->fusedChains[0].size(), 4u);
+
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(readImage(output), readImage(referenceOutput));
+    vx_size saved = 0;
+    ASSERT_EQ(vxQueryGraph(graph, VX_GRAPH_FUSED_BYTES_SAVED, &saved, sizeof(saved)), VX_SUCCESS);
+    EXPECT_GT(saved, 0u);
+
+    vxReleaseThreshold(&thresh);
+    vxReleaseImage(&output);
+    vxReleaseImage(&referenceOutput);
+    vxReleaseImage(&input);
+    vxReleaseGraph(&reference);
+}
+
+TEST_F(GraphTest, ChainFusesOnTargetsMatchingTheCModel)
+{
+    vx_image input = createPattern(7);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image mid = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_node first = vxNotNode(graph, input, mid);
+    vx_node second = vxAndNode(graph, mid, input, output);
+
+    /* with the default targets the nodes go to the preferred one, which need not be the
+     * C model, and fuse as long as it computes the same pixels */
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(graph->fusedChains.size(), 1u);
+    EXPECT_EQ(graph->fusedChains[0].size(), 2u);
+    EXPECT_TRUE(context->targets[first->affinity]->bit_exact);
+    EXPECT_TRUE(context->targets[second->affinity]->bit_exact);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    std::vector<vx_uint8> fused = readImage(output);
+
+    /* a tiling kernel which declares that it reads no neighborhood joins the chain as well */
+    if (vxSetNodeTarget(first, VX_TARGET_STRING, "khronos.tiling") == VX_SUCCESS)
+    {
+        ASSERT_FALSE(context->targets[first->affinity]->bit_exact);
+        ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+        ASSERT_EQ(graph->fusedChains.size(), 1u);
+        EXPECT_EQ(graph->fusedChains[0].size(), 2u);
+        ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+        EXPECT_EQ(readImage(output), fused);
+
+        /* one which declares a neighborhood does not */
+        vx_neighborhood_size_t nbhd = {-1, 1, -1, 1};
+        first->attributes.nhbdinfo = nbhd;
+        ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+        EXPECT_TRUE(graph->fusedChains.empty());
+        ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+        EXPECT_EQ(readImage(output), fused);
+    }
+
+    vxReleaseNode(&first);
+    vxReleaseNode(&second);
+    vxReleaseImage(&mid);
+    vxReleaseImage(&output);
+    vxReleaseImage(&input);
+}
+
+TEST_F(GraphTest, ChildGraphNodesRunInParent)
+{
+    vx_image input = createPattern(8);
+    vx_graph reference = vxCreateGraph(context);
+    vx_image half = vxCreateImage(context, width / 2, height / 2, VX_DF_IMAGE_U8);
+    vx_image referenceHalf = vxCreateImage(context, width / 2, height / 2, VX_DF_IMAGE_U8);
+    vx_image blurred = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image inverted = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+
+    /* HalfScaleGaussian(3) is a child graph of Gaussian3x3 -> ScaleImage(NEAREST) */
+    vx_node composite = vxHalfScaleGaussianNode(graph, input, half, 3);
+    vxNotNode(graph, input, inverted);
+    vxGaussian3x3Node(reference, input, blurred);
+    vxScaleImageNode(reference, blurred, referenceHalf, VX_INTERPOLATION_NEAREST_NEIGHBOR);
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(reference), VX_SUCCESS);
+    ASSERT_EQ(graph->inlinedGraphs.size(), 1u);
+    vx_graph child = composite->child;
+    EXPECT_TRUE(child->inlined);
+    EXPECT_EQ(graph->numNodes, 2u + child->numNodes);
+    EXPECT_EQ(graph->getNumNodes(), 2u);
+    for (vx_uint32 n = 0; n < child->numNodes; n++)
+    {
+        EXPECT_EQ(child->nodes[n]->graph, graph);
+        EXPECT_EQ(child->nodes[n]->inlined_into, composite);
+    }
+
+    auto readHalf = [&](vx_image image) {
+        std::vector<vx_uint8> data((width / 2) * (height / 2));
+        vx_rectangle_t rect = {0, 0, width / 2, height / 2};
+        vx_imagepatch_addressing_t addr = {};
+        addr.dim_x = width / 2;
+        addr.dim_y = height / 2;
+        addr.stride_x = 1;
+        addr.stride_y = (vx_int32)(width / 2);
+        EXPECT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, data.data(), VX_READ_ONLY,
+                                   VX_MEMORY_TYPE_HOST),
+                  VX_SUCCESS);
+        return data;
+    };
+
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(readHalf(half), readHalf(referenceHalf));
+    EXPECT_TRUE(composite->executed);
+    EXPECT_EQ(composite->status, VX_SUCCESS);
+    for (vx_uint32 n = 0; n < child->numNodes; n++)
+    {
+        EXPECT_TRUE(child->nodes[n]->executed);
+    }
+
+    /* re-verification restores the child graph and splices it in again */
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(graph->inlinedGraphs.size(), 1u);
+    EXPECT_EQ(graph->numNodes, 2u + composite->child->numNodes);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(readHalf(half), readHalf(referenceHalf));
+
+    vxReleaseImage(&input);
+    vxReleaseImage(&half);
+    vxReleaseImage(&referenceHalf);
+    vxReleaseImage(&blurred);
+    vxReleaseImage(&inverted);
+    vxReleaseGraph(&reference);
+}
+
+TEST_F(GraphTest, VirtualImagesShareSlabsWhenLifetimesAllow)
+{
+    vx_image input = createPattern(9);
+    vx_graph reference = vxCreateGraph(context);
+    vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image referenceOutput = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_border_t border = {};
+    border.mode = VX_BORDER_REPLICATE;
+
+    /* Box -> {Gaussian, Median} -> AbsDiff -> Erode -> Dilate, v2 and v3 are alive together
+     * while v1 is dead once both of its readers ran */
+    auto build = [&](vx_graph g, vx_bool isVirtual, vx_image out, std::vector<vx_image> &t) {
+        for (vx_uint32 i = 0; i < 5; i++)
+        {
+            t.push_back(isVirtual ? vxCreateVirtualImage(g, width, height, VX_DF_IMAGE_U8)
+                                  : vxCreateImage(context, width, height, VX_DF_IMAGE_U8));
+        }
+        vx_node nodes[] = {
+            vxBox3x3Node(g, input, t[0]),
+            vxGaussian3x3Node(g, t[0], t[1]),
+            vxMedian3x3Node(g, t[0], t[2]),
+            vxAbsDiffNode(g, t[1], t[2], t[3]),
+            vxErode3x3Node(g, t[3], t[4]),
+            vxDilate3x3Node(g, t[4], out),
+        };
+        for (vx_node &node : nodes)
+        {
+            EXPECT_EQ(vxSetNodeAttribute(node, VX_NODE_BORDER, &border, sizeof(border)), VX_SUCCESS);
+            vxReleaseNode(&node);
+        }
+    };
+    std::vector<vx_image> planned, unplanned;
+    build(graph, vx_true_e, output, planned);
+    build(reference, vx_false_e, referenceOutput, unplanned);
+
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(graph->plannedRefs.size(), 5u);
+    EXPECT_EQ(graph->memorySlabs.size(), 3u);
+    EXPECT_EQ(graph->virtualBytes, 5 * graph->slabBytes / 3);
+    EXPECT_TRUE(reference->plannedRefs.empty());
+    EXPECT_EQ(planned[0]->memory.ptrs[0], planned[3]->memory.ptrs[0]);
+    EXPECT_TRUE(planned[4]->memory.ptrs[0] == planned[1]->memory.ptrs[0] ||
+                planned[4]->memory.ptrs[0] == planned[2]->memory.ptrs[0]);
+    EXPECT_NE(planned[1]->memory.ptrs[0], planned[2]->memory.ptrs[0]);
+
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(reference), VX_SUCCESS);
+    EXPECT_EQ(readImage(output), readImage(referenceOutput));
+
+    /* re-verification drops the plan and builds the same one */
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(graph->memorySlabs.size(), 3u);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(readImage(output), readImage(referenceOutput));
+
+    for (vx_image &image : planned)
+    {
+        vxReleaseImage(&image);
+    }
+    for (vx_image &image : unplanned)
+    {
+        vxReleaseImage(&image);
+    }
+    vxReleaseImage(&input);
+    vxReleaseImage(&output);
+    vxReleaseImage(&referenceOutput);
+    vxReleaseGraph(&reference);
+}
@@ -9,6 +9,10 @@
  */
 #include <gtest/gtest.h>
 #include <VX/vx.h>
+#include <VX/vx_lib_debug.h>
+
+#include <thread>
+#include <vector>
 
 #include "vx_internal.h"
 
@@ -208,4 +212,224 @@ TEST_F(ImageTest, Destruct)
 {
     image->destruct();
     EXPECT_EQ(image->memory.allocated, vx_false_e);
-}
\ No newline at end of file
+}
+TEST_F(ImageTest, MapPatchInPlace)
+{
+    vx_rectangle_t rect = {4, 2, 20, 10};
+    vx_imagepatch_addressing_t addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_map_id map_id = 0;
+    void *ptr = nullptr;
+
+    ASSERT_EQ(image->allocateImage(), vx_true_e);
+    ASSERT_EQ(vxMapImagePatch(image, &rect, 0, &map_id, &addr, &ptr, VX_WRITE_ONLY,
+                              VX_MEMORY_TYPE_HOST, VX_NOGAP_X),
+              VX_SUCCESS);
+    /* the patch is the plane itself, with the plane's row pitch */
+    EXPECT_EQ(addr.stride_y, image->memory.strides[0][VX_DIM_Y]);
+    EXPECT_EQ(ptr, Memory::formatMemoryPtr(&image->memory, 0, rect.start_x, rect.start_y, 0));
+    vx_uint8 *pixel = (vx_uint8 *)vxFormatImagePatchAddress2d(ptr, 3, 5, &addr);
+    pixel[0] = 11;
+    pixel[1] = 22;
+    pixel[2] = 33;
+    EXPECT_EQ(vxUnmapImagePatch(image, map_id), VX_SUCCESS);
+
+    vx_uint8 rgb[3] = {};
+    vx_rectangle_t one = {7, 7, 8, 8};
+    vx_imagepatch_addressing_t one_addr = VX_IMAGEPATCH_ADDR_INIT;
+    one_addr.dim_x = 1;
+    one_addr.dim_y = 1;
+    one_addr.stride_x = 3;
+    one_addr.stride_y = 3;
+    ASSERT_EQ(vxCopyImagePatch(image, &one, 0, &one_addr, rgb, VX_READ_ONLY, VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    EXPECT_EQ(rgb[0], 11);
+    EXPECT_EQ(rgb[1], 22);
+    EXPECT_EQ(rgb[2], 33);
+    vxReleaseImage(&image);
+}
+
+TEST_F(ImageTest, MapPatchSplittingBytesCopies)
+{
+    vx_image bits = vxCreateImage(context, 64, 8, VX_DF_IMAGE_U1);
+    vx_rectangle_t rect = {3, 0, 13, 8};
+    vx_imagepatch_addressing_t addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_map_id map_id = 0;
+    void *ptr = nullptr;
+
+    ASSERT_EQ(vxMapImagePatch(bits, &rect, 0, &map_id, &addr, &ptr, VX_READ_AND_WRITE,
+                              VX_MEMORY_TYPE_HOST, VX_NOGAP_X),
+              VX_SUCCESS);
+    /* a U1 patch which does not start on a byte is written back bit by bit from a copy */
+    vx_uint8 *base = bits->memory.ptrs[0];
+    EXPECT_TRUE((vx_uint8 *)ptr < base ||
+                (vx_uint8 *)ptr >= base + Memory::computeMemorySize(&bits->memory, 0));
+    EXPECT_EQ(vxUnmapImagePatch(bits, map_id), VX_SUCCESS);
+
+    rect.start_x = 8;
+    rect.end_x = 24;
+    ASSERT_EQ(vxMapImagePatch(bits, &rect, 0, &map_id, &addr, &ptr, VX_READ_AND_WRITE,
+                              VX_MEMORY_TYPE_HOST, VX_NOGAP_X),
+              VX_SUCCESS);
+    EXPECT_EQ((vx_uint8 *)ptr, base + 1);
+    EXPECT_EQ(vxUnmapImagePatch(bits, map_id), VX_SUCCESS);
+
+    vxReleaseImage(&bits);
+    vxReleaseImage(&image);
+}
+
+TEST_F(ImageTest, ShareImageCopiesOnWrite)
+{
+    vx_image copy = vxCreateImage(context, width, height, format);
+    vx_image other = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_pixel_value_t value = {};
+    value.RGB[0] = 1;
+    value.RGB[1] = 2;
+    value.RGB[2] = 3;
+    ASSERT_EQ(vxSetImagePixelValues(image, &value), VX_SUCCESS);
+
+    EXPECT_EQ(Image::shareImage(image, other), vx_false_e);
+    ASSERT_EQ(Image::shareImage(image, copy), vx_true_e);
+    EXPECT_EQ(copy->memory.ptrs[0], image->memory.ptrs[0]);
+    EXPECT_EQ(copy->memory.share, image->memory.share);
+
+    /* the writer moves off the shared planes and the reader keeps the old pixels */
+    vx_rectangle_t rect = {0, 0, 1, 1};
+    vx_imagepatch_addressing_t addr = VX_IMAGEPATCH_ADDR_INIT;
+    vx_map_id map_id = 0;
+    void *ptr = nullptr;
+    ASSERT_EQ(vxMapImagePatch(copy, &rect, 0, &map_id, &addr, &ptr, VX_READ_AND_WRITE,
+                              VX_MEMORY_TYPE_HOST, VX_NOGAP_X),
+              VX_SUCCESS);
+    EXPECT_NE(copy->memory.ptrs[0], image->memory.ptrs[0]);
+    EXPECT_EQ(copy->memory.share, nullptr);
+    EXPECT_EQ(((vx_uint8 *)ptr)[2], 3);
+    ((vx_uint8 *)ptr)[0] = 99;
+    EXPECT_EQ(vxUnmapImagePatch(copy, map_id), VX_SUCCESS);
+    EXPECT_EQ(image->memory.ptrs[0][0], 1);
+
+    /* the last holder frees the planes, whichever goes first */
+    ASSERT_EQ(Image::shareImage(copy, image), vx_true_e);
+    EXPECT_EQ(image->memory.ptrs[0][0], 99);
+    vxReleaseImage(&copy);
+    EXPECT_EQ(image->memory.ptrs[0][0], 99);
+    EXPECT_EQ(image->unshareImage(vx_true_e), vx_true_e);
+    EXPECT_EQ(image->memory.share, nullptr);
+
+    vxReleaseImage(&other);
+    vxReleaseImage(&image);
+}
+
+TEST_F(ImageTest, ShareImageKeepsCopySemantics)
+{
+    vx_image copy = vxCreateImage(context, width, height, format);
+    vx_pixel_value_t value = {};
+    value.RGB[0] = 7;
+    ASSERT_EQ(vxSetImagePixelValues(image, &value), VX_SUCCESS);
+
+    /* a copy leaves the pixels outside of the valid region alone, sharing would not */
+    vx_rectangle_t rect = {1, 1, width - 1, height - 1};
+    ASSERT_EQ(vxSetImageValidRectangle(image, &rect), VX_SUCCESS);
+    EXPECT_EQ(Image::shareImage(image, copy), vx_false_e);
+    ASSERT_EQ(vxSetImageValidRectangle(image, nullptr), VX_SUCCESS);
+
+    /* threads sharing and writing the same planes leave one count per holder */
+    const vx_uint32 numCopies = 8;
+    std::vector<vx_image> copies(numCopies);
+    std::vector<std::thread> workers;
+    for (vx_uint32 i = 0; i < numCopies; i++)
+    {
+        copies[i] = vxCreateImage(context, width, height, format);
+    }
+    for (vx_uint32 i = 0; i < numCopies; i++)
+    {
+        workers.emplace_back([&, i]() {
+            for (vx_uint32 n = 0; n < 100; n++)
+            {
+                EXPECT_EQ(Image::shareImage(image, copies[i]), vx_true_e);
+                if (n % 2 == 1)
+                {
+                    EXPECT_EQ(copies[i]->unshareImage(vx_true_e), vx_true_e);
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+    ASSERT_NE(image->memory.share, nullptr);
+    EXPECT_EQ(image->memory.share->count, 1u);
+    for (vx_image &c : copies)
+    {
+        EXPECT_EQ(c->memory.share, nullptr);
+        EXPECT_EQ(c->memory.ptrs[0][0], 7);
+        vxReleaseImage(&c);
+    }
+    EXPECT_EQ(image->unshareImage(vx_true_e), vx_true_e);
+    EXPECT_EQ(image->memory.share, nullptr);
+
+    vxReleaseImage(&copy);
+}
+
+TEST_F(ImageTest, CopyNodeSharesPlanes)
+{
+    vx_image input = vxCreateImage(context, 64, 32, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, 64, 32, VX_DF_IMAGE_U8);
+    vx_pixel_value_t value = {};
+    value.U8 = 42;
+    ASSERT_EQ(vxSetImagePixelValues(input, &value), VX_SUCCESS);
+
+    vx_graph graph = vxCreateGraph(context);
+    vx_node node = vxCopyNode(graph, (vx_reference)input, (vx_reference)output);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(output->memory.ptrs[0], input->memory.ptrs[0]);
+
+    /* refilling the input leaves the output with the previous frame */
+    value.U8 = 7;
+    ASSERT_EQ(vxSetImagePixelValues(input, &value), VX_SUCCESS);
+    EXPECT_NE(output->memory.ptrs[0], input->memory.ptrs[0]);
+    EXPECT_EQ(output->memory.ptrs[0][0], 42);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+    EXPECT_EQ(output->memory.ptrs[0][0], 7);
+
+    vxReleaseNode(&node);
+    vxReleaseGraph(&graph);
+    vxReleaseImage(&output);
+    vxReleaseImage(&input);
+    vxReleaseImage(&image);
+}
+
+TEST_F(ImageTest, DebugCopyImageSharesPlanes)
+{
+    if (vxLoadKernels(context, "openvx-debug") != VX_SUCCESS)
+    {
+        GTEST_SKIP() << "the debug target is not available";
+    }
+    vx_image copy = vxCreateImage(context, width, height, format);
+    vx_pixel_value_t value = {};
+    value.RGB[0] = 4;
+    value.RGB[1] = 5;
+    value.RGB[2] = 6;
+    ASSERT_EQ(vxSetImagePixelValues(image, &value), VX_SUCCESS);
+
+    vx_graph graph = vxCreateGraph(context);
+    vx_kernel kernel = vxGetKernelByEnum(context, VX_KERNEL_DEBUG_COPY_IMAGE);
+    ASSERT_EQ(vxGetStatus((vx_reference)kernel), VX_SUCCESS);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    ASSERT_EQ(vxSetParameterByIndex(node, 0, (vx_reference)image), VX_SUCCESS);
+    ASSERT_EQ(vxSetParameterByIndex(node, 1, (vx_reference)copy), VX_SUCCESS);
+    ASSERT_EQ(vxVerifyGraph(graph), VX_SUCCESS);
+    ASSERT_EQ(vxProcessGraph(graph), VX_SUCCESS);
+
+    /* the copy holds the input planes until one of them is written */
+    EXPECT_EQ(copy->memory.ptrs[0], image->memory.ptrs[0]);
+    EXPECT_NE(copy->memory.share, nullptr);
+    EXPECT_EQ(copy->memory.ptrs[0][2], 6);
+
+    vxReleaseNode(&node);
+    vxReleaseKernel(&kernel);
+    vxReleaseGraph(&graph);
+    vxReleaseImage(&copy);
+    vxReleaseImage(&image);
+}
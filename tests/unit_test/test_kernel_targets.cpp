@@ -0,0 +1,697 @@
+/**
+ * @file test_kernel_targets.cpp
+ * @brief Compare the Optimized Targets against the C Model
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2025 Edge.AI
+ *
+ */
+#include <gtest/gtest.h>
+#include <VX/vx.h>
+#include <VX/vx_compatibility.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+/*! \brief What a target is expected to match the C model on.
+ */
+struct TargetCoverage
+{
+    const char *target;
+    /*! \brief The tiling kernels only implement the undefined border for neighborhoods and the constant one for warps */
+    bool allBorders;
+    /*! \brief The tiling kernels leave out the formats beyond the core ones for depth conversion and convolution */
+    bool allFormats;
+    /*! \brief The largest difference allowed for phase, the tiling one is a polynomial within the spec's one code */
+    vx_int32 phaseTolerance;
+};
+
+struct KernelOutputs
+{
+    std::vector<vx_image> images;
+    std::vector<vx_distribution> distributions;
+};
+
+typedef std::function<vx_node(vx_graph, KernelOutputs &)> build_f;
+
+class KernelTargetTest : public ::testing::Test
+{
+protected:
+    vx_context context = nullptr;
+    vx_uint32 width = 0;
+    vx_uint32 height = 0;
+    vx_uint32 compared = 0;
+    std::vector<vx_reference> held;
+
+    void TearDown() override
+    {
+        if (context)
+        {
+            vxReleaseContext(&context);
+        }
+    }
+
+    /*! \brief Creates the context with VX_CPU_VARIANT forced, false if the host lacks the variant.
+     */
+    bool createContext(const char *variant, vx_enum expected)
+    {
+        if (variant)
+        {
+            EXPECT_EQ(setenv("VX_CPU_VARIANT", variant, 1), 0);
+        }
+        context = vxCreateContext();
+        unsetenv("VX_CPU_VARIANT");
+        EXPECT_EQ(vxGetStatus((vx_reference)context), VX_SUCCESS);
+        vx_enum actual = VX_CPU_VARIANT_SCALAR;
+        EXPECT_EQ(vxQueryContext(context, VX_CONTEXT_CPU_VARIANT, &actual, sizeof(actual)), VX_SUCCESS);
+        return variant == nullptr || actual == expected;
+    }
+
+    vx_reference hold(vx_reference ref)
+    {
+        held.push_back(ref);
+        return ref;
+    }
+
+    /*! \brief An image of pseudo random bytes, the same for the same seed.
+     */
+    vx_image image(vx_df_image format, int seed, vx_uint32 w = 0u, vx_uint32 h = 0u)
+    {
+        vx_image im = vxCreateImage(context, w ? w : width, h ? h : height, format);
+        vx_size planes = 0;
+        vxQueryImage(im, VX_IMAGE_PLANES, &planes, sizeof(planes));
+        vx_rectangle_t rect = {0u, 0u, w ? w : width, h ? h : height};
+        for (vx_uint32 p = 0u; p < (vx_uint32)planes; p++)
+        {
+            vx_map_id id;
+            vx_imagepatch_addressing_t addr;
+            void *base = nullptr;
+            vxMapImagePatch(im, &rect, p, &id, &addr, &base, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, 0);
+            vx_uint32 rows = (addr.dim_y + addr.step_y - 1u) / addr.step_y;
+            vx_uint32 bytes = format == VX_DF_IMAGE_U1 ? (addr.dim_x + 7u) / 8u
+                                                       : (addr.dim_x + addr.step_x - 1u) / addr.step_x * addr.stride_x;
+            vx_uint32 s = (vx_uint32)seed * 977u + p * 131u;
+            for (vx_uint32 y = 0u; y < rows; y++)
+            {
+                vx_uint8 *row = (vx_uint8 *)base + y * addr.stride_y;
+                for (vx_uint32 b = 0u; b < bytes; b++)
+                {
+                    s = s * 1103515245u + 12345u;
+                    row[b] = (vx_uint8)((s >> 16) ^ (b + y));
+                }
+            }
+            vxUnmapImagePatch(im, id);
+        }
+        return (vx_image)hold((vx_reference)im);
+    }
+
+    vx_scalar scalar(vx_enum type, const void *value)
+    {
+        return (vx_scalar)hold((vx_reference)vxCreateScalar(context, type, value));
+    }
+
+    /*! \brief The pixels of a rectangle, U1 unpacked to one byte per pixel.
+     */
+    static std::vector<vx_uint8> readRect(vx_image im, vx_rectangle_t rect)
+    {
+        std::vector<vx_uint8> out;
+        vx_size planes = 0;
+        vx_df_image format = 0;
+        vxQueryImage(im, VX_IMAGE_PLANES, &planes, sizeof(planes));
+        vxQueryImage(im, VX_IMAGE_FORMAT, &format, sizeof(format));
+        if (rect.end_x <= rect.start_x || rect.end_y <= rect.start_y)
+        {
+            return out;
+        }
+        for (vx_uint32 p = 0u; p < (vx_uint32)planes; p++)
+        {
+            vx_map_id id;
+            vx_imagepatch_addressing_t addr;
+            void *base = nullptr;
+            vxMapImagePatch(im, &rect, p, &id, &addr, &base, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0);
+            vx_uint32 rows = (addr.dim_y + addr.step_y - 1u) / addr.step_y;
+            for (vx_uint32 y = 0u; y < rows; y++)
+            {
+                vx_uint8 *row = (vx_uint8 *)base + y * addr.stride_y;
+                if (format == VX_DF_IMAGE_U1)
+                {
+                    vx_uint32 shift = rect.start_x % 8u;
+                    for (vx_uint32 x = 0u; x < addr.dim_x; x++)
+                    {
+                        out.push_back((row[(x + shift) / 8u] >> ((x + shift) % 8u)) & 1u);
+                    }
+                }
+                else
+                {
+                    vx_uint32 bytes = (addr.dim_x + addr.step_x - 1u) / addr.step_x * addr.stride_x;
+                    out.insert(out.end(), row, row + bytes);
+                }
+            }
+            vxUnmapImagePatch(im, id);
+        }
+        return out;
+    }
+
+    /*! \brief Runs one node on the C model and on the target and expects the same outputs within the
+     * valid region of the C model. Kernels the target does not implement are skipped, a null target
+     * leaves the node on the targets the context picks.
+     */
+    void compare(const std::string &name, const char *target, build_f build,
+                 vx_border_t border = {VX_BORDER_UNDEFINED, {{0}}}, vx_int32 tolerance = 0)
+    {
+        const char *targets[2] = {"khronos.any", target};
+        std::vector<std::vector<vx_uint8>> results[2];
+        std::vector<vx_rectangle_t> valid;
+        vx_status status[2] = {VX_SUCCESS, VX_SUCCESS};
+        for (int t = 0; t < 2; t++)
+        {
+            vx_graph graph = vxCreateGraph(context);
+            KernelOutputs outputs;
+            vx_node node = build(graph, outputs);
+            EXPECT_EQ(vxGetStatus((vx_reference)node), VX_SUCCESS) << name;
+            bool implemented = targets[t] == nullptr ||
+                               vxSetNodeTarget(node, VX_TARGET_STRING, targets[t]) == VX_SUCCESS;
+            vxSetNodeAttribute(node, VX_NODE_BORDER, &border, sizeof(border));
+            if (implemented)
+            {
+                status[t] = vxVerifyGraph(graph);
+                if (status[t] == VX_SUCCESS)
+                {
+                    status[t] = vxProcessGraph(graph);
+                }
+                for (size_t i = 0u; i < outputs.images.size(); i++)
+                {
+                    if (t == 0)
+                    {
+                        vx_rectangle_t rect;
+                        vxGetValidRegionImage(outputs.images[i], &rect);
+                        valid.push_back(rect);
+                    }
+                    results[t].push_back(readRect(outputs.images[i], valid[i]));
+                }
+                for (vx_distribution dist : outputs.distributions)
+                {
+                    vx_size bins = 0u;
+                    vxQueryDistribution(dist, VX_DISTRIBUTION_BINS, &bins, sizeof(bins));
+                    std::vector<vx_uint8> data(bins * sizeof(vx_int32));
+                    vxCopyDistribution(dist, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+                    results[t].push_back(data);
+                }
+            }
+            for (vx_image im : outputs.images)
+            {
+                vxReleaseImage(&im);
+            }
+            for (vx_distribution dist : outputs.distributions)
+            {
+                vxReleaseDistribution(&dist);
+            }
+            for (vx_reference ref : held)
+            {
+                vxReleaseReference(&ref);
+            }
+            held.clear();
+            vxReleaseNode(&node);
+            vxReleaseGraph(&graph);
+            if (!implemented)
+            {
+                ASSERT_EQ(t, 1) << name << " has no C model kernel";
+                return;
+            }
+        }
+
+        compared++;
+        std::string where = name + " at " + std::to_string(width) + "x" + std::to_string(height);
+        ASSERT_EQ(status[0], VX_SUCCESS) << where;
+        ASSERT_EQ(status[1], VX_SUCCESS) << where;
+        ASSERT_EQ(results[0].size(), results[1].size()) << where;
+        for (size_t o = 0u; o < results[0].size(); o++)
+        {
+            ASSERT_EQ(results[0][o].size(), results[1][o].size()) << where;
+            size_t diffs = 0u, first = 0u;
+            for (size_t i = 0u; i < results[0][o].size(); i++)
+            {
+                /* the phase codes wrap around, 255 is one away from 0 */
+                vx_int32 d = std::abs((vx_int32)results[0][o][i] - (vx_int32)results[1][o][i]);
+                if (tolerance && d > 128)
+                {
+                    d = 256 - d;
+                }
+                if (d > tolerance && diffs++ == 0u)
+                {
+                    first = i;
+                }
+            }
+            EXPECT_EQ(diffs, 0u) << where << ", output " << o << " differs first at byte " << first << ": "
+                                 << (vx_uint32)results[0][o][first] << " on the C model, "
+                                 << (vx_uint32)results[1][o][first] << " on "
+                                 << (target ? target : "the default targets");
+        }
+    }
+
+    /*! \brief Every kernel with an optimized implementation, over the formats, policies and borders
+     * the target covers.
+     */
+    void compareKernels(const TargetCoverage &cov)
+    {
+        const vx_df_image U1 = VX_DF_IMAGE_U1, U8 = VX_DF_IMAGE_U8, S16 = VX_DF_IMAGE_S16, U16 = VX_DF_IMAGE_U16;
+        const vx_df_image S32 = VX_DF_IMAGE_S32, U32 = VX_DF_IMAGE_U32;
+        const char *t = cov.target;
+        bool even = width % 2u == 0u && height % 2u == 0u;
+
+        vx_border_t undefined = {VX_BORDER_UNDEFINED, {{0}}};
+        vx_border_t replicate = {VX_BORDER_REPLICATE, {{0}}};
+        vx_border_t constant = {VX_BORDER_CONSTANT, {{0}}};
+        constant.constant_value.U8 = 77u;
+        vx_border_t constant1 = constant;
+        constant1.constant_value.U1 = vx_true_e;
+        std::vector<vx_border_t> borders = {undefined};
+        if (cov.allBorders)
+        {
+            borders = {undefined, replicate, constant, constant1};
+        }
+        std::vector<vx_border_t> warpBorders = cov.allBorders ? borders : std::vector<vx_border_t>{constant};
+
+        const std::string fmt[] = {"U1", "U8", "S16", "U16", "S32", "U32"};
+        auto fs = [&](vx_df_image f) {
+            return f == U1 ? fmt[0] : f == U8 ? fmt[1] : f == S16 ? fmt[2] : f == U16 ? fmt[3] : f == S32 ? fmt[4]
+                 : f == U32 ? fmt[5] : std::string((const char *)&f, 4);
+        };
+
+        /* element-wise */
+        for (vx_df_image f : {U8, S16, U16})
+        {
+            compare("absdiff " + fs(f), t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, f)};
+                return vxAbsDiffNode(g, image(f, 1), image(f, 2), o.images[0]);
+            });
+        }
+        const vx_df_image arith[][3] = {{U8, U8, U8}, {U8, U8, S16}, {U8, S16, S16}, {S16, U8, S16}, {S16, S16, S16}};
+        for (auto &f : arith)
+        {
+            for (vx_enum policy : {VX_CONVERT_POLICY_WRAP, VX_CONVERT_POLICY_SATURATE})
+            {
+                std::string types = fs(f[0]) + "," + fs(f[1]) + "->" + fs(f[2]) + " policy " + std::to_string(policy & 0xf);
+                compare("add " + types, t, [&](vx_graph g, KernelOutputs &o) {
+                    o.images = {vxCreateImage(context, width, height, f[2])};
+                    return vxAddNode(g, image(f[0], 1), image(f[1], 2), policy, o.images[0]);
+                });
+                compare("subtract " + types, t, [&](vx_graph g, KernelOutputs &o) {
+                    o.images = {vxCreateImage(context, width, height, f[2])};
+                    return vxSubtractNode(g, image(f[0], 1), image(f[1], 2), policy, o.images[0]);
+                });
+                for (vx_float32 scale : {1.0f, 1.0f / 255.0f, 0.37f})
+                {
+                    for (vx_enum rounding : {VX_ROUND_POLICY_TO_ZERO, VX_ROUND_POLICY_TO_NEAREST_EVEN})
+                    {
+                        compare("multiply " + types + " scale " + std::to_string(scale) + " rounding " +
+                                std::to_string(rounding & 0xf), t, [&](vx_graph g, KernelOutputs &o) {
+                            o.images = {vxCreateImage(context, width, height, f[2])};
+                            return vxMultiplyNode(g, image(f[0], 1), image(f[1], 2), scalar(VX_TYPE_FLOAT32, &scale),
+                                                  policy, rounding, o.images[0]);
+                        });
+                    }
+                }
+            }
+        }
+        for (vx_df_image f : {U8, U1})
+        {
+            for (int op = 0; op < 4; op++)
+            {
+                compare("bitwise " + std::to_string(op) + " " + fs(f), t, [&](vx_graph g, KernelOutputs &o) {
+                    o.images = {vxCreateImage(context, width, height, f)};
+                    vx_image a = image(f, 1), b = image(f, 2);
+                    return op == 0 ? vxAndNode(g, a, b, o.images[0]) : op == 1 ? vxOrNode(g, a, b, o.images[0])
+                         : op == 2 ? vxXorNode(g, a, b, o.images[0]) : vxNotNode(g, a, o.images[0]);
+                });
+            }
+        }
+        for (vx_df_image f : {U8, S16})
+        {
+            compare("min " + fs(f), t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, f)};
+                return vxMinNode(g, image(f, 1), image(f, 2), o.images[0]);
+            });
+            compare("max " + fs(f), t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, f)};
+                return vxMaxNode(g, image(f, 1), image(f, 2), o.images[0]);
+            });
+        }
+        for (vx_float32 alpha : {0.0f, 0.3f, 1.0f})
+        {
+            compare("weighted average " + std::to_string(alpha), t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, U8)};
+                return vxWeightedAverageNode(g, image(U8, 1), scalar(VX_TYPE_FLOAT32, &alpha), image(U8, 2), o.images[0]);
+            });
+        }
+        for (vx_df_image in : {U8, S16})
+        {
+            for (vx_df_image out : {U8, U1})
+            {
+                if (in == S16 && out == U1)
+                {
+                    continue;
+                }
+                for (vx_enum type : {VX_THRESHOLD_TYPE_BINARY, VX_THRESHOLD_TYPE_RANGE})
+                {
+                    compare("threshold " + fs(in) + "->" + fs(out) + " " + std::to_string(type & 0xf), t,
+                            [&](vx_graph g, KernelOutputs &o) {
+                        o.images = {vxCreateImage(context, width, height, out)};
+                        vx_threshold th = vxCreateThresholdForImage(context, type, in, out);
+                        hold((vx_reference)th);
+                        vx_pixel_value_t lo, hi, tv, fv;
+                        memset(&lo, 0, sizeof(lo));
+                        memset(&hi, 0, sizeof(hi));
+                        memset(&tv, 0, sizeof(tv));
+                        memset(&fv, 0, sizeof(fv));
+                        if (in == U8) { lo.U8 = 60u; hi.U8 = 200u; } else { lo.S16 = -1000; hi.S16 = 9000; }
+                        if (out == U8) { tv.U8 = 250u; fv.U8 = 3u; } else { tv.U1 = vx_true_e; fv.U1 = vx_false_e; }
+                        if (type == VX_THRESHOLD_TYPE_BINARY)
+                            vxCopyThresholdValue(th, &lo, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                        else
+                            vxCopyThresholdRange(th, &lo, &hi, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                        vxCopyThresholdOutput(th, &tv, &fv, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                        return vxThresholdNode(g, image(in, 1), th, o.images[0]);
+                    });
+                }
+            }
+        }
+        std::vector<std::pair<vx_df_image, vx_df_image>> depths = {{U8, S16}, {S16, U8}, {U8, U1}, {U1, U8}};
+        if (cov.allFormats)
+        {
+            depths.insert(depths.end(), {{U8, U16}, {U8, U32}, {U16, U8}, {S16, S32}, {S32, S16}, {U32, U8}});
+        }
+        for (auto &f : depths)
+        {
+            for (vx_enum policy : {VX_CONVERT_POLICY_WRAP, VX_CONVERT_POLICY_SATURATE})
+            {
+                for (vx_int32 shift : {0, 5})
+                {
+                    compare("convert depth " + fs(f.first) + "->" + fs(f.second) + " policy " +
+                            std::to_string(policy & 0xf) + " shift " + std::to_string(shift), t,
+                            [&](vx_graph g, KernelOutputs &o) {
+                        o.images = {vxCreateImage(context, width, height, f.second)};
+                        return vxConvertDepthNode(g, image(f.first, 1), o.images[0], policy, scalar(VX_TYPE_INT32, &shift));
+                    });
+                }
+            }
+        }
+        compare("magnitude", t, [&](vx_graph g, KernelOutputs &o) {
+            o.images = {vxCreateImage(context, width, height, S16)};
+            return vxMagnitudeNode(g, image(S16, 1), image(S16, 2), o.images[0]);
+        });
+        compare("phase", t, [&](vx_graph g, KernelOutputs &o) {
+            o.images = {vxCreateImage(context, width, height, U8)};
+            return vxPhaseNode(g, image(S16, 1), image(S16, 2), o.images[0]);
+        }, undefined, cov.phaseTolerance);
+        for (vx_df_image f : {U8, S16})
+        {
+            compare("table lookup " + fs(f), t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, f)};
+                vx_lut lut = vxCreateLUT(context, f == U8 ? VX_TYPE_UINT8 : VX_TYPE_INT16, f == U8 ? 256u : 65536u);
+                hold((vx_reference)lut);
+                std::vector<vx_uint8> table(f == U8 ? 256u : 131072u);
+                for (size_t i = 0u; i < table.size(); i++)
+                {
+                    table[i] = (vx_uint8)(i * 7u + 3u);
+                }
+                vxCopyLUT(lut, table.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                return vxTableLookupNode(g, image(f, 1), lut, o.images[0]);
+            });
+        }
+        compare("integral image", t, [&](vx_graph g, KernelOutputs &o) {
+            o.images = {vxCreateImage(context, width, height, U32)};
+            return vxIntegralImageNode(g, image(U8, 1), o.images[0]);
+        });
+        for (vx_size bins : {(vx_size)256, (vx_size)7})
+        {
+            compare("histogram " + std::to_string(bins), t, [&](vx_graph g, KernelOutputs &o) {
+                o.distributions = {vxCreateDistribution(context, bins, 10, 246u)};
+                return vxHistogramNode(g, image(U8, 1), o.distributions[0]);
+            });
+        }
+
+        /* neighborhoods */
+        for (const vx_border_t &b : borders)
+        {
+            std::string border = " border " + std::to_string(b.mode & 0xf);
+            for (vx_df_image f : {U8, U1})
+            {
+                for (int k = 0; k < 5; k++)
+                {
+                    if (f == U1 && (k == 1 || k == 2))
+                    {
+                        continue;
+                    }
+                    compare("filter " + std::to_string(k) + " " + fs(f) + border, t, [&](vx_graph g, KernelOutputs &o) {
+                        o.images = {vxCreateImage(context, width, height, f)};
+                        vx_image in = image(f, 1);
+                        return k == 0 ? vxMedian3x3Node(g, in, o.images[0]) : k == 1 ? vxBox3x3Node(g, in, o.images[0])
+                             : k == 2 ? vxGaussian3x3Node(g, in, o.images[0]) : k == 3 ? vxErode3x3Node(g, in, o.images[0])
+                             : vxDilate3x3Node(g, in, o.images[0]);
+                    }, b);
+                }
+            }
+            compare("sobel 3x3" + border, t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, S16), vxCreateImage(context, width, height, S16)};
+                return vxSobel3x3Node(g, image(U8, 1), o.images[0], o.images[1]);
+            }, b);
+            const vx_size dims[][2] = {{3, 3}, {7, 3}, {15, 15}};
+            for (auto &d : dims)
+            {
+                if (d[0] > width || d[1] > height)
+                {
+                    continue;
+                }
+                for (vx_df_image out : {U8, S16})
+                {
+                    for (vx_uint32 scale : {1u, 1024u})
+                    {
+                        for (vx_df_image in : {U8, S16})
+                        {
+                            if (in == S16 && !cov.allFormats)
+                            {
+                                continue;
+                            }
+                            compare("convolve " + std::to_string(d[0]) + "x" + std::to_string(d[1]) + " " + fs(in) + "->" +
+                                    fs(out) + " scale " + std::to_string(scale) + border, t,
+                                    [&](vx_graph g, KernelOutputs &o) {
+                                o.images = {vxCreateImage(context, width, height, out)};
+                                vx_convolution conv = vxCreateConvolution(context, d[0], d[1]);
+                                hold((vx_reference)conv);
+                                std::vector<vx_int16> coeffs(d[0] * d[1]);
+                                vx_uint32 s = 7u;
+                                for (vx_int16 &c : coeffs)
+                                {
+                                    s = s * 1103515245u + 12345u;
+                                    c = (vx_int16)((vx_int32)((s >> 16) % 41u) - 20);
+                                }
+                                vxCopyConvolutionCoefficients(conv, coeffs.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                                vxSetConvolutionAttribute(conv, VX_CONVOLUTION_SCALE, &scale, sizeof(scale));
+                                return vxConvolveNode(g, image(in, 1), conv, o.images[0]);
+                            }, b);
+                        }
+                    }
+                }
+            }
+        }
+
+        /* channels and color */
+        std::vector<vx_df_image> formats = {VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX};
+        if (even)
+        {
+            formats.insert(formats.end(), {VX_DF_IMAGE_NV12, VX_DF_IMAGE_NV21, VX_DF_IMAGE_IYUV, VX_DF_IMAGE_YUV4,
+                                           VX_DF_IMAGE_YUYV, VX_DF_IMAGE_UYVY});
+        }
+        else
+        {
+            formats.push_back(VX_DF_IMAGE_YUV4);
+        }
+        for (vx_df_image f : formats)
+        {
+            bool rgb = f == VX_DF_IMAGE_RGB || f == VX_DF_IMAGE_RGBX;
+            std::vector<vx_enum> channels = rgb ? std::vector<vx_enum>{VX_CHANNEL_R, VX_CHANNEL_G, VX_CHANNEL_B}
+                                                : std::vector<vx_enum>{VX_CHANNEL_Y, VX_CHANNEL_U, VX_CHANNEL_V};
+            if (f == VX_DF_IMAGE_RGBX)
+            {
+                channels.push_back(VX_CHANNEL_A);
+            }
+            bool half_x = f == VX_DF_IMAGE_NV12 || f == VX_DF_IMAGE_NV21 || f == VX_DF_IMAGE_IYUV ||
+                          f == VX_DF_IMAGE_YUYV || f == VX_DF_IMAGE_UYVY;
+            bool half_y = f == VX_DF_IMAGE_NV12 || f == VX_DF_IMAGE_NV21 || f == VX_DF_IMAGE_IYUV;
+            for (vx_enum ch : channels)
+            {
+                bool sub = !rgb && ch != VX_CHANNEL_Y;
+                compare("channel extract " + fs(f) + " " + std::to_string(ch & 0xf), t, [&](vx_graph g, KernelOutputs &o) {
+                    o.images = {vxCreateImage(context, sub && half_x ? width / 2u : width, sub && half_y ? height / 2u : height, U8)};
+                    return vxChannelExtractNode(g, image(f, 1), ch, o.images[0]);
+                });
+            }
+            compare("channel combine " + fs(f), t, [&](vx_graph g, KernelOutputs &o) {
+                o.images = {vxCreateImage(context, width, height, f)};
+                vx_uint32 w = half_x ? width / 2u : width, h = half_y ? height / 2u : height;
+                return vxChannelCombineNode(g, image(U8, 1), image(U8, 2, w, h), image(U8, 3, w, h),
+                                            f == VX_DF_IMAGE_RGBX ? image(U8, 4) : nullptr, o.images[0]);
+            });
+        }
+        /* the C model converts colors of even sizes only */
+        std::vector<vx_df_image> sources, destinations;
+        if (even)
+        {
+            sources = {VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_NV12, VX_DF_IMAGE_NV21, VX_DF_IMAGE_IYUV,
+                       VX_DF_IMAGE_YUYV, VX_DF_IMAGE_UYVY};
+            destinations = {VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_YUV4, VX_DF_IMAGE_NV12, VX_DF_IMAGE_IYUV};
+        }
+        for (vx_df_image in : sources)
+        {
+            for (vx_df_image out : destinations)
+            {
+                for (vx_enum space : {VX_COLOR_SPACE_BT709, VX_COLOR_SPACE_BT601_525})
+                {
+                    if (in == out)
+                    {
+                        continue;
+                    }
+                    compare("color convert " + fs(in) + "->" + fs(out) + " space " + std::to_string(space & 0xf), t,
+                            [&](vx_graph g, KernelOutputs &o) {
+                        o.images = {vxCreateImage(context, width, height, out)};
+                        vx_image src = image(in, 1);
+                        vxSetImageAttribute(src, VX_IMAGE_SPACE, &space, sizeof(space));
+                        return vxColorConvertNode(g, src, o.images[0]);
+                    });
+                }
+            }
+        }
+
+        /* geometry */
+        const vx_uint32 sizes[][2] = {{width / 2u + 1u, height / 2u + 1u}, {width * 2u - 3u, height * 2u + 1u}, {width / 3u + 1u, height * 3u / 2u}};
+        for (const vx_border_t &b : borders)
+        {
+            for (vx_df_image f : {U8, U1, S16})
+            {
+                for (vx_enum type : {VX_INTERPOLATION_NEAREST_NEIGHBOR, VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_AREA})
+                {
+                    if (f == S16 && type != VX_INTERPOLATION_NEAREST_NEIGHBOR)
+                    {
+                        continue;
+                    }
+                    for (auto &sz : sizes)
+                    {
+                        compare("scale " + fs(f) + " " + std::to_string(type & 0xf) + " to " + std::to_string(sz[0]) + "x" +
+                                std::to_string(sz[1]) + " border " + std::to_string(b.mode & 0xf), t,
+                                [&](vx_graph g, KernelOutputs &o) {
+                            o.images = {vxCreateImage(context, sz[0], sz[1], f)};
+                            return vxScaleImageNode(g, image(f, 1), o.images[0], type);
+                        }, b);
+                    }
+                }
+            }
+        }
+        const vx_float32 affine[][6] = {{1, 0, 0, 1, 0, 0}, {0.9f, 0.2f, -0.15f, 1.1f, 3.5f, -2.25f}, {1.7f, -0.3f, 0.4f, 0.6f, -20.f, 5.f}};
+        const vx_float32 perspective[][9] = {{1, 0, 0, 0, 1, 0, 0, 0, 1}, {0.9f, 0.05f, 0.0004f, 0.1f, 1.1f, 0.0007f, 2.5f, -3.f, 1.f}};
+        for (const vx_border_t &b : warpBorders)
+        {
+            for (vx_df_image f : {U8, U1})
+            {
+                for (vx_enum type : {VX_INTERPOLATION_NEAREST_NEIGHBOR, VX_INTERPOLATION_BILINEAR})
+                {
+                    std::string suffix = " " + fs(f) + " " + std::to_string(type & 0xf) + " border " + std::to_string(b.mode & 0xf);
+                    for (size_t m = 0u; m < dimof(affine); m++)
+                    {
+                        compare("warp affine " + std::to_string(m) + suffix, t, [&](vx_graph g, KernelOutputs &o) {
+                            o.images = {vxCreateImage(context, width + 5u, height - 2u, f)};
+                            vx_matrix matrix = vxCreateMatrix(context, VX_TYPE_FLOAT32, 2, 3);
+                            hold((vx_reference)matrix);
+                            vxCopyMatrix(matrix, (void *)affine[m], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                            return vxWarpAffineNode(g, image(f, 1), matrix, type, o.images[0]);
+                        }, b);
+                    }
+                    for (size_t m = 0u; f == U8 && m < dimof(perspective); m++)
+                    {
+                        compare("warp perspective " + std::to_string(m) + suffix, t, [&](vx_graph g, KernelOutputs &o) {
+                            o.images = {vxCreateImage(context, width + 5u, height - 2u, f)};
+                            vx_matrix matrix = vxCreateMatrix(context, VX_TYPE_FLOAT32, 3, 3);
+                            hold((vx_reference)matrix);
+                            vxCopyMatrix(matrix, (void *)perspective[m], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+                            return vxWarpPerspectiveNode(g, image(f, 1), matrix, type, o.images[0]);
+                        }, b);
+                    }
+                }
+            }
+        }
+    }
+
+    /*! \brief Compares at a size of whole tiles, an odd one with partial tiles on both edges and one
+     * smaller than a tile.
+     */
+    void compareAllSizes(const TargetCoverage &cov)
+    {
+        const vx_uint32 dims[][2] = {{202u, 60u}, {203u, 61u}, {9u, 3u}};
+        for (auto &d : dims)
+        {
+            width = d[0];
+            height = d[1];
+            compareKernels(cov);
+        }
+        EXPECT_GT(compared, 0u);
+    }
+};
+
+#if defined(__x86_64__) || defined(__aarch64__)
+TEST_F(KernelTargetTest, TilingMatchesCModel)
+{
+    ASSERT_TRUE(createContext(nullptr, VX_CPU_VARIANT_SCALAR));
+    compareAllSizes({"khronos.tiling", false, false, 1});
+}
+#endif
+
+/* the targets picked by priority give the C model's pixels for every border, a target which
+ * leaves a border out hands the node to the next one */
+TEST_F(KernelTargetTest, DefaultTargetsMatchCModel)
+{
+    ASSERT_TRUE(createContext(nullptr, VX_CPU_VARIANT_SCALAR));
+    compareAllSizes({nullptr, true, false, 1});
+}
+
+#if defined(__x86_64__)
+TEST_F(KernelTargetTest, X86SimdScalarMatchesCModel)
+{
+    ASSERT_TRUE(createContext("scalar", VX_CPU_VARIANT_SCALAR));
+    compareAllSizes({"khronos.x86simd", true, true, 0});
+}
+
+TEST_F(KernelTargetTest, X86SimdSse42MatchesCModel)
+{
+    if (!createContext("sse4.2", VX_CPU_VARIANT_SSE42))
+    {
+        GTEST_SKIP() << "the host has no SSE4.2";
+    }
+    compareAllSizes({"khronos.x86simd", true, true, 0});
+}
+
+TEST_F(KernelTargetTest, X86SimdAvx2MatchesCModel)
+{
+    if (!createContext("avx2", VX_CPU_VARIANT_AVX2))
+    {
+        GTEST_SKIP() << "the host has no AVX2";
+    }
+    compareAllSizes({"khronos.x86simd", true, true, 0});
+}
+
+TEST_F(KernelTargetTest, X86SimdAvx512MatchesCModel)
+{
+    if (!createContext("avx512", VX_CPU_VARIANT_AVX512))
+    {
+        GTEST_SKIP() << "the host has no AVX-512";
+    }
+    compareAllSizes({"khronos.x86simd", true, true, 0});
+}
+#endif
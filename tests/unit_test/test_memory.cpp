@@ -0,0 +1,220 @@
+/**
+ * @file test_memory.cpp
+ * @brief Test Internal Memory Pool and Descriptor Import
+ * @version 0.1
+ * @date 2025-01-05
+ *
+ * @copyright Copyright (c) 2025 Edge.AI
+ *
+ */
+#include <gtest/gtest.h>
+#include <VX/vx.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+class MemoryPoolTest : public ::testing::Test
+{
+protected:
+    vx_context context;
+
+    void SetUp() override
+    {
+        context = vxCreateContext();
+        ASSERT_EQ(vxGetStatus((vx_reference)context), VX_SUCCESS);
+    }
+
+    void TearDown() override
+    {
+        vxReleaseContext(&context);
+    }
+};
+
+TEST_F(MemoryPoolTest, BlocksAreAlignedAndCleared)
+{
+    MemoryPool &pool = context->memory_pool;
+    EXPECT_EQ(pool.alignment(), (vx_size)VX_INT_MEMORY_ALIGNMENT);
+
+    for (vx_size size : {1u, 63u, 100u, 4097u, 1u << 20})
+    {
+        vx_uint8 *block = (vx_uint8 *)pool.allocate(size);
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ((uintptr_t)block % pool.alignment(), 0u);
+        for (vx_size i = 0; i < size; i++)
+        {
+            ASSERT_EQ(block[i], 0u);
+        }
+        /* dirty it, the next user of the block still gets it cleared */
+        memset(block, 0xA5, size);
+        pool.release(block);
+        block = (vx_uint8 *)pool.allocate(size);
+        EXPECT_EQ(block[0], 0u);
+        EXPECT_EQ(block[size - 1], 0u);
+        pool.release(block);
+    }
+}
+
+TEST_F(MemoryPoolTest, ReleasedBlocksAreReusedBySizeClass)
+{
+    MemoryPool &pool = context->memory_pool;
+    pool.trim();
+    vx_size reused = pool.reusedBlocks();
+
+    void *block = pool.allocate(1000);
+    pool.release(block);
+    EXPECT_EQ(pool.cachedBytes(), 1024u);
+
+    /* 990 bytes falls into the same class as 1000, 1500 does not */
+    EXPECT_EQ(pool.allocate(990), block);
+    EXPECT_EQ(pool.reusedBlocks(), reused + 1);
+    EXPECT_EQ(pool.cachedBytes(), 0u);
+    void *other = pool.allocate(1500);
+    EXPECT_NE(other, block);
+    pool.release(other);
+    pool.release(block);
+
+    pool.trim();
+    EXPECT_EQ(pool.cachedBytes(), 0u);
+}
+
+TEST_F(MemoryPoolTest, ObjectMemoryComesFromThePool)
+{
+    vx_image first = vxCreateImage(context, 320, 240, VX_DF_IMAGE_U8);
+    ASSERT_EQ(first->allocateImage(), vx_true_e);
+    vx_uint8 *ptr = first->memory.ptrs[0];
+    EXPECT_EQ((uintptr_t)ptr % context->memory_pool.alignment(), 0u);
+    vxReleaseImage(&first);
+
+    /* an image of the same size picks the freed plane back up */
+    vx_image second = vxCreateImage(context, 320, 240, VX_DF_IMAGE_U8);
+    ASSERT_EQ(second->allocateImage(), vx_true_e);
+    EXPECT_EQ(second->memory.ptrs[0], ptr);
+    vxReleaseImage(&second);
+}
+
+#if defined(__linux__)
+class FdImportTest : public MemoryPoolTest
+{
+protected:
+    /* a memfd holding size bytes, byte i set to i * seed */
+    int createFd(vx_size size, vx_uint8 seed)
+    {
+        int fd = memfd_create("coreflow-test", 0);
+        EXPECT_GE(fd, 0);
+        std::vector<vx_uint8> data(size);
+        for (vx_size i = 0; i < size; i++)
+        {
+            data[i] = (vx_uint8)(i * seed);
+        }
+        EXPECT_EQ(pwrite(fd, data.data(), size, 0), (ssize_t)size);
+        return fd;
+    }
+};
+
+TEST_F(FdImportTest, ImagePlanesMapTheDescriptor)
+{
+    const vx_uint32 width = 64, height = 32;
+    const vx_size offset = 100;
+    int fd = createFd(offset + width * height, 3);
+
+    vx_imagepatch_addressing_t addr = VX_IMAGEPATCH_ADDR_INIT;
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    vx_int32 fds[] = {fd};
+    vx_size offsets[] = {offset};
+    vx_image image = vxCreateImageFromFd(context, VX_DF_IMAGE_U8, &addr, fds, offsets, VX_READ_AND_WRITE);
+    ASSERT_EQ(vxGetStatus((vx_reference)image), VX_SUCCESS);
+    /* the image keeps its mapping after the descriptor is closed */
+    close(fd);
+
+    std::vector<vx_uint8> out(width * height);
+    vx_rectangle_t rect = {0, 0, width, height};
+    ASSERT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, out.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    for (vx_size i = 0; i < out.size(); i++)
+    {
+        ASSERT_EQ(out[i], (vx_uint8)((offset + i) * 3));
+    }
+
+    /* writes through the image land in the shared memory */
+    int other = createFd(width * height, 5);
+    vx_int32 other_fds[] = {other};
+    ASSERT_EQ(vxSwapImageFd(image, other_fds, nullptr, 1, VX_READ_AND_WRITE), VX_SUCCESS);
+    ASSERT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, out.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    EXPECT_EQ(out[7], (vx_uint8)(7 * 5));
+    std::fill(out.begin(), out.end(), 0xAB);
+    ASSERT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, out.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    vx_uint8 byte = 0;
+    ASSERT_EQ(pread(other, &byte, 1, width * height - 1), 1);
+    EXPECT_EQ(byte, 0xAB);
+
+    vxReleaseImage(&image);
+    close(other);
+}
+
+TEST_F(FdImportTest, TensorStorageMapsTheDescriptor)
+{
+    vx_size dims[] = {4, 8};
+    vx_size strides[] = {2, 8};
+    int fd = createFd(4096 + 64, 1);
+
+    vx_tensor tensor = vxCreateTensorFromFd(context, 2, dims, VX_TYPE_INT16, 8, strides, fd, 4096, VX_READ_ONLY);
+    ASSERT_EQ(vxGetStatus((vx_reference)tensor), VX_SUCCESS);
+    close(fd);
+
+    vx_size start[] = {0, 0};
+    std::vector<vx_int16> out(4 * 8);
+    ASSERT_EQ(vxCopyTensorPatch(tensor, 2, start, dims, strides, out.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    vx_uint8 *bytes = (vx_uint8 *)out.data();
+    for (vx_size i = 0; i < 64; i++)
+    {
+        ASSERT_EQ(bytes[i], (vx_uint8)(4096 + i));
+    }
+
+    /* a released tensor leaves the imported storage to its owner */
+    vxReleaseTensor(&tensor);
+}
+
+TEST_F(FdImportTest, ReadOnlyDescriptorImportsForReading)
+{
+    const vx_uint32 width = 16, height = 8;
+    int fd = createFd(width * height, 7);
+    /* reopen the memfd without write access, as a consumer process would receive it */
+    int ro = open(("/proc/self/fd/" + std::to_string(fd)).c_str(), O_RDONLY);
+    ASSERT_GE(ro, 0);
+
+    vx_imagepatch_addressing_t addr = VX_IMAGEPATCH_ADDR_INIT;
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    vx_int32 fds[] = {ro};
+    vx_image writable = vxCreateImageFromFd(context, VX_DF_IMAGE_U8, &addr, fds, nullptr, VX_READ_AND_WRITE);
+    EXPECT_NE(vxGetStatus((vx_reference)writable), VX_SUCCESS);
+    vx_image bad = vxCreateImageFromFd(context, VX_DF_IMAGE_U8, &addr, fds, nullptr, VX_TYPE_UINT8);
+    EXPECT_EQ(vxGetStatus((vx_reference)bad), VX_ERROR_INVALID_PARAMETERS);
+
+    vx_image image = vxCreateImageFromFd(context, VX_DF_IMAGE_U8, &addr, fds, nullptr, VX_READ_ONLY);
+    ASSERT_EQ(vxGetStatus((vx_reference)image), VX_SUCCESS);
+    std::vector<vx_uint8> out(width * height);
+    vx_rectangle_t rect = {0, 0, width, height};
+    ASSERT_EQ(vxCopyImagePatch(image, &rect, 0, &addr, out.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST), VX_SUCCESS);
+    EXPECT_EQ(out[9], (vx_uint8)(9 * 7));
+
+    vxReleaseImage(&image);
+    close(ro);
+    close(fd);
+}
+#endif
@@ -10,6 +10,9 @@
 #include <gtest/gtest.h>
 #include <VX/vx.h>
 
+#include <cstdlib>
+#include <cstring>
+
 #include "vx_internal.h"
 
 using namespace coreflow;
@@ -31,4 +34,85 @@ protected:
         delete target;
         vxReleaseContext(&context);
     }
-};
\ No newline at end of file
+};
+#if defined(__x86_64__)
+TEST_F(TargetTest, X86SimdOutranksTiling)
+{
+    vx_bool x86simd = vx_false_e;
+    for (vx_uint32 t = 0u; t < context->num_targets; t++)
+    {
+        if (strcmp(context->targets[t]->name, "khronos.x86simd") == 0)
+        {
+            x86simd = context->targets[t]->enabled;
+        }
+    }
+    ASSERT_EQ(x86simd, vx_true_e);
+
+    vx_graph graph = vxCreateGraph(context);
+    vx_image in0 = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_U8);
+    vx_image in1 = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_U8);
+    vx_image box = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_U8);
+    vx_image sum = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_U8);
+    vx_image gx = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_S16);
+    vx_image gy = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_S16);
+
+    /* both implement box and add, x86simd wins */
+    vx_node boxNode = vxBox3x3Node(graph, in0, box);
+    vx_node addNode = vxAddNode(graph, in0, in1, VX_CONVERT_POLICY_SATURATE, sum);
+    ASSERT_NE(boxNode, nullptr);
+    ASSERT_NE(addNode, nullptr);
+    EXPECT_STREQ(context->targets[boxNode->affinity]->name, "khronos.x86simd");
+    EXPECT_STREQ(context->targets[addNode->affinity]->name, "khronos.x86simd");
+
+    /* the kernels x86simd lacks still go to the next target down */
+    vx_node sobelNode = vxSobel3x3Node(graph, in0, gx, gy);
+    ASSERT_NE(sobelNode, nullptr);
+    EXPECT_STRNE(context->targets[sobelNode->affinity]->name, "khronos.x86simd");
+
+    vxReleaseNode(&boxNode);
+    vxReleaseNode(&addNode);
+    vxReleaseNode(&sobelNode);
+    vxReleaseImage(&in0);
+    vxReleaseImage(&in1);
+    vxReleaseImage(&box);
+    vxReleaseImage(&sum);
+    vxReleaseImage(&gx);
+    vxReleaseImage(&gy);
+    vxReleaseGraph(&graph);
+}
+
+TEST(TargetVariantTest, TilingFollowsTheCpuVariant)
+{
+    /* the tiling kernels are built for SSE4.1, a scalar context leaves them out */
+    ASSERT_EQ(setenv("VX_CPU_VARIANT", "scalar", 1), 0);
+    vx_context context = vxCreateContext();
+    unsetenv("VX_CPU_VARIANT");
+    ASSERT_EQ(vxGetStatus((vx_reference)context), VX_SUCCESS);
+
+    vx_enum variant = VX_CPU_VARIANT_AVX512;
+    ASSERT_EQ(vxQueryContext(context, VX_CONTEXT_CPU_VARIANT, &variant, sizeof(variant)), VX_SUCCESS);
+    EXPECT_EQ(variant, VX_CPU_VARIANT_SCALAR);
+    for (vx_uint32 t = 0u; t < context->num_targets; t++)
+    {
+        if (strcmp(context->targets[t]->name, "khronos.tiling") == 0)
+        {
+            EXPECT_EQ(context->targets[t]->enabled, vx_false_e);
+        }
+    }
+
+    vx_graph graph = vxCreateGraph(context);
+    vx_image in = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_U8);
+    vx_image gx = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_S16);
+    vx_image gy = vxCreateImage(context, 64u, 48u, VX_DF_IMAGE_S16);
+    vx_node node = vxSobel3x3Node(graph, in, gx, gy);
+    ASSERT_NE(node, nullptr);
+    EXPECT_STRNE(context->targets[node->affinity]->name, "khronos.tiling");
+
+    vxReleaseNode(&node);
+    vxReleaseImage(&in);
+    vxReleaseImage(&gx);
+    vxReleaseImage(&gy);
+    vxReleaseGraph(&graph);
+    vxReleaseContext(&context);
+}
+#endif
@@ -0,0 +1,229 @@
+/**
+ * @file test_tensor.cpp
+ * @brief Test Internal Tensor Object
+ * @version 0.1
+ * @date 2025-01-05
+ *
+ * @copyright Copyright (c) 2025 Edge.AI
+ *
+ */
+#include <gtest/gtest.h>
+#include <VX/vx.h>
+
+#include <vector>
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+class TensorTest : public ::testing::Test
+{
+protected:
+    vx_context context;
+    vx_tensor tensor;
+    vx_size dims[3] = {8, 6, 4};
+
+    void SetUp() override
+    {
+        context = vxCreateContext();
+        ASSERT_EQ(vxGetStatus((vx_reference)context), VX_SUCCESS);
+        tensor = vxCreateTensor(context, 3, dims, VX_TYPE_UINT8, 0);
+        ASSERT_EQ(vxGetStatus((vx_reference)tensor), VX_SUCCESS);
+
+        /* fill every element with its own linear index */
+        std::vector<vx_uint8> data(dims[0] * dims[1] * dims[2]);
+        for (vx_size i = 0; i < data.size(); i++)
+            data[i] = (vx_uint8)i;
+        vx_size start[3] = {0, 0, 0};
+        vx_size stride[3] = {1, dims[0], dims[0] * dims[1]};
+        ASSERT_EQ(vxCopyTensorPatch(tensor, 3, start, dims, stride, data.data(), VX_WRITE_ONLY,
+                                    VX_MEMORY_TYPE_HOST),
+                  VX_SUCCESS);
+    }
+
+    void TearDown() override
+    {
+        vxReleaseTensor(&tensor);
+        vxReleaseContext(&context);
+    }
+
+    vx_uint8 at(vx_size x, vx_size y, vx_size z) const
+    {
+        return (vx_uint8)(x + dims[0] * (y + dims[1] * z));
+    }
+};
+
+TEST_F(TensorTest, CopyPatchReadsSubViewIntoPaddedBuffer)
+{
+    vx_size start[3] = {2, 1, 1};
+    vx_size end[3] = {7, 5, 3};
+    /* 5x4x2 patch, rows padded to 8 bytes and planes to 40 */
+    vx_size stride[3] = {1, 8, 40};
+    std::vector<vx_uint8> out(80, 0xFF);
+
+    ASSERT_EQ(vxCopyTensorPatch(tensor, 3, start, end, stride, out.data(), VX_READ_ONLY,
+                                VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    for (vx_size z = 0; z < 2; z++)
+        for (vx_size y = 0; y < 4; y++)
+        {
+            for (vx_size x = 0; x < 5; x++)
+                EXPECT_EQ(out[z * 40 + y * 8 + x], at(x + 2, y + 1, z + 1));
+            for (vx_size x = 5; x < 8; x++)
+                EXPECT_EQ(out[z * 40 + y * 8 + x], 0xFF);
+        }
+}
+
+TEST_F(TensorTest, CopyPatchWritesOnlyTheSubView)
+{
+    vx_size start[3] = {0, 2, 1};
+    vx_size end[3] = {8, 4, 4};
+    vx_size stride[3] = {1, 8, 16};
+    std::vector<vx_uint8> in(48, 0);
+
+    ASSERT_EQ(vxCopyTensorPatch(tensor, 3, start, end, stride, in.data(), VX_WRITE_ONLY,
+                                VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+
+    vx_size all_start[3] = {0, 0, 0};
+    vx_size all_stride[3] = {1, dims[0], dims[0] * dims[1]};
+    std::vector<vx_uint8> out(dims[0] * dims[1] * dims[2]);
+    ASSERT_EQ(vxCopyTensorPatch(tensor, 3, all_start, dims, all_stride, out.data(), VX_READ_ONLY,
+                                VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    for (vx_size z = 0; z < dims[2]; z++)
+        for (vx_size y = 0; y < dims[1]; y++)
+            for (vx_size x = 0; x < dims[0]; x++)
+            {
+                bool inside = z >= 1 && y >= 2 && y < 4;
+                EXPECT_EQ(out[x + dims[0] * (y + dims[1] * z)], inside ? 0 : at(x, y, z));
+            }
+}
+
+TEST_F(TensorTest, CopyStridedTransposesAndFoldsRuns)
+{
+    /* 4x3 transpose: every run is one element */
+    std::vector<vx_uint16> src(12), dst(12, 0);
+    for (vx_size i = 0; i < src.size(); i++)
+        src[i] = (vx_uint16)(i * 3);
+    vx_size extent[2] = {4, 3};
+    vx_size src_stride[2] = {2, 8};
+    vx_size dst_stride[2] = {6, 2};
+    Tensor::copyStrided((vx_uint8 *)dst.data(), dst_stride, (const vx_uint8 *)src.data(),
+                        src_stride, extent, 2, 2);
+    for (vx_size y = 0; y < 3; y++)
+        for (vx_size x = 0; x < 4; x++)
+            EXPECT_EQ(dst[x * 3 + y], src[y * 4 + x]);
+
+    /* packed on both sides with a degenerate middle dimension */
+    std::vector<vx_uint8> a(24), b(24, 0);
+    for (vx_size i = 0; i < a.size(); i++)
+        a[i] = (vx_uint8)(i + 1);
+    vx_size extent3[3] = {6, 1, 4};
+    vx_size stride3[3] = {1, 6, 6};
+    Tensor::copyStrided(b.data(), stride3, a.data(), stride3, extent3, 3, 1);
+    EXPECT_EQ(a, b);
+}
+
+TEST_F(TensorTest, SliceViewMapsInPlace)
+{
+    vx_size start[3] = {1, 2, 1};
+    vx_size end[3] = {5, 6, 3};
+    vx_tensor view = vxCreateTensorFromView(tensor, 3, start, end);
+    ASSERT_EQ(vxGetStatus((vx_reference)view), VX_SUCCESS);
+
+    vx_size view_start[3] = {0, 0, 0};
+    vx_size view_dims[3] = {4, 4, 2};
+    vx_size stride[3] = {0};
+    vx_map_id map_id = 0;
+    void *ptr = nullptr;
+    ASSERT_EQ(vxMapTensorPatch(view, 3, view_start, view_dims, &map_id, stride, &ptr, VX_READ_ONLY,
+                               VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    EXPECT_EQ(ptr, (vx_uint8 *)tensor->addr + at(1, 2, 1));
+    EXPECT_EQ(stride[1], dims[0]);
+    EXPECT_EQ(stride[2], dims[0] * dims[1]);
+    vx_uint8 *base = (vx_uint8 *)ptr;
+    EXPECT_EQ(base[3 * stride[0] + 2 * stride[1] + stride[2]], at(4, 4, 2));
+    EXPECT_EQ(vxUnmapTensorPatch(view, map_id), VX_SUCCESS);
+
+    vx_size bad_end[3] = {5, 6, 5};
+    vx_tensor bad = vxCreateTensorFromView(tensor, 3, start, bad_end);
+    EXPECT_NE(vxGetStatus((vx_reference)bad), VX_SUCCESS);
+
+    vxReleaseTensor(&view);
+}
+
+TEST_F(TensorTest, PermuteViewReordersWithoutCopy)
+{
+    /* [W, H, C] -> [C, W, H], the HWC to CHW case seen from the element order */
+    vx_size order[3] = {2, 0, 1};
+    vx_tensor view = vxCreateTensorFromPermute(tensor, 3, order);
+    ASSERT_EQ(vxGetStatus((vx_reference)view), VX_SUCCESS);
+    EXPECT_EQ(view->addr, tensor->addr);
+    EXPECT_EQ(view->dimensions[0], dims[2]);
+    EXPECT_EQ(view->dimensions[1], dims[0]);
+    EXPECT_EQ(view->dimensions[2], dims[1]);
+    EXPECT_EQ(view->isContiguous(), vx_false_e);
+
+    /* one strided copy packs it */
+    vx_size start[3] = {0, 0, 0};
+    vx_size stride[3] = {1, dims[2], dims[2] * dims[0]};
+    std::vector<vx_uint8> out(dims[0] * dims[1] * dims[2]);
+    ASSERT_EQ(vxCopyTensorPatch(view, 3, start, view->dimensions, stride, out.data(), VX_READ_ONLY,
+                                VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    for (vx_size y = 0; y < dims[1]; y++)
+        for (vx_size x = 0; x < dims[0]; x++)
+            for (vx_size c = 0; c < dims[2]; c++)
+                EXPECT_EQ(out[c + dims[2] * (x + dims[0] * y)], at(x, y, c));
+
+    /* writes land in the parent */
+    vx_uint8 value = 0xAB;
+    vx_size one_start[3] = {3, 2, 1};
+    vx_size one_end[3] = {4, 3, 2};
+    vx_size one_stride[3] = {1, 1, 1};
+    ASSERT_EQ(vxCopyTensorPatch(view, 3, one_start, one_end, one_stride, &value, VX_WRITE_ONLY,
+                                VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    EXPECT_EQ(((vx_uint8 *)tensor->addr)[2 + dims[0] * (1 + dims[1] * 3)], value);
+
+    vx_size repeat[3] = {0, 0, 1};
+    vx_tensor bad = vxCreateTensorFromPermute(tensor, 3, repeat);
+    EXPECT_NE(vxGetStatus((vx_reference)bad), VX_SUCCESS);
+
+    vxReleaseTensor(&view);
+}
+
+TEST_F(TensorTest, ReshapeViewSharesPackedStorage)
+{
+    vx_size shape[2] = {dims[0] * dims[1], dims[2]};
+    vx_tensor view = vxCreateTensorFromReshape(tensor, 2, shape);
+    ASSERT_EQ(vxGetStatus((vx_reference)view), VX_SUCCESS);
+    EXPECT_EQ(view->addr, tensor->addr);
+    EXPECT_EQ(view->isContiguous(), vx_true_e);
+    EXPECT_EQ(view->size(), tensor->size());
+
+    vx_size start[2] = {0, 0};
+    vx_size stride[2] = {0};
+    vx_map_id map_id = 0;
+    void *ptr = nullptr;
+    ASSERT_EQ(vxMapTensorPatch(view, 2, start, shape, &map_id, stride, &ptr, VX_READ_ONLY,
+                               VX_MEMORY_TYPE_HOST),
+              VX_SUCCESS);
+    EXPECT_EQ(((vx_uint8 *)ptr)[5 + shape[0] * 3], at(5, 0, 3));
+    EXPECT_EQ(vxUnmapTensorPatch(view, map_id), VX_SUCCESS);
+
+    vx_size wrong[2] = {dims[0], dims[1]};
+    vx_tensor bad = vxCreateTensorFromReshape(tensor, 2, wrong);
+    EXPECT_NE(vxGetStatus((vx_reference)bad), VX_SUCCESS);
+
+    /* a permuted view has no packed order to reshape */
+    vx_size order[3] = {1, 0, 2};
+    vx_tensor permuted = vxCreateTensorFromPermute(tensor, 3, order);
+    vx_tensor flat = vxCreateTensorFromReshape(permuted, 2, shape);
+    EXPECT_EQ(vxGetStatus((vx_reference)flat), VX_ERROR_NOT_SUPPORTED);
+
+    vxReleaseTensor(&permuted);
+    vxReleaseTensor(&view);
+}
@@ -0,0 +1,285 @@
+/**
+ * @file test_threadpool.cpp
+ * @brief Test Internal Threadpool Scheduling
+ * @version 0.1
+ * @date 2025-08-22
+ *
+ * @copyright Copyright (c) 2025 Edge.AI
+ *
+ */
+#include <gtest/gtest.h>
+#include <VX/vx.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vx_internal.h"
+
+using namespace coreflow;
+
+namespace
+{
+
+/*! \brief A synthetic DAG of layers, every node depends on two nodes of the layer above.
+ * Node costs are slept rather than spun so the comparison measures scheduling, not how
+ * many cores the machine running the test happens to have.
+ */
+struct SkewedDag
+{
+    vx_uint32 width;
+    vx_uint32 layers;
+    std::vector<std::chrono::microseconds> cost;
+    std::vector<std::vector<vx_uint32>> consumers;
+    std::vector<std::atomic<vx_uint32>> pending;
+    std::vector<vx_value_set_t> items;
+    std::atomic<vx_uint32> executed{0u};
+
+    SkewedDag(vx_uint32 w, vx_uint32 l, vx_uint32 heavyEvery)
+        : width(w), layers(l), cost(w * l), consumers(w * l), pending(w * l), items(w * l)
+    {
+        for (vx_uint32 n = 0; n < w * l; n++)
+        {
+            /* one expensive node (think OptPyrLK) among many cheap ones (think Threshold) */
+            cost[n] = std::chrono::microseconds(n % heavyEvery == 0 ? 4000 : 200);
+            items[n].v1 = (vx_value_t)this;
+            items[n].v2 = (vx_value_t)n;
+            if (n >= w)
+            {
+                vx_uint32 layer = n / w, col = n % w;
+                vx_uint32 a = (layer - 1) * w + col;
+                vx_uint32 b = (layer - 1) * w + (col * 5u + 1u) % w;
+                consumers[a].push_back(n);
+                if (b != a) consumers[b].push_back(n);
+            }
+        }
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto &p : pending) p = 0u;
+        for (auto &c : consumers)
+            for (vx_uint32 s : c) pending[s]++;
+        executed = 0u;
+    }
+
+    /* runs the node and returns the consumers it released */
+    std::vector<vx_value_set_t *> run(vx_uint32 n)
+    {
+        std::vector<vx_value_set_t *> ready;
+        std::this_thread::sleep_for(cost[n]);
+        executed++;
+        for (vx_uint32 s : consumers[n])
+        {
+            if (--pending[s] == 0) ready.push_back(&items[s]);
+        }
+        return ready;
+    }
+};
+
+/*! \brief The scheduling the pool used before: every item goes to the next worker in turn,
+ * whether or not it is busy, and a worker only ever drains its own queue.
+ */
+class RoundRobinPool
+{
+public:
+    explicit RoundRobinPool(vx_uint32 numWorkers) : queues(numWorkers)
+    {
+        for (vx_uint32 i = 0; i < numWorkers; i++)
+        {
+            threads.emplace_back([this, i] { loop(i); });
+        }
+    }
+
+    ~RoundRobinPool()
+    {
+        for (auto &q : queues)
+        {
+            std::lock_guard<std::mutex> guard(q.lock);
+            q.stop = true;
+            q.cond.notify_all();
+        }
+        for (auto &t : threads) t.join();
+    }
+
+    void issue(vx_value_set_t *item)
+    {
+        Queue &q = queues[next++ % queues.size()];
+        std::lock_guard<std::mutex> guard(q.lock);
+        q.items.push_back(item);
+        q.cond.notify_one();
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex lock;
+        std::condition_variable cond;
+        std::deque<vx_value_set_t *> items;
+        bool stop = false;
+    };
+
+    void loop(vx_uint32 i)
+    {
+        Queue &q = queues[i];
+        for (;;)
+        {
+            vx_value_set_t *item;
+            {
+                std::unique_lock<std::mutex> guard(q.lock);
+                q.cond.wait(guard, [&] { return q.stop || !q.items.empty(); });
+                if (q.items.empty()) return;
+                item = q.items.front();
+                q.items.pop_front();
+            }
+            SkewedDag *dag = (SkewedDag *)item->v1;
+            for (vx_value_set_t *r : dag->run((vx_uint32)item->v2)) issue(r);
+        }
+    }
+
+    std::vector<Queue> queues;
+    std::vector<std::thread> threads;
+    std::atomic<vx_uint32> next{0u};
+};
+
+vx_bool runDagNode(vx_threadpool_worker_t *worker)
+{
+    SkewedDag *dag = (SkewedDag *)worker->data->v1;
+    std::vector<vx_value_set_t *> ready = dag->run((vx_uint32)worker->data->v2);
+    for (vx_value_set_t *r : ready)
+    {
+        Osal::issueThreadpool(worker->pool, r, 1);
+    }
+    return vx_true_e;
+}
+
+template <typename Issue>
+double timeDag(SkewedDag &dag, Issue issue)
+{
+    auto start = std::chrono::steady_clock::now();
+    dag.reset();
+    for (vx_uint32 n = 0; n < dag.width; n++)
+    {
+        issue(&dag.items[n]);
+    }
+    while (dag.executed.load() < dag.width * dag.layers)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+vx_bool countItem(vx_threadpool_worker_t *worker)
+{
+    std::atomic<vx_uint32> *count = (std::atomic<vx_uint32> *)worker->data->v1;
+    (*count)++;
+    return vx_true_e;
+}
+
+} // namespace
+
+TEST(ThreadpoolTest, DequeOwnerIsLifoThievesAreFifo)
+{
+    vx_deque_t *d = VX_CALLOC(vx_deque_t);
+    vx_value_set_t items[3] = {};
+    Osal::initDeque(d);
+
+    for (auto &item : items)
+    {
+        ASSERT_EQ(Osal::pushDeque(d, &item), vx_true_e);
+    }
+    EXPECT_EQ(Osal::stealDeque(d), &items[0]);
+    EXPECT_EQ(Osal::popDeque(d), &items[2]);
+    EXPECT_EQ(Osal::popDeque(d), &items[1]);
+    EXPECT_EQ(Osal::popDeque(d), nullptr);
+    EXPECT_EQ(Osal::stealDeque(d), nullptr);
+    delete d;
+}
+
+TEST(ThreadpoolTest, ConcurrentStealsTakeEveryItemOnce)
+{
+    const vx_uint32 total = 100000, thieves = 3;
+    vx_deque_t *d = VX_CALLOC(vx_deque_t);
+    std::vector<vx_value_set_t> items(total);
+    std::vector<std::atomic<vx_uint32>> seen(total);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    Osal::initDeque(d);
+
+    auto take = [&](vx_value_set_t *item) {
+        if (item) seen[item - items.data()]++;
+    };
+    for (vx_uint32 t = 0; t < thieves; t++)
+    {
+        threads.emplace_back([&] {
+            while (!done.load()) take(Osal::stealDeque(d));
+        });
+    }
+    for (vx_uint32 i = 0; i < total; i++)
+    {
+        while (Osal::pushDeque(d, &items[i]) == vx_false_e)
+        {
+            take(Osal::popDeque(d));
+        }
+        if (i % 3 == 0) take(Osal::popDeque(d));
+    }
+    for (vx_value_set_t *item; (item = Osal::popDeque(d)) != nullptr;) take(item);
+    done = true;
+    for (auto &t : threads) t.join();
+    for (vx_value_set_t *item; (item = Osal::stealDeque(d)) != nullptr;) take(item);
+
+    for (vx_uint32 i = 0; i < total; i++)
+    {
+        ASSERT_EQ(seen[i].load(), 1u) << "item " << i;
+    }
+    delete d;
+}
+
+TEST(ThreadpoolTest, IssuedItemsAllComplete)
+{
+    const vx_uint32 total = 5000;
+    std::atomic<vx_uint32> count{0u};
+    std::vector<vx_value_set_t> items(total);
+    vx_threadpool_t *pool = Osal::createThreadpool(4, total, sizeof(vx_value_set_t), countItem, nullptr);
+    ASSERT_NE(pool, nullptr);
+
+    for (auto &item : items)
+    {
+        item.v1 = (vx_value_t)&count;
+    }
+    ASSERT_EQ(Osal::issueThreadpool(pool, items.data(), total), vx_true_e);
+    EXPECT_EQ(Osal::completeThreadpool(pool, vx_true_e), vx_true_e);
+    EXPECT_EQ(count.load(), total);
+    Osal::destroyThreadpool(&pool);
+    EXPECT_EQ(pool, nullptr);
+}
+
+TEST(ThreadpoolTest, SkewedDagWorkStealingVsRoundRobin)
+{
+    const vx_uint32 workers = 4;
+    /* the expensive nodes line up with the round-robin issue order */
+    SkewedDag dag(4 * workers, 6, workers);
+    double stealing, roundRobin;
+
+    {
+        RoundRobinPool pool(workers);
+        roundRobin = timeDag(dag, [&](vx_value_set_t *item) { pool.issue(item); });
+    }
+    ASSERT_EQ(dag.executed.load(), dag.width * dag.layers);
+
+    vx_threadpool_t *pool = Osal::createThreadpool(workers, dag.width * dag.layers,
+                                                   sizeof(vx_value_set_t), runDagNode, nullptr);
+    ASSERT_NE(pool, nullptr);
+    stealing = timeDag(dag, [&](vx_value_set_t *item) { Osal::issueThreadpool(pool, item, 1); });
+    Osal::destroyThreadpool(&pool);
+    ASSERT_EQ(dag.executed.load(), dag.width * dag.layers);
+
+    std::cout << "[ BENCH    ] " << dag.width * dag.layers << " nodes on " << workers
+              << " workers: round-robin " << roundRobin << " ms, work-stealing " << stealing
+              << " ms" << std::endl;
+}